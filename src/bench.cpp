@@ -0,0 +1,205 @@
+/*******************************************************************************
+ * Scripted benchmark runner (build flag BENCH_MODE)
+ *
+ * After setup the firmware plays touch scenarios through the normal indev
+ * path (bench_touch() in my_touchpad_read) and prints one BENCH_CSV_HEADER
+ * row per scenario:
+ *
+ *   frames      refresh timer runs that flushed something
+ *   flush_us    time in the flush callback per area (SPI transfer)
+ *   render_us   refresh timer run time minus its flush time (LVGL drawing)
+ *   heap_free_min / lv_mem_free_min   lowest free heap / LVGL pool seen at a frame
+ *   event_us    injected press -> LV_EVENT_PRESSED in the button callback
+ *   pixel_us    injected press -> end of the first frame flushed after it
+ *
+ * The refresh timer callback is wrapped to time whole frames.
+ ******************************************************************************/
+#include <Arduino.h>
+#include <string.h>
+#include <lvgl.h>
+#include "esp_heap_caps.h"
+
+#include "bench.h"
+
+#ifdef BENCH_MODE
+
+#define BENCH_SETTLE_MS 1000  // first full draw and boot noise before the first scenario
+
+typedef struct {
+    const char * name;
+    uint16_t steps;
+    uint16_t press_ms;
+    uint16_t release_ms;
+    int8_t   button;          // >= 0: that button; -1: step i taps button i % count; -2: no touch
+} bench_scenario_t;
+
+// Every button is tapped an even number of times, so toggles end as they started
+static const bench_scenario_t scenarios[] = {
+    { "tap_rapid",  36,   60,   60, -1 },
+    { "toggle_all", 36,  100,  100, -1 },
+    { "hold",        1, 3000,  300,  1 },
+    { "idle",        1,    0, 3000, -2 },
+};
+#define BENCH_SCENARIOS (int)(sizeof(scenarios) / sizeof(scenarios[0]))
+
+typedef struct {
+    uint32_t frames;
+    uint32_t flush_areas, flush_us_sum, flush_us_max;
+    uint32_t render_us_sum, render_us_max;
+    uint32_t heap_free_min, lv_mem_free_min;
+    uint32_t events, event_n, event_us_sum, event_us_max;
+    uint32_t pixel_n, pixel_us_sum, pixel_us_max;
+} bench_acc_t;
+
+static lv_obj_t * const * bench_buttons;
+static int bench_count;
+static bool armed = false;
+static int scen = -1;
+static uint16_t step;
+static uint32_t start_ms, scen_t0, step_t0;
+static bool was_pressed = false;
+static bench_acc_t acc;
+
+static lv_timer_cb_t refr_cb_orig;
+static uint32_t frame_flush_us, frame_flushes;
+static uint32_t inject_us;
+static bool await_event = false, await_pixels = false;
+
+static inline void track(uint32_t v, uint32_t * sum, uint32_t * max)
+{
+    *sum += v;
+    if (v > *max) *max = v;
+}
+
+static void scenario_begin(uint32_t now)
+{
+    memset(&acc, 0, sizeof(acc));
+    acc.heap_free_min = acc.lv_mem_free_min = UINT32_MAX;
+    step = 0;
+    scen_t0 = step_t0 = now;
+    await_event = await_pixels = false;
+}
+
+static void scenario_end(uint32_t now)
+{
+    uint32_t ms = now - scen_t0;
+    Serial.printf("%s,%lu,%lu,%.1f,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu\n",
+                  scenarios[scen].name, (unsigned long)ms, (unsigned long)acc.frames,
+                  ms ? acc.frames * 1000.0f / ms : 0.0f,
+                  (unsigned long)acc.flush_areas,
+                  (unsigned long)(acc.flush_areas ? acc.flush_us_sum / acc.flush_areas : 0),
+                  (unsigned long)acc.flush_us_max,
+                  (unsigned long)(acc.frames ? acc.render_us_sum / acc.frames : 0),
+                  (unsigned long)acc.render_us_max,
+                  (unsigned long)(acc.frames ? acc.heap_free_min : 0),
+                  (unsigned long)(acc.frames ? acc.lv_mem_free_min : 0),
+                  (unsigned long)acc.events,
+                  (unsigned long)(acc.event_n ? acc.event_us_sum / acc.event_n : 0),
+                  (unsigned long)acc.event_us_max,
+                  (unsigned long)(acc.pixel_n ? acc.pixel_us_sum / acc.pixel_n : 0),
+                  (unsigned long)acc.pixel_us_max);
+}
+
+static void bench_refr_cb(lv_timer_t * t)
+{
+    frame_flush_us = frame_flushes = 0;
+    uint32_t t0 = micros();
+    refr_cb_orig(t);
+    uint32_t now = micros();
+    if (scen < 0 || frame_flushes == 0) return;
+
+    acc.frames++;
+    track(now - t0 - frame_flush_us, &acc.render_us_sum, &acc.render_us_max);
+    if (await_pixels) {
+        acc.pixel_n++;
+        track(now - inject_us, &acc.pixel_us_sum, &acc.pixel_us_max);
+        await_pixels = false;
+    }
+
+    uint32_t heap = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    if (heap < acc.heap_free_min) acc.heap_free_min = heap;
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    if (mon.free_size < acc.lv_mem_free_min) acc.lv_mem_free_min = mon.free_size;
+}
+
+void bench_start(lv_obj_t * const * buttons, int count)
+{
+    bench_buttons = buttons;
+    bench_count = count;
+
+    lv_timer_t * refr = _lv_disp_get_refr_timer(lv_disp_get_default());
+    refr_cb_orig = refr->timer_cb;
+    refr->timer_cb = bench_refr_cb;
+
+    start_ms = millis();
+    armed = true;
+    Serial.println("BENCH start");
+    Serial.println(BENCH_CSV_HEADER);
+}
+
+bool bench_touch(lv_indev_data_t * data)
+{
+    uint32_t now = millis();
+    if (armed && now - start_ms >= BENCH_SETTLE_MS) {
+        armed = false;
+        scen = 0;
+        scenario_begin(now);
+    }
+    if (scen < 0) return false;
+
+    const bench_scenario_t * s = &scenarios[scen];
+    while (now - step_t0 >= (uint32_t)s->press_ms + s->release_ms) {
+        step_t0 += s->press_ms + s->release_ms;
+        if (++step < s->steps) continue;
+        scenario_end(now);
+        if (++scen >= BENCH_SCENARIOS) {
+            scen = -1;
+            Serial.println("BENCH done");
+            return false;
+        }
+        scenario_begin(now);
+        s = &scenarios[scen];
+    }
+
+    bool pressed = s->button != -2 && now - step_t0 < s->press_ms;
+    if (pressed) {
+        int idx = s->button >= 0 ? s->button : step % bench_count;
+        lv_area_t a;
+        lv_obj_get_coords(bench_buttons[idx], &a);
+        data->point.x = (a.x1 + a.x2) / 2;
+        data->point.y = (a.y1 + a.y2) / 2;
+        if (!was_pressed) {
+            inject_us = micros();
+            await_event = true;
+            await_pixels = false;
+        }
+    }
+    data->state = pressed ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+    was_pressed = pressed;
+    return true;
+}
+
+void bench_flush(uint32_t px, uint32_t us)
+{
+    (void)px;
+    frame_flush_us += us;
+    frame_flushes++;
+    if (scen < 0) return;
+    acc.flush_areas++;
+    track(us, &acc.flush_us_sum, &acc.flush_us_max);
+}
+
+void bench_event(lv_event_code_t code)
+{
+    if (scen < 0 || code != LV_EVENT_PRESSED) return;
+    acc.events++;
+    if (await_event) {
+        acc.event_n++;
+        track(micros() - inject_us, &acc.event_us_sum, &acc.event_us_max);
+        await_event = false;
+        await_pixels = true;
+    }
+}
+
+#endif /* BENCH_MODE */
@@ -0,0 +1,23 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <lvgl.h>
+
+// CSV schema of the scenario rows, one per scenario (see bench.cpp).
+// Any other runner of the scenarios must print exactly these columns.
+#define BENCH_CSV_HEADER "scenario,duration_ms,frames,fps,flush_areas,flush_us_avg,flush_us_max," \
+                         "render_us_avg,render_us_max,heap_free_min,lv_mem_free_min," \
+                         "events,event_us_avg,event_us_max,pixel_us_avg,pixel_us_max"
+
+#ifdef BENCH_MODE
+// Start the scripted scenarios on the given buttons; call at the end of setup()
+void bench_start(lv_obj_t * const * buttons, int count);
+
+// Hooks: touch read_cb (returns true while a scenario drives the input),
+// flush_cb (pixels and microseconds of one area) and button event_cb
+bool bench_touch(lv_indev_data_t * data);
+void bench_flush(uint32_t px, uint32_t us);
+void bench_event(lv_event_code_t code);
+#endif
+
+#endif
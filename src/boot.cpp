@@ -0,0 +1,80 @@
+/*******************************************************************************
+ * Boot pipeline timing and splash
+ *
+ * setup() marks each phase as it ends; boot_ready() prints them once the UI
+ * takes input. Times are micros() since the app started, so the ROM and
+ * second stage bootloader before it (a few hundred ms) are not included.
+ *
+ * The splash is boot_cell.c, one pre-rendered inactive cell (tools/assets.py
+ * bootcell), blitted 18 times from flash, with the labels printed in the
+ * Arduino_GFX 6x8 font. Toggles restored checked from NVS use boot_cell_on.c
+ * instead, so the splash already shows the saved state. It needs no LVGL and no RAM buffer, and it stays up
+ * until LVGL's first frame replaces it.
+ ******************************************************************************/
+#include <Arduino.h>
+#include <Arduino_GFX_Library.h>
+
+#include "boot.h"
+#include "boot_cell.h"
+#include "fp_proto.h"
+
+typedef struct {
+    const char * name;
+    uint32_t us;
+} boot_phase_t;
+
+static boot_phase_t phases[BOOT_MAX_PHASES];
+static int phase_count = 0;
+static bool ready = false;
+static bool first_event = false;
+
+void boot_mark(const char * phase)
+{
+    if (phase_count < BOOT_MAX_PHASES)
+        phases[phase_count++] = { phase, (uint32_t)micros() };
+}
+
+void boot_splash(Arduino_GFX * gfx, const char * const * labels, int cols, int rows,
+                 uint32_t checked)
+{
+    int w = boot_cell.header.w, h = boot_cell.header.h;
+    gfx->setTextColor(RGB565_BLACK);
+    for (int i = 0; i < cols * rows; i++) {
+        int x = (i % cols) * w, y = (i / cols) * h;
+        const lv_img_dsc_t * cell = (checked >> i) & 1 ? &boot_cell_on : &boot_cell;
+        gfx->draw16bitRGBBitmap(x, y, (uint16_t *)cell->data, w, h);
+        int len = strlen(labels[i]);
+        gfx->setCursor(x + (w - len * 6) / 2, y + (h - 8) / 2);
+        gfx->print(labels[i]);
+    }
+}
+
+void boot_ready()
+{
+    if (ready) return;
+    ready = true;
+    boot_mark("ready");
+    uint32_t total_us = phases[phase_count - 1].us;
+    fp_stat_set(FP_STAT_BOOT_MS, total_us / 1000 ? total_us / 1000 : 1);
+    fp_set_ready();
+
+    Serial.println("Boot phase        end ms  phase ms");
+    uint32_t prev = 0;
+    for (int i = 0; i < phase_count; i++) {
+        Serial.printf("  %-14s %7.1f  %7.1f\n", phases[i].name,
+                      phases[i].us / 1000.0f, (phases[i].us - prev) / 1000.0f);
+        prev = phases[i].us;
+    }
+}
+
+bool boot_is_ready()
+{
+    return ready;
+}
+
+void boot_event()
+{
+    if (first_event) return;
+    first_event = true;
+    Serial.printf("Boot: first button event queued at %.1f ms\n", micros() / 1000.0f);
+}
@@ -0,0 +1,30 @@
+#ifndef BOOT_H
+#define BOOT_H
+
+#include <Arduino_GFX_Library.h>
+
+// Boot pipeline: the I2C slave answers "not ready" first, a pre-rendered grid
+// goes straight from flash to the panel, the LVGL objects are built after
+// setup() returns, and INT_READY is raised once LVGL's first frame is out.
+
+#ifndef BOOT_MAX_PHASES
+#define BOOT_MAX_PHASES 12
+#endif
+
+// End of a boot phase: records micros() since app start under `phase`
+void boot_mark(const char * phase);
+
+// Blit the pre-rendered cells (boot_cell.c, boot_cell_on.c where bit i of
+// `checked` is set) into a cols x rows grid and print the labels with the
+// Arduino_GFX built-in font
+void boot_splash(Arduino_GFX * gfx, const char * const * labels, int cols, int rows,
+                 uint32_t checked);
+
+// The UI takes input: raise INT_READY, publish FP_STAT_BOOT_MS, print phases
+void boot_ready();
+bool boot_is_ready();
+
+// A button event was queued for the master; the first one is timed
+void boot_event();
+
+#endif
@@ -0,0 +1,548 @@
+#include <lvgl.h>
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN uint8_t boot_cell_map[] = {
+  0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b,
+  0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b,
+  0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b,
+  0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b,
+  0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b,
+  0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b,
+  0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b,
+  0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b,
+  0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b,
+  0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b,
+  0x8d, 0x7b, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x8d, 0x7b,
+  0x8d, 0x7b, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x8d, 0x7b,
+  0x8d, 0x7b, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x8d, 0x7b,
+  0x8d, 0x7b, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x8d, 0x7b,
+  0x8d, 0x7b, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x8d, 0x7b,
+  0x20, 0x08, 0x61, 0x10, 0x61, 0x10, 0x81, 0x10, 0x82, 0x10, 0xa2, 0x10, 0x82, 0x10, 0xa2, 0x18,
+  0xc2, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc3, 0x18, 0x03, 0x21, 0x03, 0x21,
+  0x03, 0x21, 0x03, 0x21, 0x03, 0x21, 0x03, 0x21, 0x03, 0x21, 0x03, 0x21, 0x03, 0x21, 0x24, 0x29,
+  0x03, 0x21, 0x03, 0x21, 0x23, 0x21, 0x03, 0x21, 0x03, 0x21, 0x03, 0x21, 0xe3, 0x20, 0xc3, 0x18,
+  0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0x03, 0x21, 0x03, 0x21,
+  0x43, 0x21, 0x43, 0x21, 0x44, 0x29, 0x44, 0x29, 0x44, 0x29, 0x44, 0x29, 0x44, 0x29, 0x65, 0x31,
+  0x65, 0x31, 0x65, 0x31, 0x65, 0x31, 0x65, 0x31, 0x65, 0x31, 0x44, 0x29, 0x44, 0x29, 0x43, 0x21,
+  0x03, 0x21, 0x03, 0x21, 0x03, 0x21, 0x03, 0x21, 0x03, 0x21, 0x03, 0x21, 0x03, 0x21, 0x03, 0x21,
+  0x03, 0x21, 0x03, 0x21, 0x03, 0x21, 0x23, 0x21, 0x23, 0x21, 0x23, 0x21, 0x23, 0x21, 0x43, 0x21,
+  0x44, 0x29, 0x44, 0x29, 0x44, 0x29, 0x23, 0x21, 0x24, 0x29, 0x03, 0x21, 0x03, 0x21, 0x81, 0x08,
+  0xe3, 0x18, 0xc6, 0x41, 0xc6, 0x41, 0x07, 0x42, 0x47, 0x4a, 0x47, 0x4a, 0x88, 0x52, 0x89, 0x52,
+  0xca, 0x62, 0x0a, 0x63, 0x2b, 0x6b, 0x4b, 0x73, 0x6c, 0x73, 0x8d, 0x7b, 0xcd, 0x83, 0xce, 0x83,
+  0x0f, 0x8c, 0x0e, 0x8c, 0x0e, 0x8c, 0x2f, 0x8c, 0x2f, 0x94, 0x4f, 0x94, 0x4f, 0x94, 0x50, 0x94,
+  0x50, 0x94, 0x70, 0x9c, 0x90, 0x9c, 0x90, 0x9c, 0x70, 0x9c, 0x70, 0x9c, 0x70, 0x9c, 0x70, 0x9c,
+  0x50, 0x94, 0x4f, 0x94, 0x4f, 0x94, 0x4f, 0x94, 0x2f, 0x94, 0x2f, 0x94, 0x2f, 0x94, 0x4f, 0x94,
+  0x90, 0x9c, 0x90, 0x9c, 0x90, 0x9c, 0x70, 0x9c, 0x91, 0x9c, 0x90, 0x9c, 0x91, 0x9c, 0x90, 0x9c,
+  0x91, 0x9c, 0xb1, 0x9c, 0xb1, 0x9c, 0xb1, 0x9c, 0xb0, 0x9c, 0x91, 0x9c, 0x90, 0x9c, 0x90, 0x9c,
+  0x70, 0x9c, 0x70, 0x9c, 0x70, 0x9c, 0x70, 0x9c, 0x70, 0x9c, 0x70, 0x9c, 0x50, 0x94, 0x4f, 0x94,
+  0x4f, 0x94, 0x2f, 0x94, 0x2f, 0x8c, 0x0f, 0x8c, 0x0f, 0x8c, 0x0f, 0x8c, 0xee, 0x83, 0x0f, 0x8c,
+  0xee, 0x83, 0xad, 0x83, 0x8c, 0x7b, 0x6c, 0x73, 0x4b, 0x73, 0x2b, 0x6b, 0xca, 0x62, 0x85, 0x29,
+  0xc3, 0x18, 0xc6, 0x41, 0x48, 0x4a, 0x68, 0x52, 0x68, 0x52, 0xc9, 0x5a, 0x0a, 0x6b, 0x2b, 0x6b,
+  0x6c, 0x73, 0xad, 0x7b, 0xcd, 0x7b, 0xcd, 0x83, 0xce, 0x83, 0xee, 0x8b, 0x2e, 0x8c, 0x2f, 0x94,
+  0x2f, 0x94, 0x2f, 0x94, 0x4f, 0x94, 0x4f, 0x94, 0x70, 0x9c, 0x90, 0x9c, 0x90, 0x9c, 0x90, 0x9c,
+  0xb1, 0x9c, 0xb1, 0x9c, 0xb1, 0x9c, 0xd1, 0xa4, 0xd1, 0xa4, 0xd1, 0xa4, 0xf1, 0xa4, 0xf2, 0xac,
+  0xf2, 0xac, 0xf2, 0xac, 0xd2, 0xac, 0xf2, 0xac, 0xf1, 0xac, 0xf1, 0xac, 0xf1, 0xac, 0xf2, 0xac,
+  0xf2, 0xac, 0x12, 0xad, 0xf2, 0xac, 0x12, 0xad, 0xf2, 0xac, 0xf2, 0xac, 0xf1, 0xac, 0xf1, 0xac,
+  0xf1, 0xa4, 0xf1, 0xa4, 0xf1, 0xac, 0xf1, 0xac, 0xd1, 0xa4, 0xf1, 0xa4, 0xf1, 0xa4, 0xd1, 0xa4,
+  0xd1, 0xa4, 0xd1, 0xa4, 0xd1, 0xa4, 0xd1, 0xa4, 0xb1, 0xa4, 0xb1, 0xa4, 0xb1, 0xa4, 0xb1, 0x9c,
+  0x90, 0x9c, 0x90, 0x94, 0x6f, 0x94, 0x4f, 0x94, 0x4f, 0x94, 0x2f, 0x94, 0x0e, 0x8c, 0x2e, 0x8c,
+  0xcd, 0x83, 0x8c, 0x73, 0x6c, 0x73, 0x2b, 0x6b, 0xea, 0x62, 0xc9, 0x5a, 0x68, 0x52, 0x03, 0x21,
+  0xc6, 0x39, 0xce, 0x83, 0x90, 0x9c, 0xd1, 0xa4, 0xf2, 0xac, 0x12, 0xad, 0x12, 0xb5, 0x33, 0xb5,
+  0x53, 0xbd, 0x73, 0xbd, 0x74, 0xbd, 0x74, 0xbd, 0x74, 0xbd, 0x94, 0xc5, 0xb4, 0xc5, 0xb5, 0xc5,
+  0xd5, 0xc5, 0xd5, 0xc5, 0xd5, 0xc5, 0xb5, 0xc5, 0xb5, 0xc5, 0xd5, 0xc5, 0xd5, 0xc5, 0xd5, 0xcd,
+  0xd5, 0xcd, 0xd5, 0xcd, 0xd5, 0xcd, 0xd5, 0xcd, 0xd5, 0xcd, 0xd5, 0xcd, 0xd5, 0xcd, 0xd5, 0xcd,
+  0xd5, 0xcd, 0xd5, 0xcd, 0xd5, 0xcd, 0xd5, 0xcd, 0xf5, 0xcd, 0xf5, 0xcd, 0xf5, 0xcd, 0xf5, 0xcd,
+  0xf6, 0xd5, 0x16, 0xd6, 0x16, 0xd6, 0x16, 0xd6, 0x16, 0xd6, 0x16, 0xce, 0x16, 0xce, 0x16, 0xce,
+  0xf5, 0xcd, 0x16, 0xce, 0xf6, 0xcd, 0xf6, 0xcd, 0xf5, 0xcd, 0xf5, 0xcd, 0xf5, 0xcd, 0xd5, 0xcd,
+  0xd5, 0xcd, 0xd5, 0xc5, 0xb5, 0xc5, 0xb5, 0xc5, 0xb4, 0xc5, 0x94, 0xc5, 0xb4, 0xc5, 0x94, 0xbd,
+  0x73, 0xbd, 0x73, 0xbd, 0x73, 0xbd, 0x53, 0xbd, 0x53, 0xb5, 0x53, 0xb5, 0x33, 0xb5, 0x32, 0xb5,
+  0x12, 0xad, 0xf2, 0xac, 0xb1, 0xa4, 0x90, 0x9c, 0x70, 0x94, 0x2f, 0x94, 0xee, 0x83, 0x27, 0x42,
+  0x8d, 0x73, 0x36, 0xd6, 0x36, 0xd6, 0x57, 0xde, 0x77, 0xde, 0x97, 0xe6, 0x98, 0xe6, 0x98, 0xe6,
+  0xb8, 0xe6, 0xd8, 0xee, 0xd8, 0xee, 0xd8, 0xee, 0xd8, 0xee, 0xd9, 0xee, 0xf9, 0xee, 0xf9, 0xee,
+  0xf9, 0xee, 0xf9, 0xee, 0xf9, 0xee, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6,
+  0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6,
+  0xf9, 0xee, 0xf9, 0xee, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6,
+  0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6,
+  0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6,
+  0xf9, 0xee, 0xf9, 0xee, 0xf9, 0xee, 0xf9, 0xee, 0xf9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee,
+  0xd9, 0xee, 0xd9, 0xee, 0xd8, 0xee, 0xb8, 0xee, 0xd8, 0xee, 0xb8, 0xe6, 0xb8, 0xe6, 0xb8, 0xe6,
+  0x98, 0xe6, 0x97, 0xe6, 0x77, 0xe6, 0x77, 0xde, 0x57, 0xde, 0x36, 0xd6, 0x16, 0xd6, 0xae, 0x7b,
+  0xce, 0x83, 0x77, 0xe6, 0x78, 0xe6, 0x98, 0xe6, 0xb8, 0xe6, 0xb8, 0xee, 0xd8, 0xee, 0xd9, 0xee,
+  0xd9, 0xee, 0xf9, 0xee, 0xf9, 0xee, 0xf9, 0xee, 0xf9, 0xf6, 0xf9, 0xf6, 0x19, 0xf7, 0x19, 0xf7,
+  0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7,
+  0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7,
+  0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x1a, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x1a, 0xf7, 0x19, 0xf7,
+  0x1a, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x1a, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7,
+  0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7,
+  0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7,
+  0x19, 0xf7, 0x19, 0xf7, 0xf9, 0xf6, 0x19, 0xf7, 0xf9, 0xf6, 0xf9, 0xee, 0xf9, 0xf6, 0xf9, 0xf6,
+  0xf9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xb8, 0xee, 0xb8, 0xe6, 0x98, 0xe6, 0x77, 0xe6, 0xce, 0x83,
+  0xef, 0x83, 0xb8, 0xee, 0xd8, 0xee, 0xf9, 0xee, 0xf9, 0xee, 0xf9, 0xee, 0xf9, 0xf6, 0xf9, 0xf6,
+  0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x1a, 0xf7, 0x1a, 0xf7, 0x3a, 0xff, 0x3a, 0xf7,
+  0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xff, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xff, 0x3a, 0xf7,
+  0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xff, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xff,
+  0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7,
+  0x3a, 0xf7, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7,
+  0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x1a, 0xf7, 0x19, 0xf7, 0x19, 0xf7,
+  0x19, 0xf7, 0x19, 0xf7, 0xf9, 0xf6, 0xf9, 0xf6, 0xd9, 0xee, 0xf9, 0xee, 0xd9, 0xee, 0xef, 0x83,
+  0x0f, 0x84, 0xd9, 0xee, 0xf9, 0xf6, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7,
+  0x1a, 0xf7, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xf7,
+  0x3a, 0xff, 0x3a, 0xff, 0x1a, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0xf9, 0xf6, 0xf9, 0xee, 0x0f, 0x84,
+  0x0f, 0x8c, 0xf9, 0xf6, 0x19, 0xf7, 0x19, 0xf7, 0x1a, 0xf7, 0x1a, 0xf7, 0x3a, 0xf7, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x5a, 0xff, 0x3a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x3a, 0xff, 0x5a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x5a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x5a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x5a, 0xff, 0x3a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x3a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x3a, 0xff, 0x5a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xf7, 0x1a, 0xf7, 0x39, 0xf7, 0x19, 0xf7, 0x0f, 0x8c,
+  0x0f, 0x84, 0x1a, 0xf7, 0x1a, 0xf7, 0x3a, 0xf7, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xf7, 0x1a, 0xf7, 0x0f, 0x8c,
+  0x0f, 0x8c, 0x1a, 0xf7, 0x1a, 0xf7, 0x3a, 0xf7, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x1a, 0xf7, 0x0f, 0x8c,
+  0x0f, 0x8c, 0x1a, 0xf7, 0x3a, 0xf7, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xf7, 0x0f, 0x8c,
+  0x0f, 0x8c, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x0f, 0x8c,
+  0x0f, 0x8c, 0x3a, 0xf7, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x2f, 0x8c,
+  0x0f, 0x8c, 0x3a, 0xf7, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x2f, 0x8c,
+  0x0f, 0x8c, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x0f, 0x8c,
+  0x0f, 0x8c, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x2f, 0x8c,
+  0x0f, 0x8c, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x2f, 0x8c,
+  0x0f, 0x8c, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x2f, 0x8c,
+  0x0f, 0x8c, 0x3a, 0xf7, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x2f, 0x8c,
+  0x0f, 0x8c, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x2f, 0x8c,
+  0x0f, 0x8c, 0x3a, 0xf7, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x0f, 0x8c,
+  0x0f, 0x8c, 0x19, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xf7, 0x0f, 0x8c,
+  0x0f, 0x84, 0x19, 0xf7, 0x1a, 0xf7, 0x3a, 0xf7, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xf7, 0x0f, 0x8c,
+  0x0f, 0x8c, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x1a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xf7, 0x3a, 0xf7, 0x1a, 0xf7, 0x0f, 0x84,
+  0x0f, 0x84, 0xf9, 0xee, 0xf9, 0xf6, 0xf9, 0xf6, 0x19, 0xf7, 0x19, 0xf7, 0x1a, 0xf7, 0x1a, 0xf7,
+  0x1a, 0xf7, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x5a, 0xff, 0x3a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x5a, 0xff, 0x3a, 0xff, 0x5a, 0xff, 0x3a, 0xff, 0x5a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xf7, 0x3a, 0xf7, 0x1a, 0xf7, 0x3a, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x0f, 0x8c,
+  0xef, 0x83, 0xd8, 0xee, 0xd9, 0xee, 0xf9, 0xee, 0xf9, 0xee, 0xf9, 0xf6, 0xf9, 0xf6, 0x19, 0xf7,
+  0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xff, 0x3a, 0xf7, 0x3a, 0xff, 0x3a, 0xf7, 0x3a, 0xff, 0x1a, 0xf7,
+  0x1a, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6, 0x0f, 0x84,
+  0xef, 0x83, 0x98, 0xe6, 0xb8, 0xe6, 0xb8, 0xee, 0xd8, 0xee, 0xd8, 0xee, 0xd9, 0xee, 0xd9, 0xee,
+  0xf9, 0xee, 0xf9, 0xee, 0xf9, 0xf6, 0xf9, 0xf6, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7,
+  0x39, 0xf7, 0x39, 0xf7, 0x1a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7,
+  0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7,
+  0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7,
+  0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xff, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xff, 0x3a, 0xff,
+  0x3a, 0xf7, 0x3a, 0xff, 0x3a, 0xf7, 0x3a, 0xff, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7,
+  0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7, 0x3a, 0xf7,
+  0x3a, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x1a, 0xf7, 0x19, 0xf7, 0x19, 0xf7,
+  0x19, 0xf7, 0x19, 0xf7, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xee, 0x83,
+  0x8d, 0x73, 0x56, 0xd6, 0x77, 0xde, 0x98, 0xe6, 0xb8, 0xe6, 0xb8, 0xee, 0xd8, 0xee, 0xd8, 0xee,
+  0xf9, 0xee, 0xf9, 0xee, 0xf9, 0xf6, 0xf9, 0xee, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6,
+  0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6,
+  0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7,
+  0x19, 0xf7, 0x1a, 0xf7, 0x1a, 0xf7, 0x1a, 0xf7, 0x1a, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7,
+  0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7,
+  0x19, 0xf7, 0xf9, 0xf6, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0xf9, 0xf6, 0x19, 0xf7, 0x19, 0xf7,
+  0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0x19, 0xf7, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6,
+  0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xf6, 0xf9, 0xee, 0xf9, 0xee, 0xf9, 0xee, 0xd9, 0xee, 0xd9, 0xee,
+  0xd9, 0xee, 0xb8, 0xee, 0xb8, 0xee, 0xb8, 0xe6, 0xb8, 0xe6, 0x98, 0xe6, 0x97, 0xe6, 0xcf, 0x83,
+  0x44, 0x29, 0x0a, 0x63, 0x8c, 0x73, 0x8d, 0x7b, 0xee, 0x83, 0x2f, 0x8c, 0x6f, 0x94, 0x90, 0x9c,
+  0xd1, 0xa4, 0x12, 0xad, 0x32, 0xb5, 0x53, 0xbd, 0x53, 0xbd, 0x94, 0xbd, 0x94, 0xbd, 0x94, 0xbd,
+  0xb4, 0xc5, 0xb4, 0xc5, 0xb5, 0xc5, 0xd5, 0xc5, 0xd5, 0xc5, 0xb5, 0xc5, 0xb5, 0xc5, 0xd5, 0xc5,
+  0xd5, 0xc5, 0xd5, 0xc5, 0xd5, 0xc5, 0xb5, 0xc5, 0xb5, 0xc5, 0xb5, 0xc5, 0xb5, 0xc5, 0xd5, 0xc5,
+  0xd5, 0xc5, 0xb4, 0xc5, 0xb4, 0xc5, 0xb4, 0xc5, 0xb5, 0xc5, 0xb4, 0xc5, 0xb4, 0xc5, 0xb4, 0xc5,
+  0xb5, 0xc5, 0xd5, 0xc5, 0xd5, 0xc5, 0xd5, 0xc5, 0xd5, 0xc5, 0xd5, 0xc5, 0xd5, 0xc5, 0xd5, 0xcd,
+  0xd5, 0xcd, 0xd5, 0xcd, 0xd5, 0xcd, 0xd5, 0xcd, 0xd5, 0xcd, 0xd4, 0xc5, 0xd5, 0xc5, 0xd5, 0xcd,
+  0xb5, 0xc5, 0xb5, 0xc5, 0xb5, 0xc5, 0xb5, 0xc5, 0xb4, 0xc5, 0xb4, 0xc5, 0x94, 0xbd, 0x74, 0xbd,
+  0x74, 0xbd, 0x53, 0xbd, 0x33, 0xb5, 0x33, 0xb5, 0x32, 0xb5, 0x12, 0xb5, 0x12, 0xb5, 0x12, 0xad,
+  0xf2, 0xac, 0xf1, 0xa4, 0xb1, 0xa4, 0xb1, 0x9c, 0x70, 0x9c, 0x70, 0x94, 0x2f, 0x94, 0x48, 0x4a,
+  0x41, 0x08, 0xc3, 0x18, 0x04, 0x21, 0x44, 0x29, 0x65, 0x31, 0x85, 0x39, 0xc6, 0x39, 0x06, 0x42,
+  0x68, 0x52, 0x88, 0x52, 0xa9, 0x5a, 0x0a, 0x63, 0x2b, 0x6b, 0x6b, 0x73, 0x6c, 0x73, 0x6c, 0x7b,
+  0xad, 0x7b, 0xad, 0x83, 0xad, 0x7b, 0xee, 0x83, 0xee, 0x8b, 0xee, 0x83, 0x0e, 0x8c, 0x0e, 0x8c,
+  0x0e, 0x8c, 0x2f, 0x8c, 0x2f, 0x8c, 0x2f, 0x94, 0x4f, 0x94, 0x4f, 0x94, 0x4f, 0x94, 0x4f, 0x94,
+  0x2f, 0x94, 0x2e, 0x8c, 0x0e, 0x8c, 0x2e, 0x8c, 0x2e, 0x8c, 0x2e, 0x8c, 0x2e, 0x8c, 0x2e, 0x8c,
+  0x0f, 0x8c, 0x0e, 0x8c, 0x2f, 0x94, 0x4f, 0x94, 0x4f, 0x94, 0x4f, 0x94, 0x4f, 0x94, 0x4f, 0x94,
+  0x2f, 0x94, 0x2f, 0x8c, 0x2f, 0x8c, 0x2f, 0x8c, 0x2f, 0x8c, 0x2f, 0x8c, 0x2f, 0x8c, 0x2e, 0x8c,
+  0xee, 0x8b, 0xee, 0x8b, 0xee, 0x8b, 0xee, 0x8b, 0xee, 0x83, 0xcd, 0x83, 0xcd, 0x83, 0xcd, 0x83,
+  0x8c, 0x7b, 0x6c, 0x73, 0x2b, 0x6b, 0x2b, 0x6b, 0x2b, 0x6b, 0x0b, 0x6b, 0x0a, 0x63, 0xca, 0x62,
+  0xc9, 0x5a, 0xa9, 0x52, 0x68, 0x52, 0x68, 0x52, 0x07, 0x42, 0xe6, 0x41, 0xa6, 0x39, 0xc2, 0x18,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x08, 0x41, 0x08, 0x81, 0x10,
+  0xc2, 0x18, 0xc3, 0x18, 0x03, 0x21, 0x03, 0x21, 0x04, 0x21, 0x24, 0x29, 0x44, 0x29, 0x44, 0x29,
+  0x64, 0x31, 0x65, 0x31, 0x65, 0x31, 0x65, 0x31, 0x64, 0x31, 0x65, 0x31, 0x85, 0x31, 0x85, 0x31,
+  0x85, 0x31, 0xa6, 0x39, 0xc6, 0x39, 0xc6, 0x41, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x27, 0x4a,
+  0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x06, 0x42, 0x06, 0x42,
+  0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x07, 0x42, 0x07, 0x42, 0x06, 0x42, 0xe6, 0x41,
+  0xc6, 0x41, 0xc6, 0x41, 0xc6, 0x41, 0xc6, 0x41, 0xc6, 0x41, 0xe6, 0x41, 0xc6, 0x41, 0xc6, 0x39,
+  0xc6, 0x41, 0xc6, 0x41, 0xc6, 0x41, 0xc6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa5, 0x39,
+  0x85, 0x39, 0x85, 0x31, 0x65, 0x31, 0x65, 0x31, 0x65, 0x31, 0x44, 0x29, 0x44, 0x29, 0x24, 0x29,
+  0x04, 0x21, 0x03, 0x21, 0xe3, 0x20, 0xc3, 0x18, 0xa2, 0x10, 0x61, 0x08, 0x41, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x41, 0x08, 0x61, 0x10, 0xa2, 0x10, 0xc2, 0x18, 0xe3, 0x20, 0x24, 0x29,
+  0x44, 0x29, 0x65, 0x31, 0x65, 0x31, 0x65, 0x31, 0xa5, 0x39, 0xa5, 0x39, 0xc5, 0x39, 0xc5, 0x39,
+  0xe6, 0x39, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x27, 0x42, 0x47, 0x4a, 0x47, 0x4a,
+  0x48, 0x4a, 0x89, 0x52, 0x89, 0x5a, 0xc9, 0x5a, 0xca, 0x62, 0x0b, 0x6b, 0x0b, 0x6b, 0x0a, 0x63,
+  0xea, 0x62, 0xca, 0x62, 0xca, 0x62, 0xca, 0x62, 0xca, 0x62, 0xea, 0x62, 0x0a, 0x6b, 0x0a, 0x6b,
+  0x0b, 0x6b, 0x0a, 0x63, 0x0a, 0x6b, 0x0a, 0x6b, 0x0a, 0x6b, 0x0b, 0x6b, 0xea, 0x62, 0xea, 0x62,
+  0x0a, 0x6b, 0x0a, 0x6b, 0x0a, 0x6b, 0x0a, 0x6b, 0x0a, 0x6b, 0x0b, 0x6b, 0x0b, 0x6b, 0x0b, 0x6b,
+  0x0b, 0x6b, 0x0b, 0x6b, 0x0b, 0x6b, 0x0b, 0x6b, 0x0b, 0x6b, 0xca, 0x62, 0xca, 0x62, 0xca, 0x62,
+  0xca, 0x62, 0xca, 0x62, 0xca, 0x62, 0xc9, 0x5a, 0xa9, 0x5a, 0xa9, 0x5a, 0x89, 0x52, 0x48, 0x52,
+  0x48, 0x52, 0x28, 0x52, 0xe7, 0x41, 0xc5, 0x39, 0x85, 0x31, 0x64, 0x31, 0x24, 0x29, 0x61, 0x10,
+  0xe3, 0x18, 0x28, 0x4a, 0x88, 0x52, 0xea, 0x6a, 0x4c, 0x73, 0x8d, 0x7b, 0xee, 0x83, 0x0f, 0x8c,
+  0x70, 0x9c, 0x90, 0x9c, 0x90, 0x9c, 0xb0, 0x9c, 0xd1, 0xa4, 0xd1, 0xac, 0xf2, 0xac, 0x12, 0xad,
+  0x12, 0xad, 0x12, 0xb5, 0x33, 0xb5, 0x53, 0xb5, 0x53, 0xbd, 0x73, 0xbd, 0x74, 0xbd, 0x74, 0xbd,
+  0x94, 0xbd, 0x94, 0xbd, 0x94, 0xbd, 0xb4, 0xc5, 0xb5, 0xc5, 0xd5, 0xc5, 0xd5, 0xc5, 0xb5, 0xc5,
+  0xb5, 0xc5, 0xb5, 0xc5, 0xb5, 0xc5, 0xb5, 0xc5, 0x94, 0xc5, 0xb5, 0xc5, 0xd5, 0xc5, 0xd5, 0xc5,
+  0xd5, 0xc5, 0xb5, 0xc5, 0xb5, 0xc5, 0x94, 0xc5, 0xb5, 0xc5, 0xb5, 0xc5, 0xb5, 0xc5, 0xb5, 0xc5,
+  0x94, 0xc5, 0x94, 0xc5, 0x94, 0xc5, 0x94, 0xc5, 0xb5, 0xc5, 0xb5, 0xc5, 0xb5, 0xc5, 0x94, 0xc5,
+  0x94, 0xc5, 0x94, 0xc5, 0x94, 0xc5, 0x94, 0xc5, 0xb4, 0xc5, 0x94, 0xc5, 0x94, 0xc5, 0x94, 0xc5,
+  0x94, 0xc5, 0x94, 0xc5, 0x94, 0xbd, 0x74, 0xbd, 0x74, 0xbd, 0x53, 0xb5, 0x33, 0xb5, 0x12, 0xb5,
+  0x12, 0xad, 0xf2, 0xac, 0xb1, 0xa4, 0xb1, 0x9c, 0x70, 0x9c, 0x2f, 0x94, 0xce, 0x83, 0x07, 0x42,
+  0x07, 0x42, 0xee, 0x8b, 0x70, 0x94, 0x91, 0x9c, 0xd1, 0xac, 0x12, 0xad, 0x33, 0xb5, 0x73, 0xbd,
+  0x94, 0xc5, 0xb4, 0xc5, 0xb5, 0xc5, 0xd5, 0xc5, 0xd5, 0xcd, 0xf5, 0xcd, 0x16, 0xd6, 0x16, 0xd6,
+  0x16, 0xd6, 0x36, 0xd6, 0x36, 0xd6, 0x36, 0xd6, 0x36, 0xd6, 0x57, 0xd6, 0x57, 0xde, 0x57, 0xde,
+  0x57, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde,
+  0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde,
+  0x77, 0xde, 0x77, 0xe6, 0x77, 0xe6, 0x77, 0xe6, 0x77, 0xe6, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde,
+  0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde,
+  0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde, 0x57, 0xde, 0x57, 0xde,
+  0x57, 0xde, 0x57, 0xde, 0x57, 0xde, 0x36, 0xd6, 0x36, 0xd6, 0x16, 0xd6, 0x16, 0xd6, 0xf5, 0xcd,
+  0xf5, 0xcd, 0xd5, 0xc5, 0xb5, 0xc5, 0x93, 0xbd, 0x53, 0xb5, 0x32, 0xb5, 0xf2, 0xac, 0xca, 0x5a,
+  0x8a, 0x52, 0xb1, 0x9c, 0x12, 0xad, 0x33, 0xb5, 0x73, 0xbd, 0x94, 0xc5, 0xb5, 0xc5, 0xf5, 0xcd,
+  0x16, 0xd6, 0x36, 0xd6, 0x36, 0xd6, 0x56, 0xd6, 0x57, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xe6,
+  0x77, 0xe6, 0x97, 0xe6, 0x97, 0xe6, 0x98, 0xe6, 0x98, 0xe6, 0x98, 0xe6, 0xb8, 0xe6, 0xb8, 0xee,
+  0xb8, 0xe6, 0xb8, 0xee, 0xb8, 0xe6, 0xb8, 0xee, 0xd8, 0xee, 0xb8, 0xee, 0xb8, 0xee, 0xb8, 0xee,
+  0xb8, 0xee, 0xb8, 0xee, 0xd8, 0xee, 0xd8, 0xee, 0xb8, 0xee, 0xd8, 0xee, 0xd8, 0xee, 0xd8, 0xee,
+  0xd8, 0xee, 0xd8, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd8, 0xee, 0xd8, 0xee, 0xd8, 0xee,
+  0xd8, 0xee, 0xd8, 0xee, 0xd8, 0xee, 0xd8, 0xee, 0xd8, 0xee, 0xd8, 0xee, 0xd8, 0xee, 0xd8, 0xee,
+  0xd8, 0xee, 0xb8, 0xee, 0xb8, 0xee, 0xb8, 0xee, 0xb8, 0xee, 0xb8, 0xee, 0xb8, 0xe6, 0xb8, 0xe6,
+  0xb8, 0xe6, 0x98, 0xe6, 0x98, 0xe6, 0x97, 0xe6, 0x97, 0xe6, 0x97, 0xe6, 0x77, 0xe6, 0x57, 0xde,
+  0x57, 0xde, 0x36, 0xd6, 0x16, 0xd6, 0xf5, 0xcd, 0xd5, 0xc5, 0xb4, 0xc5, 0x73, 0xbd, 0x2b, 0x63,
+  0xca, 0x5a, 0xf2, 0xac, 0x53, 0xb5, 0x93, 0xbd, 0xb4, 0xc5, 0xd5, 0xc5, 0xf5, 0xcd, 0x16, 0xd6,
+  0x36, 0xd6, 0x57, 0xde, 0x77, 0xe6, 0x77, 0xe6, 0x97, 0xe6, 0x98, 0xe6, 0xb8, 0xee, 0xb8, 0xe6,
+  0xb8, 0xee, 0xd8, 0xee, 0xd8, 0xee, 0xd8, 0xee, 0xd8, 0xee, 0xd8, 0xee, 0xd9, 0xee, 0xd9, 0xee,
+  0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee,
+  0xd9, 0xee, 0xf9, 0xee, 0xf9, 0xee, 0xf9, 0xee, 0xf9, 0xee, 0xd9, 0xee, 0xf9, 0xee, 0xf9, 0xee,
+  0xd9, 0xee, 0xd9, 0xee, 0xf9, 0xee, 0xf9, 0xee, 0xf9, 0xee, 0xf9, 0xee, 0xf9, 0xee, 0xf9, 0xee,
+  0xf9, 0xee, 0xf9, 0xee, 0xf9, 0xee, 0xf9, 0xee, 0xd9, 0xee, 0xf9, 0xee, 0xf9, 0xee, 0xf9, 0xee,
+  0xf9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee,
+  0xd8, 0xee, 0xb8, 0xee, 0xb8, 0xee, 0xb8, 0xee, 0xb8, 0xee, 0xb8, 0xe6, 0x98, 0xe6, 0x97, 0xe6,
+  0x77, 0xde, 0x57, 0xde, 0x36, 0xd6, 0x16, 0xd6, 0x15, 0xce, 0xf5, 0xcd, 0xb5, 0xc5, 0x4c, 0x6b,
+  0xaa, 0x5a, 0xf2, 0xac, 0x12, 0xb5, 0x53, 0xbd, 0xb4, 0xc5, 0xd5, 0xc5, 0xf5, 0xcd, 0x16, 0xd6,
+  0x36, 0xd6, 0x57, 0xde, 0x77, 0xde, 0x77, 0xe6, 0x98, 0xe6, 0x98, 0xe6, 0xb8, 0xe6, 0xb8, 0xe6,
+  0xb8, 0xe6, 0xb8, 0xee, 0xd8, 0xee, 0xd8, 0xee, 0xd8, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd8, 0xee,
+  0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee,
+  0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xf9, 0xee, 0xf9, 0xee, 0xf9, 0xee, 0xd9, 0xee, 0xd9, 0xee,
+  0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee,
+  0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee,
+  0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd9, 0xee, 0xd8, 0xee, 0xd8, 0xee, 0xd8, 0xee,
+  0xb8, 0xee, 0xb8, 0xe6, 0xb8, 0xe6, 0xb8, 0xe6, 0x98, 0xe6, 0x97, 0xe6, 0x77, 0xe6, 0x77, 0xde,
+  0x57, 0xde, 0x36, 0xd6, 0x16, 0xd6, 0xf5, 0xcd, 0xd5, 0xc5, 0x94, 0xbd, 0x53, 0xbd, 0x2c, 0x6b,
+  0x48, 0x4a, 0x2f, 0x94, 0x70, 0x9c, 0xd1, 0xac, 0x12, 0xb5, 0x33, 0xb5, 0x73, 0xbd, 0xb5, 0xc5,
+  0xd5, 0xc5, 0xf5, 0xcd, 0x16, 0xd6, 0x36, 0xd6, 0x57, 0xde, 0x77, 0xde, 0x77, 0xde, 0x77, 0xde,
+  0x98, 0xe6, 0x98, 0xe6, 0x98, 0xe6, 0x98, 0xe6, 0x98, 0xe6, 0x98, 0xe6, 0x98, 0xe6, 0xb8, 0xe6,
+  0xb8, 0xe6, 0x98, 0xe6, 0x98, 0xe6, 0xb8, 0xe6, 0x98, 0xe6, 0x98, 0xe6, 0x98, 0xe6, 0xb8, 0xe6,
+  0xb8, 0xe6, 0xb8, 0xee, 0xb8, 0xee, 0xb8, 0xee, 0xb8, 0xee, 0xb8, 0xee, 0xb8, 0xee, 0xb8, 0xee,
+  0xb8, 0xee, 0xb8, 0xe6, 0xb8, 0xe6, 0xb8, 0xee, 0xb8, 0xee, 0xb8, 0xee, 0xb8, 0xee, 0xb8, 0xee,
+  0xb8, 0xee, 0xb8, 0xee, 0xd8, 0xee, 0xb8, 0xee, 0xb8, 0xee, 0xb8, 0xee, 0xb8, 0xe6, 0xb8, 0xee,
+  0xb8, 0xe6, 0xb8, 0xe6, 0xb8, 0xe6, 0xb8, 0xe6, 0xb8, 0xe6, 0x98, 0xe6, 0x98, 0xe6, 0x98, 0xe6,
+  0x98, 0xe6, 0x77, 0xde, 0x77, 0xde, 0x57, 0xde, 0x57, 0xde, 0x56, 0xd6, 0x36, 0xd6, 0x16, 0xd6,
+  0xf6, 0xcd, 0xd5, 0xc5, 0xb5, 0xc5, 0x74, 0xbd, 0x32, 0xb5, 0xf2, 0xac, 0xb1, 0x9c, 0x89, 0x52,
+  0xc2, 0x10, 0xa5, 0x31, 0xc6, 0x39, 0x06, 0x42, 0x07, 0x42, 0x28, 0x4a, 0x48, 0x4a, 0x48, 0x52,
+  0x68, 0x52, 0xa9, 0x5a, 0xe9, 0x5a, 0xea, 0x62, 0x0a, 0x6b, 0x0b, 0x6b, 0x2b, 0x6b, 0x6c, 0x73,
+  0x6c, 0x73, 0x8d, 0x7b, 0xad, 0x7b, 0xcd, 0x83, 0x0e, 0x8c, 0x2e, 0x8c, 0x2f, 0x94, 0x2f, 0x94,
+  0x2f, 0x8c, 0x0f, 0x8c, 0x0f, 0x8c, 0xee, 0x83, 0xce, 0x83, 0xad, 0x7b, 0x8d, 0x7b, 0x6c, 0x73,
+  0x6c, 0x73, 0x6c, 0x73, 0x4c, 0x73, 0x4b, 0x73, 0x4b, 0x73, 0x4b, 0x73, 0x4b, 0x73, 0x4b, 0x73,
+  0x4b, 0x73, 0x4b, 0x73, 0x4b, 0x73, 0x4b, 0x73, 0x4b, 0x73, 0x4b, 0x73, 0x4b, 0x73, 0x4b, 0x73,
+  0x4b, 0x73, 0x6c, 0x73, 0x6c, 0x73, 0x8c, 0x73, 0x6d, 0x7b, 0x6c, 0x73, 0x6c, 0x73, 0x8d, 0x7b,
+  0xad, 0x7b, 0x8d, 0x7b, 0x8c, 0x73, 0x6c, 0x73, 0x6c, 0x73, 0x6c, 0x73, 0x4b, 0x73, 0x4b, 0x73,
+  0x2b, 0x73, 0x2b, 0x6b, 0x2b, 0x6b, 0x0b, 0x6b, 0x0b, 0x6b, 0x0b, 0x6b, 0xea, 0x62, 0xa9, 0x5a,
+  0x68, 0x52, 0x48, 0x52, 0x27, 0x4a, 0xe6, 0x39, 0xa5, 0x39, 0x85, 0x31, 0x65, 0x31, 0xa2, 0x10,
+  0x8d, 0x7b, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x8d, 0x7b,
+  0x8d, 0x7b, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x8d, 0x7b,
+  0x8d, 0x7b, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x8d, 0x7b,
+  0x8d, 0x7b, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x8d, 0x7b,
+  0x8d, 0x7b, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x8d, 0x7b,
+  0x8d, 0x7b, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff,
+  0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x5a, 0xff, 0x8d, 0x7b,
+  0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b,
+  0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b,
+  0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b,
+  0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b,
+  0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b,
+  0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b,
+  0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b,
+  0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b,
+  0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b,
+  0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b, 0x8d, 0x7b
+};
+
+const lv_img_dsc_t boot_cell = {
+  .header.cf = LV_IMG_CF_TRUE_COLOR,
+  .header.always_zero = 0,
+  .header.reserved = 0,
+  .header.w = 80,
+  .header.h = 53,
+  .data_size = 8480,
+  .data = boot_cell_map,
+};
@@ -0,0 +1,17 @@
+#ifndef BOOT_CELL_H
+#define BOOT_CELL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <lvgl.h>
+
+extern const lv_img_dsc_t boot_cell;
+extern const lv_img_dsc_t boot_cell_on;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BOOT_CELL_H */
@@ -0,0 +1,548 @@
+#include <lvgl.h>
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN uint8_t boot_cell_on_map[] = {
+  0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a,
+  0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a,
+  0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a,
+  0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a,
+  0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a,
+  0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a,
+  0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a,
+  0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a,
+  0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a,
+  0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a,
+  0x45, 0x7a, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x45, 0x7a,
+  0x45, 0x7a, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x45, 0x7a,
+  0x45, 0x7a, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x45, 0x7a,
+  0x45, 0x7a, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x45, 0x7a,
+  0x45, 0x7a, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x45, 0x7a,
+  0x20, 0x08, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x18,
+  0x40, 0x18, 0x40, 0x18, 0x40, 0x18, 0x40, 0x18, 0x40, 0x18, 0x60, 0x18, 0x80, 0x20, 0x80, 0x20,
+  0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x28,
+  0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x60, 0x20, 0x60, 0x18,
+  0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x80, 0x20, 0x80, 0x20,
+  0xa0, 0x20, 0xa0, 0x20, 0xa0, 0x28, 0xa0, 0x28, 0xa0, 0x28, 0xa0, 0x28, 0xa0, 0x28, 0xa0, 0x30,
+  0xa0, 0x30, 0xa0, 0x30, 0xa0, 0x30, 0xa0, 0x30, 0xa0, 0x30, 0xa0, 0x28, 0xa0, 0x28, 0xa0, 0x20,
+  0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20,
+  0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0xa0, 0x20,
+  0xa0, 0x28, 0xa0, 0x28, 0xa0, 0x28, 0x80, 0x20, 0x80, 0x28, 0x80, 0x20, 0x80, 0x20, 0x60, 0x08,
+  0x81, 0x18, 0xc0, 0x40, 0xc0, 0x40, 0xe0, 0x40, 0x00, 0x49, 0x00, 0x49, 0x40, 0x51, 0x40, 0x51,
+  0x61, 0x61, 0x81, 0x61, 0xa1, 0x69, 0xc1, 0x71, 0xc1, 0x71, 0xe2, 0x79, 0x03, 0x82, 0x02, 0x82,
+  0x23, 0x8a, 0x42, 0x8a, 0x42, 0x8a, 0x43, 0x8a, 0x43, 0x92, 0x43, 0x92, 0x43, 0x92, 0x63, 0x92,
+  0x63, 0x92, 0x63, 0x9a, 0x83, 0x9a, 0x83, 0x9a, 0x63, 0x9a, 0x63, 0x9a, 0x83, 0x9a, 0x63, 0x9a,
+  0x63, 0x92, 0x63, 0x92, 0x63, 0x92, 0x43, 0x92, 0x43, 0x92, 0x43, 0x92, 0x43, 0x92, 0x63, 0x92,
+  0x83, 0x9a, 0x83, 0x9a, 0x84, 0x9a, 0x63, 0x9a, 0x84, 0x9a, 0x83, 0x9a, 0x84, 0x9a, 0x83, 0x9a,
+  0x84, 0x9a, 0x84, 0x9a, 0x84, 0x9a, 0x84, 0x9a, 0x83, 0x9a, 0x84, 0x9a, 0x83, 0x9a, 0x83, 0x9a,
+  0x63, 0x9a, 0x63, 0x9a, 0x63, 0x9a, 0x63, 0x9a, 0x63, 0x9a, 0x63, 0x9a, 0x63, 0x92, 0x43, 0x92,
+  0x43, 0x92, 0x43, 0x92, 0x43, 0x8a, 0x43, 0x8a, 0x43, 0x8a, 0x23, 0x8a, 0x22, 0x82, 0x23, 0x8a,
+  0x22, 0x82, 0xe3, 0x81, 0xe2, 0x79, 0xc2, 0x71, 0xc1, 0x71, 0xa1, 0x69, 0x61, 0x61, 0x02, 0x29,
+  0x81, 0x18, 0xc0, 0x40, 0x00, 0x49, 0x40, 0x51, 0x20, 0x51, 0x61, 0x59, 0x82, 0x69, 0xa1, 0x69,
+  0xe2, 0x71, 0x03, 0x7a, 0x03, 0x7a, 0x23, 0x82, 0x23, 0x82, 0x23, 0x8a, 0x43, 0x8a, 0x44, 0x92,
+  0x64, 0x92, 0x63, 0x92, 0x63, 0x92, 0x63, 0x92, 0x64, 0x9a, 0x84, 0x9a, 0x84, 0x9a, 0x84, 0x9a,
+  0xa4, 0x9a, 0xa4, 0x9a, 0xa4, 0x9a, 0xc4, 0xa2, 0xc4, 0xa2, 0xc4, 0xa2, 0xc4, 0xa2, 0xc5, 0xaa,
+  0xc5, 0xaa, 0xc5, 0xaa, 0xc5, 0xaa, 0xc5, 0xaa, 0xc4, 0xaa, 0xc4, 0xaa, 0xe4, 0xaa, 0xc4, 0xaa,
+  0xc4, 0xaa, 0xe4, 0xaa, 0xc4, 0xaa, 0xe4, 0xaa, 0xc4, 0xaa, 0xc4, 0xaa, 0xc4, 0xaa, 0xc4, 0xaa,
+  0xc4, 0xa2, 0xc4, 0xa2, 0xc4, 0xaa, 0xc4, 0xaa, 0xc4, 0xa2, 0xc4, 0xa2, 0xc4, 0xa2, 0xc4, 0xa2,
+  0xc4, 0xa2, 0xc4, 0xa2, 0xc4, 0xa2, 0xc4, 0xa2, 0xa4, 0xa2, 0xa4, 0xa2, 0xa4, 0xa2, 0xa4, 0x9a,
+  0x84, 0x9a, 0x83, 0x92, 0x83, 0x92, 0x63, 0x92, 0x63, 0x92, 0x63, 0x92, 0x43, 0x8a, 0x43, 0x8a,
+  0x23, 0x82, 0xe2, 0x71, 0xc2, 0x71, 0xa1, 0x69, 0x82, 0x61, 0x61, 0x59, 0x20, 0x51, 0xa1, 0x20,
+  0x44, 0x39, 0x02, 0x82, 0x83, 0x9a, 0xa4, 0xa2, 0xc4, 0xaa, 0xc4, 0xaa, 0xe4, 0xb2, 0xe4, 0xb2,
+  0x04, 0xbb, 0x04, 0xbb, 0x04, 0xbb, 0x04, 0xbb, 0x05, 0xbb, 0x25, 0xc3, 0x24, 0xc3, 0x25, 0xc3,
+  0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xcb,
+  0x25, 0xcb, 0x25, 0xcb, 0x44, 0xcb, 0x45, 0xcb, 0x45, 0xcb, 0x45, 0xcb, 0x45, 0xcb, 0x45, 0xcb,
+  0x44, 0xcb, 0x44, 0xcb, 0x25, 0xcb, 0x45, 0xcb, 0x45, 0xcb, 0x45, 0xcb, 0x45, 0xcb, 0x45, 0xcb,
+  0x45, 0xd3, 0x65, 0xd3, 0x65, 0xd3, 0x65, 0xd3, 0x65, 0xd3, 0x65, 0xcb, 0x45, 0xcb, 0x45, 0xcb,
+  0x45, 0xcb, 0x45, 0xcb, 0x45, 0xcb, 0x45, 0xcb, 0x45, 0xcb, 0x45, 0xcb, 0x45, 0xcb, 0x44, 0xcb,
+  0x25, 0xcb, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x24, 0xc3, 0x24, 0xc3, 0x25, 0xc3, 0x25, 0xbb,
+  0x24, 0xbb, 0x04, 0xbb, 0x04, 0xbb, 0x04, 0xbb, 0x05, 0xb3, 0x05, 0xb3, 0xe4, 0xb2, 0xe4, 0xb2,
+  0xc4, 0xaa, 0xc4, 0xaa, 0xa4, 0xa2, 0x83, 0x9a, 0x63, 0x92, 0x43, 0x92, 0x22, 0x82, 0xa4, 0x41,
+  0xc8, 0x72, 0x85, 0xd3, 0x65, 0xd3, 0x85, 0xdb, 0x85, 0xdb, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3,
+  0xa5, 0xe3, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xc5, 0xeb, 0xa5, 0xeb, 0xc5, 0xeb, 0xc5, 0xeb,
+  0xc5, 0xeb, 0xc5, 0xeb, 0xc5, 0xeb, 0xc5, 0xf3, 0xc5, 0xf3, 0xc5, 0xf3, 0xc4, 0xf3, 0xa4, 0xf3,
+  0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xc5, 0xf3, 0xc5, 0xf3, 0xc5, 0xf3,
+  0xa5, 0xeb, 0xc5, 0xeb, 0xc5, 0xf3, 0xc5, 0xf3, 0xc5, 0xf3, 0xa5, 0xf3, 0xc5, 0xf3, 0xc5, 0xf3,
+  0xc5, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa5, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3,
+  0xa4, 0xf3, 0xc5, 0xf3, 0xc5, 0xf3, 0xc5, 0xf3, 0xc5, 0xf3, 0xc5, 0xf3, 0xc5, 0xf3, 0xc5, 0xf3,
+  0xc5, 0xeb, 0xc5, 0xeb, 0xc5, 0xeb, 0xc5, 0xeb, 0xc5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb,
+  0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3,
+  0xa5, 0xe3, 0xa5, 0xe3, 0x85, 0xe3, 0x85, 0xdb, 0x85, 0xdb, 0x65, 0xd3, 0x65, 0xd3, 0xc9, 0x7a,
+  0xe9, 0x82, 0x85, 0xe3, 0x85, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb,
+  0xa4, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xc5, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xc4, 0xf3,
+  0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3,
+  0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3,
+  0xc4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3,
+  0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3,
+  0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3,
+  0xa4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3,
+  0xc4, 0xf3, 0xc4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xc4, 0xeb, 0xa5, 0xf3, 0xa5, 0xf3,
+  0xa5, 0xeb, 0xa4, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xe3, 0xa4, 0xe3, 0x85, 0xe3, 0xe9, 0x82,
+  0x09, 0x83, 0xa5, 0xeb, 0xa5, 0xeb, 0xc5, 0xeb, 0xc5, 0xeb, 0xc5, 0xeb, 0xa4, 0xf3, 0xa4, 0xf3,
+  0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xa4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xfb, 0xc4, 0xf3,
+  0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xfb, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xfb, 0xc4, 0xf3,
+  0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xfb, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xa4, 0xfb,
+  0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3,
+  0xc4, 0xf3, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3,
+  0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3,
+  0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc5, 0xf3, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0x09, 0x83,
+  0x09, 0x83, 0xa5, 0xeb, 0xc5, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xa4, 0xf3, 0xc4, 0xf3,
+  0xa4, 0xf3, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb, 0xc4, 0xf3,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xa4, 0xf3, 0xc4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xeb, 0x09, 0x83,
+  0x09, 0x8b, 0xa4, 0xf3, 0xc4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xc4, 0xf3, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb,
+  0xc4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xa4, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xf3, 0xa4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0x09, 0x8b,
+  0x09, 0x83, 0xc4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb,
+  0xa4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa4, 0xf3, 0xa4, 0xf3, 0x09, 0x8b,
+  0x09, 0x8b, 0xa4, 0xf3, 0xa4, 0xf3, 0xc4, 0xf3, 0xc4, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb, 0xa3, 0xfb,
+  0xa3, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc3, 0xfb, 0xa3, 0xfb,
+  0xc4, 0xfb, 0xc3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xc3, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb,
+  0xa4, 0xfb, 0xa4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa4, 0xf3, 0x09, 0x8b,
+  0x09, 0x8b, 0xa4, 0xf3, 0xc4, 0xf3, 0xc4, 0xfb, 0xa4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa4, 0xfb,
+  0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0x82, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa2, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb,
+  0xc3, 0xfb, 0x82, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb,
+  0xa3, 0xfb, 0xc3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xf3, 0x09, 0x8b,
+  0x09, 0x8b, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb,
+  0xa4, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xc3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb,
+  0xa2, 0xfb, 0xa3, 0xfb, 0xa2, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa2, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc3, 0xfb, 0x82, 0xfb,
+  0xa2, 0xfb, 0xa3, 0xfb, 0xa2, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa3, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb, 0x09, 0x8b,
+  0x09, 0x8b, 0xc4, 0xf3, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb,
+  0xa4, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc3, 0xfb, 0xc3, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0x82, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa2, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xc3, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb,
+  0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0x09, 0x8b,
+  0x09, 0x8b, 0xc4, 0xf3, 0xc4, 0xfb, 0xa4, 0xfb, 0xa3, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb,
+  0xa4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xa3, 0xfb, 0x82, 0xfb, 0xc4, 0xfb, 0xc3, 0xfb, 0x82, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb,
+  0xa2, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xa3, 0xfb, 0xc3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc3, 0xfb,
+  0xa3, 0xfb, 0xc3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb,
+  0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa3, 0xfb, 0x09, 0x8b,
+  0x09, 0x8b, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xa3, 0xfb, 0xa2, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb,
+  0xa3, 0xfb, 0xa2, 0xfb, 0xa2, 0xfb, 0xa2, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xa3, 0xfb, 0xa2, 0xfb, 0xa2, 0xfb, 0xa2, 0xfb, 0xa2, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa2, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb,
+  0xa2, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa2, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa3, 0xfb, 0x09, 0x8b,
+  0x09, 0x8b, 0xc4, 0xfb, 0xa4, 0xfb, 0xa3, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xa3, 0xfb, 0x82, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa2, 0xfb, 0x82, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa2, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xa3, 0xfb, 0xc3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xa2, 0xfb, 0x82, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0x09, 0x8b,
+  0x09, 0x8b, 0xc4, 0xfb, 0xa4, 0xfb, 0xa3, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc3, 0xfb, 0xa3, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa2, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xc3, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa2, 0xfb, 0xa3, 0xfb, 0xc3, 0xfb, 0xa3, 0xfb, 0x82, 0xfb,
+  0x82, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb,
+  0xa2, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xc3, 0xfb, 0xc3, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa4, 0xfb, 0x09, 0x8b,
+  0x09, 0x8b, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb,
+  0xa2, 0xfb, 0xa2, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa2, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0x82, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb,
+  0xc3, 0xfb, 0xc4, 0xfb, 0xc3, 0xfb, 0xc3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa2, 0xfb, 0xa3, 0xfb, 0xa2, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa3, 0xfb, 0x09, 0x8b,
+  0x09, 0x8b, 0xc4, 0xf3, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb,
+  0xc3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb,
+  0xa2, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xc3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb,
+  0xa3, 0xfb, 0xa2, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa2, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xc3, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb,
+  0xa3, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0x09, 0x8b,
+  0x09, 0x8b, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb,
+  0xa4, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb,
+  0xa2, 0xfb, 0xa2, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb,
+  0xa3, 0xfb, 0xa2, 0xfb, 0xa2, 0xfb, 0xa2, 0xfb, 0x82, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb,
+  0xc4, 0xfb, 0xa3, 0xfb, 0xa2, 0xfb, 0xa3, 0xfb, 0xa2, 0xfb, 0xa3, 0xfb, 0xc3, 0xfb, 0xa3, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0x09, 0x8b,
+  0x09, 0x8b, 0xa4, 0xf3, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa4, 0xfb,
+  0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa2, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc3, 0xfb, 0xc3, 0xfb, 0xc3, 0xfb, 0xc3, 0xfb, 0xa3, 0xfb, 0xc3, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa3, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb, 0x09, 0x8b,
+  0x09, 0x8b, 0xa4, 0xf3, 0xa4, 0xf3, 0xc4, 0xf3, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb,
+  0xa3, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xf3, 0x09, 0x8b,
+  0x09, 0x83, 0xc4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xa4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa4, 0xf3, 0x09, 0x8b,
+  0x09, 0x8b, 0xa4, 0xf3, 0xc4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb,
+  0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0x09, 0x83,
+  0x09, 0x83, 0xa4, 0xeb, 0xc5, 0xf3, 0xa4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3,
+  0xa4, 0xf3, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb,
+  0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb,
+  0xa3, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb,
+  0xc4, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb,
+  0xa3, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xa4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xc4, 0xf3, 0xc4, 0xf3, 0xa4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xa4, 0xf3, 0x09, 0x8b,
+  0x09, 0x83, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa4, 0xeb, 0xa4, 0xf3, 0xc4, 0xf3, 0xa4, 0xf3,
+  0xc4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb,
+  0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb,
+  0xa4, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa3, 0xfb, 0xa4, 0xfb,
+  0xa4, 0xfb, 0xa4, 0xfb, 0xa3, 0xfb, 0xc4, 0xfb, 0xa4, 0xfb, 0xc4, 0xfb, 0xa3, 0xfb, 0xa3, 0xfb,
+  0xa4, 0xfb, 0xa3, 0xfb, 0xa4, 0xfb, 0xa3, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb,
+  0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb,
+  0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xfb, 0xa4, 0xf3, 0xc4, 0xfb, 0xc4, 0xf3, 0xc4, 0xfb, 0xa4, 0xf3,
+  0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0x09, 0x83,
+  0x09, 0x83, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xeb, 0xa4, 0xeb, 0xa5, 0xeb, 0xa4, 0xeb, 0xa5, 0xeb,
+  0xa4, 0xeb, 0xa4, 0xeb, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xc4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3,
+  0xc4, 0xf3, 0xc4, 0xf3, 0xa4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3,
+  0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3,
+  0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3,
+  0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xfb, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xa4, 0xfb, 0xc4, 0xfb,
+  0xc4, 0xf3, 0xc4, 0xfb, 0xc4, 0xf3, 0xc4, 0xfb, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3,
+  0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3,
+  0xc4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xc4, 0xf3, 0xa4, 0xf3,
+  0xa4, 0xf3, 0xc4, 0xf3, 0xc5, 0xf3, 0xc5, 0xf3, 0xa5, 0xeb, 0xa4, 0xeb, 0xa5, 0xeb, 0x09, 0x83,
+  0xc8, 0x72, 0x85, 0xd3, 0x85, 0xdb, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xeb, 0xa5, 0xeb, 0xc5, 0xeb,
+  0xc5, 0xeb, 0xc4, 0xeb, 0xc5, 0xf3, 0xc5, 0xeb, 0xa5, 0xf3, 0xc5, 0xf3, 0xc5, 0xf3, 0xc5, 0xf3,
+  0xc5, 0xf3, 0xc5, 0xf3, 0xa5, 0xf3, 0xa4, 0xf3, 0xa5, 0xf3, 0xa5, 0xf3, 0xa5, 0xf3, 0xc5, 0xf3,
+  0xc4, 0xf3, 0xa4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3,
+  0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3,
+  0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xa4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3,
+  0xa4, 0xf3, 0xa4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xc4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3,
+  0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xa4, 0xf3, 0xc5, 0xf3,
+  0xc5, 0xf3, 0xc5, 0xf3, 0xa5, 0xf3, 0xa4, 0xeb, 0xc5, 0xeb, 0xc5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb,
+  0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3, 0xe9, 0x82,
+  0xe2, 0x28, 0xa1, 0x61, 0xe1, 0x71, 0xe2, 0x79, 0x02, 0x82, 0x43, 0x8a, 0x63, 0x92, 0x83, 0x9a,
+  0xa3, 0xa2, 0xc4, 0xaa, 0xe4, 0xb2, 0xe4, 0xba, 0x04, 0xbb, 0x25, 0xbb, 0x25, 0xbb, 0x25, 0xbb,
+  0x24, 0xc3, 0x24, 0xc3, 0x25, 0xc3, 0x45, 0xc3, 0x45, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x45, 0xc3,
+  0x45, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3,
+  0x45, 0xc3, 0x24, 0xc3, 0x25, 0xc3, 0x24, 0xc3, 0x25, 0xc3, 0x24, 0xc3, 0x24, 0xc3, 0x24, 0xc3,
+  0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x45, 0xc3, 0x25, 0xcb,
+  0x45, 0xcb, 0x25, 0xcb, 0x25, 0xcb, 0x25, 0xcb, 0x25, 0xcb, 0x44, 0xc3, 0x45, 0xc3, 0x25, 0xcb,
+  0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x24, 0xc3, 0x25, 0xc3, 0x25, 0xbb, 0x05, 0xbb,
+  0x04, 0xbb, 0x04, 0xbb, 0xe4, 0xb2, 0xe4, 0xb2, 0xe4, 0xb2, 0xe4, 0xb2, 0xe4, 0xb2, 0xc4, 0xaa,
+  0xc4, 0xaa, 0xc3, 0xa2, 0xa4, 0xa2, 0x84, 0x9a, 0x83, 0x9a, 0x63, 0x92, 0x43, 0x92, 0xa5, 0x49,
+  0x20, 0x08, 0x60, 0x18, 0x80, 0x20, 0x80, 0x28, 0xa0, 0x30, 0xa0, 0x38, 0xc0, 0x38, 0xe0, 0x40,
+  0x20, 0x51, 0x40, 0x51, 0x61, 0x59, 0x81, 0x61, 0xa1, 0x69, 0xc1, 0x71, 0xc2, 0x71, 0xe2, 0x79,
+  0xe2, 0x79, 0x03, 0x82, 0x02, 0x7a, 0x23, 0x82, 0x23, 0x8a, 0x22, 0x82, 0x43, 0x8a, 0x43, 0x8a,
+  0x43, 0x8a, 0x43, 0x8a, 0x43, 0x8a, 0x43, 0x92, 0x63, 0x92, 0x63, 0x92, 0x63, 0x92, 0x63, 0x92,
+  0x63, 0x92, 0x43, 0x8a, 0x43, 0x8a, 0x43, 0x8a, 0x43, 0x8a, 0x43, 0x8a, 0x43, 0x8a, 0x43, 0x8a,
+  0x44, 0x8a, 0x43, 0x8a, 0x43, 0x92, 0x63, 0x92, 0x63, 0x92, 0x63, 0x92, 0x63, 0x92, 0x63, 0x92,
+  0x43, 0x92, 0x43, 0x8a, 0x43, 0x8a, 0x43, 0x8a, 0x43, 0x8a, 0x43, 0x8a, 0x43, 0x8a, 0x43, 0x8a,
+  0x23, 0x8a, 0x23, 0x8a, 0x23, 0x8a, 0x23, 0x8a, 0x23, 0x82, 0x23, 0x82, 0x23, 0x82, 0x23, 0x82,
+  0xe2, 0x79, 0xc2, 0x71, 0xa1, 0x69, 0xa1, 0x69, 0xa1, 0x69, 0xa1, 0x69, 0x81, 0x61, 0x81, 0x61,
+  0x61, 0x59, 0x40, 0x51, 0x20, 0x51, 0x20, 0x51, 0xe0, 0x40, 0xe0, 0x40, 0xc0, 0x38, 0x81, 0x18,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x20, 0x08, 0x40, 0x10,
+  0x40, 0x18, 0x60, 0x18, 0x60, 0x20, 0x60, 0x20, 0x80, 0x20, 0x80, 0x28, 0x80, 0x28, 0x80, 0x28,
+  0x80, 0x30, 0xa0, 0x30, 0xa0, 0x30, 0xa0, 0x30, 0x80, 0x30, 0xa0, 0x30, 0xa0, 0x30, 0xa0, 0x30,
+  0xa0, 0x30, 0xc0, 0x38, 0xc0, 0x38, 0xc0, 0x40, 0xe0, 0x40, 0xe0, 0x40, 0xe0, 0x40, 0x00, 0x49,
+  0xe0, 0x40, 0xe0, 0x40, 0xe0, 0x40, 0xe0, 0x40, 0xe0, 0x40, 0xe0, 0x40, 0xe0, 0x40, 0xe0, 0x40,
+  0xe0, 0x40, 0xe0, 0x40, 0xe0, 0x40, 0xe0, 0x40, 0xe0, 0x40, 0xe0, 0x40, 0xe0, 0x40, 0xe0, 0x40,
+  0xc0, 0x40, 0xc0, 0x40, 0xc0, 0x40, 0xc0, 0x40, 0xc0, 0x40, 0xc0, 0x40, 0xc0, 0x40, 0xc0, 0x38,
+  0xc0, 0x40, 0xc0, 0x40, 0xc0, 0x40, 0xc0, 0x38, 0xc0, 0x38, 0xc0, 0x38, 0xc0, 0x38, 0xa0, 0x38,
+  0xa0, 0x38, 0xa0, 0x30, 0xa0, 0x30, 0xa0, 0x30, 0xa0, 0x30, 0x80, 0x28, 0x80, 0x28, 0x80, 0x28,
+  0x80, 0x20, 0x60, 0x20, 0x60, 0x20, 0x60, 0x18, 0x40, 0x10, 0x20, 0x08, 0x20, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x20, 0x10, 0x40, 0x10, 0x40, 0x18, 0x60, 0x20, 0x80, 0x28,
+  0x80, 0x28, 0xa0, 0x30, 0xa0, 0x30, 0xa0, 0x30, 0xc0, 0x38, 0xc0, 0x38, 0xc0, 0x38, 0xe0, 0x38,
+  0xe0, 0x38, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x20, 0x49, 0x20, 0x49,
+  0x20, 0x49, 0x41, 0x51, 0x41, 0x59, 0x61, 0x59, 0x81, 0x61, 0x82, 0x69, 0x82, 0x69, 0x81, 0x61,
+  0x82, 0x61, 0x62, 0x61, 0x62, 0x61, 0x82, 0x61, 0x82, 0x61, 0x82, 0x61, 0x82, 0x69, 0x82, 0x69,
+  0xa2, 0x69, 0xa1, 0x61, 0x82, 0x69, 0x82, 0x69, 0x82, 0x69, 0x82, 0x69, 0x82, 0x61, 0x82, 0x61,
+  0x82, 0x69, 0x82, 0x69, 0x82, 0x69, 0x82, 0x69, 0x82, 0x69, 0xa2, 0x69, 0x82, 0x69, 0x82, 0x69,
+  0x82, 0x69, 0xa2, 0x69, 0xa2, 0x69, 0x82, 0x69, 0x82, 0x69, 0x82, 0x61, 0x62, 0x61, 0x62, 0x61,
+  0x62, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x59, 0x61, 0x59, 0x61, 0x59, 0x41, 0x51, 0x21, 0x51,
+  0x21, 0x51, 0x21, 0x51, 0xe0, 0x40, 0xe0, 0x38, 0xc0, 0x30, 0x80, 0x30, 0x80, 0x28, 0x40, 0x10,
+  0xa1, 0x18, 0x00, 0x49, 0x40, 0x51, 0x82, 0x69, 0xc2, 0x71, 0xe2, 0x79, 0x22, 0x82, 0x43, 0x8a,
+  0x63, 0x9a, 0x83, 0x9a, 0x83, 0x9a, 0xa3, 0x9a, 0xa4, 0xa2, 0xc4, 0xaa, 0xc4, 0xaa, 0xc4, 0xaa,
+  0xc4, 0xaa, 0xe4, 0xb2, 0xe4, 0xb2, 0x05, 0xb3, 0x04, 0xbb, 0x04, 0xbb, 0x25, 0xbb, 0x25, 0xbb,
+  0x25, 0xbb, 0x25, 0xbb, 0x25, 0xbb, 0x25, 0xc3, 0x25, 0xc3, 0x45, 0xc3, 0x45, 0xc3, 0x45, 0xc3,
+  0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x45, 0xc3, 0x45, 0xc3,
+  0x45, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3,
+  0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3,
+  0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3,
+  0x25, 0xc3, 0x25, 0xc3, 0x25, 0xbb, 0x25, 0xbb, 0x05, 0xbb, 0x05, 0xb3, 0xe4, 0xb2, 0xe4, 0xb2,
+  0xc4, 0xaa, 0xc4, 0xaa, 0xa4, 0xa2, 0x84, 0x9a, 0x63, 0x9a, 0x43, 0x92, 0x02, 0x82, 0x84, 0x41,
+  0x84, 0x41, 0x23, 0x8a, 0x83, 0x92, 0x84, 0x9a, 0xc4, 0xaa, 0xe4, 0xaa, 0xe5, 0xb2, 0x24, 0xbb,
+  0x25, 0xc3, 0x25, 0xc3, 0x25, 0xc3, 0x45, 0xc3, 0x45, 0xcb, 0x45, 0xcb, 0x65, 0xd3, 0x65, 0xd3,
+  0x65, 0xd3, 0x85, 0xd3, 0x65, 0xd3, 0x65, 0xd3, 0x65, 0xd3, 0x85, 0xd3, 0x85, 0xdb, 0x85, 0xdb,
+  0x85, 0xdb, 0x85, 0xdb, 0x85, 0xdb, 0x85, 0xdb, 0x85, 0xdb, 0x85, 0xdb, 0x85, 0xdb, 0x85, 0xdb,
+  0x85, 0xdb, 0x85, 0xdb, 0x85, 0xdb, 0x85, 0xdb, 0x85, 0xdb, 0x85, 0xdb, 0x85, 0xdb, 0x85, 0xdb,
+  0x85, 0xdb, 0x85, 0xe3, 0x85, 0xe3, 0x85, 0xe3, 0x85, 0xe3, 0x85, 0xdb, 0x85, 0xdb, 0x85, 0xdb,
+  0x85, 0xdb, 0x85, 0xdb, 0x85, 0xdb, 0x85, 0xdb, 0x85, 0xdb, 0x85, 0xdb, 0x85, 0xdb, 0x85, 0xdb,
+  0x85, 0xdb, 0x85, 0xdb, 0x85, 0xdb, 0x85, 0xdb, 0x85, 0xdb, 0x85, 0xdb, 0x85, 0xdb, 0x85, 0xdb,
+  0x85, 0xdb, 0x85, 0xdb, 0x65, 0xdb, 0x65, 0xd3, 0x65, 0xd3, 0x65, 0xd3, 0x65, 0xd3, 0x45, 0xcb,
+  0x45, 0xcb, 0x45, 0xc3, 0x25, 0xc3, 0x24, 0xbb, 0x04, 0xb3, 0xe4, 0xb2, 0xc4, 0xaa, 0x27, 0x5a,
+  0x06, 0x52, 0x84, 0x9a, 0xc4, 0xaa, 0xe5, 0xb2, 0x04, 0xbb, 0x25, 0xc3, 0x25, 0xc3, 0x45, 0xcb,
+  0x65, 0xd3, 0x65, 0xd3, 0x65, 0xd3, 0x85, 0xd3, 0x85, 0xdb, 0x85, 0xdb, 0x85, 0xdb, 0x85, 0xe3,
+  0x85, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xeb,
+  0xa5, 0xe3, 0xa5, 0xeb, 0xa5, 0xe3, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb,
+  0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb,
+  0xa5, 0xeb, 0xa4, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa4, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb,
+  0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb,
+  0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xe3, 0xa5, 0xe3,
+  0xa5, 0xe3, 0x85, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3, 0x85, 0xe3, 0x85, 0xdb,
+  0x85, 0xdb, 0x65, 0xd3, 0x65, 0xd3, 0x45, 0xcb, 0x45, 0xc3, 0x25, 0xc3, 0x04, 0xbb, 0x87, 0x62,
+  0x27, 0x5a, 0xc4, 0xaa, 0x05, 0xb3, 0x24, 0xbb, 0x24, 0xc3, 0x45, 0xc3, 0x45, 0xcb, 0x65, 0xd3,
+  0x65, 0xd3, 0x85, 0xdb, 0x85, 0xe3, 0x85, 0xe3, 0x85, 0xe3, 0xa5, 0xe3, 0xa5, 0xeb, 0xa5, 0xe3,
+  0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb,
+  0xa4, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb,
+  0xa4, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb,
+  0xa4, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb,
+  0xa4, 0xeb, 0xa4, 0xeb, 0xa5, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb, 0xa5, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb,
+  0xa5, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb,
+  0xa4, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xe3, 0x85, 0xe3, 0xa5, 0xe3,
+  0x85, 0xdb, 0x85, 0xdb, 0x65, 0xd3, 0x65, 0xd3, 0x65, 0xcb, 0x45, 0xcb, 0x25, 0xc3, 0xa8, 0x6a,
+  0x07, 0x5a, 0xc4, 0xaa, 0xe4, 0xb2, 0x04, 0xbb, 0x25, 0xc3, 0x45, 0xc3, 0x45, 0xcb, 0x65, 0xd3,
+  0x65, 0xd3, 0x85, 0xdb, 0x85, 0xdb, 0x85, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3, 0x85, 0xe3, 0x85, 0xe3,
+  0xa5, 0xe3, 0xa5, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb,
+  0xa4, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb,
+  0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa4, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb,
+  0xa5, 0xeb, 0xa5, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb,
+  0xa4, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb, 0xa5, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb,
+  0xa4, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb, 0xa5, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb, 0xa4, 0xeb,
+  0xa5, 0xeb, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3, 0x85, 0xe3, 0x85, 0xe3, 0x85, 0xdb,
+  0x85, 0xdb, 0x85, 0xd3, 0x65, 0xd3, 0x65, 0xcb, 0x45, 0xc3, 0x25, 0xbb, 0x04, 0xbb, 0x67, 0x6a,
+  0xa5, 0x49, 0x43, 0x92, 0x83, 0x9a, 0xc4, 0xaa, 0xc4, 0xb2, 0xe4, 0xb2, 0x04, 0xbb, 0x25, 0xc3,
+  0x45, 0xc3, 0x65, 0xcb, 0x65, 0xd3, 0x85, 0xd3, 0x85, 0xdb, 0x85, 0xdb, 0x85, 0xdb, 0xa5, 0xdb,
+  0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3,
+  0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3,
+  0xa5, 0xe3, 0xa5, 0xeb, 0xc5, 0xeb, 0xc5, 0xeb, 0xc5, 0xeb, 0xc5, 0xeb, 0xc5, 0xeb, 0xc5, 0xeb,
+  0xc5, 0xeb, 0xc5, 0xe3, 0xc5, 0xe3, 0xc5, 0xeb, 0xc5, 0xeb, 0xc5, 0xeb, 0xc5, 0xeb, 0xc5, 0xeb,
+  0xa5, 0xeb, 0xa5, 0xeb, 0xc5, 0xeb, 0xc5, 0xeb, 0xa5, 0xeb, 0xa5, 0xeb, 0xa5, 0xe3, 0xa5, 0xeb,
+  0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3, 0xa5, 0xe3,
+  0xa5, 0xe3, 0x85, 0xdb, 0x85, 0xdb, 0x85, 0xdb, 0x85, 0xdb, 0x85, 0xd3, 0x65, 0xd3, 0x65, 0xd3,
+  0x45, 0xcb, 0x45, 0xc3, 0x25, 0xc3, 0x05, 0xbb, 0xe4, 0xb2, 0xc4, 0xaa, 0x84, 0x9a, 0xe5, 0x51,
+  0x81, 0x10, 0xc0, 0x30, 0xe0, 0x38, 0x00, 0x41, 0x00, 0x41, 0x21, 0x49, 0x21, 0x49, 0x21, 0x51,
+  0x41, 0x51, 0x61, 0x59, 0x81, 0x59, 0x82, 0x61, 0x82, 0x69, 0xa1, 0x69, 0xa1, 0x69, 0xc1, 0x71,
+  0xc1, 0x71, 0xe2, 0x79, 0x02, 0x7a, 0x02, 0x82, 0x22, 0x8a, 0x42, 0x8a, 0x43, 0x92, 0x43, 0x92,
+  0x43, 0x8a, 0x23, 0x8a, 0x23, 0x8a, 0x02, 0x82, 0x02, 0x82, 0xe2, 0x79, 0xe2, 0x79, 0xc1, 0x71,
+  0xc1, 0x71, 0xc1, 0x71, 0xa1, 0x71, 0xc1, 0x71, 0xc1, 0x71, 0xc1, 0x71, 0xc1, 0x71, 0xc1, 0x71,
+  0xc1, 0x71, 0xc1, 0x71, 0xc1, 0x71, 0xc1, 0x71, 0xc1, 0x71, 0xc1, 0x71, 0xc1, 0x71, 0xc1, 0x71,
+  0xc1, 0x71, 0xc1, 0x71, 0xc1, 0x71, 0xe1, 0x71, 0xc2, 0x79, 0xc1, 0x71, 0xc1, 0x71, 0xe2, 0x79,
+  0xe2, 0x79, 0xe2, 0x79, 0xe1, 0x71, 0xc1, 0x71, 0xc1, 0x71, 0xc1, 0x71, 0xc1, 0x71, 0xa1, 0x71,
+  0xa1, 0x71, 0xa1, 0x69, 0xa1, 0x69, 0xa1, 0x69, 0xa1, 0x69, 0xa1, 0x69, 0x82, 0x61, 0x61, 0x59,
+  0x41, 0x51, 0x21, 0x51, 0x21, 0x49, 0x00, 0x39, 0xe0, 0x38, 0xc0, 0x30, 0xa0, 0x30, 0x60, 0x10,
+  0x45, 0x7a, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x45, 0x7a,
+  0x45, 0x7a, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x45, 0x7a,
+  0x45, 0x7a, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x45, 0x7a,
+  0x45, 0x7a, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x45, 0x7a,
+  0x45, 0x7a, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x45, 0x7a,
+  0x45, 0x7a, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb,
+  0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x20, 0xfb, 0x45, 0x7a,
+  0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a,
+  0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a,
+  0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a,
+  0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a,
+  0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a,
+  0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a,
+  0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a,
+  0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a,
+  0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a,
+  0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a, 0x45, 0x7a
+};
+
+const lv_img_dsc_t boot_cell_on = {
+  .header.cf = LV_IMG_CF_TRUE_COLOR,
+  .header.always_zero = 0,
+  .header.reserved = 0,
+  .header.w = 80,
+  .header.h = 53,
+  .data_size = 8480,
+  .data = boot_cell_on_map,
+};
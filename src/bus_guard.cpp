@@ -0,0 +1,124 @@
+/*******************************************************************************
+ * I2C bus guard: fault detection and bus clear
+ *
+ * Two ways a bus goes bad on this board. A device is cut off mid-byte (a
+ * glitch on the radio harness, a master reset during a read) and keeps SDA
+ * low waiting for clocks that never come: every later transfer fails. Or a
+ * driver is left in a state where reads "succeed" with 0xFF bytes, as after
+ * Wire1.begin() corrupted Wire (docs/done_changes.md): the GT911 then
+ * reports touches at 65535/65535. The first shows as a line sampled low
+ * while the bus is idle, the second as a run of impossible transfers.
+ *
+ * Either way the caller detaches the driver, runs bus_clear() on the pins
+ * and starts the driver again; the guard only decides when, and keeps the
+ * counts. A recovery that did not help is retried after BUS_GUARD_RETRY_MS
+ * so a dead bus does not take the loop.
+ ******************************************************************************/
+#include "bus_guard.h"
+
+static bool wait_high(const bus_pins_t * p, bool (*line)(void *), int half_periods)
+{
+    for (int i = 0; i < half_periods && !line(p->ctx); i++)
+        p->delay_us(p->ctx, BUS_GUARD_HALF_US);
+    return line(p->ctx);
+}
+
+bus_clear_t bus_clear(const bus_pins_t * p, int * pulses)
+{
+    int n = 0;
+    if (pulses) *pulses = 0;
+    p->pull_sda(p->ctx, false);
+    p->pull_scl(p->ctx, false);
+    p->delay_us(p->ctx, BUS_GUARD_HALF_US);
+    // Allow a clock-stretching device 1 ms to let go of SCL
+    if (!wait_high(p, p->scl, 200)) return BUS_CLEAR_SCL_LOW;
+
+    // Each SCL low phase lets the device shift out its next bit. A STOP needs
+    // SDA low while SCL is low, then SCL up, then SDA up: if the device
+    // drives a 0 in that low phase, the STOP becomes one more clock pulse.
+    while (n <= 9) {
+        if (!p->sda(p->ctx)) {
+            if (n == 9) break;
+            p->pull_scl(p->ctx, true);
+            p->delay_us(p->ctx, BUS_GUARD_HALF_US);
+            p->pull_scl(p->ctx, false);
+            wait_high(p, p->scl, 200);
+            p->delay_us(p->ctx, BUS_GUARD_HALF_US);
+            n++;
+            continue;
+        }
+        p->pull_scl(p->ctx, true);
+        p->delay_us(p->ctx, BUS_GUARD_HALF_US);
+        bool sda_free = p->sda(p->ctx);
+        if (sda_free) p->pull_sda(p->ctx, true);
+        p->delay_us(p->ctx, BUS_GUARD_HALF_US);
+        p->pull_scl(p->ctx, false);
+        wait_high(p, p->scl, 200);
+        p->delay_us(p->ctx, BUS_GUARD_HALF_US);
+        if (sda_free) {
+            p->pull_sda(p->ctx, false);   // STOP
+            p->delay_us(p->ctx, BUS_GUARD_HALF_US);
+            break;
+        }
+        n++;
+    }
+    if (pulses) *pulses = n;
+
+    if (!p->scl(p->ctx)) return BUS_CLEAR_SCL_LOW;
+    return p->sda(p->ctx) ? BUS_CLEAR_OK : BUS_CLEAR_SDA_LOW;
+}
+
+void bus_guard_init(bus_guard_t * g, const char * name)
+{
+    *g = bus_guard_t();
+    g->name = name;
+}
+
+static bool may_recover(const bus_guard_t * g, uint32_t now_ms)
+{
+    return (int32_t)(now_ms - g->retry_at_ms) >= 0;
+}
+
+bool bus_guard_transfer(bus_guard_t * g, bool ok, uint32_t now_ms)
+{
+    if (ok) {
+        g->bad_run = 0;
+        return false;
+    }
+    g->bad_transfers++;
+    if (g->bad_run < 255) g->bad_run++;
+    return g->bad_run >= BUS_GUARD_BAD_READS && may_recover(g, now_ms);
+}
+
+bool bus_guard_sample(bus_guard_t * g, bool sda, bool scl, uint32_t now_ms)
+{
+    if (sda && scl) {
+        g->line_low = false;
+        return false;
+    }
+    if (!g->line_low) {
+        g->line_low = true;
+        g->low_since_ms = now_ms;
+        return false;
+    }
+    if (now_ms - g->low_since_ms < BUS_GUARD_STUCK_MS || !may_recover(g, now_ms))
+        return false;
+    g->stuck_detected++;
+    return true;
+}
+
+void bus_guard_recovered(bus_guard_t * g, bool ok, int pulses, uint32_t us, uint32_t now_ms)
+{
+    g->pulses += pulses;
+    g->last_us = us;
+    if (us > g->max_us) g->max_us = us;
+    g->bad_run = 0;
+    g->line_low = false;
+    if (ok) {
+        g->recoveries++;
+        g->retry_at_ms = now_ms;
+    } else {
+        g->failed++;
+        g->retry_at_ms = now_ms + BUS_GUARD_RETRY_MS;
+    }
+}
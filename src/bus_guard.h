@@ -0,0 +1,78 @@
+#ifndef BUS_GUARD_H
+#define BUS_GUARD_H
+
+#include <stdint.h>
+
+/* I2C bus fault detection and the bus clear sequence, without any Arduino
+ * dependency: i2c_recover.cpp supplies the pin access and the driver
+ * restart, test/host/bus_guard_sim.cpp a simulated bus. */
+
+// Consecutive failed or impossible transfers before a recovery
+#ifndef BUS_GUARD_BAD_READS
+#define BUS_GUARD_BAD_READS 3
+#endif
+// A line sampled low for this long while the bus should be idle is stuck
+#ifndef BUS_GUARD_STUCK_MS
+#define BUS_GUARD_STUCK_MS 200
+#endif
+// Wait after a recovery that did not free the bus before trying again
+#ifndef BUS_GUARD_RETRY_MS
+#define BUS_GUARD_RETRY_MS 1000
+#endif
+// Half SCL period of the bus clear pulses (5 us: 100 kHz)
+#ifndef BUS_GUARD_HALF_US
+#define BUS_GUARD_HALF_US 5
+#endif
+
+// Open-drain access to the two lines while the I2C driver is detached
+typedef struct {
+    bool (*sda)(void * ctx);                // line level, true = high
+    bool (*scl)(void * ctx);
+    void (*pull_sda)(void * ctx, bool low); // false releases the line
+    void (*pull_scl)(void * ctx, bool low);
+    void (*delay_us)(void * ctx, uint32_t us);
+    void * ctx;
+} bus_pins_t;
+
+typedef enum {
+    BUS_CLEAR_OK = 0,     // both lines high after the STOP
+    BUS_CLEAR_SCL_LOW,    // another device holds SCL: nothing to clock
+    BUS_CLEAR_SDA_LOW,    // SDA still low after 9 clock pulses
+} bus_clear_t;
+
+// I2C bus clear (UM10204 3.1.16): clock SCL until the device holding SDA
+// has shifted out its byte and releases it (at most 9 pulses), then send a
+// STOP so every device sees the bus free. `pulses` gets the count used.
+bus_clear_t bus_clear(const bus_pins_t * pins, int * pulses);
+
+typedef struct {
+    const char * name;
+    // detection
+    uint8_t  bad_run;         // consecutive bad transfers
+    bool     line_low;        // last idle sample had a line low
+    uint32_t low_since_ms;
+    uint32_t retry_at_ms;     // no recovery before this after a failed one
+    // counters
+    uint32_t bad_transfers;
+    uint32_t stuck_detected;
+    uint32_t recoveries;      // recoveries that left the bus working
+    uint32_t failed;          // recoveries that did not
+    uint32_t pulses;          // bus clear SCL pulses, all recoveries
+    uint32_t last_us;         // duration of the last recovery
+    uint32_t max_us;
+} bus_guard_t;
+
+void bus_guard_init(bus_guard_t * g, const char * name);
+
+// Outcome of one transfer (driver error or impossible data = !ok). True when
+// the run of bad transfers calls for a recovery now.
+bool bus_guard_transfer(bus_guard_t * g, bool ok, uint32_t now_ms);
+
+// Line levels sampled while no transfer is running. True when a line has
+// been low for BUS_GUARD_STUCK_MS and a recovery should run now.
+bool bus_guard_sample(bus_guard_t * g, bool sda, bool scl, uint32_t now_ms);
+
+// Result of the recovery the guard asked for, `us` long
+void bus_guard_recovered(bus_guard_t * g, bool ok, int pulses, uint32_t us, uint32_t now_ms);
+
+#endif
@@ -0,0 +1,155 @@
+#include <lvgl.h>
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN uint8_t button_4_106x40_i4_map[] = {
+  0x37, 0x38, 0x37, 0x88, 0x5c, 0x5b, 0x5c, 0x6d, 0xa5, 0xa4, 0xa5, 0x41, 0x01, 0x02, 0x01, 0xd1,
+  0x00, 0x00, 0x00, 0xf5, 0x20, 0x20, 0x20, 0x9c, 0xb8, 0xb5, 0xb8, 0x37, 0xca, 0xca, 0xca, 0x2d,
+  0xf2, 0xee, 0xf2, 0x22, 0xf7, 0xf6, 0xf7, 0x1e, 0x73, 0x73, 0x73, 0x5d, 0x8e, 0x8d, 0x8e, 0x4e,
+  0x0b, 0x0e, 0x0b, 0xae, 0x02, 0x03, 0x02, 0xbc, 0xd8, 0xd6, 0xd8, 0x28, 0xe5, 0xe1, 0xe5, 0x23,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x34,
+  0x44, 0x33, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43, 0x33, 0xdd, 0xdd, 0xdd, 0xdc, 0xcc,
+  0xc5, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05,
+  0x55, 0x55, 0x5c, 0xcc, 0xcd, 0xdd, 0xdc, 0x55, 0xc4, 0x44, 0x44, 0x44, 0x44, 0x44, 0x33, 0x33,
+  0x3d, 0xdc, 0xcc, 0xc5, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0xcc, 0xdd, 0xdd, 0x33, 0x33, 0xd5, 0x11, 0xc3, 0x44,
+  0x44, 0x44, 0x43, 0x33, 0x3d, 0xc5, 0x50, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xa1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00, 0x05, 0x55, 0xcd, 0x33,
+  0x33, 0x33, 0xd1, 0xad, 0x44, 0x44, 0x44, 0x33, 0x3d, 0xc0, 0x1a, 0xab, 0xbb, 0xb2, 0x22, 0x22,
+  0x22, 0x26, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x76, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 0xbb,
+  0xbb, 0xba, 0xa1, 0x10, 0x5d, 0x33, 0x33, 0x3c, 0x05, 0x44, 0x44, 0x43, 0x3d, 0xc0, 0x1b, 0xbb,
+  0xbb, 0x22, 0x22, 0x22, 0x66, 0x66, 0x66, 0x76, 0x66, 0x67, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+  0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x77, 0x77,
+  0x76, 0x66, 0x66, 0x66, 0x22, 0x22, 0xbb, 0xbb, 0xba, 0xa1, 0xc3, 0x33, 0x3d, 0x55, 0x44, 0x44,
+  0x33, 0xdc, 0x0a, 0xbb, 0xb2, 0x22, 0x66, 0x66, 0x66, 0x67, 0x77, 0x7e, 0x77, 0x77, 0xe7, 0x7e,
+  0x77, 0x77, 0xe7, 0x77, 0x7e, 0xee, 0x77, 0x77, 0xe7, 0x77, 0x77, 0x77, 0x77, 0xee, 0xee, 0xee,
+  0xee, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x66, 0x62, 0x22, 0xbb, 0xaa, 0x1c,
+  0x33, 0x3d, 0x5c, 0x43, 0x33, 0x3d, 0xc5, 0x1b, 0x22, 0x22, 0x66, 0x67, 0x77, 0x77, 0xee, 0xee,
+  0xee, 0xee, 0xef, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x7e, 0xe7, 0x76,
+  0x66, 0x62, 0x22, 0xbb, 0xa0, 0xdd, 0xdc, 0x5d, 0x4c, 0xd3, 0x3d, 0xc5, 0x1b, 0x22, 0x66, 0x67,
+  0x77, 0x77, 0xee, 0xee, 0xee, 0xf8, 0xf8, 0x8f, 0x8f, 0xff, 0xf8, 0xff, 0x8f, 0xff, 0x88, 0x8f,
+  0xf8, 0xf8, 0x8f, 0xf8, 0x88, 0x88, 0x8f, 0xff, 0x88, 0x88, 0x88, 0xf8, 0x8f, 0x8f, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xfe, 0x77, 0x77, 0x66, 0x22, 0x2b, 0xa0, 0xcc, 0xc5, 0x0d, 0x45, 0xc3, 0xdc,
+  0x50, 0x12, 0x66, 0x66, 0x77, 0x7e, 0xee, 0xee, 0xee, 0xff, 0x88, 0x88, 0x88, 0x88, 0x99, 0x89,
+  0x89, 0x98, 0x88, 0x88, 0x99, 0x88, 0x89, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x98,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x8f, 0xff, 0xff, 0xfe, 0xee, 0x77, 0x76, 0x62, 0x22, 0xb1, 0x5c,
+  0xc5, 0x0d, 0x40, 0xcd, 0xdc, 0x50, 0x12, 0x66, 0x67, 0x77, 0x7e, 0xef, 0xee, 0xff, 0xf8, 0x88,
+  0x99, 0x99, 0x99, 0x98, 0x89, 0x99, 0x98, 0x99, 0x99, 0x98, 0x99, 0x89, 0x98, 0x88, 0x99, 0x98,
+  0x99, 0x99, 0x98, 0x88, 0x99, 0x89, 0x99, 0x98, 0x88, 0x88, 0x88, 0x88, 0xff, 0xfe, 0xee, 0xe7,
+  0x76, 0x66, 0x22, 0x21, 0x55, 0x55, 0x0d, 0x30, 0x5d, 0xc5, 0x00, 0x12, 0x66, 0x67, 0x77, 0xee,
+  0xfe, 0xff, 0xff, 0x88, 0x89, 0x98, 0x89, 0x99, 0x99, 0x88, 0x89, 0x89, 0x99, 0x99, 0x89, 0x99,
+  0x89, 0x98, 0x99, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x88, 0x99, 0x99, 0x99, 0x99, 0x98,
+  0x88, 0x88, 0xff, 0xef, 0xe7, 0x77, 0x76, 0x62, 0x21, 0x55, 0x55, 0x0d, 0xd1, 0x0d, 0xc5, 0x00,
+  0xa2, 0x67, 0x77, 0x77, 0xee, 0xff, 0xff, 0xf8, 0x88, 0x89, 0x99, 0x89, 0x88, 0x99, 0x98, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x99, 0x89, 0x99, 0x98, 0x88, 0x98, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x88, 0x8f, 0xfe, 0xee, 0x77, 0x76, 0x62, 0x21, 0x05, 0x55,
+  0x0d, 0xd1, 0x0c, 0x55, 0x00, 0xa2, 0x67, 0x77, 0x7e, 0xee, 0xef, 0xff, 0xf8, 0x89, 0x98, 0x98,
+  0x89, 0x99, 0x89, 0x89, 0x99, 0x99, 0x99, 0x99, 0x89, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x89,
+  0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x89, 0x88, 0x8f, 0xff, 0xee, 0xe7,
+  0x77, 0x66, 0x21, 0x00, 0x05, 0x0d, 0xca, 0x05, 0x50, 0x00, 0xa2, 0x77, 0x77, 0x7e, 0xee, 0xff,
+  0xff, 0x88, 0x89, 0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x89, 0x99, 0x99,
+  0x99, 0x88, 0x89, 0x99, 0x99, 0x99, 0x99, 0x99, 0x89, 0x89, 0x99, 0x89, 0x99, 0x99, 0x99, 0x88,
+  0x98, 0x88, 0xff, 0xfe, 0xee, 0x77, 0x66, 0x2a, 0x00, 0x05, 0x0d, 0xca, 0x15, 0x50, 0x00, 0xa6,
+  0x77, 0x77, 0xee, 0xee, 0xff, 0xf8, 0x88, 0x89, 0x99, 0x99, 0x98, 0x89, 0x98, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0x89, 0x98, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x89, 0x99,
+  0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0xff, 0xfe, 0xee, 0x77, 0x66, 0x2a, 0x00, 0x00, 0x0d,
+  0x5a, 0x15, 0x50, 0x00, 0xa6, 0x77, 0x77, 0xee, 0xef, 0xff, 0xf8, 0x88, 0x89, 0x98, 0x89, 0x99,
+  0x99, 0x89, 0x89, 0x98, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x99,
+  0x98, 0x99, 0x98, 0x89, 0x99, 0x99, 0x99, 0x99, 0x98, 0x99, 0x98, 0x88, 0x88, 0xee, 0xee, 0x77,
+  0x66, 0x2a, 0x00, 0x00, 0x0d, 0x5b, 0x15, 0x50, 0x01, 0xa6, 0x77, 0x77, 0xee, 0xef, 0xff, 0x88,
+  0x88, 0x89, 0x99, 0x99, 0x89, 0x99, 0x98, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0x98, 0x99, 0x89, 0x99, 0x99, 0x99, 0x98, 0x98, 0x99, 0x99, 0x89, 0x98, 0x98, 0x99,
+  0x88, 0x88, 0xfe, 0xe7, 0x77, 0x66, 0x2a, 0x00, 0x00, 0x0d, 0x5b, 0x15, 0x50, 0x01, 0xa6, 0x77,
+  0x77, 0xee, 0xee, 0xff, 0x88, 0x88, 0x99, 0x98, 0x99, 0x89, 0x98, 0x99, 0x89, 0x99, 0x89, 0x99,
+  0x99, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99, 0x99, 0x98, 0x98, 0x89, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0x89, 0x89, 0x99, 0x99, 0x88, 0x8f, 0xff, 0xee, 0x77, 0x66, 0x2a, 0x00, 0x00, 0x0d, 0x5b,
+  0x1c, 0x50, 0x00, 0xa2, 0x67, 0x77, 0x7e, 0xee, 0xff, 0xf8, 0x88, 0x89, 0x88, 0x99, 0x89, 0x99,
+  0x99, 0x89, 0x98, 0x99, 0x98, 0x99, 0x99, 0x99, 0x98, 0x89, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0x99, 0x98, 0x99, 0x89, 0x98, 0x99, 0x99, 0x98, 0x88, 0x8f, 0xff, 0xe7, 0x77, 0x66,
+  0x6a, 0x00, 0x00, 0x0d, 0x0b, 0x1c, 0x55, 0x00, 0xa2, 0x67, 0x77, 0x77, 0xee, 0xef, 0xff, 0xf8,
+  0x88, 0x99, 0x88, 0x99, 0x89, 0x99, 0x89, 0x99, 0x99, 0x99, 0x89, 0x99, 0x99, 0x98, 0x99, 0x89,
+  0x99, 0x99, 0x98, 0x99, 0x99, 0x99, 0x98, 0x89, 0x99, 0x99, 0x99, 0x98, 0x89, 0x99, 0x88, 0x88,
+  0xff, 0xee, 0xe7, 0x77, 0x62, 0x21, 0x00, 0x50, 0x0d, 0x0b, 0x0c, 0xc5, 0x50, 0xa2, 0x67, 0x77,
+  0x7e, 0xee, 0xff, 0xff, 0xff, 0x88, 0x88, 0x88, 0x99, 0x99, 0x99, 0x98, 0x99, 0x99, 0x99, 0x99,
+  0x89, 0x98, 0x99, 0x88, 0x88, 0x88, 0x88, 0x89, 0x89, 0x99, 0x99, 0x99, 0x88, 0x99, 0x99, 0x99,
+  0x99, 0x99, 0x88, 0x88, 0x8f, 0xff, 0xee, 0x77, 0x76, 0x62, 0x21, 0x00, 0x00, 0x0d, 0x0b, 0x0d,
+  0xc5, 0x50, 0x12, 0x66, 0x77, 0x77, 0x7e, 0xee, 0xee, 0xff, 0xf8, 0x88, 0x88, 0x88, 0x88, 0x89,
+  0x98, 0x88, 0x88, 0x88, 0x99, 0x89, 0x88, 0x99, 0x88, 0x98, 0x99, 0x98, 0x89, 0x98, 0x99, 0x99,
+  0x99, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xff, 0xef, 0xe7, 0x77, 0x66, 0x62, 0x21,
+  0x05, 0x55, 0x0d, 0x5a, 0x03, 0xdc, 0x50, 0x12, 0x66, 0x66, 0x77, 0x7e, 0xee, 0xee, 0xef, 0xff,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x99, 0x88, 0x88, 0x88, 0x98, 0x88, 0x88, 0x88, 0x88, 0x99, 0x88,
+  0x88, 0x88, 0x88, 0x89, 0x98, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xff, 0xee,
+  0xe7, 0x76, 0x66, 0x22, 0x21, 0x05, 0x55, 0x0d, 0x5a, 0x53, 0x3d, 0xc5, 0x12, 0x22, 0x66, 0x67,
+  0x77, 0x77, 0xee, 0xef, 0xfe, 0xef, 0xff, 0xff, 0xf8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0xff, 0xff, 0xff, 0xfe, 0xe7, 0x77, 0x76, 0x66, 0x22, 0xb1, 0x55, 0x55, 0x0d, 0xc1, 0xc4, 0x33,
+  0xdc, 0x1b, 0x22, 0x22, 0x66, 0x67, 0x77, 0x77, 0xee, 0xee, 0xee, 0xef, 0xff, 0xff, 0xff, 0xff,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8f, 0xff, 0x8f, 0x88, 0x8f, 0xf8, 0xf8, 0xf8, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xee, 0xee, 0x77, 0x77, 0x76, 0x66, 0x62, 0x2b, 0xb1, 0x5c,
+  0x55, 0x5d, 0xc0, 0x34, 0x43, 0x3d, 0x5a, 0x22, 0x22, 0x22, 0x66, 0x66, 0x67, 0x77, 0x77, 0xee,
+  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xfe, 0xee, 0xee, 0xee,
+  0xfe, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x7e, 0x7e, 0x77, 0x77, 0x76, 0x66,
+  0x22, 0x22, 0xbb, 0xa0, 0xcc, 0xc5, 0x5d, 0xd5, 0x34, 0x44, 0x33, 0xd5, 0x1b, 0x22, 0x22, 0x22,
+  0x22, 0x66, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+  0x77, 0x77, 0x7e, 0x77, 0x7e, 0xe7, 0xe7, 0xe7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+  0x77, 0x66, 0x66, 0x66, 0x22, 0x22, 0x22, 0xba, 0x0c, 0xcc, 0xdc, 0x5d, 0xd5, 0x44, 0x44, 0x43,
+  0x33, 0xc5, 0x1a, 0xbb, 0x22, 0x22, 0x26, 0x66, 0x66, 0x67, 0x66, 0x67, 0x67, 0x77, 0x66, 0x67,
+  0x77, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x76, 0x77, 0x76, 0x67, 0x67, 0x67, 0x66, 0x67,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x22, 0x22, 0x22, 0x2b, 0xbb, 0xa1, 0x05, 0xdd, 0xdd, 0xdd,
+  0xc3, 0x3c, 0x44, 0x44, 0x44, 0x44, 0x33, 0xdc, 0xc5, 0x55, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
+  0x1a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x11, 0x1a, 0x11, 0x1a, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0x1a, 0xaa, 0xaa, 0xa1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x55,
+  0xcc, 0xdd, 0xd3, 0x33, 0x34, 0x44, 0x3c, 0x34, 0x44, 0x44, 0x44, 0x44, 0x44, 0x33, 0x33, 0x3d,
+  0xdc, 0xcc, 0xc5, 0x55, 0x55, 0x55, 0x50, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x5c,
+  0xcc, 0xcc, 0xcd, 0xdd, 0x33, 0x33, 0x34, 0x44, 0x44, 0x44, 0x44, 0x4d, 0x34, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xdd, 0xdd,
+  0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xd3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x34, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x43, 0x33, 0x34, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43, 0x33, 0x33, 0x33, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xdc, 0xdc, 0xcc, 0xcc, 0x55, 0xcc, 0xcc, 0xcc, 0x55, 0x55, 0xc5, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcd, 0xd3, 0x33, 0x34, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x33, 0x43, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3d, 0xdc, 0x55, 0x55, 0x00,
+  0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xaa, 0x11, 0x1a, 0xaa, 0xaa, 0xa1, 0xaa, 0x11, 0xa1, 0x11, 0x11, 0x11, 0x11,
+  0x10, 0x00, 0x05, 0x55, 0xcd, 0xd3, 0x33, 0x44, 0x33, 0xd3, 0x43, 0x33, 0x3d, 0xdd, 0xdc, 0xcc,
+  0x55, 0x00, 0x01, 0x11, 0x11, 0x1a, 0xaa, 0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+  0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0xaa, 0x11, 0x11, 0x00, 0x55, 0xcd, 0xd3, 0x33, 0x3d, 0xd4, 0x43,
+  0x33, 0xdd, 0xdc, 0xc5, 0x55, 0x00, 0x01, 0x11, 0x1a, 0xaa, 0xab, 0xab, 0xbb, 0xbb, 0xbb, 0x22,
+  0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+  0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2b, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0x11, 0x11, 0x00, 0x55,
+  0xcd, 0xdd, 0xdc, 0xd4, 0x44, 0x3d, 0xdd, 0xdc, 0xc5, 0x50, 0x00, 0x11, 0x11, 0xaa, 0xab, 0xbb,
+  0xbb, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x66, 0x66, 0x66, 0x62, 0x26,
+  0x66, 0x66, 0x66, 0x66, 0x62, 0x66, 0x66, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xbb, 0xba,
+  0xaa, 0xaa, 0x11, 0x00, 0x55, 0x5c, 0xcd, 0xdd, 0x44, 0x44, 0x43, 0x3d, 0xdd, 0xcc, 0x55, 0x00,
+  0x11, 0x11, 0xaa, 0xaa, 0xbb, 0xb2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x62, 0x22, 0x22, 0x22, 0x26, 0x26, 0x66, 0x66, 0x66, 0x22, 0x22, 0x22,
+  0x22, 0x22, 0xbb, 0xbb, 0xba, 0xaa, 0x11, 0x10, 0x00, 0x55, 0xcc, 0xdd, 0x34, 0x44, 0x44, 0x44,
+  0x43, 0x3d, 0xdd, 0xcc, 0x55, 0x00, 0x11, 0x11, 0xaa, 0xaa, 0xbb, 0xbb, 0xb2, 0x22, 0x22, 0x22,
+  0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+  0x22, 0x22, 0x22, 0x22, 0x22, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0x11, 0x10, 0x05, 0x5c, 0xcc, 0xd3,
+  0x34, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43, 0x33, 0x3d, 0xdd, 0xcc, 0xcc, 0xcc, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xcc, 0xcc, 0x33,
+  0x33, 0x33, 0x34, 0x44, 0x44, 0x44, 0x44, 0x44
+};
+
+const lv_img_dsc_t button_4_106x40_i4 = {
+  .header.cf = LV_IMG_CF_INDEXED_4BIT,
+  .header.always_zero = 0,
+  .header.reserved = 0,
+  .header.w = 106,
+  .header.h = 40,
+  .data_size = 2184,
+  .data = button_4_106x40_i4_map,
+};
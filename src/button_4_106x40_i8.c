@@ -0,0 +1,347 @@
+#include <lvgl.h>
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN uint8_t button_4_106x40_i8_map[] = {
+  0xef, 0xeb, 0xef, 0x23, 0xef, 0xeb, 0xef, 0x24, 0xf7, 0xf3, 0xf7, 0x23, 0xe7, 0xe3, 0xe7, 0x23,
+  0x00, 0x04, 0x00, 0xbb, 0xce, 0xcc, 0xce, 0x2f, 0xde, 0xdb, 0xde, 0x23, 0xe7, 0xe3, 0xe7, 0x22,
+  0xbd, 0xba, 0xbd, 0x36, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x1c, 0x18, 0x9b, 0xef, 0xef, 0xef, 0x20,
+  0x00, 0x00, 0x00, 0xc8, 0xf7, 0xf7, 0xf7, 0x1a, 0xce, 0xcb, 0xce, 0x2b, 0xce, 0xcf, 0xce, 0x2b,
+  0x6c, 0x6a, 0x6c, 0x65, 0x6b, 0x67, 0x6b, 0x65, 0xf7, 0xf7, 0xf7, 0x19, 0xbd, 0xba, 0xbd, 0x35,
+  0xd6, 0xd7, 0xd6, 0x24, 0xde, 0xdb, 0xde, 0x24, 0x0e, 0x0f, 0x0e, 0xbb, 0x06, 0x08, 0x06, 0xd8,
+  0x42, 0x3f, 0x42, 0x82, 0xc6, 0xc5, 0xc6, 0x2e, 0xde, 0xdb, 0xde, 0x28, 0x9c, 0x9c, 0x9c, 0x48,
+  0x52, 0x55, 0x52, 0x72, 0xd6, 0xd3, 0xd6, 0x2d, 0x25, 0x28, 0x25, 0x94, 0xd6, 0xd3, 0xd6, 0x2c,
+  0xf7, 0xf7, 0xf7, 0x1d, 0xf7, 0xf6, 0xf7, 0x21, 0x00, 0x02, 0x00, 0xba, 0xc6, 0xc3, 0xc6, 0x32,
+  0x10, 0x16, 0x10, 0xa6, 0xd6, 0xd3, 0xd6, 0x28, 0xb4, 0xb0, 0xb4, 0x3d, 0x5a, 0x5c, 0x5a, 0x6b,
+  0x21, 0x22, 0x21, 0x9c, 0xb5, 0xb3, 0xb5, 0x38, 0xbd, 0xbe, 0xbd, 0x31, 0xc1, 0xbc, 0xc1, 0x32,
+  0xad, 0xaa, 0xad, 0x3a, 0xbd, 0xba, 0xbd, 0x36, 0x6b, 0x69, 0x6b, 0x61, 0x8c, 0x8b, 0x8c, 0x4e,
+  0xa5, 0xa0, 0xa5, 0x42, 0x00, 0x00, 0x00, 0xcf, 0x31, 0x2e, 0x31, 0x8c, 0x00, 0x00, 0x00, 0xc3,
+  0xa5, 0xa6, 0xa5, 0x3f, 0x94, 0x8f, 0x94, 0x4a, 0x94, 0x95, 0x94, 0x49, 0x00, 0x08, 0x00, 0xdb,
+  0x29, 0x2c, 0x29, 0x95, 0xbd, 0xc3, 0xbd, 0x35, 0xc6, 0xc3, 0xc6, 0x31, 0xa5, 0xa1, 0xa5, 0x46,
+  0x4e, 0x4c, 0x4e, 0x7c, 0x31, 0x33, 0x31, 0x8a, 0x31, 0x30, 0x31, 0x8f, 0x00, 0x00, 0x00, 0xee,
+  0x00, 0x00, 0x00, 0xf3, 0xbd, 0xbe, 0xbd, 0x34, 0xc5, 0xbb, 0xc5, 0x36, 0xd6, 0xd3, 0xd6, 0x29,
+  0xd6, 0xd7, 0xd6, 0x2a, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0xa4,
+  0x18, 0x14, 0x18, 0xa9, 0xa5, 0xa6, 0xa5, 0x3d, 0xad, 0xae, 0xad, 0x39, 0xf7, 0xf7, 0xf7, 0x1c,
+  0xff, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0xca, 0x09, 0x0c, 0x09, 0xc3, 0x94, 0x8f, 0x94, 0x4e,
+  0x18, 0x1a, 0x18, 0xa0, 0x18, 0x1d, 0x18, 0xa2, 0x39, 0x38, 0x39, 0x88, 0x39, 0x38, 0x39, 0x8b,
+  0x1f, 0x23, 0x1f, 0x95, 0x18, 0x1c, 0x18, 0x9e, 0x00, 0x02, 0x00, 0xdd, 0x02, 0x02, 0x02, 0xde,
+  0xf7, 0xf3, 0xf7, 0x22, 0xf7, 0xf3, 0xf7, 0x24, 0xad, 0xa9, 0xad, 0x3e, 0xad, 0xac, 0xad, 0x3f,
+  0x31, 0x34, 0x31, 0x8e, 0x37, 0x34, 0x37, 0x8d, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x00, 0xfb,
+  0x63, 0x65, 0x63, 0x68, 0x86, 0x88, 0x86, 0x4f, 0x8c, 0x8a, 0x8c, 0x4d, 0xc9, 0xcc, 0xc9, 0x2e,
+  0xce, 0xcb, 0xce, 0x2c, 0xf7, 0xf7, 0xf7, 0x20, 0xf8, 0xf8, 0xf8, 0x22, 0xef, 0xee, 0xef, 0x1c,
+  0xef, 0xef, 0xef, 0x1e, 0xad, 0xae, 0xad, 0x3c, 0xc6, 0xc3, 0xc6, 0x2d, 0x63, 0x60, 0x63, 0x68,
+  0x2b, 0x29, 0x2b, 0x96, 0x31, 0x2f, 0x31, 0x90, 0xad, 0xaa, 0xad, 0x45, 0xad, 0xa9, 0xad, 0x3a,
+  0xad, 0xae, 0xad, 0x38, 0xef, 0xeb, 0xef, 0x22, 0xef, 0xef, 0xef, 0x21, 0xde, 0xdd, 0xde, 0x27,
+  0xe1, 0xde, 0xe1, 0x28, 0xd1, 0xcf, 0xd1, 0x2c, 0xd6, 0xd7, 0xd6, 0x2b, 0xa5, 0xa2, 0xa5, 0x41,
+  0xf7, 0xf3, 0xf7, 0x17, 0xf7, 0xf7, 0xf7, 0x18, 0x18, 0x18, 0x18, 0xa6, 0x18, 0x18, 0x18, 0xa9,
+  0xad, 0xa6, 0xad, 0x42, 0xad, 0xaa, 0xad, 0x44, 0x4a, 0x4b, 0x4a, 0x7c, 0x4a, 0x4e, 0x4a, 0x7c,
+  0xd6, 0xd7, 0xd6, 0x27, 0xd6, 0xd7, 0xd6, 0x2c, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0xea,
+  0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00, 0xbe, 0x08, 0x04, 0x08, 0xb8,
+  0x00, 0x00, 0x00, 0xd9, 0x06, 0x07, 0x06, 0xd7, 0x68, 0x6c, 0x68, 0x63, 0x6b, 0x6d, 0x6b, 0x63,
+  0xbd, 0xc5, 0xbd, 0x31, 0xc6, 0xc7, 0xc6, 0x2c, 0x63, 0x65, 0x63, 0x66, 0x6b, 0x65, 0x6b, 0x61,
+  0x9a, 0x9c, 0x9a, 0x42, 0x9c, 0x9e, 0x9c, 0x43, 0x21, 0x20, 0x21, 0x97, 0x21, 0x24, 0x21, 0x9a,
+  0xb5, 0xb6, 0xb5, 0x3a, 0x39, 0x3c, 0x39, 0x82, 0x3e, 0x41, 0x3e, 0x7e, 0xbd, 0xb6, 0xbd, 0x38,
+  0x6f, 0x6f, 0x6f, 0x5c, 0x73, 0x70, 0x73, 0x5d, 0xc6, 0xc7, 0xc6, 0x2f, 0xc6, 0xc7, 0xc6, 0x31,
+  0x17, 0x1b, 0x17, 0x99, 0x10, 0x18, 0x10, 0xa3, 0x45, 0x46, 0x45, 0x7e, 0x42, 0x43, 0x42, 0x82,
+  0x3b, 0x3c, 0x3b, 0x85, 0x3a, 0x3b, 0x3a, 0x89, 0xb5, 0xbc, 0xb5, 0x33, 0xbd, 0xb6, 0xbd, 0x37,
+  0x4a, 0x4b, 0x4a, 0x78, 0x4a, 0x4d, 0x4a, 0x78, 0x29, 0x2b, 0x29, 0x90, 0x29, 0x30, 0x29, 0x8d,
+  0x31, 0x34, 0x31, 0x8c, 0x39, 0x34, 0x39, 0x8a, 0x38, 0x38, 0x38, 0x84, 0x39, 0x34, 0x39, 0x87,
+  0x00, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x00, 0xe4, 0x0f, 0x12, 0x0f, 0xa8, 0x10, 0x14, 0x10, 0xaa,
+  0xb5, 0xb5, 0xb5, 0x34, 0xb5, 0xb2, 0xb5, 0x37, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x06, 0x00, 0xc4,
+  0x73, 0x75, 0x73, 0x5a, 0x7b, 0x78, 0x7b, 0x58, 0x08, 0x0c, 0x08, 0xaf, 0x0e, 0x10, 0x0e, 0xac,
+  0x9b, 0x97, 0x9b, 0x48, 0x9c, 0x9a, 0x9c, 0x48, 0x5a, 0x61, 0x5a, 0x6c, 0x63, 0x60, 0x63, 0x6b,
+  0x05, 0x08, 0x05, 0xb5, 0x08, 0x0c, 0x08, 0xb1, 0x07, 0x08, 0x07, 0xb1, 0x08, 0x08, 0x08, 0xb3,
+  0x29, 0x28, 0x29, 0x94, 0x29, 0x2b, 0x29, 0x93, 0x73, 0x74, 0x73, 0x5d, 0x75, 0x73, 0x75, 0x5f,
+  0x50, 0x50, 0x50, 0x73, 0x52, 0x51, 0x52, 0x74, 0x9d, 0xa0, 0x9d, 0x46, 0xa5, 0xa1, 0xa5, 0x43,
+  0x00, 0x02, 0x00, 0xdb, 0x00, 0x04, 0x00, 0xdc, 0x00, 0x00, 0x00, 0xd1, 0x02, 0x07, 0x02, 0xcd,
+  0xad, 0xa9, 0xad, 0x3c, 0xad, 0xae, 0xad, 0x3a, 0x00, 0x04, 0x00, 0xb7, 0x08, 0x04, 0x08, 0xb6,
+  0xa5, 0xa8, 0xa5, 0x41, 0xad, 0xaa, 0xad, 0x3d, 0x6b, 0x69, 0x6b, 0x63, 0x73, 0x69, 0x73, 0x60,
+  0x6b, 0x6e, 0x6b, 0x60, 0x71, 0x6d, 0x71, 0x60, 0x21, 0x1c, 0x21, 0xa1, 0x21, 0x20, 0x21, 0x9e,
+  0x5a, 0x57, 0x5a, 0x70, 0x5a, 0x5a, 0x5a, 0x70, 0xb4, 0xae, 0xb4, 0x38, 0xb5, 0xae, 0xb5, 0x3a,
+  0x42, 0x43, 0x42, 0x7e, 0x42, 0x47, 0x42, 0x7d, 0x81, 0x82, 0x81, 0x53, 0x7c, 0x80, 0x7c, 0x58,
+  0x8c, 0x8e, 0x8c, 0x4f, 0x94, 0x92, 0x94, 0x4c, 0x0d, 0x10, 0x0d, 0xad, 0x10, 0x14, 0x10, 0xad,
+  0x31, 0x2e, 0x31, 0x92, 0x32, 0x2c, 0x32, 0x93, 0x0b, 0x0c, 0x0b, 0xb3, 0x10, 0x12, 0x10, 0xb2,
+  0xa4, 0xa0, 0xa4, 0x40, 0xa5, 0xa2, 0xa5, 0x40, 0x62, 0x64, 0x62, 0x64, 0x63, 0x65, 0x63, 0x65,
+  0x3f, 0x3f, 0x3f, 0x86, 0x42, 0x43, 0x42, 0x85, 0xb4, 0xb6, 0xb4, 0x38, 0xb5, 0xb2, 0xb5, 0x39,
+  0x87, 0x85, 0x87, 0x54, 0x8c, 0x87, 0x8c, 0x53, 0x84, 0x84, 0x84, 0x54, 0x84, 0x89, 0x84, 0x53,
+  0x4a, 0x4a, 0x4a, 0x7b, 0x52, 0x4f, 0x52, 0x77, 0x9c, 0x99, 0x9c, 0x45, 0x9c, 0x9e, 0x9c, 0x44,
+  0xce, 0xcf, 0xce, 0x2a, 0xd6, 0xd3, 0xd6, 0x26, 0x7b, 0x7c, 0x7b, 0x57, 0x7b, 0x79, 0x7b, 0x5b,
+  0x04, 0x07, 0x04, 0xbb, 0x06, 0x07, 0x06, 0xbf, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0xce,
+  0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x5e, 0x40, 0x40, 0x3f, 0x3f, 0x3f, 0x3f,
+  0x3f, 0x83, 0x83, 0x83, 0x82, 0xad, 0xad, 0xad, 0xad, 0xad, 0xac, 0x56, 0xc9, 0xc9, 0xc9, 0xc9,
+  0xc9, 0xc9, 0xc9, 0xc9, 0x17, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0x56, 0xac, 0xac, 0xac, 0xac, 0xac,
+  0xac, 0xac, 0xac, 0x56, 0xc9, 0x37, 0x37, 0x17, 0x17, 0x17, 0x17, 0x17, 0x89, 0x89, 0x89, 0x89,
+  0x89, 0x89, 0x17, 0x17, 0x37, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9,
+  0xc9, 0xc9, 0xc9, 0xc9, 0x37, 0x17, 0x17, 0x17, 0xc9, 0x89, 0xc9, 0xc9, 0x56, 0xac, 0xac, 0xad,
+  0xad, 0xad, 0xac, 0xac, 0x40, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46,
+  0x45, 0x40, 0xad, 0x88, 0xca, 0xfe, 0xb2, 0x09, 0x09, 0x09, 0x04, 0xce, 0xce, 0xb6, 0xb6, 0xae,
+  0x9d, 0x50, 0x55, 0x0a, 0x92, 0xc0, 0xc0, 0x32, 0xa7, 0xa7, 0x32, 0x3d, 0xab, 0xab, 0xab, 0xab,
+  0xaa, 0x95, 0x95, 0xaa, 0xaa, 0x95, 0xaa, 0xab, 0x3d, 0x3d, 0x3d, 0x32, 0x3d, 0x3d, 0x52, 0x95,
+  0x95, 0x18, 0xaa, 0x18, 0x95, 0x18, 0x95, 0x18, 0x18, 0x18, 0x18, 0x95, 0x18, 0x95, 0x95, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0xab, 0xab, 0x3d, 0x32, 0x32, 0x32, 0x32, 0xa6, 0x32, 0xa6,
+  0xc0, 0x92, 0xd7, 0x55, 0x50, 0xae, 0xb6, 0xbe, 0xcf, 0xce, 0x22, 0x22, 0xce, 0xb6, 0x51, 0x38,
+  0x16, 0x3f, 0x46, 0x40, 0x46, 0x46, 0x46, 0x46, 0x46, 0x5f, 0x3f, 0xad, 0x56, 0x88, 0x84, 0x31,
+  0x4d, 0xb2, 0x86, 0xbf, 0xbd, 0xbd, 0xe3, 0x7a, 0x51, 0x28, 0x6c, 0x38, 0x38, 0xe5, 0xe4, 0x5c,
+  0x5d, 0x53, 0x53, 0x53, 0xa1, 0xec, 0xed, 0xed, 0x18, 0x9f, 0x9f, 0x9f, 0xdd, 0xf4, 0xf4, 0x7f,
+  0xf5, 0xf5, 0xf5, 0x3c, 0xf5, 0x7f, 0x7f, 0x7f, 0xa5, 0xa5, 0xa5, 0xa5, 0xf5, 0xf5, 0xa5, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0xf4, 0x9f, 0x9f,
+  0x9f, 0xed, 0xa0, 0xa1, 0x53, 0x53, 0x53, 0x5c, 0x5c, 0x38, 0x28, 0xd7, 0x51, 0x7b, 0xaf, 0xbd,
+  0x04, 0x04, 0x09, 0x09, 0x0c, 0x4d, 0x31, 0xfe, 0x09, 0x47, 0x1c, 0xa5, 0xbc, 0x85, 0x46, 0x46,
+  0x46, 0x46, 0x46, 0x5e, 0x82, 0xac, 0x88, 0xca, 0xfe, 0xb2, 0xbf, 0x47, 0xc0, 0x95, 0xdd, 0xf4,
+  0xa5, 0xc5, 0x1c, 0xd9, 0x27, 0x27, 0x27, 0x6b, 0x6b, 0xea, 0x8f, 0x2e, 0x2e, 0x2e, 0x8f, 0x8f,
+  0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0xd4, 0x99, 0x99, 0xd5, 0xd5, 0xd5, 0xd4, 0xd4, 0xd3, 0xd5, 0x99,
+  0x99, 0x99, 0xb4, 0xfb, 0xb5, 0xb5, 0xb5, 0xb5, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0x99,
+  0x99, 0x99, 0xd4, 0x2e, 0x2e, 0x2e, 0xd2, 0xeb, 0xea, 0x8e, 0x6b, 0xba, 0x27, 0x27, 0xd9, 0xd9,
+  0xd9, 0x1c, 0x1c, 0xf5, 0xa4, 0xdc, 0x95, 0x52, 0x32, 0xa6, 0x93, 0x47, 0xbf, 0x33, 0xfe, 0x31,
+  0x84, 0x85, 0x88, 0x88, 0x87, 0xa5, 0xc2, 0xb3, 0x46, 0x46, 0x46, 0x46, 0x5f, 0x83, 0xac, 0x85,
+  0xff, 0x09, 0x48, 0x3d, 0xd8, 0x99, 0xdf, 0xf2, 0xf2, 0xe0, 0x36, 0xb9, 0x1b, 0xc7, 0x5b, 0x34,
+  0x5a, 0x69, 0x69, 0xef, 0x94, 0x94, 0x94, 0x94, 0x41, 0x41, 0x08, 0x41, 0x13, 0x13, 0x13, 0x13,
+  0x13, 0x13, 0x08, 0x08, 0x08, 0xef, 0xee, 0x08, 0x08, 0x08, 0xa3, 0x08, 0x08, 0x08, 0x13, 0x13,
+  0x42, 0x13, 0xb0, 0xb0, 0xb0, 0x13, 0x41, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x94, 0xef, 0xef,
+  0xef, 0xef, 0xdb, 0x69, 0xcc, 0xd1, 0x69, 0x5a, 0x34, 0x34, 0xc7, 0xf7, 0xf7, 0xb9, 0x36, 0xe1,
+  0xe0, 0x2f, 0xf2, 0xfa, 0xfb, 0x6b, 0xd8, 0xdc, 0x28, 0xb3, 0x84, 0x85, 0x85, 0x85, 0x84, 0xe7,
+  0xdd, 0xc0, 0x46, 0x46, 0x46, 0x46, 0x40, 0x56, 0xca, 0xb2, 0xbf, 0xe4, 0x60, 0xf2, 0xf2, 0x2f,
+  0xe1, 0xb8, 0xf6, 0x91, 0x77, 0x34, 0xd1, 0x2c, 0x29, 0x29, 0xef, 0x08, 0xb0, 0xa2, 0x3a, 0x2a,
+  0x2a, 0x2a, 0x2a, 0x23, 0x23, 0x9a, 0x8d, 0x8d, 0x8d, 0x8d, 0x3a, 0x8d, 0x8d, 0x8d, 0x6a, 0x23,
+  0x8d, 0x8d, 0x64, 0x8d, 0x8d, 0x64, 0x8d, 0x64, 0x8d, 0x8d, 0x64, 0x8d, 0x6a, 0x6a, 0x6a, 0x6a,
+  0x9a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x9a, 0x3a, 0x23, 0x23, 0x23, 0x2a, 0x3a, 0x3a, 0x3a, 0x3a,
+  0x3a, 0x13, 0x2a, 0x13, 0xee, 0xa3, 0xa3, 0x29, 0x4a, 0x5a, 0xe9, 0x91, 0x36, 0xe1, 0xe0, 0xf2,
+  0xf2, 0xfb, 0xd5, 0xa4, 0xb7, 0xfe, 0xff, 0xfe, 0xff, 0x33, 0xc0, 0x93, 0x46, 0x45, 0x40, 0x40,
+  0x56, 0xff, 0x09, 0xbd, 0xe4, 0xd4, 0xe1, 0xe0, 0x36, 0xf6, 0x77, 0x5a, 0xef, 0xee, 0xee, 0xa2,
+  0x13, 0x41, 0x41, 0x9a, 0x8d, 0x0f, 0x05, 0x1f, 0x0f, 0x0f, 0x0f, 0x0f, 0x76, 0x0f, 0x0f, 0x1f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x1f, 0x0f, 0x0f, 0x0f, 0x0f, 0x44, 0x44, 0x1f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x25, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x9a,
+  0x6a, 0x9a, 0x3a, 0x41, 0x08, 0xdb, 0x29, 0xcc, 0xe9, 0xf7, 0x35, 0x61, 0xfa, 0xfb, 0x1c, 0xb7,
+  0xfe, 0x0c, 0x0c, 0x04, 0xc0, 0xbf, 0x45, 0x88, 0xff, 0xac, 0x31, 0x09, 0xbf, 0x51, 0xf4, 0xf1,
+  0xe8, 0x3b, 0xe9, 0x2c, 0xdb, 0x41, 0x41, 0x3a, 0x9a, 0x3a, 0x63, 0x64, 0x1f, 0x1f, 0x44, 0x80,
+  0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x03, 0x1a, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+  0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x06, 0x15, 0x15, 0x15, 0x15, 0x15,
+  0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+  0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x25, 0x1a, 0x43, 0x80, 0x0f, 0x1f, 0x1f, 0x64, 0x9a, 0x2a,
+  0x13, 0xee, 0xdb, 0x2c, 0x5a, 0xf7, 0xe1, 0xf1, 0xd4, 0xa7, 0x04, 0x86, 0x86, 0xb6, 0xa6, 0x09,
+  0x5f, 0xbe, 0x04, 0x84, 0x0c, 0xce, 0x48, 0x6c, 0x1c, 0x36, 0x69, 0x69, 0xb1, 0x08, 0x13, 0x3a,
+  0x8d, 0x64, 0x0e, 0x0f, 0x76, 0x44, 0x43, 0x15, 0x15, 0x06, 0x07, 0x71, 0x07, 0x71, 0x71, 0x03,
+  0x71, 0x03, 0x03, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x03,
+  0x03, 0x00, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x71, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x03, 0x03, 0x07, 0x73, 0x73, 0x73, 0x44, 0x0f, 0x64, 0x63, 0x23, 0x13, 0xee, 0xcd, 0x34,
+  0xf7, 0xe1, 0xfa, 0xdc, 0xe3, 0xbf, 0xbe, 0x7b, 0x3e, 0x09, 0x5e, 0x93, 0xaf, 0x4d, 0x09, 0xb6,
+  0x50, 0x3e, 0x27, 0xf6, 0xee, 0xb1, 0x08, 0x41, 0x05, 0x0e, 0xf8, 0x44, 0x1f, 0x76, 0x80, 0x06,
+  0x06, 0x06, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x01, 0x02,
+  0x01, 0x59, 0x02, 0x01, 0x01, 0x01, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x01, 0x02, 0x02, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x07, 0x14, 0x81, 0x76, 0xf8, 0x64, 0x3a, 0x41, 0x08, 0x4a, 0x5a, 0xf6, 0x4f, 0xd8, 0xd6, 0xaf,
+  0x24, 0xd6, 0x3e, 0x86, 0x83, 0x5c, 0x9d, 0x33, 0x04, 0x48, 0x93, 0x3d, 0x6b, 0xc7, 0xa3, 0x08,
+  0x41, 0x3a, 0x0e, 0x0e, 0x0f, 0x81, 0x1a, 0x03, 0x06, 0x06, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00,
+  0x02, 0x02, 0x59, 0x02, 0x02, 0x59, 0x02, 0x72, 0x0b, 0x59, 0x65, 0x20, 0x02, 0x0b, 0x20, 0x65,
+  0x02, 0x59, 0x21, 0x72, 0x02, 0x59, 0x0b, 0x58, 0x02, 0x0b, 0x00, 0x00, 0x02, 0x02, 0x02, 0x0b,
+  0x21, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x59, 0x02, 0x01, 0x59, 0x02, 0x02, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x06, 0x14, 0x1a, 0x1f, 0x0e,
+  0x0e, 0x2a, 0x41, 0xa3, 0x69, 0x77, 0xf7, 0x27, 0x93, 0x50, 0xd6, 0x93, 0x3e, 0x33, 0x88, 0x18,
+  0x93, 0x86, 0xbf, 0x51, 0xe4, 0xa0, 0x60, 0x7c, 0x08, 0x13, 0x2a, 0x64, 0x0e, 0x0f, 0x81, 0x80,
+  0x07, 0x06, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x02, 0x02, 0x72, 0x0b, 0x02, 0x02, 0x65,
+  0x59, 0x02, 0x0b, 0x68, 0x67, 0x78, 0x67, 0x12, 0x79, 0x0d, 0x59, 0x65, 0x67, 0x4b, 0x59, 0x21,
+  0x68, 0x58, 0x02, 0x68, 0x02, 0x66, 0x72, 0x0b, 0x59, 0x21, 0x58, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x20, 0x68, 0x72, 0x0b, 0x21, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x06, 0x73, 0x76, 0x0f, 0x0f, 0x64, 0x9a, 0x39, 0x29, 0x5a,
+  0xf7, 0xba, 0x38, 0x93, 0x93, 0xc0, 0xe4, 0xb2, 0xb2, 0x1c, 0x3e, 0x87, 0xb7, 0x93, 0xa9, 0xed,
+  0x8b, 0x5a, 0x13, 0x3a, 0x9a, 0x0e, 0x0f, 0x0f, 0x44, 0x14, 0x07, 0x03, 0x03, 0x03, 0x03, 0x00,
+  0x00, 0x00, 0x01, 0x02, 0x59, 0x0d, 0x68, 0x02, 0x00, 0x0b, 0x65, 0x58, 0x02, 0x0b, 0x0d, 0x12,
+  0x12, 0x12, 0x12, 0x0d, 0x4b, 0x79, 0x12, 0x79, 0x0d, 0x12, 0x79, 0x58, 0x02, 0x0b, 0x02, 0x59,
+  0x0b, 0x20, 0x58, 0x02, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x59, 0x4c, 0x78, 0x79, 0x12, 0x79,
+  0x21, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x03, 0x06, 0x80, 0x1f, 0x0f, 0x0e, 0x9a, 0x13, 0x29, 0x69, 0xc6, 0xba, 0x5c, 0xc1, 0x38, 0xa6,
+  0xa8, 0xb2, 0x04, 0x60, 0xaa, 0xb7, 0x48, 0xc0, 0x52, 0x18, 0xd4, 0x69, 0x13, 0x3a, 0x9a, 0x0e,
+  0x0f, 0x76, 0x1a, 0x14, 0x06, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x02, 0x65, 0x72, 0x02, 0x01,
+  0x0b, 0x02, 0x59, 0x02, 0x68, 0x4b, 0x67, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x79, 0x12,
+  0x67, 0x20, 0x20, 0x20, 0x58, 0x02, 0x02, 0x59, 0x59, 0x59, 0x58, 0x68, 0x20, 0x72, 0x01, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x59, 0x21, 0x0d, 0x67, 0x58, 0x02, 0x02, 0x59, 0x59, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x06, 0x1a, 0x1f, 0x0f,
+  0x0e, 0x3a, 0x08, 0xb1, 0x91, 0x6b, 0x52, 0x3e, 0xe5, 0xa6, 0x52, 0x33, 0xbd, 0xc3, 0xdc, 0x7a,
+  0x51, 0x3e, 0x18, 0x7e, 0x99, 0x2c, 0x3a, 0x05, 0x0e, 0x0e, 0x0f, 0x81, 0x80, 0x06, 0x03, 0x03,
+  0x03, 0x03, 0x00, 0x00, 0x00, 0x02, 0x58, 0x58, 0x59, 0x4b, 0x78, 0x58, 0x65, 0x67, 0x0d, 0x59,
+  0x20, 0x79, 0x12, 0x12, 0x12, 0x12, 0x12, 0x4c, 0x0d, 0x58, 0x00, 0x59, 0x59, 0x58, 0x58, 0x02,
+  0x02, 0x02, 0x0b, 0x72, 0x0b, 0x0d, 0x4b, 0x21, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x59,
+  0x72, 0x0d, 0x72, 0x59, 0x02, 0x65, 0x0b, 0x0d, 0x0d, 0x4b, 0x58, 0x59, 0x66, 0x59, 0x72, 0x67,
+  0x58, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x06, 0x1a, 0x1f, 0x0e, 0x9b, 0xb0, 0xa3, 0x77, 0x11,
+  0x18, 0xa8, 0x3e, 0xa6, 0x95, 0x04, 0xae, 0xfb, 0xa5, 0x47, 0x50, 0x5c, 0x9f, 0x7e, 0x99, 0x70,
+  0x3a, 0x05, 0x0e, 0x0f, 0x1f, 0x1a, 0x14, 0x06, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x02, 0x02, 0x59, 0x0d, 0x79, 0x00, 0x0b, 0x12, 0x12, 0x68, 0x0d, 0x12, 0x79, 0x79, 0x79, 0x12,
+  0x12, 0x4c, 0x4b, 0x59, 0x02, 0x02, 0x59, 0x0d, 0x0b, 0x59, 0x59, 0x67, 0x79, 0x79, 0x79, 0x4c,
+  0x20, 0x59, 0x59, 0x59, 0x59, 0x02, 0x58, 0x20, 0x59, 0x02, 0x59, 0x4c, 0x68, 0x59, 0x02, 0x0d,
+  0x79, 0x12, 0x12, 0x79, 0x0d, 0x4b, 0x0d, 0x58, 0x4b, 0x79, 0x21, 0x02, 0x00, 0x00, 0x03, 0x03,
+  0x03, 0x06, 0x43, 0x1f, 0x0e, 0x9b, 0xb0, 0xa3, 0x34, 0xd4, 0xed, 0xa9, 0xa9, 0x3e, 0x9f, 0x04,
+  0xd6, 0xdf, 0xc4, 0x47, 0xd7, 0x5c, 0x9f, 0xf4, 0xb4, 0xee, 0x3a, 0x05, 0x0e, 0x0f, 0x1f, 0x80,
+  0x06, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x01, 0x0d, 0x78, 0x21,
+  0x59, 0x02, 0x68, 0x79, 0x67, 0x12, 0x4b, 0x0b, 0x20, 0x0d, 0x79, 0x0d, 0x59, 0x02, 0x02, 0x02,
+  0x02, 0x65, 0x58, 0x02, 0x20, 0x4c, 0x12, 0x12, 0x12, 0x12, 0x12, 0x4b, 0x20, 0x68, 0x20, 0x02,
+  0x58, 0x68, 0x59, 0x02, 0x02, 0x0b, 0x72, 0x02, 0x02, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x79,
+  0x78, 0x0b, 0x59, 0x0d, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xf9, 0x1a, 0x1f, 0x0f, 0x9b,
+  0x2a, 0xee, 0x69, 0xd4, 0x18, 0x53, 0xa8, 0x5d, 0x9f, 0x04, 0x93, 0xf2, 0xc5, 0xd6, 0xd7, 0x5c,
+  0x9f, 0xf4, 0xb4, 0x29, 0x3a, 0x05, 0x0f, 0x0f, 0x1f, 0x80, 0x06, 0x03, 0x03, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x02, 0x59, 0x59, 0x0d, 0x67, 0x21, 0x02, 0x02, 0x59, 0x72, 0x0d, 0x4b,
+  0x0d, 0x58, 0x20, 0x79, 0x12, 0x4c, 0x65, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x12, 0x12,
+  0x12, 0x12, 0x79, 0x0d, 0x65, 0x67, 0x78, 0x78, 0x67, 0x02, 0x02, 0x58, 0x02, 0x02, 0x02, 0x02,
+  0x59, 0x68, 0x58, 0x68, 0x12, 0x12, 0x12, 0x79, 0x67, 0x66, 0x0d, 0x0b, 0x65, 0x72, 0x02, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x76, 0x0f, 0x0f, 0x9b, 0xb0, 0xee, 0xd1, 0xd4, 0xed, 0xa1,
+  0xa8, 0x53, 0x18, 0x86, 0x54, 0xf1, 0xc5, 0x51, 0xd7, 0x3e, 0xed, 0x7f, 0x99, 0xef, 0x3a, 0x05,
+  0x0e, 0x0f, 0x1f, 0x1a, 0x06, 0x06, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x59, 0x20, 0x68,
+  0x59, 0x0d, 0x0b, 0x02, 0x02, 0x00, 0x02, 0x59, 0x0b, 0x79, 0x79, 0x20, 0x0b, 0x12, 0x79, 0x4c,
+  0x21, 0x59, 0x59, 0x59, 0x59, 0x59, 0x01, 0x01, 0x58, 0x12, 0x12, 0x12, 0x12, 0x12, 0x78, 0x20,
+  0x58, 0x72, 0x58, 0x72, 0x72, 0x58, 0x02, 0x02, 0x02, 0x02, 0x59, 0x59, 0x02, 0x21, 0x79, 0x0d,
+  0x79, 0x12, 0x0b, 0x02, 0x72, 0x58, 0x59, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x03, 0x03, 0x06,
+  0x1a, 0x1f, 0x0f, 0x9b, 0x08, 0x29, 0x69, 0x2e, 0xa1, 0x52, 0xa8, 0x5c, 0xec, 0x22, 0xc0, 0xf1,
+  0xf5, 0x24, 0x50, 0x6d, 0xa0, 0x7e, 0x99, 0x69, 0x8c, 0x9a, 0x0e, 0x0e, 0x0f, 0x1f, 0x1a, 0x14,
+  0x07, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x72, 0x68, 0x58, 0x65, 0x68, 0x02, 0x02, 0x02,
+  0x02, 0x59, 0x0b, 0x79, 0x12, 0x68, 0x65, 0x0d, 0x12, 0x67, 0x20, 0x4b, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x0b, 0x0b, 0x12, 0x79, 0x12, 0x12, 0x79, 0x4b, 0x66, 0x59, 0x65, 0x12, 0x12, 0x12, 0x0d,
+  0x59, 0x02, 0x59, 0x65, 0x4b, 0x58, 0x59, 0x0b, 0x65, 0x02, 0x68, 0x4b, 0x59, 0x68, 0x0d, 0x58,
+  0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x73, 0x76, 0x0f, 0x0e, 0x3a, 0x08, 0x70,
+  0x26, 0x2e, 0xa9, 0xa8, 0x3e, 0xa7, 0x53, 0x22, 0x6d, 0xe0, 0xa5, 0xb7, 0x47, 0x38, 0xa9, 0x18,
+  0xd4, 0xd0, 0x41, 0x3a, 0x9a, 0x0e, 0x0f, 0x0f, 0x81, 0x43, 0x06, 0x03, 0x03, 0x03, 0x03, 0x00,
+  0x00, 0x00, 0x02, 0x59, 0x00, 0x01, 0x59, 0x02, 0x00, 0x02, 0x02, 0x59, 0x0b, 0x4c, 0x79, 0x12,
+  0x0d, 0x12, 0x12, 0x12, 0x68, 0x0d, 0x4c, 0x79, 0x79, 0x78, 0x4b, 0x68, 0x20, 0x58, 0x68, 0x79,
+  0x12, 0x79, 0x4b, 0x65, 0x20, 0x68, 0x12, 0x12, 0x21, 0x02, 0x02, 0x02, 0x59, 0x0b, 0x0b, 0x02,
+  0x02, 0x59, 0x59, 0x02, 0x02, 0x02, 0x59, 0x0b, 0x0b, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x03, 0x15, 0x1a, 0x1f, 0x0e, 0x0f, 0x3a, 0x08, 0x2c, 0x5b, 0xea, 0x5c, 0x3e, 0xa6, 0x3e,
+  0x5d, 0x22, 0x32, 0x2f, 0xdd, 0xbd, 0xaf, 0x93, 0xa6, 0xa0, 0x8b, 0xd0, 0x41, 0x23, 0x9a, 0x64,
+  0xf8, 0x76, 0x76, 0x1d, 0x73, 0x07, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x68, 0x0d, 0x0d, 0x0d, 0x4c, 0x79, 0x4b, 0x59, 0x59,
+  0x0b, 0x0d, 0x0d, 0x67, 0x0d, 0x0d, 0x67, 0x00, 0x01, 0x72, 0x72, 0x72, 0x72, 0x0b, 0x72, 0x4b,
+  0x67, 0x12, 0x02, 0x02, 0x02, 0x02, 0x02, 0x59, 0x01, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x59, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x07, 0x80, 0x1f, 0x0f, 0x64,
+  0x9a, 0x2a, 0x29, 0x49, 0x5b, 0xea, 0x5c, 0x32, 0xe5, 0x3e, 0x5d, 0x22, 0x32, 0xf1, 0x18, 0x04,
+  0xb6, 0x51, 0x93, 0x53, 0x60, 0xc7, 0xa3, 0x41, 0x3a, 0x9b, 0x8d, 0xf8, 0x0f, 0x76, 0x1a, 0x15,
+  0x14, 0x06, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x02, 0x01, 0x01, 0x01, 0x01, 0x0b, 0x0b, 0x01, 0x02, 0x02, 0x01, 0x59, 0x01, 0x01, 0x59, 0x59,
+  0x01, 0x00, 0x02, 0x01, 0x02, 0x02, 0x59, 0x01, 0x01, 0x59, 0x59, 0x0b, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x03, 0x06, 0x73, 0x44, 0x0f, 0xf8, 0x9a, 0x2a, 0x08, 0x70, 0xcc, 0x91, 0x8e,
+  0xa8, 0xc0, 0x6c, 0xc1, 0xa9, 0x22, 0x1e, 0xfb, 0x3e, 0x0c, 0x04, 0xb6, 0x51, 0xe4, 0xbb, 0x91,
+  0xb1, 0x08, 0x13, 0x8c, 0x3a, 0x64, 0xf8, 0x44, 0x1f, 0x76, 0x76, 0x06, 0x06, 0x03, 0x03, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x02, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x03, 0x07, 0x14, 0x44,
+  0x1f, 0xf8, 0x64, 0x2a, 0x41, 0xa3, 0x2c, 0x34, 0xb8, 0x60, 0x3e, 0x93, 0x6c, 0xc0, 0x3e, 0x22,
+  0xd7, 0x8b, 0xd7, 0x56, 0xfe, 0x86, 0xbd, 0x93, 0x1c, 0xb9, 0x5a, 0xcd, 0x97, 0x13, 0x2a, 0x3a,
+  0x9a, 0x64, 0x0f, 0x0f, 0x76, 0x44, 0x43, 0x07, 0x07, 0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x03, 0x03, 0x07, 0x07, 0x73, 0x73, 0x44, 0x76, 0x0f, 0x0f, 0x05, 0x8c, 0x13, 0xa3, 0x29,
+  0x5a, 0x30, 0xe0, 0x27, 0x38, 0x28, 0x93, 0x6c, 0xe5, 0x22, 0x24, 0xd9, 0xe7, 0x3f, 0x88, 0xfe,
+  0x86, 0xaf, 0x7f, 0x62, 0x77, 0xe9, 0x69, 0x2c, 0xee, 0x08, 0x13, 0x23, 0x9a, 0x64, 0x64, 0x64,
+  0x44, 0x1a, 0x1a, 0x80, 0x06, 0x15, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x03, 0x03, 0x07,
+  0x71, 0x03, 0x71, 0x71, 0x71, 0x03, 0x03, 0x71, 0x03, 0x71, 0x03, 0x71, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x15, 0x15, 0x1a, 0x43, 0x1f,
+  0x0f, 0x0f, 0x0e, 0x0f, 0x9a, 0x2a, 0x13, 0xee, 0xb1, 0xd1, 0x91, 0x36, 0xf2, 0x1c, 0x28, 0x9d,
+  0x51, 0xd7, 0x38, 0x87, 0xb6, 0x95, 0x4d, 0x46, 0x83, 0x88, 0x4d, 0x04, 0xc0, 0xd4, 0xb8, 0xb9,
+  0xf6, 0xe9, 0x5a, 0xcc, 0x29, 0xee, 0x13, 0x41, 0x2a, 0x9b, 0x9a, 0x9a, 0x0f, 0x0f, 0x1f, 0x1f,
+  0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x1a, 0x1a, 0x25, 0x1a, 0x1a,
+  0x1a, 0x1a, 0x25, 0x25, 0x25, 0x25, 0x25, 0x15, 0x03, 0x25, 0x80, 0x15, 0x1a, 0x25, 0x1a, 0x14,
+  0x07, 0x80, 0x15, 0x80, 0x15, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+  0x80, 0x80, 0x80, 0x80, 0xf8, 0x1f, 0x0f, 0x76, 0x64, 0x0e, 0x9a, 0x3a, 0x3a, 0x13, 0x13, 0xb0,
+  0xcd, 0x2c, 0x5a, 0x30, 0x36, 0x36, 0xb5, 0x52, 0x24, 0x48, 0xaf, 0x47, 0x93, 0xce, 0xce, 0xa6,
+  0x88, 0x46, 0x5e, 0x83, 0x88, 0x0c, 0xce, 0x6c, 0xba, 0xe0, 0xb9, 0xf7, 0xf6, 0x91, 0xe9, 0x49,
+  0x5a, 0x2c, 0xda, 0xb1, 0xb1, 0x13, 0x13, 0x2a, 0x9a, 0x9a, 0x8d, 0x63, 0x63, 0x0e, 0x0f, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+  0x0f, 0xf8, 0xf8, 0x0f, 0x0f, 0x44, 0x0f, 0x0f, 0x0f, 0x43, 0x43, 0x0f, 0x43, 0x0f, 0x43, 0x0f,
+  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x8d, 0x8d, 0x8d, 0x8d,
+  0x64, 0x9b, 0x2a, 0x2a, 0x41, 0x08, 0x08, 0x29, 0x2c, 0x2c, 0x91, 0x91, 0xf6, 0xb9, 0xe0, 0xd4,
+  0x32, 0xaf, 0xb6, 0xbd, 0xce, 0xb6, 0x51, 0x09, 0x04, 0xd7, 0x82, 0x46, 0x45, 0x5f, 0x83, 0x56,
+  0xca, 0x0c, 0xbd, 0xa6, 0x1c, 0x99, 0xf3, 0xe1, 0xb9, 0x3b, 0x7c, 0x5b, 0x5b, 0xef, 0xcd, 0x08,
+  0xee, 0xa3, 0x08, 0x42, 0x08, 0x08, 0x08, 0x42, 0x13, 0x42, 0x42, 0x42, 0x08, 0x41, 0x2a, 0x3a,
+  0x3a, 0x3a, 0x3a, 0x8c, 0x3a, 0x3a, 0x05, 0x05, 0x05, 0x05, 0x9a, 0x9b, 0x9b, 0x8c, 0x9b, 0x8c,
+  0x23, 0x41, 0x8c, 0x9b, 0x23, 0x2a, 0x13, 0x23, 0x41, 0x23, 0xb0, 0x23, 0x2a, 0xa2, 0xa2, 0x23,
+  0xa2, 0x13, 0x13, 0x13, 0x08, 0x08, 0x08, 0xa3, 0xee, 0x94, 0x94, 0xdb, 0x69, 0xd1, 0x7c, 0x34,
+  0xc7, 0x3b, 0x1b, 0x36, 0x4f, 0xf2, 0xb4, 0x27, 0x18, 0x47, 0xce, 0x22, 0x86, 0x86, 0x33, 0x09,
+  0xbf, 0x85, 0x4d, 0x48, 0xad, 0x46, 0x45, 0x46, 0x45, 0x5e, 0x3f, 0x82, 0x56, 0x84, 0x33, 0xbd,
+  0x9d, 0x0a, 0x92, 0xa6, 0x32, 0x3d, 0x95, 0xdd, 0xa5, 0xc5, 0xd8, 0x27, 0xbb, 0x6b, 0x60, 0xeb,
+  0xeb, 0xd2, 0x8b, 0x8b, 0xd2, 0xd2, 0x8b, 0x8b, 0x2e, 0x2e, 0x2e, 0xd2, 0xd2, 0xd2, 0x2e, 0x8b,
+  0xeb, 0x8e, 0xeb, 0xd2, 0xeb, 0xeb, 0xeb, 0x11, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0xd4, 0xd3, 0xd5,
+  0xd3, 0xd3, 0xd3, 0xd3, 0x8a, 0x8b, 0xd3, 0xd2, 0x11, 0x11, 0x11, 0xeb, 0x8e, 0x60, 0x6b, 0x27,
+  0x27, 0x1c, 0xc5, 0xc5, 0xc5, 0xc5, 0xa5, 0xa4, 0xdd, 0xdc, 0x18, 0x95, 0x52, 0x32, 0xa6, 0x92,
+  0x9d, 0xb7, 0x04, 0x33, 0xb2, 0xfe, 0x84, 0x85, 0x56, 0x83, 0x83, 0x5e, 0x85, 0xbd, 0x85, 0x5f,
+  0x46, 0x45, 0x46, 0x46, 0x46, 0x45, 0x5e, 0x40, 0x3f, 0x82, 0xac, 0x88, 0x84, 0xfe, 0x0c, 0x09,
+  0x04, 0xbf, 0xb6, 0xb7, 0x24, 0x51, 0x55, 0x28, 0x28, 0x93, 0xc0, 0x93, 0xc1, 0xe5, 0xa6, 0x3e,
+  0x3e, 0x3e, 0xa8, 0xa8, 0xa9, 0x53, 0x53, 0x53, 0x53, 0x53, 0x5c, 0x3e, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x5d, 0x3e, 0xa9, 0x53, 0x53, 0x53, 0x53, 0x53, 0xa9, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
+  0x5c, 0x6d, 0xe4, 0xe5, 0xe5, 0xc1, 0x38, 0x38, 0x38, 0x93, 0xd7, 0x51, 0x51, 0x51, 0x47, 0x24,
+  0xaf, 0xe3, 0xb6, 0xbe, 0xbf, 0x04, 0x04, 0x33, 0x4d, 0xca, 0x84, 0x84, 0x88, 0xad, 0x3f, 0x3f,
+  0x40, 0x5f, 0x45, 0x46, 0x46, 0x46, 0xad, 0x86, 0x31, 0x82, 0x5e, 0x45, 0x46, 0x46, 0x46, 0x46,
+  0x46, 0x46, 0x46, 0x46, 0x45, 0x45, 0x45, 0x5f, 0x5e, 0x40, 0x3f, 0xad, 0xac, 0x56, 0x88, 0x88,
+  0x85, 0x84, 0x84, 0x31, 0xff, 0xff, 0xff, 0x31, 0x4d, 0x0c, 0x0c, 0x0c, 0x33, 0x09, 0x86, 0x04,
+  0xce, 0xce, 0xce, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x86, 0x09, 0x09, 0x09, 0x09, 0x86, 0x86, 0x09, 0x09, 0x86, 0x86, 0x09, 0x33,
+  0x33, 0x33, 0xb2, 0x0c, 0x4d, 0xfe, 0xfe, 0xfe, 0x31, 0x84, 0x85, 0x88, 0x88, 0xac, 0xac, 0x83,
+  0x3f, 0x40, 0x5e, 0x45, 0x46, 0x45, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x40, 0x40,
+  0x40, 0x0c, 0xfe, 0x85, 0x56, 0x82, 0x40, 0x5e, 0x5f, 0x45, 0x45, 0x45, 0x45, 0x45, 0x5f, 0x40,
+  0x3f, 0x82, 0xad, 0xac, 0x85, 0xca, 0xff, 0xfe, 0x4d, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xfd, 0xfd,
+  0xfd, 0xfd, 0x4e, 0xbc, 0xfc, 0xbf, 0xe7, 0xe7, 0xe3, 0xaf, 0x7a, 0x7a, 0x24, 0x48, 0x48, 0x48,
+  0x48, 0x48, 0x7b, 0x7a, 0x7a, 0x47, 0x9d, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x7b, 0x7a, 0x7a, 0x7a,
+  0x7a, 0x7a, 0x47, 0x7a, 0x7a, 0x7a, 0x47, 0x47, 0x7a, 0x7a, 0x48, 0x48, 0x48, 0x48, 0xaf, 0xaf,
+  0xaf, 0xe3, 0xe7, 0xe7, 0x16, 0x16, 0x16, 0xfd, 0xb3, 0x4d, 0x31, 0x85, 0x56, 0xad, 0x83, 0x40,
+  0x5e, 0x45, 0x45, 0x45, 0x45, 0x45, 0x5f, 0x3f, 0x84, 0xac, 0x5f, 0xfe, 0x4d, 0xfe, 0xff, 0x31,
+  0xca, 0x84, 0x84, 0x84, 0x31, 0xfe, 0x0c, 0xb3, 0x87, 0xb6, 0x48, 0xd6, 0x93, 0xa6, 0x32, 0xaa,
+  0x95, 0x95, 0x95, 0xdd, 0xf4, 0xa5, 0xa5, 0xa5, 0xc5, 0x1c, 0xd9, 0xd9, 0x27, 0xbb, 0xbb, 0xbb,
+  0x6b, 0x60, 0x60, 0x10, 0x8b, 0x8b, 0x8b, 0xd2, 0x10, 0x10, 0x10, 0x11, 0xd2, 0x8b, 0x8b, 0x8b,
+  0xd2, 0x10, 0x11, 0x10, 0x10, 0xd2, 0x10, 0x11, 0x60, 0x60, 0x60, 0x10, 0x2e, 0x10, 0x11, 0x11,
+  0x11, 0x60, 0x11, 0x10, 0x60, 0x60, 0x11, 0x60, 0x60, 0x6b, 0xbb, 0xbb, 0xd9, 0x1c, 0xc5, 0xa5,
+  0xa4, 0xdc, 0x18, 0xaa, 0x32, 0xc0, 0x92, 0x47, 0xb6, 0x04, 0xb2, 0x84, 0x88, 0xac, 0x82, 0x82,
+  0xac, 0x31, 0x09, 0x88, 0x45, 0x84, 0x0c, 0x4d, 0x0c, 0x33, 0x09, 0x86, 0x04, 0xbf, 0xb7, 0x24,
+  0x51, 0x93, 0x6d, 0xa1, 0x18, 0xf4, 0xc5, 0xd8, 0xba, 0x60, 0x8e, 0xd2, 0x8b, 0x99, 0xc2, 0xfb,
+  0xfa, 0xb5, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf3, 0x2f, 0xe0, 0xe0, 0x62, 0x62, 0xe0, 0x62,
+  0x4f, 0xe1, 0x35, 0x35, 0xe0, 0x62, 0x62, 0x4f, 0x4f, 0x4f, 0x35, 0x35, 0x35, 0x35, 0xe1, 0xe1,
+  0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0x4f, 0xe1, 0xe0, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x2f,
+  0x2f, 0xf3, 0xf2, 0xf2, 0xf2, 0xf2, 0xb5, 0xfb, 0xc2, 0x99, 0xd4, 0x11, 0xba, 0xd9, 0x1c, 0xa5,
+  0x18, 0x52, 0x38, 0xd6, 0xae, 0xcf, 0x09, 0x0c, 0xff, 0x31, 0x4d, 0x09, 0xce, 0x82, 0x45, 0xac,
+  0x0c, 0x4d, 0x33, 0x86, 0xce, 0xbf, 0xb7, 0x47, 0x51, 0x93, 0xe5, 0x53, 0x18, 0xa5, 0xd8, 0x27,
+  0x60, 0xd2, 0x99, 0xfb, 0xfa, 0xde, 0xdf, 0xf3, 0x62, 0xe0, 0xe1, 0xe1, 0x36, 0x36, 0xb8, 0xf6,
+  0xf6, 0x91, 0x30, 0x91, 0x30, 0x91, 0x77, 0x34, 0x77, 0x77, 0x77, 0x77, 0x77, 0xd0, 0x34, 0x77,
+  0x34, 0x34, 0x34, 0x34, 0x49, 0xcc, 0xcc, 0xcc, 0x49, 0x34, 0x34, 0x5a, 0x5a, 0x7c, 0x5a, 0x7c,
+  0x34, 0x34, 0x34, 0x5a, 0xe9, 0x77, 0x77, 0x34, 0x77, 0x91, 0x91, 0xf7, 0xb8, 0x36, 0x36, 0x36,
+  0x36, 0x35, 0x2f, 0xf1, 0xdf, 0xb5, 0x99, 0xd4, 0x8e, 0x27, 0xa5, 0xf4, 0x18, 0xa7, 0x93, 0x7a,
+  0xbd, 0xce, 0x86, 0x86, 0x09, 0xbf, 0x04, 0x45, 0x46, 0x5f, 0x85, 0xb2, 0x33, 0x86, 0x04, 0xbd,
+  0xaf, 0xd6, 0x93, 0xe5, 0x53, 0x18, 0xf5, 0xd9, 0xba, 0xeb, 0xd4, 0xc2, 0xfa, 0xf2, 0x61, 0x35,
+  0x35, 0x36, 0xf6, 0x30, 0x30, 0x7c, 0x5a, 0x34, 0x34, 0x5a, 0x5a, 0xd1, 0xcc, 0xcd, 0x4a, 0x4a,
+  0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0xef, 0x29, 0xb1, 0xb1, 0xdb, 0xef, 0xef, 0x4a, 0x4a, 0xb1,
+  0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x29, 0xb1, 0x4a, 0x29, 0xb1, 0xb1, 0x29, 0x4a, 0x4a,
+  0xcd, 0x69, 0xcc, 0xcc, 0xcc, 0x49, 0xe9, 0x77, 0xe8, 0x30, 0x3b, 0xb8, 0x36, 0x35, 0x2f, 0xdf,
+  0xfa, 0xb4, 0x99, 0xd2, 0xba, 0x1c, 0x7e, 0xa1, 0xc0, 0x55, 0x7a, 0xb7, 0xbf, 0x87, 0xcf, 0x04,
+  0x83, 0x45, 0x46, 0x46, 0x5f, 0xac, 0x0c, 0x86, 0x22, 0x04, 0xbf, 0xb7, 0x51, 0xc0, 0x5c, 0x18,
+  0xf4, 0xc5, 0xd9, 0x8e, 0x8b, 0x99, 0xb5, 0xfa, 0x61, 0x62, 0x35, 0xb8, 0xf6, 0xf6, 0xf6, 0x30,
+  0xe8, 0x49, 0x49, 0x49, 0xd1, 0xd1, 0x5a, 0x4a, 0x70, 0x70, 0x70, 0x70, 0x70, 0xda, 0xda, 0xda,
+  0xda, 0xdb, 0xb1, 0x29, 0x29, 0xda, 0xda, 0xda, 0xda, 0x2c, 0x2c, 0x2c, 0x2c, 0x4a, 0x4a, 0x4a,
+  0x2c, 0x70, 0x2c, 0x70, 0xda, 0x70, 0x70, 0x70, 0x70, 0x70, 0x2c, 0x69, 0x49, 0x49, 0x49, 0xe9,
+  0x91, 0x91, 0x91, 0xf6, 0x36, 0xe1, 0xe1, 0x2f, 0xf2, 0xb5, 0xc2, 0x8b, 0x60, 0xd9, 0xc5, 0x7e,
+  0xa0, 0x5c, 0x93, 0x50, 0xae, 0xb6, 0xce, 0x22, 0x31, 0x40, 0x46, 0x45, 0x46, 0x46, 0x46, 0x46,
+  0x40, 0xac, 0xfe, 0x33, 0x22, 0xce, 0xb6, 0x9d, 0x28, 0xc0, 0x3d, 0x95, 0xf4, 0xf5, 0x1c, 0x27,
+  0x10, 0x8b, 0xc2, 0xfa, 0xf2, 0xf1, 0xe0, 0xe1, 0x36, 0xb9, 0xb9, 0x1b, 0x3b, 0x1b, 0x3b, 0x1b,
+  0xc6, 0xc6, 0x1b, 0x1b, 0x3b, 0x1b, 0x1b, 0x1b, 0x3b, 0x3b, 0x7c, 0x6e, 0x7d, 0x7d, 0x6e, 0x7d,
+  0x7d, 0x7d, 0xd0, 0xd0, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7d, 0x7d, 0x7c, 0x7c, 0x3b,
+  0x7c, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x1b, 0x1b, 0xb9, 0xb9, 0xe1, 0xe0, 0x4f, 0xf1, 0xf3, 0xf2,
+  0xfa, 0xfb, 0x8b, 0xd2, 0xbb, 0x1c, 0xa4, 0x18, 0x3d, 0xa6, 0x0a, 0x9d, 0xb6, 0xbf, 0x33, 0x4d,
+  0x88, 0x40, 0x46, 0x46, 0x45, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x40, 0x83, 0x82,
+  0xad, 0xac, 0x85, 0x31, 0xcb, 0x4e, 0x4e, 0x4e, 0x16, 0x16, 0x16, 0xe7, 0xe7, 0xe3, 0x7b, 0x7a,
+  0x47, 0x50, 0x0a, 0x9c, 0x92, 0x54, 0x1e, 0xa6, 0xa7, 0x3d, 0x3d, 0x32, 0x32, 0x32, 0xa6, 0xc0,
+  0x54, 0x92, 0x9c, 0x0a, 0x0a, 0x9c, 0x0a, 0x0a, 0x0a, 0x55, 0x55, 0x55, 0x0a, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x0a, 0x0a, 0x9c, 0x9c, 0x92, 0x9c, 0x9c, 0x92, 0x92, 0x92, 0x0a, 0x9c, 0x9c,
+  0x0a, 0x0a, 0x50, 0x50, 0x50, 0x50, 0x47, 0x47, 0x47, 0x7b, 0xe7, 0x16, 0x16, 0x16, 0x4e, 0xcb,
+  0x17, 0x89, 0xc8, 0xc9, 0xac, 0xad, 0x83, 0x3f, 0x5e, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46
+};
+
+const lv_img_dsc_t button_4_106x40_i8 = {
+  .header.cf = LV_IMG_CF_INDEXED_8BIT,
+  .header.always_zero = 0,
+  .header.reserved = 0,
+  .header.w = 106,
+  .header.h = 40,
+  .data_size = 5264,
+  .data = button_4_106x40_i8_map,
+};
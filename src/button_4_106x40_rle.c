@@ -0,0 +1,644 @@
+#include <lvgl.h>
+#include "img_rle.h"
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN uint8_t button_4_106x40_rle_map[] = {
+  0x88, 0x00, 0x00, 0xff, 0x0c, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf4, 0x00, 0x00, 0xf1, 0x00, 0x00,
+  0xf0, 0x00, 0x00, 0xef, 0x00, 0x00, 0xee, 0x00, 0x00, 0xef, 0x00, 0x00, 0xed, 0x00, 0x00, 0xea,
+  0x00, 0x00, 0xe9, 0x00, 0x00, 0xea, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xe5, 0x83, 0x00, 0x00, 0xe4,
+  0x02, 0x00, 0x00, 0xe1, 0x20, 0x00, 0xdf, 0x20, 0x00, 0xde, 0x86, 0x20, 0x00, 0xdc, 0x07, 0x21,
+  0x08, 0xdb, 0x20, 0x00, 0xde, 0x20, 0x00, 0xdd, 0x20, 0x00, 0xdb, 0x20, 0x00, 0xdc, 0x20, 0x00,
+  0xde, 0x20, 0x00, 0xdf, 0x00, 0x00, 0xdf, 0x81, 0x00, 0x00, 0xe1, 0x81, 0x00, 0x00, 0xe2, 0x82,
+  0x00, 0x00, 0xe1, 0x06, 0x20, 0x00, 0xdf, 0x20, 0x00, 0xdc, 0x40, 0x00, 0xda, 0x40, 0x00, 0xd9,
+  0x41, 0x08, 0xd9, 0x41, 0x08, 0xda, 0x41, 0x08, 0xd8, 0x81, 0x41, 0x08, 0xd7, 0x84, 0x41, 0x08,
+  0xd6, 0x03, 0x41, 0x08, 0xd5, 0x41, 0x08, 0xd7, 0x41, 0x08, 0xd9, 0x40, 0x00, 0xdb, 0x83, 0x20,
+  0x00, 0xdc, 0x00, 0x20, 0x00, 0xde, 0x85, 0x20, 0x00, 0xdc, 0x82, 0x20, 0x00, 0xdb, 0x01, 0x20,
+  0x00, 0xda, 0x40, 0x00, 0xd9, 0x81, 0x41, 0x08, 0xd7, 0x08, 0x41, 0x08, 0xd9, 0x20, 0x00, 0xda,
+  0x21, 0x08, 0xda, 0x20, 0x00, 0xdc, 0x20, 0x00, 0xde, 0x20, 0x00, 0xdf, 0x00, 0x00, 0xe0, 0x00,
+  0x00, 0xe1, 0x00, 0x00, 0xe3, 0x81, 0x00, 0x00, 0xe4, 0x02, 0x00, 0x00, 0xe1, 0x00, 0x00, 0xe0,
+  0x00, 0x00, 0xf4, 0x8a, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xf2, 0x00, 0x00,
+  0xe5, 0x00, 0x00, 0xdb, 0x00, 0x00, 0xd1, 0x00, 0x00, 0xcc, 0x00, 0x00, 0xc6, 0x00, 0x00, 0xc1,
+  0x81, 0x00, 0x00, 0xbf, 0x0d, 0x20, 0x00, 0xba, 0x40, 0x00, 0xb6, 0x40, 0x00, 0xb5, 0x61, 0x08,
+  0xb0, 0x61, 0x08, 0xae, 0x82, 0x10, 0xa6, 0xa2, 0x10, 0xa2, 0xc3, 0x18, 0x9f, 0xe3, 0x18, 0x9d,
+  0xe3, 0x18, 0x9b, 0x04, 0x21, 0x98, 0x45, 0x29, 0x94, 0x45, 0x29, 0x91, 0x66, 0x31, 0x8d, 0x81,
+  0x85, 0x29, 0x8c, 0x01, 0x86, 0x31, 0x8b, 0xa6, 0x31, 0x8a, 0x81, 0xa7, 0x39, 0x88, 0x02, 0xa7,
+  0x39, 0x87, 0xa7, 0x39, 0x86, 0xc7, 0x39, 0x85, 0x81, 0xe7, 0x39, 0x83, 0x04, 0xc7, 0x39, 0x83,
+  0xc7, 0x39, 0x84, 0xe7, 0x39, 0x84, 0xc7, 0x39, 0x85, 0xa7, 0x39, 0x86, 0x81, 0xa6, 0x31, 0x87,
+  0x0d, 0xa6, 0x31, 0x88, 0x86, 0x31, 0x8a, 0xa6, 0x31, 0x8a, 0xa6, 0x31, 0x89, 0xc7, 0x39, 0x88,
+  0xe7, 0x39, 0x83, 0xe7, 0x39, 0x82, 0xe8, 0x41, 0x83, 0xc7, 0x39, 0x84, 0xe8, 0x41, 0x81, 0xe7,
+  0x39, 0x81, 0xe8, 0x41, 0x82, 0xe7, 0x39, 0x83, 0xe8, 0x41, 0x81, 0x82, 0x08, 0x42, 0x81, 0x03,
+  0x07, 0x3a, 0x80, 0xe8, 0x41, 0x81, 0xe7, 0x39, 0x82, 0xe7, 0x39, 0x83, 0x83, 0xc7, 0x39, 0x84,
+  0x02, 0xc7, 0x39, 0x85, 0xc7, 0x39, 0x84, 0xa7, 0x39, 0x86, 0x81, 0xa7, 0x39, 0x88, 0x01, 0xa6,
+  0x31, 0x89, 0x86, 0x31, 0x8b, 0x81, 0x86, 0x31, 0x8c, 0x0d, 0x66, 0x31, 0x8d, 0x65, 0x29, 0x8f,
+  0x66, 0x31, 0x8d, 0x65, 0x29, 0x91, 0x25, 0x29, 0x95, 0x04, 0x21, 0x99, 0x04, 0x21, 0x9e, 0xe3,
+  0x18, 0x9e, 0xc3, 0x18, 0xa0, 0x82, 0x10, 0xa7, 0x81, 0x08, 0xad, 0x41, 0x08, 0xb0, 0x21, 0x08,
+  0xb2, 0x20, 0x00, 0xb4, 0x81, 0x00, 0x00, 0xba, 0x07, 0x20, 0x00, 0xb6, 0x61, 0x08, 0xab, 0xe3,
+  0x18, 0xa3, 0x65, 0x29, 0x98, 0x82, 0x10, 0xb8, 0x00, 0x00, 0xee, 0x00, 0x00, 0xff, 0x00, 0x00,
+  0xf4, 0x84, 0x00, 0x00, 0xff, 0x1f, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xe3, 0x00,
+  0x00, 0xdd, 0x00, 0x00, 0xd9, 0x00, 0x00, 0xd3, 0x00, 0x00, 0xcf, 0x00, 0x00, 0xcb, 0x00, 0x00,
+  0xc6, 0x00, 0x00, 0xbe, 0x41, 0x08, 0xb6, 0x61, 0x08, 0xb1, 0x61, 0x08, 0xb2, 0xa2, 0x10, 0xad,
+  0xc3, 0x18, 0xa7, 0xe3, 0x18, 0xa3, 0x24, 0x21, 0x9e, 0x45, 0x29, 0x98, 0x65, 0x29, 0x98, 0x65,
+  0x29, 0x97, 0x66, 0x31, 0x94, 0x66, 0x31, 0x91, 0xa6, 0x31, 0x8e, 0xa7, 0x39, 0x8d, 0xc7, 0x39,
+  0x8d, 0xc7, 0x39, 0x8c, 0xc7, 0x39, 0x8a, 0xe7, 0x39, 0x8a, 0xe8, 0x41, 0x89, 0x08, 0x42, 0x87,
+  0x08, 0x42, 0x86, 0x08, 0x42, 0x83, 0x81, 0x28, 0x42, 0x82, 0x01, 0x28, 0x42, 0x81, 0x48, 0x42,
+  0x7e, 0x81, 0x49, 0x4a, 0x7c, 0x00, 0x69, 0x4a, 0x7c, 0x82, 0x6a, 0x52, 0x7b, 0x01, 0x4a, 0x52,
+  0x7b, 0x6a, 0x52, 0x7b, 0x81, 0x69, 0x4a, 0x7b, 0x07, 0x89, 0x4a, 0x7b, 0x69, 0x4a, 0x7a, 0x69,
+  0x4a, 0x79, 0x89, 0x4a, 0x77, 0x69, 0x4a, 0x78, 0x8a, 0x52, 0x79, 0x6a, 0x52, 0x79, 0x69, 0x4a,
+  0x7a, 0x81, 0x69, 0x4a, 0x7b, 0x81, 0x69, 0x4a, 0x7c, 0x81, 0x69, 0x4a, 0x7b, 0x00, 0x69, 0x4a,
+  0x7e, 0x81, 0x69, 0x4a, 0x7d, 0x84, 0x49, 0x4a, 0x7d, 0x00, 0x29, 0x4a, 0x7e, 0x81, 0x28, 0x42,
+  0x80, 0x03, 0x28, 0x42, 0x81, 0x08, 0x42, 0x84, 0x07, 0x3a, 0x86, 0xe7, 0x39, 0x88, 0x81, 0xc7,
+  0x39, 0x8b, 0x17, 0xc7, 0x39, 0x8c, 0xa6, 0x31, 0x8f, 0xa6, 0x31, 0x8e, 0x65, 0x29, 0x94, 0x24,
+  0x21, 0x9c, 0x04, 0x21, 0x9e, 0xe3, 0x18, 0xa4, 0xc3, 0x18, 0xaa, 0xa2, 0x10, 0xab, 0x61, 0x08,
+  0xb3, 0x20, 0x00, 0xb9, 0x20, 0x00, 0xbb, 0x00, 0x00, 0xbf, 0x00, 0x00, 0xc1, 0x00, 0x00, 0xc8,
+  0x00, 0x00, 0xca, 0x00, 0x00, 0xcf, 0x00, 0x00, 0xcd, 0x20, 0x00, 0xc0, 0xc3, 0x18, 0xa3, 0xaa,
+  0x52, 0x73, 0x69, 0x4a, 0x72, 0x61, 0x08, 0xb9, 0x00, 0x00, 0xd6, 0x84, 0x00, 0x00, 0xff, 0x11,
+  0x00, 0x00, 0xf8, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xe1, 0x00, 0x00, 0xd9, 0x00, 0x00, 0xd1, 0x00,
+  0x00, 0xcd, 0x00, 0x00, 0xc5, 0x41, 0x08, 0xb6, 0xc3, 0x18, 0xa3, 0x45, 0x29, 0x91, 0xe7, 0x39,
+  0x83, 0x28, 0x42, 0x7d, 0x49, 0x4a, 0x7a, 0x69, 0x4a, 0x76, 0x8a, 0x52, 0x74, 0xaa, 0x52, 0x71,
+  0xcb, 0x5a, 0x6d, 0xeb, 0x5a, 0x6b, 0x81, 0xeb, 0x5a, 0x68, 0x03, 0xec, 0x62, 0x68, 0x0c, 0x63,
+  0x67, 0x2c, 0x63, 0x63, 0x2d, 0x6b, 0x63, 0x82, 0x4d, 0x6b, 0x61, 0x81, 0x2d, 0x6b, 0x61, 0x81,
+  0x4d, 0x6b, 0x61, 0x82, 0x4d, 0x6b, 0x5f, 0x00, 0x6d, 0x6b, 0x5e, 0x81, 0x6e, 0x73, 0x5d, 0x82,
+  0x6e, 0x73, 0x5f, 0x81, 0x6d, 0x6b, 0x5e, 0x01, 0x4e, 0x73, 0x5f, 0x6e, 0x73, 0x5f, 0x81, 0x8e,
+  0x73, 0x5d, 0x02, 0x8e, 0x73, 0x5b, 0xae, 0x73, 0x5a, 0xaf, 0x7b, 0x5b, 0x81, 0xcf, 0x7b, 0x57,
+  0x02, 0xcf, 0x7b, 0x58, 0xcf, 0x7b, 0x59, 0xce, 0x73, 0x59, 0x81, 0xae, 0x73, 0x59, 0x01, 0xae,
+  0x73, 0x5a, 0xae, 0x73, 0x59, 0x81, 0x8e, 0x73, 0x58, 0x0f, 0x8e, 0x73, 0x5b, 0x8e, 0x73, 0x5c,
+  0x8e, 0x73, 0x5d, 0x6d, 0x6b, 0x5e, 0x4d, 0x6b, 0x5f, 0x4d, 0x6b, 0x60, 0x4d, 0x6b, 0x62, 0x4d,
+  0x6b, 0x64, 0x2c, 0x63, 0x64, 0x0c, 0x63, 0x64, 0x2c, 0x63, 0x66, 0x0c, 0x63, 0x69, 0x0b, 0x5b,
+  0x6b, 0xeb, 0x5a, 0x6b, 0xeb, 0x5a, 0x6c, 0xcb, 0x5a, 0x6d, 0x81, 0xcb, 0x5a, 0x71, 0x16, 0xaa,
+  0x52, 0x71, 0xaa, 0x52, 0x74, 0x6a, 0x52, 0x76, 0x49, 0x4a, 0x79, 0x08, 0x42, 0x7e, 0xe7, 0x39,
+  0x82, 0xc7, 0x39, 0x86, 0x86, 0x31, 0x8a, 0x65, 0x29, 0x90, 0x24, 0x21, 0x99, 0xc3, 0x18, 0xa4,
+  0x41, 0x08, 0xb3, 0x00, 0x00, 0xc2, 0x00, 0x00, 0xcd, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd2, 0x00,
+  0x00, 0xd6, 0x00, 0x00, 0xdb, 0x00, 0x00, 0xda, 0x41, 0x08, 0xbb, 0x69, 0x4a, 0x78, 0xae, 0x73,
+  0x60, 0x20, 0x00, 0xc5, 0x83, 0x00, 0x00, 0xff, 0x17, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xeb, 0x00,
+  0x00, 0xdf, 0x00, 0x00, 0xd6, 0x00, 0x00, 0xce, 0x00, 0x00, 0xc1, 0xa3, 0x18, 0xa8, 0xa6, 0x31,
+  0x88, 0xab, 0x5a, 0x72, 0x8e, 0x73, 0x5f, 0x0f, 0x7c, 0x57, 0x10, 0x84, 0x56, 0x30, 0x84, 0x51,
+  0x71, 0x8c, 0x4d, 0xb2, 0x94, 0x4b, 0xd3, 0x9c, 0x49, 0xf3, 0x9c, 0x47, 0x14, 0xa5, 0x44, 0x55,
+  0xad, 0x41, 0x34, 0xa5, 0x3f, 0x55, 0xad, 0x3f, 0x75, 0xad, 0x3e, 0x75, 0xad, 0x3d, 0x96, 0xb5,
+  0x3b, 0x81, 0xb6, 0xb5, 0x3a, 0x81, 0xb6, 0xb5, 0x39, 0x81, 0xf7, 0xbd, 0x36, 0x01, 0xd7, 0xbd,
+  0x36, 0xf7, 0xbd, 0x34, 0x85, 0xd7, 0xbd, 0x35, 0x82, 0xd7, 0xbd, 0x36, 0x01, 0x96, 0xb5, 0x39,
+  0xb6, 0xb5, 0x38, 0x82, 0xd7, 0xbd, 0x36, 0x00, 0xb7, 0xbd, 0x37, 0x82, 0xd7, 0xbd, 0x36, 0x81,
+  0xd7, 0xbd, 0x35, 0x01, 0xd8, 0xc5, 0x35, 0xd7, 0xbd, 0x35, 0x82, 0xb6, 0xb5, 0x35, 0x01, 0xd7,
+  0xbd, 0x34, 0xf7, 0xbd, 0x36, 0x85, 0xd7, 0xbd, 0x37, 0x00, 0xb6, 0xb5, 0x39, 0x83, 0x96, 0xb5,
+  0x3b, 0x08, 0x76, 0xb5, 0x3b, 0x75, 0xad, 0x3c, 0x55, 0xad, 0x3c, 0x55, 0xad, 0x3d, 0x75, 0xad,
+  0x3c, 0x55, 0xad, 0x3e, 0x34, 0xa5, 0x40, 0x34, 0xa5, 0x3f, 0x14, 0xa5, 0x43, 0x81, 0xf3, 0x9c,
+  0x44, 0x14, 0xd3, 0x9c, 0x48, 0xb2, 0x94, 0x4a, 0x92, 0x94, 0x4b, 0x71, 0x8c, 0x4f, 0x51, 0x8c,
+  0x50, 0x10, 0x84, 0x54, 0xef, 0x7b, 0x5a, 0xaf, 0x7b, 0x5f, 0x0c, 0x63, 0x67, 0xab, 0x5a, 0x70,
+  0x08, 0x42, 0x7e, 0x04, 0x21, 0x9c, 0x20, 0x00, 0xc1, 0x00, 0x00, 0xd4, 0x00, 0x00, 0xd6, 0x00,
+  0x00, 0xd5, 0x00, 0x00, 0xd6, 0x00, 0x00, 0xd3, 0x62, 0x10, 0xb4, 0x48, 0x42, 0x7c, 0x45, 0x29,
+  0x93, 0x83, 0x00, 0x00, 0xff, 0x11, 0x00, 0x00, 0xf1, 0x00, 0x00, 0xdd, 0x00, 0x00, 0xd1, 0x00,
+  0x00, 0xc5, 0x41, 0x08, 0xb3, 0x66, 0x31, 0x90, 0x2c, 0x63, 0x69, 0x30, 0x84, 0x55, 0x30, 0x84,
+  0x51, 0x51, 0x8c, 0x4e, 0x92, 0x94, 0x4a, 0x93, 0x9c, 0x49, 0xd3, 0x9c, 0x45, 0xf3, 0x9c, 0x43,
+  0x14, 0xa5, 0x41, 0x34, 0xa5, 0x3f, 0x55, 0xad, 0x3d, 0x55, 0xad, 0x3a, 0x81, 0x96, 0xb5, 0x38,
+  0x04, 0x96, 0xb5, 0x39, 0xd7, 0xbd, 0x36, 0xb6, 0xb5, 0x32, 0xf6, 0xb5, 0x32, 0x18, 0xc6, 0x31,
+  0x83, 0xf7, 0xbd, 0x32, 0x81, 0x18, 0xc6, 0x32, 0x00, 0x38, 0xc6, 0x2e, 0x83, 0x38, 0xc6, 0x2c,
+  0x01, 0x18, 0xc6, 0x2f, 0x38, 0xc6, 0x2d, 0x81, 0x38, 0xc6, 0x2c, 0x04, 0x18, 0xc6, 0x2e, 0x18,
+  0xc6, 0x32, 0x38, 0xc6, 0x2d, 0x38, 0xc6, 0x2c, 0x59, 0xce, 0x2c, 0x81, 0x38, 0xc6, 0x2c, 0x02,
+  0x59, 0xce, 0x2c, 0x38, 0xc6, 0x2d, 0x59, 0xce, 0x2c, 0x81, 0x38, 0xc6, 0x2c, 0x01, 0x59, 0xce,
+  0x2c, 0x38, 0xc6, 0x2d, 0x83, 0x18, 0xc6, 0x2d, 0x00, 0x38, 0xc6, 0x2e, 0x84, 0x18, 0xc6, 0x2f,
+  0x01, 0x38, 0xc6, 0x2e, 0xf8, 0xc5, 0x30, 0x81, 0x18, 0xc6, 0x32, 0x01, 0xf8, 0xc5, 0x32, 0xf7,
+  0xbd, 0x32, 0x84, 0x18, 0xc6, 0x31, 0x03, 0xd7, 0xbd, 0x31, 0xf7, 0xbd, 0x30, 0xd7, 0xbd, 0x34,
+  0xd6, 0xb5, 0x37, 0x81, 0xb7, 0xbd, 0x37, 0x16, 0x96, 0xb5, 0x38, 0x75, 0xad, 0x39, 0x35, 0xad,
+  0x3d, 0x14, 0xa5, 0x40, 0xf3, 0x9c, 0x43, 0xd2, 0x94, 0x44, 0x92, 0x94, 0x4a, 0x71, 0x8c, 0x4e,
+  0x30, 0x84, 0x51, 0xf0, 0x83, 0x58, 0xcf, 0x7b, 0x5b, 0x6e, 0x73, 0x62, 0x49, 0x4a, 0x78, 0x82,
+  0x10, 0xab, 0x00, 0x00, 0xcd, 0x00, 0x00, 0xce, 0x00, 0x00, 0xcc, 0x00, 0x00, 0xce, 0x00, 0x00,
+  0xc3, 0x45, 0x29, 0x93, 0x44, 0x21, 0x99, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfe, 0x81, 0x00, 0x00,
+  0xf5, 0x0c, 0x00, 0x00, 0xde, 0x00, 0x00, 0xce, 0x00, 0x00, 0xc0, 0x61, 0x08, 0xb3, 0x66, 0x31,
+  0x90, 0x6d, 0x6b, 0x60, 0x92, 0x94, 0x4c, 0x71, 0x8c, 0x4b, 0x92, 0x94, 0x48, 0xd3, 0x9c, 0x45,
+  0x14, 0xa5, 0x41, 0x35, 0xad, 0x3e, 0x96, 0xb5, 0x3b, 0x81, 0xb6, 0xb5, 0x38, 0x01, 0xd6, 0xb5,
+  0x34, 0xd7, 0xbd, 0x34, 0x81, 0xf7, 0xbd, 0x33, 0x04, 0x38, 0xc6, 0x30, 0x38, 0xc6, 0x2d, 0x79,
+  0xce, 0x2e, 0x59, 0xce, 0x2f, 0x9a, 0xd6, 0x2c, 0x83, 0x79, 0xce, 0x2b, 0x00, 0xba, 0xd6, 0x2b,
+  0x81, 0x79, 0xce, 0x2b, 0x00, 0x7a, 0xd6, 0x2b, 0x83, 0x79, 0xce, 0x2b, 0x00, 0x7a, 0xd6, 0x2b,
+  0x83, 0x79, 0xce, 0x2b, 0x81, 0xba, 0xd6, 0x2a, 0x00, 0x7a, 0xd6, 0x2b, 0x83, 0x79, 0xce, 0x2b,
+  0x00, 0x9a, 0xd6, 0x27, 0x88, 0x79, 0xce, 0x2b, 0x87, 0xba, 0xd6, 0x2a, 0x8a, 0x79, 0xce, 0x2b,
+  0x13, 0x79, 0xce, 0x2d, 0x79, 0xce, 0x2e, 0x38, 0xc6, 0x2e, 0x18, 0xc6, 0x2e, 0x38, 0xc6, 0x30,
+  0x18, 0xc6, 0x31, 0xf7, 0xbd, 0x34, 0xd7, 0xbd, 0x36, 0x76, 0xb5, 0x3a, 0x96, 0xb5, 0x38, 0x55,
+  0xad, 0x3c, 0x14, 0xa5, 0x40, 0xf3, 0x9c, 0x44, 0x72, 0x94, 0x4a, 0x30, 0x84, 0x4e, 0xef, 0x7b,
+  0x56, 0xcf, 0x7b, 0x5a, 0xaa, 0x52, 0x71, 0x82, 0x10, 0xac, 0x00, 0x00, 0xcc, 0x81, 0x00, 0x00,
+  0xc8, 0x18, 0x20, 0x00, 0xbc, 0x45, 0x29, 0x96, 0x41, 0x08, 0xb3, 0x00, 0x00, 0xfe, 0x00, 0x00,
+  0xd9, 0x00, 0x00, 0xce, 0x00, 0x00, 0xe0, 0x00, 0x00, 0xcf, 0x00, 0x00, 0xbf, 0x41, 0x08, 0xb3,
+  0xe3, 0x18, 0xa1, 0x49, 0x4a, 0x7a, 0x31, 0x8c, 0x4f, 0xf4, 0xa4, 0x40, 0xf4, 0xa4, 0x45, 0x14,
+  0xa5, 0x3f, 0x55, 0xad, 0x3a, 0x76, 0xb5, 0x3a, 0xf7, 0xbd, 0x36, 0xf7, 0xbd, 0x33, 0x18, 0xc6,
+  0x31, 0x38, 0xc6, 0x30, 0x18, 0xc6, 0x2f, 0x78, 0xc6, 0x2e, 0x59, 0xce, 0x2c, 0x81, 0x9a, 0xd6,
+  0x2c, 0x01, 0xba, 0xd6, 0x2a, 0xba, 0xd6, 0x27, 0x84, 0xdb, 0xde, 0x28, 0x01, 0x1c, 0xe7, 0x24,
+  0xdb, 0xde, 0x28, 0x92, 0xdb, 0xde, 0x24, 0x00, 0xdb, 0xde, 0x23, 0x94, 0xdb, 0xde, 0x24, 0x85,
+  0xdb, 0xde, 0x28, 0x04, 0x9a, 0xd6, 0x28, 0xdb, 0xde, 0x2a, 0x9a, 0xd6, 0x29, 0xba, 0xd6, 0x27,
+  0x79, 0xce, 0x2b, 0x81, 0x9a, 0xd6, 0x2c, 0x1c, 0x59, 0xce, 0x2c, 0x38, 0xc6, 0x30, 0xf7, 0xbd,
+  0x32, 0xd7, 0xbd, 0x33, 0xb6, 0xb5, 0x37, 0x76, 0xb5, 0x3a, 0x55, 0xad, 0x3a, 0x55, 0xad, 0x3e,
+  0xf3, 0x9c, 0x44, 0x92, 0x94, 0x4b, 0x31, 0x8c, 0x52, 0x8d, 0x6b, 0x60, 0x85, 0x29, 0x8f, 0x20,
+  0x00, 0xba, 0x00, 0x00, 0xbe, 0x00, 0x00, 0xbd, 0x61, 0x08, 0xaf, 0x65, 0x29, 0x90, 0x00, 0x00,
+  0xbf, 0x00, 0x00, 0xfa, 0x41, 0x08, 0xb1, 0x20, 0x00, 0xb9, 0x00, 0x00, 0xd4, 0x00, 0x00, 0xc7,
+  0x20, 0x00, 0xb7, 0xa3, 0x18, 0xaa, 0x45, 0x29, 0x98, 0xca, 0x52, 0x70, 0xb2, 0x94, 0x49, 0x81,
+  0x75, 0xad, 0x3b, 0x0a, 0x96, 0xb5, 0x37, 0xd7, 0xbd, 0x37, 0xd7, 0xbd, 0x35, 0x18, 0xc6, 0x31,
+  0x38, 0xc6, 0x2d, 0x59, 0xce, 0x2c, 0x59, 0xce, 0x2b, 0x79, 0xce, 0x2b, 0xba, 0xd6, 0x2b, 0xba,
+  0xd6, 0x2a, 0x9a, 0xd6, 0x29, 0x81, 0xdb, 0xde, 0x24, 0x03, 0xdb, 0xde, 0x22, 0x1c, 0xe7, 0x22,
+  0x5d, 0xef, 0x22, 0x1c, 0xe7, 0x22, 0x81, 0x5d, 0xef, 0x22, 0x01, 0x1c, 0xe7, 0x23, 0x5d, 0xef,
+  0x22, 0x83, 0x1c, 0xe7, 0x23, 0x00, 0x5d, 0xef, 0x23, 0x81, 0x1c, 0xe7, 0x23, 0x00, 0x5d, 0xef,
+  0x23, 0x82, 0x1c, 0xe7, 0x23, 0x82, 0x5d, 0xef, 0x23, 0x81, 0x1c, 0xe7, 0x23, 0x01, 0x5d, 0xef,
+  0x23, 0x1c, 0xe7, 0x23, 0x81, 0x5d, 0xef, 0x23, 0x81, 0x1c, 0xe7, 0x23, 0x85, 0x5d, 0xef, 0x23,
+  0x82, 0x1c, 0xe7, 0x23, 0x85, 0x5d, 0xef, 0x23, 0x00, 0x1c, 0xe7, 0x23, 0x81, 0x5d, 0xef, 0x23,
+  0x01, 0x1c, 0xe7, 0x23, 0x5d, 0xef, 0x22, 0x85, 0x1c, 0xe7, 0x22, 0x02, 0x1c, 0xe7, 0x24, 0x1c,
+  0xe7, 0x23, 0x1c, 0xe7, 0x22, 0x82, 0xfb, 0xde, 0x25, 0x27, 0xba, 0xd6, 0x2a, 0x79, 0xce, 0x2b,
+  0x59, 0xce, 0x2c, 0x78, 0xc6, 0x2d, 0x18, 0xc6, 0x32, 0xd7, 0xbd, 0x35, 0xb6, 0xb5, 0x37, 0x75,
+  0xad, 0x3a, 0x34, 0xa5, 0x40, 0xf3, 0x9c, 0x44, 0x92, 0x94, 0x4b, 0xef, 0x7b, 0x58, 0x28, 0x42,
+  0x7e, 0xa2, 0x10, 0xac, 0x41, 0x08, 0xb3, 0x41, 0x08, 0xb0, 0xc3, 0x18, 0xa8, 0x86, 0x31, 0x8f,
+  0x00, 0x00, 0xc1, 0x00, 0x00, 0xf8, 0x24, 0x21, 0x9b, 0xa2, 0x10, 0xab, 0x00, 0x00, 0xca, 0x00,
+  0x00, 0xc0, 0x61, 0x08, 0xb0, 0xe3, 0x18, 0xa0, 0x86, 0x31, 0x90, 0xeb, 0x5a, 0x6b, 0xd3, 0x9c,
+  0x45, 0xb6, 0xb5, 0x37, 0x96, 0xb5, 0x37, 0xd7, 0xbd, 0x37, 0xf7, 0xbd, 0x33, 0x59, 0xce, 0x2f,
+  0x59, 0xce, 0x2b, 0x79, 0xce, 0x2a, 0xba, 0xd6, 0x2a, 0x9a, 0xd6, 0x2c, 0xba, 0xd6, 0x2b, 0xba,
+  0xd6, 0x27, 0x82, 0xdb, 0xde, 0x23, 0x81, 0x1c, 0xe7, 0x23, 0x87, 0x5d, 0xef, 0x23, 0x81, 0x9e,
+  0xf7, 0x23, 0x04, 0x5d, 0xef, 0x24, 0x9e, 0xf7, 0x23, 0x5d, 0xef, 0x24, 0x9e, 0xf7, 0x24, 0x9e,
+  0xf7, 0x23, 0x82, 0x5d, 0xef, 0x24, 0x81, 0x5d, 0xef, 0x23, 0x81, 0x9e, 0xf7, 0x23, 0x81, 0x5d,
+  0xef, 0x23, 0x00, 0x5d, 0xef, 0x24, 0x81, 0x9e, 0xf7, 0x23, 0x00, 0x5d, 0xef, 0x24, 0x84, 0x5d,
+  0xef, 0x23, 0x00, 0x5d, 0xef, 0x24, 0x87, 0x5d, 0xef, 0x23, 0x00, 0x9e, 0xf7, 0x23, 0x8b, 0x5d,
+  0xef, 0x23, 0x84, 0x1c, 0xe7, 0x23, 0x21, 0x1c, 0xe7, 0x22, 0xba, 0xd6, 0x25, 0xba, 0xd6, 0x2c,
+  0xba, 0xd6, 0x2b, 0x79, 0xce, 0x2a, 0x59, 0xce, 0x2c, 0x18, 0xc6, 0x2f, 0xf7, 0xbd, 0x33, 0xd7,
+  0xbd, 0x37, 0x75, 0xad, 0x39, 0x55, 0xad, 0x3e, 0xd3, 0x9c, 0x44, 0x72, 0x94, 0x4f, 0xab, 0x5a,
+  0x71, 0xe4, 0x20, 0xa1, 0xa2, 0x10, 0xaa, 0xa2, 0x10, 0xa5, 0xe4, 0x20, 0x9f, 0x86, 0x31, 0x8f,
+  0x00, 0x00, 0xbe, 0x00, 0x00, 0xeb, 0xa6, 0x31, 0x8e, 0xe2, 0x10, 0xa2, 0x00, 0x00, 0xc3, 0x20,
+  0x00, 0xb9, 0xa3, 0x18, 0xa8, 0x44, 0x21, 0x97, 0xa6, 0x31, 0x8a, 0x0c, 0x63, 0x69, 0x14, 0xa5,
+  0x43, 0xb7, 0xbd, 0x37, 0xd7, 0xbd, 0x37, 0xf7, 0xbd, 0x34, 0x18, 0xc6, 0x2f, 0x81, 0x59, 0xce,
+  0x2b, 0x05, 0x79, 0xce, 0x2b, 0xba, 0xd6, 0x2c, 0xdb, 0xde, 0x29, 0x1c, 0xe7, 0x23, 0xdb, 0xde,
+  0x22, 0xdb, 0xde, 0x23, 0x82, 0x1c, 0xe7, 0x23, 0x82, 0x5d, 0xef, 0x23, 0x81, 0x9e, 0xf7, 0x23,
+  0x00, 0x9e, 0xf7, 0x24, 0x81, 0x9e, 0xf7, 0x23, 0x14, 0x9e, 0xf7, 0x24, 0x9e, 0xf7, 0x23, 0x7d,
+  0xef, 0x21, 0x7d, 0xef, 0x20, 0x9e, 0xf7, 0x24, 0xbe, 0xf7, 0x20, 0xbe, 0xf7, 0x1e, 0x9e, 0xf7,
+  0x23, 0x7d, 0xef, 0x20, 0xbe, 0xf7, 0x1e, 0xbe, 0xf7, 0x1f, 0x9e, 0xf7, 0x23, 0x9e, 0xf7, 0x24,
+  0xbe, 0xf7, 0x21, 0x7d, 0xef, 0x21, 0x9e, 0xf7, 0x23, 0x9e, 0xf7, 0x24, 0x7d, 0xef, 0x20, 0x9e,
+  0xf7, 0x22, 0x9e, 0xf7, 0x23, 0x7d, 0xef, 0x20, 0x81, 0x5d, 0xef, 0x23, 0x82, 0x9e, 0xf7, 0x23,
+  0x01, 0x7d, 0xef, 0x20, 0xbe, 0xf7, 0x21, 0x83, 0x9e, 0xf7, 0x23, 0x82, 0x5d, 0xef, 0x23, 0x03,
+  0x9e, 0xf7, 0x24, 0x9e, 0xf7, 0x23, 0x5d, 0xef, 0x24, 0x9e, 0xf7, 0x24, 0x82, 0x9e, 0xf7, 0x23,
+  0x88, 0x5d, 0xef, 0x23, 0x82, 0x1c, 0xe7, 0x23, 0x03, 0xdb, 0xde, 0x23, 0xba, 0xd6, 0x25, 0xdb,
+  0xde, 0x2a, 0x9a, 0xd6, 0x2c, 0x81, 0x59, 0xce, 0x2b, 0x20, 0xf7, 0xbd, 0x30, 0xf7, 0xbd, 0x34,
+  0xb7, 0xbd, 0x37, 0x75, 0xad, 0x3b, 0x14, 0xa5, 0x41, 0xf3, 0x9c, 0x46, 0xeb, 0x5a, 0x6c, 0x24,
+  0x21, 0x9b, 0xe3, 0x18, 0xa0, 0xe4, 0x20, 0xa0, 0x24, 0x21, 0x9b, 0x86, 0x31, 0x90, 0x00, 0x00,
+  0xc2, 0x00, 0x00, 0xd8, 0x08, 0x42, 0x80, 0x24, 0x21, 0x99, 0x00, 0x00, 0xbd, 0x41, 0x08, 0xb3,
+  0x03, 0x19, 0xa1, 0x66, 0x31, 0x91, 0xe7, 0x39, 0x86, 0x2c, 0x63, 0x67, 0x35, 0xad, 0x3f, 0xd7,
+  0xbd, 0x37, 0xd7, 0xbd, 0x35, 0xf7, 0xbd, 0x30, 0x59, 0xce, 0x2c, 0x59, 0xce, 0x2b, 0x79, 0xce,
+  0x2b, 0xba, 0xd6, 0x2c, 0xba, 0xd6, 0x27, 0x1c, 0xe7, 0x22, 0xdb, 0xde, 0x23, 0x83, 0x1c, 0xe7,
+  0x23, 0x82, 0x5d, 0xef, 0x23, 0x81, 0x9e, 0xf7, 0x23, 0x01, 0x7d, 0xef, 0x21, 0x7d, 0xef, 0x20,
+  0x81, 0x9e, 0xf7, 0x23, 0x1b, 0xbe, 0xf7, 0x20, 0x9e, 0xf7, 0x24, 0x9e, 0xf7, 0x23, 0x7d, 0xef,
+  0x1f, 0x7d, 0xef, 0x1e, 0x7d, 0xef, 0x1b, 0x9e, 0xf7, 0x17, 0x7d, 0xef, 0x1b, 0xbe, 0xf7, 0x19,
+  0xbe, 0xf7, 0x18, 0xbe, 0xf7, 0x1a, 0x9e, 0xf7, 0x24, 0xbe, 0xf7, 0x1f, 0x5d, 0xef, 0x19, 0xbe,
+  0xf7, 0x1c, 0x9e, 0xf7, 0x24, 0xbe, 0xf7, 0x22, 0x7d, 0xef, 0x1e, 0x9e, 0xf7, 0x22, 0x9e, 0xf7,
+  0x23, 0x7d, 0xef, 0x1e, 0x9e, 0xf7, 0x23, 0xbe, 0xf7, 0x23, 0x7d, 0xef, 0x21, 0x7d, 0xef, 0x20,
+  0x9e, 0xf7, 0x24, 0xbe, 0xf7, 0x21, 0x9e, 0xf7, 0x22, 0x86, 0x9e, 0xf7, 0x23, 0x04, 0xbe, 0xf7,
+  0x1d, 0x7d, 0xef, 0x1e, 0x7d, 0xef, 0x21, 0x7d, 0xef, 0x20, 0xbe, 0xf7, 0x22, 0x87, 0x9e, 0xf7,
+  0x23, 0x84, 0x5d, 0xef, 0x23, 0x81, 0x1c, 0xe7, 0x23, 0x02, 0xdb, 0xde, 0x22, 0xfb, 0xde, 0x25,
+  0xba, 0xd6, 0x2b, 0x81, 0x79, 0xce, 0x2b, 0x1a, 0x59, 0xce, 0x2c, 0x38, 0xc6, 0x30, 0x17, 0xbe,
+  0x35, 0x96, 0xb5, 0x38, 0x35, 0xad, 0x3d, 0xf3, 0x9c, 0x45, 0x0b, 0x5b, 0x6b, 0x65, 0x29, 0x95,
+  0x44, 0x21, 0x99, 0x24, 0x21, 0x9a, 0x45, 0x29, 0x96, 0x66, 0x31, 0x90, 0x00, 0x00, 0xc6, 0x00,
+  0x00, 0xc5, 0xaa, 0x52, 0x73, 0x86, 0x31, 0x8f, 0x41, 0x08, 0xb8, 0x82, 0x10, 0xad, 0x44, 0x21,
+  0x96, 0xa7, 0x39, 0x8c, 0x08, 0x42, 0x85, 0x6d, 0x6b, 0x64, 0x55, 0xad, 0x3e, 0xd7, 0xbd, 0x33,
+  0x18, 0xc6, 0x31, 0x38, 0xc6, 0x30, 0x59, 0xce, 0x2b, 0x81, 0x79, 0xce, 0x2b, 0x02, 0xba, 0xd6,
+  0x2a, 0xba, 0xd6, 0x24, 0x1c, 0xe7, 0x22, 0x83, 0x1c, 0xe7, 0x23, 0x82, 0x5d, 0xef, 0x23, 0x0c,
+  0x5d, 0xef, 0x24, 0x9e, 0xf7, 0x23, 0x9e, 0xf7, 0x24, 0xbe, 0xf7, 0x1b, 0x7d, 0xef, 0x1e, 0x9e,
+  0xf7, 0x23, 0x5d, 0xef, 0x23, 0x7d, 0xef, 0x1f, 0xbe, 0xf7, 0x1f, 0x9e, 0xf7, 0x22, 0x9e, 0xf7,
+  0x23, 0x7d, 0xef, 0x20, 0xbe, 0xf7, 0x1a, 0x83, 0xbe, 0xf7, 0x19, 0x0f, 0xbe, 0xf7, 0x1a, 0xbe,
+  0xf7, 0x1c, 0xbe, 0xf7, 0x18, 0xbe, 0xf7, 0x19, 0xbe, 0xf7, 0x18, 0xbe, 0xf7, 0x1a, 0xbe, 0xf7,
+  0x19, 0xbe, 0xf7, 0x18, 0x9e, 0xf7, 0x22, 0x9e, 0xf7, 0x23, 0x7d, 0xef, 0x20, 0x9e, 0xf7, 0x23,
+  0x9e, 0xf7, 0x24, 0x7d, 0xef, 0x20, 0xbe, 0xf7, 0x1d, 0x9e, 0xf7, 0x22, 0x81, 0x9e, 0xf7, 0x23,
+  0x82, 0x5d, 0xef, 0x23, 0x08, 0x9e, 0xf7, 0x23, 0x5d, 0xef, 0x23, 0x9e, 0xf7, 0x24, 0xff, 0xff,
+  0x1e, 0x9e, 0xf7, 0x17, 0xbe, 0xf7, 0x18, 0xbe, 0xf7, 0x19, 0xbe, 0xf7, 0x18, 0xbe, 0xf7, 0x21,
+  0x89, 0x9e, 0xf7, 0x23, 0x83, 0x5d, 0xef, 0x23, 0x81, 0x1c, 0xe7, 0x23, 0x23, 0xdb, 0xde, 0x22,
+  0xba, 0xd6, 0x26, 0x9a, 0xd6, 0x2c, 0x79, 0xce, 0x2b, 0x59, 0xce, 0x2b, 0x38, 0xc6, 0x30, 0xd7,
+  0xbd, 0x31, 0x96, 0xb5, 0x38, 0x75, 0xad, 0x3b, 0x13, 0x9d, 0x43, 0x2b, 0x5b, 0x6b, 0xa6, 0x31,
+  0x8d, 0x65, 0x29, 0x93, 0x65, 0x29, 0x96, 0x65, 0x29, 0x91, 0xa6, 0x31, 0x8c, 0x00, 0x00, 0xc5,
+  0x20, 0x00, 0xb9, 0x4c, 0x63, 0x68, 0xc7, 0x39, 0x85, 0x82, 0x10, 0xad, 0xa3, 0x18, 0xa7, 0x45,
+  0x29, 0x93, 0xc7, 0x39, 0x87, 0x08, 0x42, 0x80, 0x6d, 0x6b, 0x60, 0x75, 0xad, 0x3e, 0xd7, 0xbd,
+  0x31, 0x18, 0xc6, 0x31, 0x38, 0xc6, 0x2e, 0x59, 0xce, 0x2b, 0x79, 0xce, 0x2b, 0xba, 0xd6, 0x2b,
+  0xdb, 0xde, 0x29, 0xba, 0xd6, 0x24, 0xdb, 0xde, 0x23, 0x83, 0x1c, 0xe7, 0x23, 0x81, 0x5d, 0xef,
+  0x23, 0x0b, 0x9e, 0xf7, 0x23, 0xbe, 0xf7, 0x20, 0x7d, 0xef, 0x21, 0x9e, 0xf7, 0x23, 0x5d, 0xef,
+  0x24, 0x7d, 0xef, 0x20, 0x9e, 0xf7, 0x23, 0x9e, 0xf7, 0x24, 0x9e, 0xf7, 0x23, 0x7d, 0xef, 0x1e,
+  0xbe, 0xf7, 0x1c, 0x5d, 0xef, 0x19, 0x86, 0xbe, 0xf7, 0x19, 0x03, 0xbe, 0xf7, 0x18, 0xbe, 0xf7,
+  0x19, 0x7d, 0xef, 0x1b, 0xbe, 0xf7, 0x1e, 0x81, 0xbe, 0xf7, 0x1d, 0x00, 0x9e, 0xf7, 0x22, 0x81,
+  0x9e, 0xf7, 0x23, 0x82, 0x9e, 0xf7, 0x24, 0x04, 0x9e, 0xf7, 0x22, 0x7d, 0xef, 0x1d, 0xbe, 0xf7,
+  0x1d, 0x7d, 0xef, 0x21, 0x5d, 0xef, 0x24, 0x84, 0x9e, 0xf7, 0x23, 0x04, 0x9e, 0xf7, 0x24, 0xbe,
+  0xf7, 0x21, 0xbe, 0xf7, 0x1a, 0x7d, 0xef, 0x1b, 0x9e, 0xf7, 0x22, 0x81, 0x9e, 0xf7, 0x23, 0x81,
+  0x9e, 0xf7, 0x24, 0x86, 0x9e, 0xf7, 0x23, 0x01, 0x5d, 0xef, 0x24, 0x9e, 0xf7, 0x23, 0x82, 0x5d,
+  0xef, 0x23, 0x82, 0x1c, 0xe7, 0x23, 0x1b, 0xdb, 0xde, 0x22, 0xdb, 0xde, 0x28, 0x9a, 0xd6, 0x2c,
+  0x79, 0xce, 0x2b, 0x59, 0xce, 0x2b, 0x18, 0xc6, 0x31, 0xd7, 0xbd, 0x37, 0x96, 0xb5, 0x36, 0x13,
+  0x9d, 0x42, 0x0c, 0x63, 0x69, 0xc7, 0x39, 0x88, 0x86, 0x31, 0x8f, 0x46, 0x31, 0x93, 0x65, 0x29,
+  0x91, 0xc7, 0x39, 0x89, 0x00, 0x00, 0xc2, 0x61, 0x08, 0xb1, 0x8e, 0x73, 0x61, 0x28, 0x42, 0x7e,
+  0xc3, 0x18, 0xa6, 0xe3, 0x18, 0xa2, 0x86, 0x31, 0x8f, 0x08, 0x42, 0x82, 0x49, 0x4a, 0x7d, 0x6e,
+  0x73, 0x5e, 0x55, 0xad, 0x3a, 0x18, 0xc6, 0x31, 0x59, 0xce, 0x30, 0x81, 0x59, 0xce, 0x2b, 0x03,
+  0x79, 0xce, 0x2b, 0xba, 0xd6, 0x2c, 0xba, 0xd6, 0x27, 0xdb, 0xde, 0x22, 0x83, 0x1c, 0xe7, 0x23,
+  0x82, 0x5d, 0xef, 0x23, 0x00, 0x9e, 0xf7, 0x23, 0x81, 0x9e, 0xf7, 0x22, 0x09, 0x9e, 0xf7, 0x24,
+  0xbe, 0xf7, 0x1c, 0x9e, 0xf7, 0x17, 0x9e, 0xf7, 0x22, 0xbe, 0xf7, 0x1f, 0x5d, 0xef, 0x19, 0xbe,
+  0xf7, 0x1b, 0x9e, 0xf7, 0x26, 0xbe, 0xf7, 0x1d, 0xbe, 0xf7, 0x18, 0x84, 0xbe, 0xf7, 0x19, 0x03,
+  0xff, 0xff, 0x18, 0xbe, 0xf7, 0x1b, 0x9e, 0xf7, 0x22, 0x5d, 0xef, 0x23, 0x81, 0x9e, 0xf7, 0x24,
+  0x81, 0x9e, 0xf7, 0x22, 0x82, 0x9e, 0xf7, 0x23, 0x05, 0x7d, 0xef, 0x20, 0x7d, 0xef, 0x21, 0x7d,
+  0xef, 0x1f, 0xbe, 0xf7, 0x1a, 0xbe, 0xf7, 0x1c, 0xbe, 0xf7, 0x21, 0x86, 0x9e, 0xf7, 0x23, 0x07,
+  0x9e, 0xf7, 0x24, 0x7d, 0xef, 0x21, 0xbe, 0xf7, 0x1a, 0x7d, 0xef, 0x21, 0x9e, 0xf7, 0x24, 0x9e,
+  0xf7, 0x23, 0xbe, 0xf7, 0x20, 0x7d, 0xef, 0x20, 0x81, 0xbe, 0xf7, 0x1a, 0x07, 0xbe, 0xf7, 0x1c,
+  0x9e, 0xf7, 0x22, 0x9e, 0xf7, 0x24, 0xbe, 0xf7, 0x23, 0x9e, 0xf7, 0x24, 0x7d, 0xef, 0x21, 0x7d,
+  0xef, 0x1b, 0x9e, 0xf7, 0x22, 0x82, 0x5d, 0xef, 0x23, 0x82, 0x1c, 0xe7, 0x23, 0x20, 0xdb, 0xde,
+  0x23, 0xdb, 0xde, 0x29, 0x9a, 0xd6, 0x2c, 0x59, 0xce, 0x2b, 0x38, 0xc6, 0x31, 0xb6, 0xb5, 0x33,
+  0xb7, 0xbd, 0x37, 0x14, 0xa5, 0x41, 0x2d, 0x6b, 0x64, 0x08, 0x42, 0x83, 0xa6, 0x31, 0x8b, 0x86,
+  0x31, 0x8d, 0x65, 0x29, 0x91, 0xe7, 0x39, 0x84, 0x20, 0x00, 0xbf, 0x82, 0x10, 0xaa, 0xcf, 0x7b,
+  0x5b, 0x69, 0x4a, 0x75, 0xc3, 0x18, 0xa5, 0xe3, 0x18, 0xa0, 0xa6, 0x31, 0x8e, 0x28, 0x42, 0x82,
+  0x49, 0x4a, 0x7d, 0x8e, 0x73, 0x5c, 0x95, 0xad, 0x38, 0x18, 0xc6, 0x31, 0x59, 0xce, 0x30, 0x59,
+  0xce, 0x2b, 0x79, 0xce, 0x2b, 0x9a, 0xd6, 0x2c, 0xdb, 0xde, 0x28, 0xba, 0xd6, 0x24, 0xdb, 0xde,
+  0x23, 0x82, 0x1c, 0xe7, 0x23, 0x83, 0x5d, 0xef, 0x23, 0x82, 0x9e, 0xf7, 0x23, 0x04, 0x9e, 0xf7,
+  0x24, 0xbe, 0xf7, 0x1b, 0xbe, 0xf7, 0x18, 0x5d, 0xef, 0x23, 0x7d, 0xef, 0x1f, 0x81, 0xbe, 0xf7,
+  0x19, 0x02, 0x7d, 0xef, 0x1d, 0xbe, 0xf7, 0x1b, 0xbe, 0xf7, 0x19, 0x82, 0xbe, 0xf7, 0x18, 0x81,
+  0xbe, 0xf7, 0x19, 0x02, 0xff, 0xff, 0x18, 0xbe, 0xf7, 0x1c, 0x9e, 0xf7, 0x24, 0x81, 0x9e, 0xf7,
+  0x23, 0x02, 0x9e, 0xf7, 0x24, 0xbe, 0xf7, 0x1a, 0x7d, 0xef, 0x1f, 0x81, 0x9e, 0xf7, 0x24, 0x00,
+  0x7d, 0xef, 0x1c, 0x82, 0xbe, 0xf7, 0x18, 0x01, 0xff, 0xff, 0x17, 0xbe, 0xf7, 0x1d, 0x83, 0x9e,
+  0xf7, 0x24, 0x0b, 0x9e, 0xf7, 0x23, 0x9e, 0xf7, 0x22, 0xbe, 0xf7, 0x1e, 0x9e, 0xf7, 0x24, 0x9e,
+  0xf7, 0x23, 0x9e, 0xf7, 0x24, 0xff, 0xff, 0x1b, 0x7d, 0xef, 0x1e, 0x9e, 0xf7, 0x24, 0x9e, 0xf7,
+  0x23, 0xbe, 0xf7, 0x1a, 0xbe, 0xf7, 0x18, 0x81, 0xbe, 0xf7, 0x19, 0x08, 0xbe, 0xf7, 0x18, 0xbe,
+  0xf7, 0x1a, 0xbe, 0xf7, 0x1c, 0xbe, 0xf7, 0x1b, 0x9e, 0xf7, 0x22, 0xbe, 0xf7, 0x1c, 0xbe, 0xf7,
+  0x18, 0xbe, 0xf7, 0x22, 0x9e, 0xf7, 0x23, 0x81, 0x5d, 0xef, 0x23, 0x82, 0x1c, 0xe7, 0x23, 0x09,
+  0xdb, 0xde, 0x22, 0x9a, 0xd6, 0x29, 0x9a, 0xd6, 0x2c, 0x59, 0xce, 0x2b, 0x38, 0xc6, 0x31, 0xb6,
+  0xb5, 0x32, 0xb7, 0xbd, 0x37, 0x34, 0xa5, 0x40, 0x6d, 0x6b, 0x60, 0x08, 0x42, 0x84, 0x81, 0xa7,
+  0x39, 0x8a, 0x13, 0x86, 0x31, 0x8e, 0x28, 0x42, 0x81, 0x20, 0x00, 0xbd, 0xe4, 0x20, 0xa0, 0x2f,
+  0x7c, 0x56, 0x6a, 0x52, 0x73, 0xc3, 0x18, 0xa4, 0x04, 0x21, 0x9e, 0xa6, 0x31, 0x8e, 0x28, 0x42,
+  0x83, 0x49, 0x4a, 0x7c, 0xae, 0x73, 0x5a, 0xb6, 0xb5, 0x38, 0x18, 0xc6, 0x31, 0x59, 0xce, 0x30,
+  0x59, 0xce, 0x2b, 0x79, 0xce, 0x2b, 0x9a, 0xd6, 0x2c, 0xba, 0xd6, 0x27, 0xdb, 0xde, 0x22, 0x83,
+  0x1c, 0xe7, 0x23, 0x83, 0x5d, 0xef, 0x23, 0x81, 0x9e, 0xf7, 0x23, 0x11, 0x5d, 0xef, 0x23, 0x5d,
+  0xef, 0x24, 0xbe, 0xf7, 0x1b, 0x9e, 0xf7, 0x17, 0xbe, 0xf7, 0x22, 0x9e, 0xf7, 0x24, 0x9e, 0xf7,
+  0x23, 0x7d, 0xef, 0x1d, 0xbe, 0xf7, 0x18, 0x5d, 0xef, 0x19, 0xbe, 0xf7, 0x19, 0xbe, 0xf7, 0x1c,
+  0x7d, 0xef, 0x1f, 0xbe, 0xf7, 0x1e, 0xbe, 0xf7, 0x1a, 0xbe, 0xf7, 0x18, 0xbe, 0xf7, 0x1a, 0x9e,
+  0xf7, 0x25, 0x83, 0x9e, 0xf7, 0x23, 0x04, 0xbe, 0xf7, 0x1f, 0x9e, 0xf7, 0x22, 0x9e, 0xf7, 0x23,
+  0xbe, 0xf7, 0x1e, 0xff, 0xff, 0x18, 0x84, 0xbe, 0xf7, 0x19, 0x07, 0xbe, 0xf7, 0x1c, 0xbe, 0xf7,
+  0x1e, 0x7d, 0xef, 0x1e, 0xbe, 0xf7, 0x1d, 0x9e, 0xf7, 0x23, 0x9e, 0xf7, 0x22, 0x7d, 0xef, 0x1e,
+  0x9e, 0xf7, 0x24, 0x81, 0x9e, 0xf7, 0x23, 0x01, 0x7d, 0xef, 0x20, 0x7d, 0xef, 0x21, 0x81, 0x9e,
+  0xf7, 0x23, 0x85, 0xbe, 0xf7, 0x19, 0x05, 0xbe, 0xf7, 0x18, 0x9e, 0xf7, 0x17, 0x7d, 0xef, 0x20,
+  0x9e, 0xf7, 0x24, 0xbe, 0xf7, 0x1a, 0x9e, 0xf7, 0x22, 0x84, 0x5d, 0xef, 0x23, 0x1b, 0xdb, 0xde,
+  0x23, 0x9a, 0xd6, 0x23, 0xdb, 0xde, 0x29, 0x9a, 0xd6, 0x2c, 0x79, 0xce, 0x2b, 0x38, 0xc6, 0x31,
+  0xf7, 0xbd, 0x32, 0xb6, 0xb5, 0x38, 0x75, 0xad, 0x3e, 0x8d, 0x6b, 0x5d, 0x08, 0x42, 0x82, 0xc7,
+  0x39, 0x8a, 0xc6, 0x31, 0x8c, 0x87, 0x39, 0x8d, 0x28, 0x42, 0x81, 0x20, 0x00, 0xbf, 0x24, 0x21,
+  0x9a, 0x30, 0x84, 0x53, 0x8a, 0x52, 0x72, 0xe4, 0x20, 0xa4, 0x04, 0x21, 0x9d, 0xa6, 0x31, 0x8d,
+  0x28, 0x42, 0x83, 0x49, 0x4a, 0x7b, 0xae, 0x73, 0x5a, 0x96, 0xb5, 0x38, 0x18, 0xc6, 0x31, 0x59,
+  0xce, 0x30, 0x81, 0x79, 0xce, 0x2b, 0x02, 0x9a, 0xd6, 0x2c, 0xba, 0xd6, 0x27, 0xdb, 0xde, 0x22,
+  0x82, 0x1c, 0xe7, 0x23, 0x84, 0x5d, 0xef, 0x23, 0x81, 0x9e, 0xf7, 0x23, 0x81, 0x9e, 0xf7, 0x24,
+  0x02, 0xbe, 0xf7, 0x1b, 0x7d, 0xef, 0x1c, 0xbe, 0xf7, 0x22, 0x81, 0x9e, 0xf7, 0x23, 0x0a, 0x9e,
+  0xf7, 0x24, 0x7d, 0xef, 0x21, 0xbe, 0xf7, 0x1a, 0xbe, 0xf7, 0x1c, 0xbe, 0xf7, 0x1b, 0x9e, 0xf7,
+  0x22, 0xbe, 0xf7, 0x1d, 0xbe, 0xf7, 0x18, 0xbe, 0xf7, 0x19, 0xff, 0xff, 0x19, 0xbe, 0xf7, 0x20,
+  0x86, 0x9e, 0xf7, 0x23, 0x83, 0xbe, 0xf7, 0x19, 0x03, 0xbe, 0xf7, 0x18, 0xbe, 0xf7, 0x1b, 0xbe,
+  0xf7, 0x20, 0x7d, 0xef, 0x1b, 0x81, 0x9e, 0xf7, 0x17, 0x00, 0x7d, 0xef, 0x1c, 0x81, 0x9e, 0xf7,
+  0x23, 0x00, 0x9e, 0xf7, 0x22, 0x83, 0x9e, 0xf7, 0x23, 0x03, 0x9e, 0xf7, 0x24, 0x7d, 0xef, 0x1e,
+  0x9e, 0xf7, 0x22, 0x7d, 0xef, 0x1e, 0x82, 0xbe, 0xf7, 0x19, 0x06, 0xbe, 0xf7, 0x18, 0x7d, 0xef,
+  0x1c, 0xbe, 0xf7, 0x24, 0xbe, 0xf7, 0x1b, 0x7d, 0xef, 0x1f, 0xbe, 0xf7, 0x1f, 0x7d, 0xef, 0x21,
+  0x81, 0x9e, 0xf7, 0x23, 0x83, 0x5d, 0xef, 0x23, 0x02, 0x1c, 0xe7, 0x22, 0xba, 0xd6, 0x26, 0xba,
+  0xd6, 0x2b, 0x81, 0x79, 0xce, 0x2b, 0x1c, 0x38, 0xc6, 0x31, 0xb6, 0xb5, 0x32, 0xb6, 0xb5, 0x38,
+  0x55, 0xad, 0x3d, 0x6d, 0x6b, 0x5e, 0x08, 0x42, 0x84, 0xe7, 0x39, 0x88, 0xc6, 0x31, 0x8b, 0xc7,
+  0x39, 0x8d, 0x08, 0x42, 0x82, 0x00, 0x00, 0xbc, 0x24, 0x21, 0x95, 0x31, 0x8c, 0x53, 0x8a, 0x52,
+  0x73, 0xe3, 0x18, 0xa3, 0x04, 0x21, 0x9e, 0x86, 0x31, 0x8f, 0x08, 0x42, 0x84, 0x69, 0x4a, 0x7c,
+  0x8e, 0x73, 0x5b, 0x96, 0xb5, 0x39, 0x18, 0xc6, 0x31, 0x59, 0xce, 0x30, 0x59, 0xce, 0x2b, 0x79,
+  0xce, 0x2b, 0x9a, 0xd6, 0x2c, 0xdb, 0xde, 0x28, 0xdb, 0xde, 0x22, 0xdb, 0xde, 0x23, 0x81, 0x1c,
+  0xe7, 0x23, 0x83, 0x5d, 0xef, 0x23, 0x06, 0x9e, 0xf7, 0x23, 0x9e, 0xf7, 0x24, 0xbe, 0xf7, 0x1e,
+  0x7d, 0xef, 0x1d, 0x9e, 0xf7, 0x24, 0xbe, 0xf7, 0x1a, 0x7d, 0xef, 0x1f, 0x81, 0x9e, 0xf7, 0x23,
+  0x03, 0x5d, 0xef, 0x23, 0x9e, 0xf7, 0x23, 0x9e, 0xf7, 0x25, 0x7d, 0xef, 0x20, 0x81, 0xbe, 0xf7,
+  0x18, 0x05, 0xbe, 0xf7, 0x1e, 0x7d, 0xef, 0x1f, 0xbe, 0xf7, 0x19, 0xbe, 0xf7, 0x18, 0xff, 0xff,
+  0x19, 0xbe, 0xf7, 0x22, 0x84, 0x9e, 0xf7, 0x24, 0x81, 0x5d, 0xef, 0x24, 0x00, 0x9e, 0xf7, 0x22,
+  0x84, 0xbe, 0xf7, 0x19, 0x04, 0x9e, 0xf7, 0x17, 0xbe, 0xf7, 0x1d, 0x9e, 0xf7, 0x22, 0x7d, 0xef,
+  0x21, 0x9e, 0xf7, 0x22, 0x81, 0x7d, 0xef, 0x21, 0x00, 0x9e, 0xf7, 0x22, 0x83, 0x9e, 0xf7, 0x23,
+  0x81, 0x9e, 0xf7, 0x24, 0x0a, 0x9e, 0xf7, 0x23, 0xbe, 0xf7, 0x21, 0xbe, 0xf7, 0x18, 0xbe, 0xf7,
+  0x1a, 0xbe, 0xf7, 0x18, 0xbe, 0xf7, 0x19, 0x7d, 0xef, 0x1f, 0x9e, 0xf7, 0x23, 0x7d, 0xef, 0x21,
+  0x9e, 0xf7, 0x22, 0x9e, 0xf7, 0x24, 0x82, 0x9e, 0xf7, 0x23, 0x82, 0x5d, 0xef, 0x23, 0x81, 0x1c,
+  0xe7, 0x23, 0x1a, 0xdb, 0xde, 0x21, 0xdb, 0xde, 0x29, 0x9a, 0xd6, 0x2c, 0x79, 0xce, 0x2b, 0x38,
+  0xc6, 0x31, 0xd7, 0xbd, 0x36, 0x96, 0xb5, 0x38, 0x75, 0xad, 0x3c, 0x4d, 0x6b, 0x61, 0xe7, 0x39,
+  0x89, 0xc7, 0x39, 0x88, 0xa6, 0x31, 0x8c, 0xa6, 0x31, 0x8e, 0xe8, 0x41, 0x87, 0x00, 0x00, 0xb8,
+  0x45, 0x29, 0x93, 0x31, 0x8c, 0x53, 0x6a, 0x52, 0x74, 0xc2, 0x10, 0xa7, 0xe3, 0x18, 0xa0, 0x86,
+  0x31, 0x91, 0xe7, 0x39, 0x86, 0x49, 0x4a, 0x7e, 0x8e, 0x73, 0x5e, 0x75, 0xad, 0x3d, 0x17, 0xbe,
+  0x31, 0x38, 0xc6, 0x30, 0x81, 0x59, 0xce, 0x2b, 0x04, 0x79, 0xce, 0x2b, 0x9a, 0xd6, 0x2c, 0xdb,
+  0xde, 0x2a, 0xba, 0xd6, 0x24, 0x1c, 0xe7, 0x22, 0x81, 0x1c, 0xe7, 0x23, 0x83, 0x5d, 0xef, 0x23,
+  0x05, 0x9e, 0xf7, 0x23, 0x7d, 0xef, 0x21, 0x7d, 0xef, 0x1e, 0x9e, 0xf7, 0x22, 0xbe, 0xf7, 0x20,
+  0x7d, 0xef, 0x1e, 0x83, 0x9e, 0xf7, 0x23, 0x0a, 0x9e, 0xf7, 0x24, 0x7d, 0xef, 0x1f, 0xbe, 0xf7,
+  0x18, 0xbe, 0xf7, 0x19, 0x7d, 0xef, 0x1d, 0xbe, 0xf7, 0x1f, 0xbe, 0xf7, 0x1a, 0xbe, 0xf7, 0x19,
+  0x5d, 0xef, 0x1a, 0xbe, 0xf7, 0x1d, 0xbe, 0xf7, 0x1c, 0x83, 0xbe, 0xf7, 0x1d, 0x00, 0xbe, 0xf7,
+  0x1e, 0x81, 0x7d, 0xef, 0x1f, 0x01, 0xbe, 0xf7, 0x19, 0xbe, 0xf7, 0x18, 0x81, 0xbe, 0xf7, 0x19,
+  0x04, 0xbe, 0xf7, 0x18, 0xbe, 0xf7, 0x1c, 0xbe, 0xf7, 0x23, 0x9e, 0xf7, 0x25, 0xbe, 0xf7, 0x20,
+  0x82, 0xbe, 0xf7, 0x19, 0x10, 0xbe, 0xf7, 0x1b, 0x9e, 0xf7, 0x24, 0x9e, 0xf7, 0x23, 0x9e, 0xf7,
+  0x24, 0xbe, 0xf7, 0x1f, 0xbe, 0xf7, 0x1c, 0x9e, 0xf7, 0x22, 0x9e, 0xf7, 0x24, 0x7d, 0xef, 0x1f,
+  0xbe, 0xf7, 0x1f, 0x9e, 0xf7, 0x23, 0x7d, 0xef, 0x1d, 0xbe, 0xf7, 0x1c, 0x9e, 0xf7, 0x25, 0x7d,
+  0xef, 0x1d, 0xbe, 0xf7, 0x1a, 0x9e, 0xf7, 0x22, 0x82, 0x9e, 0xf7, 0x23, 0x83, 0x5d, 0xef, 0x23,
+  0x1e, 0x1c, 0xe7, 0x23, 0x1c, 0xe7, 0x22, 0xfb, 0xde, 0x25, 0xba, 0xd6, 0x2b, 0x79, 0xce, 0x2b,
+  0x59, 0xce, 0x2b, 0x18, 0xc6, 0x31, 0xd7, 0xbd, 0x37, 0x75, 0xad, 0x38, 0x76, 0xb5, 0x3f, 0x4d,
+  0x6b, 0x62, 0xa7, 0x39, 0x8b, 0xa6, 0x31, 0x8c, 0x86, 0x31, 0x8f, 0x85, 0x29, 0x8e, 0xc7, 0x39,
+  0x8b, 0x00, 0x00, 0xb9, 0x66, 0x31, 0x8f, 0x71, 0x8c, 0x51, 0x69, 0x4a, 0x77, 0x82, 0x10, 0xad,
+  0xc3, 0x18, 0xa3, 0x65, 0x29, 0x94, 0xa7, 0x39, 0x89, 0x08, 0x42, 0x80, 0x8d, 0x6b, 0x61, 0x54,
+  0xa5, 0x3e, 0xf7, 0xbd, 0x36, 0x18, 0xc6, 0x31, 0x38, 0xc6, 0x30, 0x59, 0xce, 0x2b, 0x81, 0x79,
+  0xce, 0x2b, 0x02, 0xba, 0xd6, 0x2c, 0x9a, 0xd6, 0x29, 0xdb, 0xde, 0x23, 0x83, 0x1c, 0xe7, 0x23,
+  0x82, 0x5d, 0xef, 0x23, 0x06, 0x9e, 0xf7, 0x23, 0x9e, 0xf7, 0x24, 0x5d, 0xef, 0x23, 0x5d, 0xef,
+  0x24, 0x9e, 0xf7, 0x24, 0x9e, 0xf7, 0x23, 0x5d, 0xef, 0x23, 0x81, 0x9e, 0xf7, 0x23, 0x05, 0x9e,
+  0xf7, 0x24, 0x7d, 0xef, 0x1f, 0xff, 0xff, 0x17, 0xbe, 0xf7, 0x18, 0xbe, 0xf7, 0x19, 0xbe, 0xf7,
+  0x1a, 0x82, 0xbe, 0xf7, 0x19, 0x02, 0x7d, 0xef, 0x1d, 0xbe, 0xf7, 0x1b, 0xff, 0xff, 0x17, 0x81,
+  0xbe, 0xf7, 0x18, 0x0c, 0x9e, 0xf7, 0x17, 0xbe, 0xf7, 0x1c, 0x7d, 0xef, 0x1e, 0xbe, 0xf7, 0x1d,
+  0x9e, 0xf7, 0x22, 0x7d, 0xef, 0x1d, 0xbe, 0xf7, 0x18, 0xbe, 0xf7, 0x19, 0xbe, 0xf7, 0x18, 0xbe,
+  0xf7, 0x1c, 0xbe, 0xf7, 0x1f, 0xbe, 0xf7, 0x1e, 0x7d, 0xef, 0x1e, 0x81, 0xbe, 0xf7, 0x19, 0x00,
+  0xbe, 0xf7, 0x22, 0x82, 0x9e, 0xf7, 0x23, 0x00, 0x9e, 0xf7, 0x24, 0x81, 0x7d, 0xef, 0x1f, 0x81,
+  0x9e, 0xf7, 0x23, 0x81, 0x9e, 0xf7, 0x24, 0x82, 0x9e, 0xf7, 0x23, 0x02, 0x9e, 0xf7, 0x24, 0x7d,
+  0xef, 0x20, 0x7d, 0xef, 0x1f, 0x82, 0x9e, 0xf7, 0x23, 0x83, 0x5d, 0xef, 0x23, 0x81, 0x1c, 0xe7,
+  0x23, 0x1e, 0xdb, 0xde, 0x24, 0xdb, 0xde, 0x2a, 0x9a, 0xd6, 0x2c, 0x59, 0xce, 0x2b, 0x79, 0xce,
+  0x2d, 0x18, 0xc6, 0x31, 0xd7, 0xbd, 0x37, 0x55, 0xad, 0x3b, 0x55, 0xad, 0x41, 0x2c, 0x63, 0x62,
+  0xa6, 0x31, 0x8e, 0x86, 0x31, 0x8f, 0x65, 0x29, 0x90, 0x86, 0x31, 0x8f, 0xa7, 0x39, 0x8d, 0x00,
+  0x00, 0xba, 0x66, 0x31, 0x8d, 0x51, 0x8c, 0x50, 0x28, 0x42, 0x7a, 0x61, 0x08, 0xb2, 0xa2, 0x10,
+  0xa8, 0x24, 0x21, 0x9b, 0x65, 0x29, 0x90, 0xe7, 0x39, 0x85, 0x6d, 0x6b, 0x63, 0x54, 0xa5, 0x3f,
+  0xf7, 0xbd, 0x36, 0x18, 0xc6, 0x32, 0x38, 0xc6, 0x30, 0x59, 0xce, 0x2c, 0x79, 0xce, 0x2a, 0x81,
+  0xba, 0xd6, 0x2b, 0x02, 0x9a, 0xd6, 0x2d, 0xfb, 0xde, 0x25, 0x1c, 0xe7, 0x22, 0x83, 0x1c, 0xe7,
+  0x23, 0x85, 0x5d, 0xef, 0x23, 0x86, 0x9e, 0xf7, 0x23, 0x00, 0x7d, 0xef, 0x1e, 0x82, 0xbe, 0xf7,
+  0x1b, 0x02, 0xff, 0xff, 0x18, 0xbe, 0xf7, 0x18, 0xbe, 0xf7, 0x1c, 0x81, 0x9e, 0xf7, 0x24, 0x00,
+  0x7d, 0xef, 0x1f, 0x81, 0xbe, 0xf7, 0x1b, 0x00, 0x7d, 0xef, 0x1c, 0x81, 0xbe, 0xf7, 0x1b, 0x02,
+  0x7d, 0xef, 0x1b, 0x5d, 0xef, 0x23, 0x5d, 0xef, 0x24, 0x83, 0x7d, 0xef, 0x21, 0x04, 0x7d, 0xef,
+  0x20, 0x7d, 0xef, 0x21, 0xbe, 0xf7, 0x1c, 0x7d, 0xef, 0x1b, 0xbe, 0xf7, 0x19, 0x84, 0x9e, 0xf7,
+  0x23, 0x02, 0x9e, 0xf7, 0x24, 0x5d, 0xef, 0x24, 0x5d, 0xef, 0x23, 0x87, 0x9e, 0xf7, 0x23, 0x01,
+  0x9e, 0xf7, 0x24, 0x9e, 0xf7, 0x23, 0x84, 0x5d, 0xef, 0x23, 0x81, 0x1c, 0xe7, 0x23, 0x26, 0x1c,
+  0xe7, 0x22, 0xba, 0xd6, 0x27, 0x9a, 0xd6, 0x2c, 0x79, 0xce, 0x2b, 0x59, 0xce, 0x2c, 0x38, 0xc6,
+  0x30, 0xf7, 0xbd, 0x32, 0x96, 0xb5, 0x38, 0x34, 0xa5, 0x3d, 0x55, 0xad, 0x41, 0x2c, 0x63, 0x63,
+  0xa6, 0x31, 0x8e, 0x66, 0x31, 0x8e, 0x46, 0x31, 0x92, 0x86, 0x31, 0x90, 0xa7, 0x39, 0x8d, 0x00,
+  0x00, 0xba, 0x66, 0x31, 0x8d, 0x31, 0x8c, 0x56, 0xe8, 0x41, 0x83, 0x20, 0x00, 0xbb, 0x61, 0x08,
+  0xaf, 0xe3, 0x18, 0xa1, 0x24, 0x21, 0x9a, 0xc7, 0x39, 0x8c, 0x2c, 0x63, 0x68, 0x14, 0xa5, 0x43,
+  0xb7, 0xbd, 0x37, 0xf7, 0xbd, 0x36, 0x18, 0xc6, 0x31, 0x38, 0xc6, 0x31, 0x38, 0xc6, 0x2d, 0x79,
+  0xce, 0x2a, 0x79, 0xce, 0x2b, 0xba, 0xd6, 0x2b, 0xdb, 0xde, 0x29, 0xdb, 0xde, 0x24, 0xba, 0xd6,
+  0x24, 0xdb, 0xde, 0x23, 0x82, 0x1c, 0xe7, 0x23, 0x89, 0x5d, 0xef, 0x23, 0x81, 0x9e, 0xf7, 0x23,
+  0x83, 0x5d, 0xef, 0x24, 0x81, 0x7d, 0xef, 0x20, 0x00, 0x5d, 0xef, 0x24, 0x81, 0x9e, 0xf7, 0x23,
+  0x01, 0x5d, 0xef, 0x24, 0x9e, 0xf7, 0x24, 0x81, 0x5d, 0xef, 0x24, 0x81, 0x9e, 0xf7, 0x24, 0x03,
+  0x5d, 0xef, 0x24, 0x5d, 0xef, 0x23, 0x9e, 0xf7, 0x23, 0x5d, 0xef, 0x24, 0x81, 0x9e, 0xf7, 0x23,
+  0x00, 0x9e, 0xf7, 0x24, 0x81, 0x5d, 0xef, 0x24, 0x81, 0x9e, 0xf7, 0x24, 0x00, 0x7d, 0xef, 0x20,
+  0x86, 0x9e, 0xf7, 0x23, 0x8e, 0x5d, 0xef, 0x23, 0x81, 0x1c, 0xe7, 0x23, 0x24, 0xdb, 0xde, 0x22,
+  0xfb, 0xde, 0x25, 0xba, 0xd6, 0x2a, 0x79, 0xce, 0x2b, 0x79, 0xce, 0x2a, 0x38, 0xc6, 0x30, 0xf7,
+  0xbd, 0x32, 0xd7, 0xbd, 0x37, 0x75, 0xad, 0x38, 0x55, 0xad, 0x3c, 0xf3, 0x9c, 0x43, 0x2c, 0x63,
+  0x66, 0xa6, 0x31, 0x8c, 0x45, 0x29, 0x94, 0x45, 0x29, 0x98, 0x65, 0x29, 0x92, 0xa7, 0x39, 0x8a,
+  0x00, 0x00, 0xb9, 0x44, 0x21, 0x94, 0xcf, 0x7b, 0x5b, 0x86, 0x31, 0x8e, 0x00, 0x00, 0xc9, 0x20,
+  0x00, 0xbb, 0x81, 0x08, 0xad, 0xe3, 0x18, 0xa2, 0x86, 0x31, 0x92, 0xec, 0x62, 0x6a, 0xf3, 0x9c,
+  0x43, 0x96, 0xb5, 0x37, 0xd7, 0xbd, 0x36, 0xd7, 0xbd, 0x33, 0x17, 0xbe, 0x31, 0x18, 0xc6, 0x31,
+  0x59, 0xce, 0x2c, 0x79, 0xce, 0x2a, 0xba, 0xd6, 0x2a, 0x9a, 0xd6, 0x2c, 0x81, 0xba, 0xd6, 0x2b,
+  0x81, 0xdb, 0xde, 0x23, 0x82, 0x1c, 0xe7, 0x23, 0x89, 0x5d, 0xef, 0x23, 0x81, 0x9e, 0xf7, 0x23,
+  0x82, 0x5d, 0xef, 0x23, 0x81, 0x5d, 0xef, 0x24, 0x01, 0x5d, 0xef, 0x23, 0x9e, 0xf7, 0x23, 0x88,
+  0x5d, 0xef, 0x23, 0x81, 0x9e, 0xf7, 0x23, 0x86, 0x5d, 0xef, 0x23, 0x01, 0x5d, 0xef, 0x24, 0x5d,
+  0xef, 0x23, 0x81, 0x9e, 0xf7, 0x23, 0x00, 0x5d, 0xef, 0x23, 0x81, 0x9e, 0xf7, 0x23, 0x8e, 0x5d,
+  0xef, 0x23, 0x26, 0x5d, 0xef, 0x22, 0x1c, 0xe7, 0x23, 0x1c, 0xe7, 0x22, 0xba, 0xd6, 0x24, 0xba,
+  0xd6, 0x2a, 0x9a, 0xd6, 0x2c, 0x79, 0xce, 0x2a, 0x39, 0xce, 0x2d, 0xf7, 0xbd, 0x30, 0xf7, 0xbd,
+  0x36, 0xb7, 0xbd, 0x37, 0x55, 0xad, 0x3a, 0x34, 0xa5, 0x3f, 0xb3, 0x9c, 0x47, 0x2c, 0x63, 0x68,
+  0x86, 0x31, 0x90, 0x44, 0x21, 0x99, 0x45, 0x29, 0x98, 0x45, 0x29, 0x95, 0x86, 0x31, 0x8f, 0x00,
+  0x00, 0xba, 0x04, 0x21, 0x9e, 0x6d, 0x6b, 0x64, 0x04, 0x21, 0xa1, 0x00, 0x00, 0xdd, 0x00, 0x00,
+  0xcd, 0x00, 0x00, 0xbe, 0x61, 0x08, 0xb1, 0x24, 0x21, 0x9a, 0xaa, 0x52, 0x6f, 0xd3, 0x9c, 0x48,
+  0x35, 0xad, 0x3d, 0x75, 0xad, 0x3a, 0xb7, 0xbd, 0x38, 0xd7, 0xbd, 0x34, 0xf7, 0xbd, 0x32, 0x18,
+  0xc6, 0x31, 0x38, 0xc6, 0x2e, 0x59, 0xce, 0x2c, 0x81, 0x79, 0xce, 0x2b, 0x02, 0xba, 0xd6, 0x2b,
+  0xba, 0xd6, 0x2a, 0x9a, 0xd6, 0x29, 0x81, 0x1c, 0xe7, 0x22, 0x81, 0xdb, 0xde, 0x23, 0x85, 0x1c,
+  0xe7, 0x23, 0xae, 0x5d, 0xef, 0x23, 0x82, 0x1c, 0xe7, 0x23, 0x81, 0x1c, 0xe7, 0x22, 0x03, 0xfb,
+  0xde, 0x25, 0xfb, 0xde, 0x26, 0xba, 0xd6, 0x2a, 0xba, 0xd6, 0x2b, 0x81, 0x79, 0xce, 0x2b, 0x21,
+  0x59, 0xce, 0x2f, 0x37, 0xbe, 0x30, 0xd7, 0xbd, 0x35, 0xb7, 0xbd, 0x37, 0x96, 0xb5, 0x38, 0x55,
+  0xad, 0x3e, 0xf4, 0xa4, 0x42, 0x71, 0x8c, 0x4d, 0xeb, 0x5a, 0x6d, 0x65, 0x29, 0x94, 0x04, 0x21,
+  0x9c, 0x24, 0x21, 0x9b, 0x45, 0x29, 0x99, 0x66, 0x31, 0x94, 0x00, 0x00, 0xba, 0xa2, 0x10, 0xa7,
+  0xcb, 0x5a, 0x6e, 0xa2, 0x10, 0xb5, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xdb, 0x00, 0x00, 0xcd, 0x00,
+  0x00, 0xbe, 0xa2, 0x10, 0xa9, 0x69, 0x4a, 0x7b, 0x51, 0x8c, 0x4d, 0x14, 0xa5, 0x41, 0x14, 0xa5,
+  0x40, 0x75, 0xad, 0x3c, 0x55, 0xad, 0x3a, 0xb6, 0xb5, 0x37, 0xd7, 0xbd, 0x36, 0xd7, 0xbd, 0x34,
+  0x18, 0xc6, 0x32, 0x38, 0xc6, 0x30, 0x82, 0x59, 0xce, 0x2c, 0x06, 0xba, 0xd6, 0x2a, 0xdb, 0xde,
+  0x28, 0xdb, 0xde, 0x29, 0xba, 0xd6, 0x27, 0xdb, 0xde, 0x23, 0xdb, 0xde, 0x24, 0xdb, 0xde, 0x23,
+  0x88, 0x1c, 0xe7, 0x22, 0x8c, 0x5d, 0xef, 0x22, 0x81, 0x1c, 0xe7, 0x23, 0x02, 0x1c, 0xe7, 0x22,
+  0x5d, 0xef, 0x22, 0x1c, 0xe7, 0x23, 0x82, 0x5d, 0xef, 0x22, 0x81, 0x1c, 0xe7, 0x23, 0x04, 0x5d,
+  0xef, 0x22, 0x1c, 0xe7, 0x23, 0x5d, 0xef, 0x22, 0x1c, 0xe7, 0x23, 0x5d, 0xef, 0x22, 0x8d, 0x1c,
+  0xe7, 0x22, 0x00, 0x1c, 0xe7, 0x23, 0x81, 0xdb, 0xde, 0x24, 0x02, 0xdb, 0xde, 0x28, 0x9a, 0xd6,
+  0x29, 0x9a, 0xd6, 0x2c, 0x81, 0x79, 0xce, 0x2b, 0x27, 0x59, 0xce, 0x2b, 0x79, 0xce, 0x2d, 0x38,
+  0xc6, 0x30, 0xf7, 0xbd, 0x32, 0xd7, 0xbd, 0x34, 0xb6, 0xb5, 0x37, 0x96, 0xb5, 0x37, 0x55, 0xad,
+  0x3d, 0xf3, 0x9c, 0x43, 0xb2, 0x94, 0x46, 0x30, 0x84, 0x51, 0xaa, 0x52, 0x73, 0x24, 0x21, 0x9c,
+  0xc2, 0x10, 0xa5, 0xe3, 0x18, 0xa3, 0x04, 0x21, 0x9e, 0x65, 0x29, 0x94, 0x21, 0x08, 0xb8, 0x61,
+  0x08, 0xaf, 0xe7, 0x39, 0x80, 0x00, 0x00, 0xca, 0x00, 0x00, 0xff, 0x00, 0x00, 0xeb, 0x00, 0x00,
+  0xda, 0x00, 0x00, 0xcb, 0x20, 0x00, 0xbc, 0x25, 0x29, 0x98, 0x6d, 0x6b, 0x60, 0xb3, 0x9c, 0x48,
+  0xd3, 0x9c, 0x48, 0xd3, 0x9c, 0x43, 0x14, 0xa5, 0x40, 0x55, 0xad, 0x3e, 0x55, 0xad, 0x3c, 0x96,
+  0xb5, 0x38, 0xb6, 0xb5, 0x37, 0xd7, 0xbd, 0x35, 0xf7, 0xbd, 0x34, 0xf7, 0xbd, 0x32, 0x38, 0xc6,
+  0x31, 0x81, 0x38, 0xc6, 0x2e, 0x81, 0x79, 0xce, 0x2b, 0x81, 0x9a, 0xd6, 0x2c, 0x00, 0x9a, 0xd6,
+  0x28, 0x81, 0x9a, 0xd6, 0x27, 0x87, 0x9a, 0xd6, 0x28, 0x81, 0xdb, 0xde, 0x28, 0x00, 0x9a, 0xd6,
+  0x28, 0x83, 0xdb, 0xde, 0x28, 0x84, 0x9a, 0xd6, 0x28, 0x0d, 0xdb, 0xde, 0x24, 0x1c, 0xe7, 0x23,
+  0x9a, 0xd6, 0x28, 0xba, 0xd6, 0x27, 0xdb, 0xde, 0x24, 0xdb, 0xde, 0x28, 0x9a, 0xd6, 0x28, 0xdb,
+  0xde, 0x28, 0xba, 0xd6, 0x25, 0x1c, 0xe7, 0x22, 0xba, 0xd6, 0x27, 0xdb, 0xde, 0x24, 0xba, 0xd6,
+  0x27, 0xdb, 0xde, 0x24, 0x8a, 0x9a, 0xd6, 0x28, 0x83, 0xba, 0xd6, 0x27, 0x06, 0x79, 0xce, 0x2a,
+  0x9a, 0xd6, 0x2c, 0x79, 0xce, 0x2b, 0xba, 0xd6, 0x2b, 0x59, 0xce, 0x2c, 0x59, 0xce, 0x2b, 0x38,
+  0xc6, 0x2e, 0x81, 0x18, 0xc6, 0x2f, 0x81, 0xd7, 0xbd, 0x34, 0x23, 0xb6, 0xb5, 0x35, 0x75, 0xad,
+  0x3a, 0x55, 0xad, 0x3a, 0x55, 0xad, 0x3e, 0xf4, 0xa4, 0x44, 0x92, 0x94, 0x49, 0xb2, 0x94, 0x4a,
+  0xaf, 0x7b, 0x5a, 0xc7, 0x39, 0x88, 0xc2, 0x10, 0xa7, 0xa3, 0x18, 0xa9, 0xa2, 0x10, 0xa9, 0xc3,
+  0x18, 0xa4, 0x24, 0x21, 0x9a, 0x20, 0x00, 0xb8, 0x20, 0x00, 0xb7, 0x65, 0x29, 0x90, 0x00, 0x00,
+  0xdb, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf9, 0x00, 0x00, 0xea, 0x00, 0x00, 0xda, 0x00, 0x00, 0xc9,
+  0x20, 0x00, 0xb8, 0x45, 0x29, 0x98, 0x0b, 0x5b, 0x6b, 0x71, 0x8c, 0x50, 0xd3, 0x9c, 0x48, 0xf3,
+  0x9c, 0x46, 0xd3, 0x9c, 0x45, 0xf3, 0x9c, 0x43, 0x14, 0xa5, 0x40, 0x34, 0xa5, 0x3d, 0x55, 0xad,
+  0x3e, 0x55, 0xad, 0x3a, 0x76, 0xb5, 0x38, 0x81, 0x96, 0xb5, 0x36, 0x81, 0xd7, 0xbd, 0x33, 0x03,
+  0xf7, 0xbd, 0x32, 0x38, 0xc6, 0x30, 0x38, 0xc6, 0x2e, 0x38, 0xc6, 0x2d, 0x81, 0x78, 0xc6, 0x2d,
+  0x00, 0x59, 0xce, 0x2b, 0x92, 0x79, 0xce, 0x2b, 0x81, 0x79, 0xce, 0x2a, 0x81, 0x79, 0xce, 0x2b,
+  0x00, 0xba, 0xd6, 0x2a, 0x82, 0x79, 0xce, 0x2b, 0x05, 0x7a, 0xd6, 0x2a, 0x9a, 0xd6, 0x29, 0x79,
+  0xce, 0x2b, 0x9a, 0xd6, 0x29, 0x79, 0xce, 0x2b, 0x9a, 0xd6, 0x29, 0x8a, 0x79, 0xce, 0x2b, 0x81,
+  0x79, 0xce, 0x2d, 0x82, 0x38, 0xc6, 0x2d, 0x02, 0x38, 0xc6, 0x2c, 0x59, 0xce, 0x2c, 0x38, 0xc6,
+  0x31, 0x81, 0xf7, 0xbd, 0x32, 0x00, 0xf7, 0xbd, 0x33, 0x81, 0xd7, 0xbd, 0x36, 0x2c, 0x96, 0xb5,
+  0x38, 0x55, 0xad, 0x3a, 0x55, 0xad, 0x3b, 0xf3, 0x9c, 0x40, 0xf3, 0x9c, 0x43, 0xd3, 0x9c, 0x45,
+  0xd3, 0x9c, 0x48, 0x91, 0x8c, 0x4d, 0x6d, 0x6b, 0x61, 0x86, 0x31, 0x8b, 0xa2, 0x10, 0xab, 0x61,
+  0x08, 0xb0, 0x61, 0x08, 0xb1, 0x40, 0x00, 0xb3, 0x61, 0x08, 0xaf, 0xe3, 0x18, 0xa2, 0x00, 0x00,
+  0xc0, 0x20, 0x00, 0xbf, 0x04, 0x21, 0x9d, 0x00, 0x00, 0xe6, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfe,
+  0x00, 0x00, 0xfa, 0x00, 0x00, 0xeb, 0x00, 0x00, 0xdc, 0x00, 0x00, 0xd1, 0x00, 0x00, 0xc9, 0x61,
+  0x08, 0xb3, 0x65, 0x29, 0x90, 0xaa, 0x52, 0x70, 0x8e, 0x73, 0x5e, 0x50, 0x84, 0x54, 0x92, 0x94,
+  0x4c, 0xd3, 0x9c, 0x4a, 0x14, 0xa5, 0x46, 0x35, 0xad, 0x42, 0x55, 0xad, 0x41, 0x75, 0xad, 0x40,
+  0x96, 0xb5, 0x3b, 0xb5, 0xad, 0x3a, 0xd7, 0xbd, 0x3a, 0xb6, 0xb5, 0x38, 0xb7, 0xbd, 0x37, 0xd7,
+  0xbd, 0x36, 0xf8, 0xc5, 0x36, 0x82, 0xd7, 0xbd, 0x37, 0x01, 0xd8, 0xc5, 0x35, 0xd7, 0xbd, 0x35,
+  0x82, 0xd8, 0xc5, 0x35, 0x02, 0xd7, 0xbd, 0x36, 0xf7, 0xbd, 0x33, 0xf7, 0xbd, 0x30, 0x83, 0x18,
+  0xc6, 0x31, 0x00, 0x17, 0xbe, 0x31, 0x81, 0x18, 0xc6, 0x31, 0x81, 0x59, 0xce, 0x30, 0x81, 0x39,
+  0xce, 0x30, 0x00, 0x38, 0xc6, 0x30, 0x81, 0x38, 0xc6, 0x31, 0x0f, 0x37, 0xbe, 0x30, 0x38, 0xc6,
+  0x31, 0x17, 0xbe, 0x31, 0xf8, 0xc5, 0x32, 0xf7, 0xbd, 0x33, 0x37, 0xbe, 0x30, 0x38, 0xc6, 0x31,
+  0x18, 0xc6, 0x32, 0xf7, 0xbd, 0x32, 0xd7, 0xbd, 0x33, 0x18, 0xc6, 0x32, 0xf7, 0xbd, 0x33, 0x18,
+  0xc6, 0x32, 0xb6, 0xb5, 0x32, 0xf8, 0xc5, 0x32, 0xf7, 0xbd, 0x32, 0x81, 0xf6, 0xb5, 0x32, 0x01,
+  0xf8, 0xc5, 0x32, 0xf6, 0xb5, 0x32, 0x82, 0xd7, 0xbd, 0x35, 0x82, 0xd7, 0xbd, 0x37, 0x01, 0xb7,
+  0xbd, 0x37, 0xb6, 0xb5, 0x37, 0x81, 0xb6, 0xb5, 0x3a, 0x33, 0x76, 0xb5, 0x3c, 0x75, 0xad, 0x3d,
+  0x55, 0xad, 0x3d, 0x35, 0xad, 0x40, 0x34, 0xa5, 0x40, 0x14, 0xa5, 0x43, 0x14, 0xa5, 0x46, 0xf3,
+  0x9c, 0x47, 0xb2, 0x94, 0x4a, 0x72, 0x94, 0x4e, 0x30, 0x84, 0x53, 0xae, 0x73, 0x5b, 0xeb, 0x5a,
+  0x69, 0xe8, 0x41, 0x81, 0xc3, 0x18, 0xa4, 0x40, 0x00, 0xb8, 0x00, 0x00, 0xbb, 0x00, 0x00, 0xbd,
+  0x00, 0x00, 0xbe, 0x00, 0x00, 0xc3, 0x00, 0x00, 0xc0, 0x41, 0x08, 0xb6, 0x00, 0x00, 0xd7, 0x00,
+  0x00, 0xca, 0xa3, 0x18, 0xaa, 0x00, 0x00, 0xe4, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfe, 0x00, 0x00,
+  0xff, 0x00, 0x00, 0xfd, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xed, 0x00, 0x00, 0xe6, 0x00, 0x00, 0xdc,
+  0x00, 0x00, 0xd3, 0x00, 0x00, 0xc4, 0x61, 0x08, 0xb3, 0xc2, 0x10, 0xa4, 0x03, 0x19, 0x99, 0x04,
+  0x21, 0x95, 0x45, 0x29, 0x8f, 0x86, 0x31, 0x8b, 0xc6, 0x31, 0x85, 0xe7, 0x39, 0x80, 0x28, 0x42,
+  0x79, 0x69, 0x4a, 0x76, 0x8a, 0x52, 0x73, 0xab, 0x5a, 0x6e, 0xcb, 0x5a, 0x6c, 0x0c, 0x63, 0x6a,
+  0x0c, 0x63, 0x69, 0x2c, 0x63, 0x68, 0x81, 0x2c, 0x63, 0x65, 0x00, 0x4d, 0x6b, 0x63, 0x81, 0x6d,
+  0x6b, 0x63, 0x81, 0x4d, 0x6b, 0x63, 0x01, 0x6d, 0x6b, 0x63, 0x6d, 0x6b, 0x62, 0x81, 0x4d, 0x6b,
+  0x61, 0x00, 0x4d, 0x6b, 0x62, 0x82, 0x4d, 0x6b, 0x63, 0x05, 0x4d, 0x6b, 0x61, 0x6d, 0x6b, 0x63,
+  0x2c, 0x63, 0x64, 0x2c, 0x63, 0x66, 0x4c, 0x63, 0x64, 0x4d, 0x6b, 0x64, 0x82, 0x2c, 0x63, 0x65,
+  0x00, 0x2d, 0x6b, 0x64, 0x84, 0x4d, 0x6b, 0x61, 0x02, 0x6d, 0x6b, 0x60, 0x4e, 0x73, 0x5f, 0x6e,
+  0x73, 0x60, 0x83, 0x4e, 0x73, 0x61, 0x03, 0x6c, 0x63, 0x63, 0x6d, 0x6b, 0x62, 0x4e, 0x73, 0x61,
+  0x4d, 0x6b, 0x64, 0x82, 0x2d, 0x6b, 0x65, 0x26, 0x2c, 0x63, 0x65, 0x2c, 0x63, 0x66, 0x2c, 0x63,
+  0x68, 0xec, 0x62, 0x68, 0xeb, 0x5a, 0x68, 0xcb, 0x5a, 0x6c, 0xaa, 0x52, 0x71, 0x8a, 0x52, 0x72,
+  0x8a, 0x52, 0x73, 0x8a, 0x52, 0x74, 0x8a, 0x52, 0x75, 0x69, 0x4a, 0x77, 0x49, 0x4a, 0x79, 0x48,
+  0x42, 0x79, 0x28, 0x42, 0x7e, 0x08, 0x42, 0x81, 0xe7, 0x39, 0x84, 0xc7, 0x39, 0x86, 0x86, 0x31,
+  0x8a, 0x45, 0x29, 0x90, 0x04, 0x21, 0x97, 0xc2, 0x10, 0xa5, 0x62, 0x10, 0xb0, 0x20, 0x00, 0xba,
+  0x00, 0x00, 0xc2, 0x00, 0x00, 0xc5, 0x00, 0x00, 0xcc, 0x00, 0x00, 0xd2, 0x00, 0x00, 0xd7, 0x00,
+  0x00, 0xdc, 0x00, 0x00, 0xea, 0x00, 0x00, 0xe9, 0x00, 0x00, 0xf9, 0x00, 0x00, 0xd6, 0x61, 0x08,
+  0xb1, 0x00, 0x00, 0xd7, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfe, 0x82, 0x00, 0x00,
+  0xff, 0x19, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xf9, 0x00, 0x00, 0xf5, 0x00, 0x00, 0xec, 0x00, 0x00,
+  0xe7, 0x00, 0x00, 0xe1, 0x00, 0x00, 0xd8, 0x00, 0x00, 0xd3, 0x00, 0x00, 0xcd, 0x00, 0x00, 0xc7,
+  0x00, 0x00, 0xc0, 0x20, 0x00, 0xbb, 0x41, 0x08, 0xb2, 0x61, 0x08, 0xaf, 0x82, 0x10, 0xab, 0xc2,
+  0x10, 0xa7, 0xe3, 0x18, 0xa3, 0x03, 0x19, 0x9e, 0x04, 0x21, 0x9c, 0x04, 0x21, 0x9a, 0x24, 0x21,
+  0x97, 0x45, 0x29, 0x97, 0x44, 0x21, 0x96, 0x65, 0x29, 0x93, 0x66, 0x31, 0x93, 0x65, 0x29, 0x90,
+  0x82, 0x86, 0x31, 0x8f, 0x02, 0xa6, 0x31, 0x8c, 0xa6, 0x31, 0x8b, 0xa7, 0x39, 0x8c, 0x83, 0xc7,
+  0x39, 0x8b, 0x02, 0xc7, 0x39, 0x8c, 0xa6, 0x31, 0x8e, 0x86, 0x31, 0x90, 0x84, 0xa6, 0x31, 0x8e,
+  0x02, 0x87, 0x39, 0x90, 0x86, 0x31, 0x8f, 0xa7, 0x39, 0x8c, 0x83, 0xc7, 0x39, 0x8a, 0x01, 0xc7,
+  0x39, 0x8b, 0xa7, 0x39, 0x8b, 0x83, 0xa6, 0x31, 0x8b, 0x81, 0xa6, 0x31, 0x8c, 0x0a, 0xa6, 0x31,
+  0x8e, 0x86, 0x31, 0x91, 0x86, 0x31, 0x92, 0x66, 0x31, 0x92, 0x66, 0x31, 0x93, 0x65, 0x29, 0x93,
+  0x65, 0x29, 0x94, 0x65, 0x29, 0x95, 0x65, 0x29, 0x96, 0x24, 0x21, 0x9a, 0x04, 0x21, 0x9d, 0x82,
+  0xe3, 0x18, 0xa2, 0x14, 0xc3, 0x18, 0xa4, 0xc2, 0x10, 0xa6, 0xa2, 0x10, 0xa9, 0xa2, 0x10, 0xac,
+  0x81, 0x08, 0xae, 0x41, 0x08, 0xb1, 0x41, 0x08, 0xb2, 0x20, 0x00, 0xba, 0x20, 0x00, 0xbf, 0x00,
+  0x00, 0xc4, 0x00, 0x00, 0xca, 0x00, 0x00, 0xd1, 0x00, 0x00, 0xd4, 0x00, 0x00, 0xd3, 0x00, 0x00,
+  0xdb, 0x00, 0x00, 0xe4, 0x00, 0x00, 0xed, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf4, 0x00, 0x00, 0xfb,
+  0x00, 0x00, 0xfe, 0x82, 0x00, 0x00, 0xff, 0x05, 0x00, 0x00, 0xe3, 0x00, 0x00, 0xbd, 0x00, 0x00,
+  0xcf, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xfe, 0x87, 0x00, 0x00, 0xff, 0x00, 0x00,
+  0x00, 0xfe, 0x81, 0x00, 0x00, 0xfd, 0x0c, 0x00, 0x00, 0xfb, 0x00, 0x00, 0xf6, 0x00, 0x00, 0xf3,
+  0x00, 0x00, 0xec, 0x00, 0x00, 0xe5, 0x00, 0x00, 0xe2, 0x00, 0x00, 0xdc, 0x00, 0x00, 0xda, 0x00,
+  0x00, 0xd8, 0x00, 0x00, 0xd5, 0x00, 0x00, 0xd3, 0x00, 0x00, 0xd2, 0x00, 0x00, 0xcf, 0x82, 0x00,
+  0x00, 0xce, 0x01, 0x00, 0x00, 0xcf, 0x00, 0x00, 0xcb, 0x81, 0x00, 0x00, 0xc9, 0x04, 0x00, 0x00,
+  0xc8, 0x00, 0x00, 0xc3, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xbe, 0x20, 0x00, 0xba, 0x81, 0x20, 0x00,
+  0xb8, 0x01, 0x20, 0x00, 0xb7, 0x20, 0x00, 0xb9, 0x84, 0x20, 0x00, 0xba, 0x81, 0x20, 0x00, 0xbc,
+  0x81, 0x20, 0x00, 0xbb, 0x01, 0x20, 0x00, 0xbc, 0x20, 0x00, 0xbb, 0x81, 0x20, 0x00, 0xb9, 0x02,
+  0x20, 0x00, 0xbb, 0x20, 0x00, 0xbd, 0x00, 0x00, 0xbe, 0x83, 0x00, 0x00, 0xbf, 0x03, 0x00, 0x00,
+  0xbd, 0x00, 0x00, 0xbe, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xbf, 0x81, 0x00, 0x00, 0xbe, 0x06, 0x00,
+  0x00, 0xc1, 0x00, 0x00, 0xc2, 0x00, 0x00, 0xc3, 0x00, 0x00, 0xc4, 0x00, 0x00, 0xc6, 0x00, 0x00,
+  0xc7, 0x00, 0x00, 0xca, 0x81, 0x00, 0x00, 0xcc, 0x0e, 0x00, 0x00, 0xcd, 0x00, 0x00, 0xd0, 0x00,
+  0x00, 0xd3, 0x00, 0x00, 0xd7, 0x00, 0x00, 0xd8, 0x00, 0x00, 0xdb, 0x00, 0x00, 0xdf, 0x00, 0x00,
+  0xe2, 0x00, 0x00, 0xe9, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf4, 0x00, 0x00, 0xf9, 0x00, 0x00, 0xfe,
+  0x00, 0x00, 0xff, 0x00, 0x00, 0xfe, 0x87, 0x00, 0x00, 0xff, 0x0a, 0x00, 0x00, 0xf4, 0x00, 0x00,
+  0xf3, 0x00, 0x00, 0xf5, 0x00, 0x00, 0xc7, 0x00, 0x00, 0xcd, 0x00, 0x00, 0xd6, 0x00, 0x00, 0xde,
+  0x00, 0x00, 0xe8, 0x00, 0x00, 0xf1, 0x00, 0x00, 0xf6, 0x00, 0x00, 0xfc, 0x82, 0x00, 0x00, 0xfe,
+  0x81, 0x00, 0x00, 0xfd, 0x0f, 0x00, 0x00, 0xfa, 0x00, 0x00, 0xf4, 0x00, 0x00, 0xee, 0x00, 0x00,
+  0xe8, 0x00, 0x00, 0xe3, 0x00, 0x00, 0xdf, 0x00, 0x00, 0xd7, 0x00, 0x00, 0xd1, 0x00, 0x00, 0xce,
+  0x00, 0x00, 0xcd, 0x00, 0x00, 0xcb, 0x20, 0x00, 0xc7, 0x20, 0x00, 0xc6, 0x20, 0x00, 0xc5, 0x40,
+  0x00, 0xc5, 0x40, 0x00, 0xc3, 0x83, 0x41, 0x08, 0xbf, 0x07, 0x61, 0x08, 0xbe, 0x61, 0x08, 0xb9,
+  0x61, 0x08, 0xba, 0x61, 0x08, 0xb8, 0x82, 0x10, 0xb4, 0x82, 0x10, 0xb0, 0xa2, 0x10, 0xad, 0xa2,
+  0x10, 0xa9, 0x81, 0xc3, 0x18, 0xa6, 0x01, 0xc2, 0x10, 0xa7, 0xa3, 0x18, 0xa8, 0x81, 0xa3, 0x18,
+  0xaa, 0x81, 0xa3, 0x18, 0xa9, 0x00, 0xc3, 0x18, 0xa9, 0x81, 0xc3, 0x18, 0xa7, 0x01, 0xc3, 0x18,
+  0xa5, 0xc2, 0x10, 0xa4, 0x82, 0xc3, 0x18, 0xa7, 0x00, 0xc3, 0x18, 0xa6, 0x81, 0xc3, 0x18, 0xa8,
+  0x84, 0xc3, 0x18, 0xa7, 0x00, 0xc3, 0x18, 0xa5, 0x82, 0xc3, 0x18, 0xa6, 0x81, 0xc3, 0x18, 0xa5,
+  0x81, 0xc3, 0x18, 0xa6, 0x00, 0xa3, 0x18, 0xa9, 0x82, 0xa3, 0x18, 0xaa, 0x81, 0xa2, 0x10, 0xaa,
+  0x10, 0xa2, 0x10, 0xab, 0xa2, 0x10, 0xae, 0xa2, 0x10, 0xb0, 0x82, 0x10, 0xb4, 0x62, 0x10, 0xb7,
+  0x62, 0x10, 0xb9, 0x62, 0x10, 0xbb, 0x41, 0x08, 0xc1, 0x40, 0x00, 0xc5, 0x20, 0x00, 0xca, 0x00,
+  0x00, 0xcf, 0x00, 0x00, 0xd6, 0x00, 0x00, 0xde, 0x00, 0x00, 0xe4, 0x00, 0x00, 0xe9, 0x00, 0x00,
+  0xf1, 0x00, 0x00, 0xf7, 0x81, 0x00, 0x00, 0xfd, 0x82, 0x00, 0x00, 0xfe, 0x1f, 0x00, 0x00, 0xfa,
+  0x00, 0x00, 0xee, 0x00, 0x00, 0xd3, 0x00, 0x00, 0xe2, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xcd, 0x00,
+  0x00, 0xcb, 0x00, 0x00, 0xcc, 0x00, 0x00, 0xce, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xd1, 0x00, 0x00,
+  0xd2, 0x00, 0x00, 0xd4, 0x00, 0x00, 0xd3, 0x00, 0x00, 0xcf, 0x00, 0x00, 0xcd, 0x00, 0x00, 0xc7,
+  0x20, 0x00, 0xc1, 0x41, 0x08, 0xb8, 0x61, 0x08, 0xb0, 0xa3, 0x18, 0xa7, 0xe4, 0x20, 0x9d, 0x24,
+  0x21, 0x98, 0x65, 0x29, 0x90, 0x86, 0x31, 0x8c, 0xc7, 0x39, 0x85, 0xe7, 0x39, 0x82, 0xe7, 0x39,
+  0x80, 0x07, 0x3a, 0x7e, 0x28, 0x42, 0x7d, 0x49, 0x4a, 0x7b, 0x69, 0x4a, 0x78, 0x81, 0x69, 0x4a,
+  0x76, 0x04, 0x8a, 0x52, 0x74, 0xaa, 0x52, 0x72, 0xcb, 0x5a, 0x71, 0xcb, 0x5a, 0x6e, 0xeb, 0x5a,
+  0x6c, 0x81, 0x0c, 0x63, 0x6b, 0x04, 0x0c, 0x63, 0x6a, 0x0c, 0x63, 0x69, 0x2c, 0x63, 0x68, 0x4c,
+  0x63, 0x67, 0x4d, 0x6b, 0x65, 0x81, 0x6d, 0x6b, 0x63, 0x01, 0x6d, 0x6b, 0x65, 0x4d, 0x6b, 0x64,
+  0x81, 0x4d, 0x6b, 0x65, 0x02, 0x4d, 0x6b, 0x66, 0x2d, 0x6b, 0x67, 0x4d, 0x6b, 0x64, 0x82, 0x6d,
+  0x6b, 0x63, 0x02, 0x4d, 0x6b, 0x64, 0x4d, 0x6b, 0x66, 0x2d, 0x6b, 0x67, 0x81, 0x4d, 0x6b, 0x66,
+  0x02, 0x4d, 0x6b, 0x64, 0x4d, 0x6b, 0x66, 0x2d, 0x6b, 0x67, 0x82, 0x2c, 0x63, 0x67, 0x02, 0x4d,
+  0x6b, 0x66, 0x4d, 0x6b, 0x62, 0x4d, 0x6b, 0x65, 0x82, 0x2d, 0x6b, 0x67, 0x02, 0x2c, 0x63, 0x67,
+  0x2d, 0x6b, 0x67, 0x4d, 0x6b, 0x67, 0x81, 0x2c, 0x63, 0x67, 0x00, 0x2d, 0x6b, 0x67, 0x81, 0x2c,
+  0x63, 0x67, 0x42, 0x0c, 0x63, 0x69, 0x0c, 0x63, 0x6b, 0xec, 0x62, 0x6c, 0xcb, 0x5a, 0x70, 0xaa,
+  0x52, 0x72, 0x8a, 0x52, 0x74, 0x69, 0x4a, 0x77, 0x49, 0x4a, 0x78, 0x28, 0x42, 0x7e, 0x08, 0x42,
+  0x81, 0xc7, 0x39, 0x84, 0x86, 0x31, 0x8a, 0x45, 0x29, 0x91, 0x04, 0x21, 0x99, 0xa3, 0x18, 0xa3,
+  0x61, 0x08, 0xad, 0x20, 0x00, 0xb9, 0x00, 0x00, 0xc6, 0x00, 0x00, 0xd3, 0x00, 0x00, 0xda, 0x00,
+  0x00, 0xe0, 0x00, 0x00, 0xe7, 0x00, 0x00, 0xe8, 0x00, 0x00, 0xe0, 0x00, 0x00, 0xd0, 0x00, 0x00,
+  0xbf, 0x00, 0x00, 0xdb, 0x00, 0x00, 0xfd, 0x00, 0x00, 0xd4, 0x00, 0x00, 0xc9, 0x00, 0x00, 0xca,
+  0x00, 0x00, 0xc7, 0x00, 0x00, 0xc2, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xbd, 0x20, 0x00, 0xb9, 0x41,
+  0x08, 0xb3, 0x82, 0x10, 0xad, 0xa2, 0x10, 0xa7, 0xe3, 0x18, 0xa1, 0x24, 0x21, 0x9a, 0x86, 0x31,
+  0x91, 0xe7, 0x39, 0x87, 0x08, 0x42, 0x82, 0x49, 0x4a, 0x7b, 0x8a, 0x52, 0x76, 0xab, 0x5a, 0x72,
+  0x0b, 0x5b, 0x6c, 0x2c, 0x63, 0x67, 0x4c, 0x63, 0x66, 0x4d, 0x6b, 0x63, 0x6d, 0x6b, 0x62, 0x8e,
+  0x73, 0x60, 0xae, 0x73, 0x5c, 0xcf, 0x7b, 0x5b, 0xef, 0x7b, 0x58, 0xcf, 0x7b, 0x57, 0x10, 0x84,
+  0x57, 0x10, 0x84, 0x55, 0x10, 0x84, 0x54, 0x10, 0x84, 0x53, 0x30, 0x84, 0x52, 0x30, 0x84, 0x51,
+  0x50, 0x84, 0x51, 0x51, 0x8c, 0x51, 0x71, 0x8c, 0x50, 0x71, 0x8c, 0x4d, 0x81, 0x51, 0x8c, 0x4d,
+  0x03, 0x71, 0x8c, 0x4c, 0x51, 0x8c, 0x4d, 0x72, 0x94, 0x4d, 0x92, 0x94, 0x4c, 0x81, 0x72, 0x94,
+  0x4c, 0x00, 0x71, 0x8c, 0x4d, 0x81, 0x51, 0x8c, 0x4d, 0x82, 0x72, 0x94, 0x4d, 0x83, 0x72, 0x94,
+  0x4b, 0x81, 0x92, 0x94, 0x4c, 0x85, 0x72, 0x94, 0x4d, 0x01, 0x92, 0x94, 0x4c, 0x71, 0x8c, 0x4d,
+  0x86, 0x51, 0x8c, 0x4d, 0x81, 0x51, 0x8c, 0x51, 0x3a, 0x50, 0x84, 0x51, 0x30, 0x84, 0x51, 0x10,
+  0x84, 0x51, 0x10, 0x84, 0x53, 0x10, 0x84, 0x55, 0xcf, 0x7b, 0x57, 0xcf, 0x7b, 0x5b, 0xae, 0x73,
+  0x5c, 0x8e, 0x73, 0x5f, 0x6d, 0x6b, 0x61, 0x2d, 0x6b, 0x65, 0x0b, 0x5b, 0x69, 0xeb, 0x5a, 0x6f,
+  0xaa, 0x52, 0x74, 0x69, 0x4a, 0x7a, 0x08, 0x42, 0x80, 0xc7, 0x39, 0x89, 0x65, 0x29, 0x94, 0xe4,
+  0x20, 0xa0, 0x82, 0x10, 0xa8, 0x21, 0x08, 0xb5, 0x00, 0x00, 0xc1, 0x00, 0x00, 0xc7, 0x00, 0x00,
+  0xce, 0x00, 0x00, 0xcf, 0x00, 0x00, 0xcb, 0x00, 0x00, 0xc0, 0x40, 0x00, 0xb4, 0x00, 0x00, 0xe7,
+  0x00, 0x00, 0xfe, 0x00, 0x00, 0xe1, 0x00, 0x00, 0xc9, 0x00, 0x00, 0xca, 0x00, 0x00, 0xc4, 0x00,
+  0x00, 0xbe, 0x20, 0x00, 0xb8, 0x41, 0x08, 0xb3, 0x82, 0x10, 0xac, 0xc3, 0x18, 0xa5, 0xe3, 0x18,
+  0xa1, 0x24, 0x21, 0x9b, 0x66, 0x31, 0x92, 0xc7, 0x39, 0x8b, 0x08, 0x42, 0x81, 0x69, 0x4a, 0x77,
+  0xab, 0x5a, 0x70, 0xeb, 0x5a, 0x6b, 0x2c, 0x63, 0x67, 0x4d, 0x6b, 0x63, 0x8e, 0x73, 0x5e, 0xcf,
+  0x7b, 0x5b, 0xef, 0x7b, 0x56, 0xf0, 0x83, 0x53, 0x2f, 0x7c, 0x53, 0x50, 0x84, 0x51, 0x51, 0x8c,
+  0x4d, 0x71, 0x8c, 0x4b, 0x92, 0x94, 0x4b, 0x92, 0x94, 0x4a, 0x81, 0xb2, 0x94, 0x48, 0x00, 0xb3,
+  0x9c, 0x48, 0x81, 0xd3, 0x9c, 0x46, 0x06, 0xf3, 0x9c, 0x43, 0xf4, 0xa4, 0x42, 0xf3, 0x9c, 0x43,
+  0xf4, 0xa4, 0x42, 0xf3, 0x9c, 0x42, 0x14, 0xa5, 0x42, 0x34, 0xa5, 0x3f, 0x83, 0x14, 0xa5, 0x42,
+  0x03, 0x14, 0xa5, 0x41, 0x54, 0xa5, 0x3e, 0x34, 0xa5, 0x3f, 0x14, 0xa5, 0x41, 0x83, 0x34, 0xa5,
+  0x3f, 0x00, 0x34, 0xa5, 0x3d, 0x82, 0x35, 0xad, 0x3c, 0x00, 0x34, 0xa5, 0x3d, 0x81, 0x34, 0xa5,
+  0x3e, 0x81, 0x35, 0xad, 0x3e, 0x03, 0x35, 0xad, 0x3f, 0x35, 0xad, 0x3e, 0x35, 0xad, 0x3f, 0x34,
+  0xa5, 0x3f, 0x81, 0x34, 0xa5, 0x3e, 0x01, 0x55, 0xad, 0x3e, 0x14, 0xa5, 0x40, 0x81, 0x14, 0xa5,
+  0x42, 0x01, 0x34, 0xa5, 0x41, 0x14, 0xa5, 0x41, 0x81, 0xf3, 0x9c, 0x43, 0x03, 0xf3, 0x9c, 0x44,
+  0xb3, 0x9c, 0x47, 0xd2, 0x94, 0x45, 0xb2, 0x94, 0x48, 0x81, 0xb2, 0x94, 0x4a, 0x2d, 0x72, 0x94,
+  0x4b, 0x51, 0x8c, 0x4e, 0x31, 0x8c, 0x52, 0x0f, 0x7c, 0x54, 0xcf, 0x7b, 0x58, 0x8e, 0x73, 0x5d,
+  0x6d, 0x6b, 0x60, 0x2c, 0x63, 0x66, 0xeb, 0x5a, 0x6b, 0xa9, 0x4a, 0x73, 0x49, 0x4a, 0x7b, 0xe8,
+  0x41, 0x85, 0x85, 0x29, 0x8f, 0x24, 0x21, 0x99, 0xc3, 0x18, 0xa7, 0x61, 0x08, 0xb2, 0x20, 0x00,
+  0xb8, 0x00, 0x00, 0xbc, 0x00, 0x00, 0xbe, 0x00, 0x00, 0xc0, 0x41, 0x08, 0xb6, 0x20, 0x00, 0xba,
+  0x00, 0x00, 0xfd, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xd5, 0x00, 0x00, 0xc6, 0x00,
+  0x00, 0xc3, 0x00, 0x00, 0xbe, 0x20, 0x00, 0xb9, 0x61, 0x08, 0xb3, 0xa2, 0x10, 0xaa, 0xe4, 0x20,
+  0xa4, 0x24, 0x21, 0x9b, 0x66, 0x31, 0x94, 0xc7, 0x39, 0x8a, 0x08, 0x42, 0x80, 0x6a, 0x52, 0x78,
+  0xcb, 0x5a, 0x71, 0x0b, 0x5b, 0x6a, 0x4c, 0x63, 0x64, 0x6d, 0x6b, 0x60, 0xae, 0x73, 0x5c, 0xef,
+  0x7b, 0x58, 0x10, 0x84, 0x53, 0x50, 0x84, 0x4e, 0x81, 0x72, 0x94, 0x4b, 0x05, 0xb2, 0x94, 0x47,
+  0xd3, 0x9c, 0x46, 0xf4, 0xa4, 0x42, 0xf4, 0xa4, 0x44, 0x15, 0xad, 0x41, 0x35, 0xad, 0x3e, 0x81,
+  0x34, 0xa5, 0x3e, 0x81, 0x55, 0xad, 0x3e, 0x02, 0x55, 0xad, 0x3d, 0x55, 0xad, 0x3c, 0x75, 0xad,
+  0x3a, 0x87, 0x75, 0xad, 0x39, 0x01, 0x96, 0xb5, 0x39, 0x96, 0xb5, 0x38, 0x81, 0x96, 0xb5, 0x37,
+  0x00, 0x76, 0xb5, 0x39, 0x81, 0x96, 0xb5, 0x39, 0x81, 0x75, 0xad, 0x39, 0x87, 0x96, 0xb5, 0x37,
+  0x03, 0x96, 0xb5, 0x38, 0x96, 0xb5, 0x37, 0x75, 0xad, 0x39, 0x96, 0xb5, 0x38, 0x81, 0x96, 0xb5,
+  0x37, 0x00, 0x96, 0xb5, 0x38, 0x81, 0x75, 0xad, 0x39, 0x01, 0x75, 0xad, 0x3a, 0x75, 0xad, 0x3c,
+  0x82, 0x55, 0xad, 0x3c, 0x1c, 0x34, 0xa5, 0x3d, 0x14, 0xa5, 0x40, 0x14, 0xa5, 0x42, 0xf4, 0xa4,
+  0x40, 0xf4, 0xa4, 0x42, 0xf4, 0xa4, 0x46, 0xb3, 0x9c, 0x46, 0xb2, 0x94, 0x4a, 0x72, 0x94, 0x4c,
+  0x51, 0x8c, 0x4e, 0x0f, 0x7c, 0x53, 0xef, 0x7b, 0x57, 0xce, 0x73, 0x5b, 0x8e, 0x73, 0x5e, 0x4d,
+  0x6b, 0x64, 0x0b, 0x5b, 0x6b, 0xaa, 0x52, 0x73, 0x49, 0x4a, 0x7e, 0xe7, 0x39, 0x88, 0x45, 0x29,
+  0x91, 0x03, 0x19, 0x9e, 0xc3, 0x18, 0xa7, 0x82, 0x10, 0xae, 0x41, 0x08, 0xb3, 0x21, 0x08, 0xb7,
+  0x21, 0x08, 0xb6, 0x20, 0x00, 0xbd, 0x00, 0x00, 0xeb, 0x00, 0x00, 0xfe, 0x81, 0x00, 0x00, 0xff,
+  0x18, 0x00, 0x00, 0xfa, 0x00, 0x00, 0xe1, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xbd, 0x00, 0x00, 0xba,
+  0x20, 0x00, 0xb9, 0x41, 0x08, 0xb4, 0x82, 0x10, 0xad, 0xe3, 0x18, 0xa3, 0x45, 0x29, 0x97, 0xa6,
+  0x31, 0x8f, 0xe8, 0x41, 0x84, 0x49, 0x4a, 0x7a, 0x8a, 0x52, 0x74, 0xcb, 0x5a, 0x6e, 0x2c, 0x63,
+  0x66, 0x6d, 0x6b, 0x63, 0x8e, 0x73, 0x5d, 0xcf, 0x7b, 0x58, 0xef, 0x7b, 0x54, 0x30, 0x84, 0x50,
+  0x51, 0x8c, 0x4c, 0x72, 0x94, 0x4a, 0xb3, 0x9c, 0x48, 0xd3, 0x9c, 0x46, 0x81, 0xd3, 0x9c, 0x42,
+  0x01, 0xf4, 0xa4, 0x43, 0xf4, 0xa4, 0x40, 0x82, 0x34, 0xa5, 0x3d, 0x81, 0x55, 0xad, 0x3d, 0x01,
+  0x55, 0xad, 0x3e, 0x75, 0xad, 0x39, 0x84, 0x75, 0xad, 0x38, 0x83, 0x76, 0xb5, 0x38, 0x01, 0x76,
+  0xb5, 0x39, 0x96, 0xb5, 0x37, 0x81, 0x96, 0xb5, 0x38, 0x83, 0x76, 0xb5, 0x38, 0x83, 0x55, 0xad,
+  0x39, 0x82, 0x75, 0xad, 0x39, 0x04, 0x55, 0xad, 0x39, 0x75, 0xad, 0x38, 0x55, 0xad, 0x39, 0x75,
+  0xad, 0x38, 0x76, 0xb5, 0x38, 0x84, 0x75, 0xad, 0x38, 0x01, 0x55, 0xad, 0x3a, 0x75, 0xad, 0x3b,
+  0x82, 0x34, 0xa5, 0x3d, 0x01, 0x14, 0xa5, 0x3f, 0xf3, 0x9c, 0x43, 0x81, 0xf3, 0x9c, 0x42, 0x18,
+  0xd3, 0x9c, 0x46, 0x92, 0x94, 0x47, 0x92, 0x94, 0x4a, 0x92, 0x94, 0x4c, 0x51, 0x8c, 0x4e, 0x30,
+  0x84, 0x55, 0xcf, 0x7b, 0x59, 0xae, 0x73, 0x5e, 0x6d, 0x6b, 0x62, 0x2c, 0x63, 0x68, 0xcb, 0x5a,
+  0x6e, 0x8a, 0x52, 0x74, 0x49, 0x4a, 0x7d, 0xe7, 0x39, 0x86, 0xa6, 0x31, 0x8e, 0x44, 0x21, 0x96,
+  0xe3, 0x18, 0xa0, 0x82, 0x10, 0xa8, 0x61, 0x08, 0xb0, 0x40, 0x00, 0xb4, 0x00, 0x00, 0xbb, 0x00,
+  0x00, 0xd0, 0x00, 0x00, 0xf5, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfe, 0x83, 0x00, 0x00, 0xff, 0x1f,
+  0x00, 0x00, 0xf5, 0x00, 0x00, 0xdf, 0x00, 0x00, 0xcc, 0x00, 0x00, 0xc2, 0x00, 0x00, 0xba, 0x20,
+  0x00, 0xb5, 0x61, 0x08, 0xac, 0xc2, 0x10, 0xa2, 0x04, 0x21, 0x9b, 0x45, 0x29, 0x91, 0xa6, 0x31,
+  0x8a, 0xe7, 0x39, 0x84, 0x49, 0x4a, 0x7b, 0x6a, 0x52, 0x75, 0xaa, 0x52, 0x72, 0xeb, 0x5a, 0x6b,
+  0x4d, 0x6b, 0x66, 0x6d, 0x6b, 0x62, 0xce, 0x73, 0x5f, 0xef, 0x7b, 0x5a, 0x10, 0x84, 0x57, 0x51,
+  0x8c, 0x53, 0x71, 0x8c, 0x50, 0x92, 0x94, 0x4e, 0xb2, 0x94, 0x4d, 0xd3, 0x9c, 0x4c, 0xd3, 0x9c,
+  0x4b, 0xf3, 0x9c, 0x49, 0xf4, 0xa4, 0x49, 0xf3, 0x9c, 0x48, 0xf4, 0xa4, 0x47, 0xf3, 0x9c, 0x47,
+  0x81, 0x13, 0x9d, 0x46, 0x81, 0xf3, 0x9c, 0x47, 0x00, 0x14, 0xa5, 0x46, 0x82, 0xf3, 0x9c, 0x47,
+  0x81, 0x14, 0xa5, 0x46, 0x01, 0x35, 0xad, 0x45, 0x55, 0xad, 0x45, 0x81, 0x55, 0xad, 0x44, 0x00,
+  0x55, 0xad, 0x45, 0x82, 0x55, 0xad, 0x44, 0x81, 0x54, 0xa5, 0x44, 0x84, 0x55, 0xad, 0x44, 0x81,
+  0x35, 0xad, 0x45, 0x01, 0x75, 0xad, 0x44, 0x55, 0xad, 0x44, 0x81, 0x35, 0xad, 0x45, 0x01, 0x14,
+  0xa5, 0x46, 0x35, 0xad, 0x45, 0x84, 0x14, 0xa5, 0x46, 0x81, 0xf3, 0x9c, 0x48, 0x19, 0xd3, 0x9c,
+  0x4a, 0xd3, 0x9c, 0x4b, 0x92, 0x94, 0x4e, 0x71, 0x8c, 0x4e, 0x72, 0x94, 0x51, 0x51, 0x8c, 0x52,
+  0x50, 0x84, 0x54, 0x10, 0x84, 0x56, 0xef, 0x7b, 0x5a, 0x8f, 0x7b, 0x5d, 0x6d, 0x6b, 0x62, 0x4d,
+  0x6b, 0x64, 0xec, 0x62, 0x6c, 0xaa, 0x52, 0x73, 0x49, 0x4a, 0x79, 0x08, 0x42, 0x81, 0xa6, 0x31,
+  0x89, 0x65, 0x29, 0x91, 0x03, 0x19, 0x9b, 0xa2, 0x10, 0xa1, 0x81, 0x08, 0xac, 0x41, 0x08, 0xb4,
+  0x00, 0x00, 0xc2, 0x00, 0x00, 0xca, 0x00, 0x00, 0xdb, 0x00, 0x00, 0xf1, 0x81, 0x00, 0x00, 0xff,
+  0x00, 0x00, 0x00, 0xfe, 0x87, 0x00, 0x00, 0xff, 0x1b, 0x00, 0x00, 0xf3, 0x00, 0x00, 0xe9, 0x00,
+  0x00, 0xe7, 0x00, 0x00, 0xe4, 0x00, 0x00, 0xdf, 0x00, 0x00, 0xd6, 0x20, 0x00, 0xd0, 0x40, 0x00,
+  0xcc, 0x41, 0x08, 0xc6, 0x61, 0x08, 0xc3, 0x61, 0x08, 0xc1, 0x82, 0x10, 0xbf, 0x82, 0x10, 0xbd,
+  0x82, 0x10, 0xba, 0xa2, 0x10, 0xb8, 0xa2, 0x10, 0xb1, 0xc2, 0x10, 0xac, 0xc3, 0x18, 0xaa, 0xc3,
+  0x18, 0xa7, 0xc3, 0x18, 0xa3, 0xc3, 0x18, 0xa0, 0xe3, 0x18, 0x9a, 0xe3, 0x18, 0x97, 0x04, 0x21,
+  0x96, 0x24, 0x21, 0x93, 0x44, 0x21, 0x91, 0x65, 0x29, 0x8d, 0x85, 0x29, 0x8a, 0x81, 0xa6, 0x31,
+  0x89, 0x0a, 0x86, 0x31, 0x8b, 0x66, 0x31, 0x8c, 0x66, 0x31, 0x8b, 0x45, 0x29, 0x8f, 0x45, 0x29,
+  0x91, 0x24, 0x21, 0x95, 0x04, 0x21, 0x96, 0xe3, 0x18, 0x99, 0xe3, 0x18, 0x9a, 0xe3, 0x18, 0x9b,
+  0xc3, 0x18, 0x9b, 0x82, 0xe3, 0x18, 0x9c, 0x82, 0xe3, 0x18, 0x9e, 0x01, 0xe3, 0x18, 0x9c, 0xe3,
+  0x18, 0x9d, 0x81, 0xe3, 0x18, 0x9e, 0x00, 0xe3, 0x18, 0x9d, 0x81, 0xe3, 0x18, 0x9e, 0x04, 0xe3,
+  0x18, 0x9c, 0xe3, 0x18, 0x9a, 0xe3, 0x18, 0x98, 0x03, 0x19, 0x96, 0xe4, 0x20, 0x97, 0x81, 0xe3,
+  0x18, 0x98, 0x03, 0x04, 0x21, 0x96, 0x04, 0x21, 0x94, 0x04, 0x21, 0x96, 0x03, 0x19, 0x99, 0x81,
+  0xe3, 0x18, 0x99, 0x06, 0xe3, 0x18, 0x9a, 0xe3, 0x18, 0x9c, 0xc3, 0x18, 0x9d, 0xc3, 0x18, 0x9e,
+  0xc3, 0x18, 0x9f, 0xc3, 0x18, 0xa1, 0xc3, 0x18, 0xa3, 0x81, 0xc3, 0x18, 0xa4, 0x0f, 0xc3, 0x18,
+  0xa9, 0xa2, 0x10, 0xb2, 0xa2, 0x10, 0xba, 0x82, 0x10, 0xbb, 0x82, 0x10, 0xc1, 0x81, 0x08, 0xc8,
+  0x61, 0x08, 0xcd, 0x61, 0x08, 0xd4, 0x41, 0x08, 0xd6, 0x20, 0x00, 0xd9, 0x20, 0x00, 0xdb, 0x00,
+  0x00, 0xe0, 0x00, 0x00, 0xe3, 0x00, 0x00, 0xe9, 0x00, 0x00, 0xee, 0x00, 0x00, 0xf9, 0x86, 0x00,
+  0x00, 0xff
+};
+
+const lv_img_dsc_t button_4_106x40_rle = {
+  .header.cf = IMG_RLE_CF,
+  .header.always_zero = 0,
+  .header.reserved = 0,
+  .header.w = 106,
+  .header.h = 40,
+  .data_size = 9986,
+  .data = button_4_106x40_rle_map,
+};
@@ -0,0 +1,19 @@
+#ifndef BUTTON_4_106X40_VARIANTS_H
+#define BUTTON_4_106X40_VARIANTS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <lvgl.h>
+
+extern const lv_img_dsc_t button_4_106x40_i4;
+extern const lv_img_dsc_t button_4_106x40_i8;
+extern const lv_img_dsc_t button_4_106x40_ck;
+extern const lv_img_dsc_t button_4_106x40_rle;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BUTTON_4_106X40_VARIANTS_H */
@@ -0,0 +1,148 @@
+/*******************************************************************************
+ * Serial command console: modules register named commands, loop() feeds it
+ * the Serial input. Only diagnostics live here; nothing on the I2C side
+ * depends on it.
+ *
+ * After console_start() a task of its own reads Serial. It is pinned to the
+ * loop's core below the loop, so reading and parsing never delay touch
+ * handling or an I2C reply, and its commands never run in the middle of a
+ * loop pass: what the loop writes (btn_data, the pages) is not changing
+ * under a script command that reads it.
+ * Commands that use LVGL still run in the loop: the task hands their line
+ * to console_poll() and waits for it, so lines run in the order they came.
+ * Commands added with console_add_task() run in the task and may block,
+ * which is what scripted input (script.cpp) needs to wait for its taps.
+ ******************************************************************************/
+#include <Arduino.h>
+#include <atomic>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "console.h"
+#include "pacing.h"
+
+#define CONSOLE_LINE_MAX 80
+// A line handed to a loop that does not run it by then is left to run when
+// it can; the task reads on
+#define CONSOLE_LOOP_WAIT_MS 2000
+
+typedef struct {
+    const char * name;
+    console_fn_t fn;
+    const char * help;
+    bool in_task;
+} console_cmd_t;
+
+static console_cmd_t commands[CONSOLE_MAX_COMMANDS];
+static int command_count = 0;
+static char line[CONSOLE_LINE_MAX];
+static int line_len = 0;
+
+static TaskHandle_t task = NULL;
+static std::atomic<bool> held(false);
+static char loop_line[CONSOLE_LINE_MAX];         // handed to console_poll()
+static std::atomic<bool> loop_line_ready(false);
+
+static void add(const char * name, console_fn_t fn, const char * help, bool in_task)
+{
+    if (command_count >= CONSOLE_MAX_COMMANDS) {
+        Serial.printf("console: no room for '%s'\n", name);
+        return;
+    }
+    commands[command_count++] = { name, fn, help, in_task };
+}
+
+void console_add(const char * name, console_fn_t fn, const char * help)
+{
+    add(name, fn, help, false);
+}
+
+void console_add_task(const char * name, console_fn_t fn, const char * help)
+{
+    add(name, fn, help, true);
+}
+
+// `from_task`: read by the console task, which runs its own commands and
+// hands the others to the loop
+static void run_line(char * s, bool from_task)
+{
+    while (*s == ' ') s++;
+    if (*s == 0) return;
+    char text[CONSOLE_LINE_MAX];
+    strcpy(text, s);
+    char * args = strchr(s, ' ');
+    if (args) {
+        *args++ = 0;
+        while (*args == ' ') args++;
+    } else {
+        args = s + strlen(s);
+    }
+
+    if (strcmp(s, "help") == 0) {
+        for (int i = 0; i < command_count; i++)
+            Serial.printf("  %-10s %s\n", commands[i].name, commands[i].help);
+        return;
+    }
+    for (int i = 0; i < command_count; i++) {
+        if (strcmp(s, commands[i].name) != 0) continue;
+        if (!from_task || commands[i].in_task) {
+            commands[i].fn(args);
+            return;
+        }
+        while (loop_line_ready.load(std::memory_order_acquire)) vTaskDelay(1);
+        strcpy(loop_line, text);
+        loop_line_ready.store(true, std::memory_order_release);
+        pacing_wake(PACING_WAKE_CONSOLE);
+        for (uint32_t t = 0; t < CONSOLE_LOOP_WAIT_MS && loop_line_ready.load(std::memory_order_acquire); t++)
+            vTaskDelay(pdMS_TO_TICKS(1));
+        return;
+    }
+    Serial.printf("unknown command '%s', try help\n", s);
+}
+
+static void read_input(bool from_task)
+{
+    while (!held.load(std::memory_order_relaxed) && Serial.available() > 0) {
+        int c = Serial.read();
+        if (c == '\r' || c == '\n') {
+            line[line_len] = 0;
+            line_len = 0;
+            run_line(line, from_task);
+        } else if (line_len < CONSOLE_LINE_MAX - 1) {
+            line[line_len++] = (char)c;
+        }
+    }
+}
+
+static void console_task(void * arg)
+{
+    for (;;) {
+        read_input(true);
+        vTaskDelay(pdMS_TO_TICKS(CONSOLE_POLL_MS));
+    }
+}
+
+// Called from setup(), in the loop task: the task goes on the loop's core.
+// Unpinned, priority 0 would only be below the loop on that core, and the
+// task would run on the other one alongside it.
+void console_start()
+{
+    xTaskCreatePinnedToCore(console_task, "console", CONSOLE_TASK_STACK, NULL, CONSOLE_TASK_PRIO, &task,
+                            xPortGetCoreID());
+}
+
+void console_hold(bool hold)
+{
+    held.store(hold, std::memory_order_relaxed);
+}
+
+void console_poll()
+{
+    if (!task) {
+        read_input(false);
+        return;
+    }
+    if (!loop_line_ready.load(std::memory_order_acquire)) return;
+    run_line(loop_line, false);
+    loop_line_ready.store(false, std::memory_order_release);
+}
@@ -0,0 +1,46 @@
+#ifndef CONSOLE_H
+#define CONSOLE_H
+
+// Line-based commands on Serial (115200, newline terminated): the first word
+// selects the command, the rest of the line is passed as `args`
+typedef void (*console_fn_t)(const char * args);
+
+#ifndef CONSOLE_MAX_COMMANDS
+#define CONSOLE_MAX_COMMANDS 16
+#endif
+
+// Console task (console_start()): pinned to the loop's core below the loop's
+// priority, so it only runs while the loop sleeps; Serial is checked every
+// CONSOLE_POLL_MS
+#ifndef CONSOLE_TASK_PRIO
+#define CONSOLE_TASK_PRIO 0
+#endif
+#ifndef CONSOLE_TASK_STACK
+#define CONSOLE_TASK_STACK 4096
+#endif
+#ifndef CONSOLE_POLL_MS
+#define CONSOLE_POLL_MS 10
+#endif
+
+// Register a command; `help` is one line shown by the built-in "help".
+// It runs in the loop (UI task), so it may use LVGL.
+void console_add(const char * name, console_fn_t fn, const char * help);
+
+// Register a command run by the console task itself: it may block (wait for
+// an injected tap to reach the master) and must not touch LVGL. Without the
+// task it runs from console_poll() like the others.
+void console_add_task(const char * name, console_fn_t fn, const char * help);
+
+// Read Serial in a task of its own from now on. Lines for console_add()
+// commands are handed to console_poll(), one at a time and in order: the
+// task waits for each to be run before reading the next.
+void console_start();
+
+// Stop reading Serial while `hold` (the serial link owns the USB port)
+void console_hold(bool hold);
+
+// Run the line the console task handed over, or, before console_start(),
+// read pending Serial input and run complete lines; call from loop()
+void console_poll();
+
+#endif
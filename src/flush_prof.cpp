@@ -0,0 +1,155 @@
+/*******************************************************************************
+ * Flush profiler (build flag FLUSH_PROF)
+ *
+ * Every area passed to my_disp_flush() goes into a ring of FLUSH_PROF_DEPTH
+ * entries (frame number, time, rectangle, duration), plus running totals per
+ * frame. Console commands:
+ *
+ *   flush               dump the ring as CSV, then the totals
+ *   flush clear         empty the ring and reset the totals
+ *   flush overlay on    outline each flushed area for FLUSH_OVERLAY_MS
+ *   flush overlay off
+ *
+ * The overlay draws straight to the panel after the flush, then invalidates
+ * the area so LVGL paints over the outline. The frame that does that repaint
+ * is not outlined itself, otherwise it would never stop.
+ ******************************************************************************/
+#include <Arduino.h>
+#include <string.h>
+#include <lvgl.h>
+
+#include "flush_prof.h"
+#include "console.h"
+
+#ifdef FLUSH_PROF
+
+#define OVERLAY_MAX_AREAS 16
+
+typedef struct {
+    uint32_t t_ms;
+    int16_t  x1, y1, x2, y2;
+    uint16_t us;       // saturates at 65535
+    uint16_t frame;
+} flush_rec_t;
+
+static flush_rec_t ring[FLUSH_PROF_DEPTH];
+static uint32_t ring_count = 0;       // total recorded, ring holds the last DEPTH
+
+static uint32_t frame_no = 0;
+static uint32_t frame_px = 0, frame_us = 0, frame_areas = 0;
+static uint32_t tot_frames, tot_areas, tot_px, tot_us, max_frame_px, max_frame_us, max_frame_areas;
+
+static bool overlay_on = false;
+static bool restoring = false;        // current frame repaints overlay outlines
+static lv_area_t overlay_areas[OVERLAY_MAX_AREAS];
+static int overlay_count = 0;
+static lv_timer_t * overlay_timer = NULL;
+
+static void reset_totals()
+{
+    tot_frames = tot_areas = tot_px = tot_us = 0;
+    max_frame_px = max_frame_us = max_frame_areas = 0;
+    frame_px = frame_us = frame_areas = 0;
+}
+
+static void overlay_timer_cb(lv_timer_t * t)
+{
+    if (overlay_count == 0) return;
+    lv_disp_t * disp = lv_disp_get_default();
+    for (int i = 0; i < overlay_count; i++)
+        _lv_inv_area(disp, &overlay_areas[i]);
+    overlay_count = 0;
+    restoring = true;
+}
+
+bool flush_prof_record(const lv_area_t * area, uint32_t us, bool last)
+{
+    uint32_t px = (uint32_t)(area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1);
+
+    flush_rec_t * r = &ring[ring_count++ % FLUSH_PROF_DEPTH];
+    r->t_ms  = millis();
+    r->x1 = area->x1; r->y1 = area->y1; r->x2 = area->x2; r->y2 = area->y2;
+    r->us    = us > 0xFFFF ? 0xFFFF : us;
+    r->frame = frame_no;
+
+    frame_px += px;
+    frame_us += us;
+    frame_areas++;
+
+    bool outline = overlay_on && !restoring;
+    if (outline) {
+        if (overlay_count < OVERLAY_MAX_AREAS) {
+            overlay_areas[overlay_count++] = *area;
+            lv_timer_reset(overlay_timer);
+        } else {
+            outline = false;   // could not be erased later
+        }
+    }
+
+    if (last) {
+        tot_frames++;
+        tot_areas += frame_areas;
+        tot_px += frame_px;
+        tot_us += frame_us;
+        if (frame_px > max_frame_px) max_frame_px = frame_px;
+        if (frame_us > max_frame_us) max_frame_us = frame_us;
+        if (frame_areas > max_frame_areas) max_frame_areas = frame_areas;
+        frame_px = frame_us = frame_areas = 0;
+        frame_no++;
+        restoring = false;
+    }
+    return outline;
+}
+
+static void dump()
+{
+    uint32_t n = ring_count < FLUSH_PROF_DEPTH ? ring_count : FLUSH_PROF_DEPTH;
+    Serial.printf("FLUSH last %lu areas, oldest first\n", (unsigned long)n);
+    Serial.println("frame,t_ms,x1,y1,w,h,px,us");
+    for (uint32_t i = ring_count - n; i != ring_count; i++) {
+        const flush_rec_t * r = &ring[i % FLUSH_PROF_DEPTH];
+        uint32_t w = r->x2 - r->x1 + 1, h = r->y2 - r->y1 + 1;
+        Serial.printf("%u,%lu,%d,%d,%lu,%lu,%lu,%u\n", r->frame, (unsigned long)r->t_ms,
+                      r->x1, r->y1, (unsigned long)w, (unsigned long)h,
+                      (unsigned long)(w * h), r->us);
+    }
+
+    lv_disp_t * disp = lv_disp_get_default();
+    uint32_t screen_px = (uint32_t)lv_disp_get_hor_res(disp) * lv_disp_get_ver_res(disp);
+    uint32_t avg_px = tot_frames ? tot_px / tot_frames : 0;
+    Serial.printf("FLUSH frames=%lu areas/frame avg=%.1f max=%lu\n",
+                  (unsigned long)tot_frames, tot_frames ? (float)tot_areas / tot_frames : 0.0f,
+                  (unsigned long)max_frame_areas);
+    Serial.printf("FLUSH px/frame avg=%lu (%.1f%% of screen) max=%lu (%.1f%%)\n",
+                  (unsigned long)avg_px, screen_px ? 100.0f * avg_px / screen_px : 0.0f,
+                  (unsigned long)max_frame_px, screen_px ? 100.0f * max_frame_px / screen_px : 0.0f);
+    Serial.printf("FLUSH us/frame avg=%lu max=%lu, us/px=%.3f\n",
+                  (unsigned long)(tot_frames ? tot_us / tot_frames : 0), (unsigned long)max_frame_us,
+                  tot_px ? (float)tot_us / tot_px : 0.0f);
+}
+
+static void flush_cmd(const char * args)
+{
+    if (*args == 0) {
+        dump();
+    } else if (strcmp(args, "clear") == 0) {
+        ring_count = 0;
+        reset_totals();
+        Serial.println("FLUSH cleared");
+    } else if (strcmp(args, "overlay on") == 0) {
+        overlay_on = true;
+    } else if (strcmp(args, "overlay off") == 0) {
+        overlay_on = false;
+    } else {
+        Serial.println("usage: flush [clear | overlay on | overlay off]");
+    }
+}
+
+void flush_prof_init()
+{
+    reset_totals();
+    overlay_timer = lv_timer_create(overlay_timer_cb, FLUSH_OVERLAY_MS, NULL);
+    console_add("flush", flush_cmd, "flushed areas: [clear | overlay on|off]");
+}
+
+#endif
@@ -0,0 +1,27 @@
+#ifndef FLUSH_PROF_H
+#define FLUSH_PROF_H
+
+#include <lvgl.h>
+
+// Flushed areas kept for the "flush" console command (16 bytes each)
+#ifndef FLUSH_PROF_DEPTH
+#define FLUSH_PROF_DEPTH 128
+#endif
+// Dirty-rect overlay: outline colour (RGB565) and how long outlines stay up
+#ifndef FLUSH_OVERLAY_COLOR
+#define FLUSH_OVERLAY_COLOR 0xF800
+#endif
+#ifndef FLUSH_OVERLAY_MS
+#define FLUSH_OVERLAY_MS 200
+#endif
+
+#ifdef FLUSH_PROF
+// Register the "flush" console command; call after the display is registered
+void flush_prof_init();
+
+// Hook for flush_cb: one area drawn in `us`, `last` from lv_disp_flush_is_last().
+// Returns true if the overlay is on and the area should be outlined.
+bool flush_prof_record(const lv_area_t * area, uint32_t us, bool last);
+#endif
+
+#endif
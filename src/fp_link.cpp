@@ -0,0 +1,241 @@
+/*******************************************************************************
+ * Serial link: fp_proto over a byte stream, framed, sequenced, acknowledged
+ *
+ * The link takes the place of the I2C master as the consumer of fp_proto's
+ * event queue: it pops events with fp_take_events() and pushes them in
+ * FP_LINK_EVENTS frames, and it reads REG_INT_MASK, REG_ENCODER and
+ * REG_PAGE as a master would, sending an FP_LINK_STATE frame when one of
+ * them has something. The host's register reads and writes go through
+ * fp_read() / fp_write(), so everything else (config, labels, pages, stats,
+ * extensions) is the I2C register map unchanged.
+ *
+ * One frame is in flight each way (stop and wait). An events frame carries
+ * up to FP_LINK_EVENTS_MAX events, so the link does not wait per event:
+ * whatever was queued while a frame was in flight goes in the next one.
+ * The frame in flight is kept until its ACK: a lost or corrupted frame is
+ * sent again, never lost, and the host drops the duplicate by its seq. A
+ * host that acknowledges nothing for FP_LINK_RETRIES_MAX retries is gone:
+ * the frame is dropped, its presses and releases go back to fp_proto for
+ * whoever reads next, and nothing more is sent until the host speaks.
+ ******************************************************************************/
+#include <string.h>
+#include "fp_link.h"
+
+static_assert(FP_LINK_EVENTS_MAX <= FP_QUEUE_DEPTH, "fp_return_events() takes back a whole frame");
+
+typedef enum { RX_SOF, RX_HEADER, RX_PAYLOAD, RX_CRC } rx_state_t;
+
+static fp_link_write_t write_cb = nullptr;
+static fp_link_stats_t stats;
+
+// Receiver
+static rx_state_t rx_state = RX_SOF;
+static uint8_t rx_buf[3 + FP_LINK_PAYLOAD_MAX + 2];   // type, seq, len, payload, CRC
+static int rx_pos, rx_need;
+static int rx_last_seq = -1;      // last host frame applied
+
+// Frame in flight to the host
+static uint8_t tx_frame[FP_LINK_OVERHEAD + FP_LINK_PAYLOAD_MAX];
+static int tx_len = 0;            // 0: nothing in flight
+static uint8_t tx_seq = 0;
+static uint32_t tx_first_ms, tx_sent_ms;
+static int tx_events;             // events in it
+static int tx_retries;
+
+static bool connected = false;
+static bool held = false;         // fp_link_hold()
+static bool state_due = false;    // send a full state frame (after HELLO)
+static int read_pending = -1;     // register of an FP_LINK_READ to answer
+
+uint16_t fp_link_crc(const uint8_t * data, int len)
+{
+    uint16_t crc = 0xFFFF;
+    while (len--) {
+        crc ^= (uint16_t)*data++ << 8;
+        for (int i = 0; i < 8; i++)
+            crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+static int frame(uint8_t * out, uint8_t type, uint8_t seq, const uint8_t * payload, int len)
+{
+    out[0] = FP_LINK_SOF;
+    out[1] = type;
+    out[2] = seq;
+    out[3] = len;
+    memcpy(out + 4, payload, len);
+    uint16_t crc = fp_link_crc(out + 1, 3 + len);
+    out[4 + len] = crc & 0xFF;
+    out[5 + len] = crc >> 8;
+    return FP_LINK_OVERHEAD + len;
+}
+
+static void send_ack(uint8_t seq)
+{
+    uint8_t f[FP_LINK_OVERHEAD];
+    write_cb(f, frame(f, FP_LINK_ACK, seq, nullptr, 0));
+}
+
+static void send_sequenced(uint8_t type, const uint8_t * payload, int len, int events, uint32_t now)
+{
+    tx_len = frame(tx_frame, type, ++tx_seq, payload, len);
+    tx_events = events;
+    tx_retries = 0;
+    tx_first_ms = tx_sent_ms = now;
+    stats.tx_frames++;
+    write_cb(tx_frame, tx_len);
+}
+
+static void handle_frame(uint32_t now)
+{
+    uint8_t type = rx_buf[0], seq = rx_buf[1], len = rx_buf[2];
+    const uint8_t * payload = rx_buf + 3;
+    stats.rx_frames++;
+
+    if (type == FP_LINK_ACK) {
+        if (tx_len && seq == tx_seq) {
+            tx_len = 0;
+            stats.events += tx_events;
+            if (now - tx_first_ms > stats.ack_max_ms) stats.ack_max_ms = now - tx_first_ms;
+        }
+        return;
+    }
+    send_ack(seq);
+    if (type == FP_LINK_HELLO) {
+        connected = true;
+        state_due = true;
+        rx_last_seq = seq;
+        return;
+    }
+    if (seq == rx_last_seq) {
+        stats.rx_dups++;
+        return;
+    }
+    rx_last_seq = seq;
+    connected = true;
+    if (type == FP_LINK_WRITE && len >= 1)
+        fp_write(payload, len);
+    else if (type == FP_LINK_READ && len >= 1)
+        read_pending = payload[0];
+}
+
+void fp_link_init(fp_link_write_t write)
+{
+    write_cb = write;
+}
+
+void fp_link_input(const uint8_t * data, int len, uint32_t now_ms)
+{
+    for (int i = 0; i < len; i++) {
+        uint8_t b = data[i];
+        switch (rx_state) {
+            case RX_SOF:
+                if (b == FP_LINK_SOF) {
+                    rx_state = RX_HEADER;
+                    rx_pos = 0;
+                }
+                break;
+            case RX_HEADER:
+                rx_buf[rx_pos++] = b;
+                if (rx_pos < 3) break;
+                if (rx_buf[2] > FP_LINK_PAYLOAD_MAX) {
+                    stats.crc_errors++;
+                    rx_state = RX_SOF;
+                    break;
+                }
+                rx_need = 3 + rx_buf[2] + 2;
+                rx_state = rx_buf[2] ? RX_PAYLOAD : RX_CRC;
+                break;
+            case RX_PAYLOAD:
+            case RX_CRC:
+                rx_buf[rx_pos++] = b;
+                if (rx_pos < rx_need) break;
+                rx_state = RX_SOF;
+                if (fp_link_crc(rx_buf, rx_need - 2) !=
+                    (rx_buf[rx_need - 2] | (uint16_t)rx_buf[rx_need - 1] << 8)) {
+                    stats.crc_errors++;
+                    break;
+                }
+                handle_frame(now_ms);
+                break;
+        }
+    }
+}
+
+// REG_INT_MASK, and REG_ENCODER / REG_PAGE when it flags them, read as a
+// master would; `full` reads them all (snapshot after HELLO)
+static bool take_state(uint8_t * p, bool full)
+{
+    uint8_t m[2];
+    fp_read(REG_INT_MASK, m, 2);
+    uint16_t mask = m[0] | m[1] << 8;
+    if (!full && !(mask & (INT_ENC | INT_PAGE | INT_READY))) return false;
+    p[0] = m[0];
+    p[1] = m[1];
+    p[2] = FP_ENCODER_ID;
+    p[3] = 0;
+    if (full || (mask & INT_ENC)) fp_read(REG_ENCODER, p + 2, 2);
+    p[4] = p[5] = 0;
+    fp_read(REG_PAGE, p + 4, 2);
+    return true;
+}
+
+uint32_t fp_link_poll(uint32_t now_ms)
+{
+    if (!write_cb) return UINT32_MAX;
+    if (tx_len && now_ms - tx_sent_ms >= FP_LINK_RETRY_MS && tx_retries >= FP_LINK_RETRIES_MAX) {
+        // Host gone: what it may not have is for the next consumer
+        if (tx_frame[1] == FP_LINK_EVENTS) fp_return_events(tx_frame + 4, tx_events);
+        tx_len = 0;
+        connected = false;
+        read_pending = -1;
+        stats.hosts_lost++;
+    }
+    if (tx_len) {
+        if (now_ms - tx_sent_ms >= FP_LINK_RETRY_MS) {
+            tx_sent_ms = now_ms;
+            tx_retries++;
+            stats.retries++;
+            write_cb(tx_frame, tx_len);
+        }
+        return FP_LINK_RETRY_MS - (now_ms - tx_sent_ms);
+    }
+    if (!connected || held) return UINT32_MAX;
+
+    uint8_t payload[FP_LINK_PAYLOAD_MAX];
+    if (read_pending >= 0) {
+        payload[0] = read_pending;
+        int n = fp_read(read_pending, payload + 1, FP_LINK_PAYLOAD_MAX - 1);
+        read_pending = -1;
+        send_sequenced(FP_LINK_DATA, payload, 1 + n, 0, now_ms);
+    } else if (int n = fp_take_events(payload, FP_LINK_EVENTS_MAX)) {
+        send_sequenced(FP_LINK_EVENTS, payload, n * FP_BATCH_RECORD, n, now_ms);
+    } else if (take_state(payload, state_due)) {
+        state_due = false;
+        send_sequenced(FP_LINK_STATE, payload, 6, 0, now_ms);
+    } else {
+        return UINT32_MAX;
+    }
+    return FP_LINK_RETRY_MS;
+}
+
+void fp_link_hold(bool hold)
+{
+    held = hold;
+}
+
+bool fp_link_idle()
+{
+    return tx_len == 0;
+}
+
+bool fp_link_connected()
+{
+    return connected;
+}
+
+const fp_link_stats_t * fp_link_stats()
+{
+    return &stats;
+}
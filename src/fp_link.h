@@ -0,0 +1,92 @@
+#ifndef FP_LINK_H
+#define FP_LINK_H
+
+#include <stdint.h>
+#include "fp_proto.h"
+
+/* Serial link: the front panel protocol over a byte stream (UART, USB
+ * serial, a pty on a host) instead of I2C. The panel pushes events and
+ * state changes as soon as they happen; the host reads and writes the
+ * fp_proto registers with request frames. Arduino-free, like fp_proto.
+ *
+ * Frame: FP_LINK_SOF, type, seq, len, payload[len], CRC-16/CCITT-FALSE of
+ * type..payload (little-endian). Every frame but FP_LINK_ACK carries a
+ * sequence number and is acknowledged with an FP_LINK_ACK of the same seq.
+ * Each side has one frame in flight and sends it again every
+ * FP_LINK_RETRY_MS until acknowledged; a receiver that gets the seq it
+ * acknowledged last acknowledges it again and drops it. A frame with a bad
+ * CRC is dropped, the sender's retry recovers it, and the receiver hunts
+ * for the next FP_LINK_SOF, so text on the same line (the console log on
+ * USB serial) is skipped. */
+
+#define FP_LINK_SOF 0xA5
+
+// Frame types, panel -> host
+#define FP_LINK_EVENTS 0x01  // n records of FP_BATCH_RECORD bytes, as in a batched REG_TOUCH
+#define FP_LINK_STATE  0x02  // REG_INT_MASK (2B LE) + REG_ENCODER (2B) + REG_PAGE (2B)
+#define FP_LINK_DATA   0x03  // register + the bytes of an FP_LINK_READ
+// Both ways, not sequenced: `seq` is the frame acknowledged
+#define FP_LINK_ACK    0x04
+// Host -> panel
+#define FP_LINK_WRITE  0x10  // register + data, as an I2C write
+#define FP_LINK_READ   0x11  // register: answered by FP_LINK_DATA
+#define FP_LINK_HELLO  0x12  // host (re)started: the panel starts pushing
+
+#ifndef FP_LINK_RETRY_MS
+#define FP_LINK_RETRY_MS 20
+#endif
+// Retries of one frame before the host is taken as gone (~1 s)
+#ifndef FP_LINK_RETRIES_MAX
+#define FP_LINK_RETRIES_MAX 50
+#endif
+// Events per FP_LINK_EVENTS frame
+#ifndef FP_LINK_EVENTS_MAX
+#define FP_LINK_EVENTS_MAX 16
+#endif
+#define FP_LINK_PAYLOAD_MAX (1 + FP_TX_MAX)
+#define FP_LINK_OVERHEAD 6   // SOF, type, seq, len, CRC
+
+typedef struct {
+    uint32_t tx_frames;      // sequenced frames sent (first time)
+    uint32_t retries;        // frames sent again
+    uint32_t rx_frames;      // good frames received
+    uint32_t rx_dups;        // received again, acknowledged and dropped
+    uint32_t crc_errors;     // frames dropped for a bad CRC or length
+    uint32_t events;         // events acknowledged by the host
+    uint32_t ack_max_ms;     // longest first send -> ACK
+    uint32_t hosts_lost;     // frames never acknowledged: host taken as gone
+} fp_link_stats_t;
+
+// Sends bytes on the line (one frame per call)
+typedef void (*fp_link_write_t)(const uint8_t * data, int len);
+
+void fp_link_init(fp_link_write_t write);
+
+// Bytes received from the line
+void fp_link_input(const uint8_t * data, int len, uint32_t now_ms);
+
+// Sends what is pending: an FP_LINK_READ answer, queued events, a state
+// change, or the frame in flight again. Returns the ms until it has to run
+// again without new input or events (UINT32_MAX: nothing in flight).
+//
+// A frame sent FP_LINK_RETRIES_MAX times without an ACK drops the host
+// (fp_link_connected() false until it sends again); the presses and
+// releases of an events frame go back to the queue (fp_return_events()).
+uint32_t fp_link_poll(uint32_t now_ms);
+
+// Hold (true): start no new frame, for a switch to I2C. The frame in flight
+// is still sent again until acknowledged or given up.
+void fp_link_hold(bool hold);
+
+// Nothing in flight: with the link held, events are no longer taken
+bool fp_link_idle();
+
+// A host said FP_LINK_HELLO (or sent any frame) and has not been dropped
+bool fp_link_connected();
+
+const fp_link_stats_t * fp_link_stats();
+
+// CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF), as used by the frames
+uint16_t fp_link_crc(const uint8_t * data, int len);
+
+#endif
@@ -0,0 +1,599 @@
+/*******************************************************************************
+ * Pico front panel protocol: register map, button event queue and the
+ * REG_STATS health block, independent of the I2C driver.
+ *
+ * Button events go through a single-producer / single-consumer ring: the UI
+ * task pushes, the I2C slave callbacks pop on REG_TOUCH reads. INT_TS is set
+ * while the ring is not empty, so a quick press/release pair between two
+ * polls reaches the master as two events instead of the release overwriting
+ * the press. Neither side takes a lock.
+ *
+ * Labels written to REG_LABEL go into one fixed slot per button, under a
+ * sequence counter: the I2C task is the only writer, and the UI copies a
+ * slot again if a write overlapped the copy, so a text is never torn.
+ *
+ * A master that enabled FP_FEATURE_CLICK gets a momentary press and its
+ * release as one FP_STATE_CLICK event when both were queued by the time it
+ * reads REG_TOUCH, i.e. the tap fell between two of its polls. The merge is
+ * done by the consumer, which owns both slots once they are published, so
+ * the producer never rewrites a queued event. Toggle buttons report their
+ * new state with press/release codes and are never merged. A human tap lasts
+ * ~100 ms, several poll periods, so the master would usually read the press
+ * alone; the click window the master sets in REG_CONFIG holds a momentary
+ * press back in the producer for that long, trading press latency for one
+ * event per tap.
+ *
+ * Extensions (REG_CAPS) are enabled by a longer REG_CONFIG write. Every
+ * stock pico_frontpanel transaction is answered the same way whether the
+ * slave has them or not, so a master that never looks at REG_CAPS keeps
+ * working; the only registers it sees change are ones it never uses.
+ * Whatever shows up in a stock transaction is opt-in: repeat events in
+ * REG_TOUCH, INT_PAGE in REG_INT_MASK (only a REG_PAGE read clears it).
+ *
+ * The last events read are kept until the master's next transaction starts,
+ * which shows the read completed. If the bus is recovered first, the press
+ * and release events among them are sent again: at least once, and a
+ * duplicate carries a state the master already has. Clicks and repeats are
+ * not: the master acts on each one, so a duplicate would act twice. They
+ * are sent at most once.
+ ******************************************************************************/
+#include <atomic>
+#include <string.h>
+#include "fp_proto.h"
+
+static_assert((FP_QUEUE_DEPTH & (FP_QUEUE_DEPTH - 1)) == 0, "FP_QUEUE_DEPTH must be a power of 2");
+static_assert(FP_BATCH_MAX >= 1 && FP_BATCH_MAX <= 255, "FP_BATCH_MAX is sent in one byte");
+
+typedef struct {
+    uint8_t  button;
+    uint8_t  state;    // FP_STATE_*
+    uint16_t count;    // FP_STATE_REPEAT: repeats in this event; click: ms held
+    bool     click;    // momentary release, may merge with its press
+} fp_event_t;
+
+static fp_event_t queue[FP_QUEUE_DEPTH];
+static std::atomic<uint32_t> q_head(0);   // written by the producer only
+static std::atomic<uint32_t> q_tail(0);   // written by the consumer only
+
+static std::atomic<uint32_t> stats[FP_STAT_COUNT];
+
+// Producer side: repeats not queued yet. At most one repeat event waits in
+// the queue; repeats made meanwhile are added up here and go out as one
+// event once the master has read it.
+static uint8_t  rep_button;
+static uint32_t rep_pending = 0;
+static uint32_t rep_pos;            // queue position of the last repeat event
+static bool     rep_queued = false;
+
+// Consumer side: events of the last REG_TOUCH read, until the next transaction
+static fp_event_t inflight[FP_BATCH_MAX];
+static int        inflight_n = 0;
+static std::atomic<bool>    inflight_valid(false);
+static std::atomic<bool>    redeliver(false);
+
+// Consumer side: press/release events the serial link took and gives back
+// (fp_return_events()), read before the queue
+static fp_event_t returned[FP_QUEUE_DEPTH];
+static int        returned_pos = 0;
+static std::atomic<int> returned_n(0);
+
+static std::atomic<int32_t> enc_count(0);   // added by the UI, taken by reads
+
+typedef struct {
+    std::atomic<uint32_t> seq;      // odd while the I2C task writes the text
+    char text[FP_LABEL_MAX];
+} fp_label_t;
+
+static fp_label_t labels[FP_LABEL_BUTTONS];
+static std::atomic<uint64_t> label_dirty(0);  // bit i: label i written, not taken
+
+static std::atomic<uint16_t> page_shown(0);      // page << 8 | count
+static std::atomic<bool>     page_changed(false);
+static std::atomic<int16_t>  page_req(-1);      // written by the master
+
+// REG_CONFIG as the master wrote it, extensions applied
+static std::atomic<uint16_t> config(0);
+static std::atomic<uint16_t> features(0);    // FP_FEATURES_OPTIN the master enabled
+static std::atomic<uint16_t> click_window(0); // ms
+static std::atomic<uint8_t>  batch(1);        // events per REG_TOUCH read
+
+// Producer side: momentary press held back for the click window
+static bool     held_valid = false;
+static uint8_t  held_button;
+static uint32_t held_since;
+
+static std::atomic<bool>    ready_pending(false);
+static std::atomic<bool>    int_active_high(false);
+static std::atomic<uint8_t> selected_reg(0xFF);
+static fp_int_cb_t int_cb = nullptr;
+
+static uint16_t int_mask()
+{
+    uint16_t mask = 0;
+    if (q_head.load(std::memory_order_acquire) != q_tail.load(std::memory_order_acquire))
+        mask |= INT_TS;
+    if (redeliver.load(std::memory_order_relaxed) || returned_n.load(std::memory_order_relaxed))
+        mask |= INT_TS;
+    if (enc_count.load(std::memory_order_relaxed) != 0)
+        mask |= INT_ENC;
+    if (page_changed.load(std::memory_order_relaxed) &&
+        (features.load(std::memory_order_relaxed) & FP_FEATURE_PAGES))
+        mask |= INT_PAGE;
+    if (ready_pending.load(std::memory_order_relaxed))
+        mask |= INT_READY;
+    return mask;
+}
+
+// Both tasks drive the line; whoever writes last re-checks the mask after
+// writing, so a stale level from the other task is always corrected
+static void update_int()
+{
+    if (!int_cb) return;
+    bool asserted;
+    do {
+        asserted = int_mask() != 0;
+        int_cb(asserted == int_active_high.load(std::memory_order_relaxed));
+    } while ((int_mask() != 0) != asserted);
+}
+
+void fp_init(fp_int_cb_t set_int)
+{
+    int_cb = set_int;
+    stats[FP_STAT_LAYOUT].store(FP_STAT_COUNT, std::memory_order_relaxed);
+    update_int();
+}
+
+static void label_write(uint8_t button, const uint8_t * text, int len)
+{
+    if (button >= FP_LABEL_BUTTONS) return;
+    if (len > FP_LABEL_MAX - 1) len = FP_LABEL_MAX - 1;
+    fp_label_t * l = &labels[button];
+    uint32_t seq = l->seq.load(std::memory_order_relaxed);
+    l->seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy(l->text, text, len);
+    l->text[len] = 0;
+    l->seq.store(seq + 2, std::memory_order_release);
+    label_dirty.fetch_or(1ull << button, std::memory_order_release);
+    fp_stat_inc(FP_STAT_LABELS);
+}
+
+void fp_receive(const uint8_t * data, int len)
+{
+    if (len <= 0) return;
+    if (!redeliver.load(std::memory_order_relaxed))
+        inflight_valid.store(false, std::memory_order_relaxed);
+    selected_reg.store(data[0], std::memory_order_relaxed);
+    fp_write(data, len);
+}
+
+void fp_write(const uint8_t * data, int len)
+{
+    if (len <= 0) return;
+    if (data[0] == REG_CONFIG && len >= 3) {
+        uint16_t cfg = data[1] | ((uint16_t)data[2] << 8);
+        config.store(cfg, std::memory_order_relaxed);
+        int_active_high.store((cfg >> 8) & 1, std::memory_order_relaxed);
+        // Missing bytes are 0: whatever the master does not ask for is off
+        uint16_t f = len >= 5 ? data[3] | ((uint16_t)data[4] << 8) : 0;
+        f &= FP_FEATURES_OPTIN;
+        int b = len >= 7 ? data[6] : 1;
+        if (!(f & FP_FEATURE_BATCH) || b < 1) b = 1;
+        if (b > FP_BATCH_MAX) b = FP_BATCH_MAX;
+        click_window.store((f & FP_FEATURE_CLICK) && len >= 6 ? data[5] * 10 : 0,
+                           std::memory_order_relaxed);
+        batch.store(b, std::memory_order_relaxed);
+        features.store(f, std::memory_order_relaxed);
+        if (!(f & FP_FEATURE_PAGES)) page_changed.store(false, std::memory_order_relaxed);
+    } else if (data[0] == REG_PAGE && len >= 2) {
+        page_req.store(data[1], std::memory_order_relaxed);
+    } else if (data[0] == REG_LABEL) {
+        const uint8_t * p = data + 1, * end = data + len;
+        while (end - p >= 2) {
+            int n = p[1];
+            if (n > end - p - 2) n = end - p - 2;   // cut short by the write
+            label_write(p[0], p + 2, n);
+            p += 2 + n;
+        }
+    }
+}
+
+uint8_t fp_selected_register()
+{
+    return selected_reg.load(std::memory_order_relaxed);
+}
+
+static void put_u32(uint8_t * p, uint32_t v)
+{
+    p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24;
+}
+
+// Next event for the master; a momentary press with its release right
+// behind goes out as one click when the master enabled them
+static bool pop_event(fp_event_t * ev)
+{
+    int rn = returned_n.load(std::memory_order_acquire);
+    if (returned_pos < rn) {
+        *ev = returned[returned_pos++];
+        if (returned_pos == rn) {
+            returned_pos = 0;
+            returned_n.store(0, std::memory_order_release);
+        }
+        return true;
+    }
+    uint32_t tail = q_tail.load(std::memory_order_relaxed);
+    uint32_t head = q_head.load(std::memory_order_acquire);
+    if (tail == head) return false;
+    *ev = queue[tail & (FP_QUEUE_DEPTH - 1)];
+    tail++;
+    if ((features.load(std::memory_order_relaxed) & FP_FEATURE_CLICK) &&
+        ev->state == FP_STATE_PRESS && tail != head) {
+        const fp_event_t & rel = queue[tail & (FP_QUEUE_DEPTH - 1)];
+        if (rel.click && rel.button == ev->button) {
+            ev->state = FP_STATE_CLICK;
+            ev->count = rel.count;
+            tail++;
+            fp_stat_inc(FP_STAT_CLICKS);
+        }
+    }
+    q_tail.store(tail, std::memory_order_release);
+    return true;
+}
+
+// [button, state, count LE]; count is 0 for press and release, as before
+// there was a count
+static int put_event(uint8_t * p, const fp_event_t & ev)
+{
+    uint16_t count = ev.state >= FP_STATE_REPEAT ? ev.count : 0;
+    p[0] = ev.button;
+    p[1] = ev.state;
+    p[2] = count & 0xFF;
+    p[3] = count >> 8;
+    return FP_BATCH_RECORD;
+}
+
+int fp_request(uint8_t * out, int max)
+{
+    return fp_read(selected_reg.load(std::memory_order_relaxed), out, max);
+}
+
+int fp_take_events(uint8_t * out, int max)
+{
+    fp_event_t ev;
+    int n = 0;
+    while (n < max && pop_event(&ev))
+        put_event(out + FP_BATCH_RECORD * n++, ev);
+    if (n) update_int();
+    return n;
+}
+
+void fp_return_events(const uint8_t * recs, int n)
+{
+    // They were taken before any returned event still unread
+    fp_event_t evs[FP_QUEUE_DEPTH];
+    int k = 0;
+    for (int i = 0; i < n && k < FP_QUEUE_DEPTH; i++, recs += FP_BATCH_RECORD)
+        if (recs[1] <= FP_STATE_PRESS) evs[k++] = { recs[0], recs[1], 0, false };
+    int rn = returned_n.load(std::memory_order_relaxed);
+    for (int i = returned_pos; i < rn && k < FP_QUEUE_DEPTH; i++) evs[k++] = returned[i];
+    memcpy(returned, evs, k * sizeof(evs[0]));
+    returned_pos = 0;
+    returned_n.store(k, std::memory_order_release);
+    update_int();
+}
+
+int fp_read(uint8_t reg, uint8_t * out, int max)
+{
+    uint8_t buf[FP_TX_MAX];
+    int n = 0;
+
+    switch (reg) {
+        case REG_INT_MASK: {
+            uint16_t mask = int_mask();
+            buf[n++] = mask & 0xFF;
+            buf[n++] = mask >> 8;
+            // INT stays asserted while events wait for a REG_TOUCH read
+            if (!(mask & INT_TS)) ready_pending.store(false, std::memory_order_relaxed);
+            fp_stat_inc(FP_STAT_POLLS);
+            break;
+        }
+        case REG_ENCODER: {
+            int32_t c = enc_count.load(std::memory_order_relaxed);
+            if (c > 127) c = 127;
+            if (c < -127) c = -127;
+            if (c) {
+                enc_count.fetch_sub(c, std::memory_order_relaxed);
+                fp_stat_set(FP_STAT_ENC_DETENTS, fp_stat_get(FP_STAT_ENC_DETENTS) + (c < 0 ? -c : c));
+                fp_stat_inc(FP_STAT_ENC_READS);
+            }
+            buf[n++] = FP_ENCODER_ID;
+            buf[n++] = (uint8_t)(int8_t)c;
+            ready_pending.store(false, std::memory_order_relaxed);
+            break;
+        }
+        case REG_PAGE: {
+            uint16_t shown = page_shown.load(std::memory_order_relaxed);
+            buf[n++] = shown >> 8;
+            buf[n++] = shown & 0xFF;
+            page_changed.store(false, std::memory_order_relaxed);
+            ready_pending.store(false, std::memory_order_relaxed);
+            break;
+        }
+        case REG_SWITCH:
+            buf[n++] = 0;  // no encoder switches
+            ready_pending.store(false, std::memory_order_relaxed);
+            break;
+        case REG_CONFIG: {
+            uint16_t cfg = config.load(std::memory_order_relaxed);
+            uint16_t f = features.load(std::memory_order_relaxed);
+            buf[n++] = cfg & 0xFF;
+            buf[n++] = cfg >> 8;
+            buf[n++] = f & 0xFF;
+            buf[n++] = f >> 8;
+            buf[n++] = click_window.load(std::memory_order_relaxed) / 10;
+            buf[n++] = batch.load(std::memory_order_relaxed);
+            break;
+        }
+        case REG_CAPS:
+            buf[n++] = FP_PROTO_VERSION;
+            buf[n++] = FP_FEATURES & 0xFF;
+            buf[n++] = FP_FEATURES >> 8;
+            buf[n++] = FP_BATCH_MAX;
+            break;
+        case REG_TOUCH: {
+            bool batched = features.load(std::memory_order_relaxed) & FP_FEATURE_BATCH;
+            int size = batched ? batch.load(std::memory_order_relaxed) : 1;
+            if (redeliver.load(std::memory_order_relaxed)) {
+                redeliver.store(false, std::memory_order_relaxed);
+            } else {
+                inflight_n = 0;
+                while (inflight_n < size && pop_event(&inflight[inflight_n])) inflight_n++;
+                inflight_valid.store(inflight_n > 0, std::memory_order_relaxed);
+            }
+            if (batched) {
+                // Fixed length, so a master never leaves a popped event unread
+                buf[n++] = inflight_n;
+                for (int i = 0; i < size; i++)
+                    n += put_event(buf + n, i < inflight_n ? inflight[i] : fp_event_t{ 0xFF, 0, 0, false });
+            } else {
+                // Empty queue: no button
+                n += put_event(buf + n, inflight_n ? inflight[0] : fp_event_t{ 0xFF, 0, 0, false });
+                buf[n++] = 0;
+            }
+            ready_pending.store(false, std::memory_order_relaxed);
+            break;
+        }
+        default:
+            if (reg >= REG_STATS && reg < REG_STATS + FP_STAT_COUNT) {
+                for (int i = reg - REG_STATS; i < FP_STAT_COUNT; i++, n += 4)
+                    put_u32(buf + n, stats[i].load(std::memory_order_relaxed));
+            } else {
+                buf[n++] = 0;
+            }
+            break;
+    }
+    update_int();
+
+    if (n > max) n = max;
+    memcpy(out, buf, n);
+    return n;
+}
+
+static bool push(fp_event_t ev)
+{
+    uint32_t head = q_head.load(std::memory_order_relaxed);
+    if (head - q_tail.load(std::memory_order_acquire) >= FP_QUEUE_DEPTH)
+        return false;
+    queue[head & (FP_QUEUE_DEPTH - 1)] = ev;
+    q_head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+// Queue the pending repeats unless an earlier repeat event is still unread
+// (`force`: before another event, to keep the order)
+static void flush_repeats(bool force)
+{
+    if (!rep_pending) return;
+    uint32_t tail = q_tail.load(std::memory_order_acquire);
+    if (!force && rep_queued && (int32_t)(tail - rep_pos) <= 0) return;
+    uint32_t pos = q_head.load(std::memory_order_relaxed);
+    uint16_t count = rep_pending > 0xFFFF ? 0xFFFF : rep_pending;
+    if (!push({ rep_button, FP_STATE_REPEAT, count, false })) return;  // full: kept for later
+    fp_stat_inc(FP_STAT_EVENTS);
+    rep_pending -= count;
+    rep_pos = pos;
+    rep_queued = true;
+}
+
+// Queue the held back press (before any other event, to keep the order)
+static bool flush_held()
+{
+    if (!held_valid) return true;
+    held_valid = false;
+    fp_stat_inc(FP_STAT_EVENTS);
+    if (push({ held_button, FP_STATE_PRESS, 0, false })) return true;
+    fp_stat_inc(FP_STAT_DROPPED);
+    return false;
+}
+
+static bool report(fp_event_t ev)
+{
+    flush_held();
+    flush_repeats(true);
+    fp_stat_inc(FP_STAT_EVENTS);
+    if (!push(ev)) {
+        fp_stat_inc(FP_STAT_DROPPED);
+        return false;
+    }
+    update_int();
+    return true;
+}
+
+bool fp_report_button(uint8_t index, uint8_t state)
+{
+    return report({ index, state, 0, false });
+}
+
+bool fp_report_press(uint8_t index, uint32_t now_ms)
+{
+    if (!(features.load(std::memory_order_relaxed) & FP_FEATURE_CLICK) ||
+        !click_window.load(std::memory_order_relaxed))
+        return report({ index, FP_STATE_PRESS, 0, false });
+    flush_held();
+    flush_repeats(true);
+    held_valid = true;
+    held_button = index;
+    held_since = now_ms;
+    return true;
+}
+
+bool fp_report_release(uint8_t index, uint16_t held_ms)
+{
+    // Its press is still held back: both go in now, next to each other
+    if (held_valid && held_button == index) {
+        held_valid = false;
+        fp_stat_inc(FP_STAT_EVENTS);
+        if (!push({ index, FP_STATE_PRESS, 0, false })) {
+            fp_stat_inc(FP_STAT_DROPPED);
+            return false;
+        }
+    }
+    return report({ index, FP_STATE_RELEASE, held_ms, true });
+}
+
+uint32_t fp_click_poll(uint32_t now_ms)
+{
+    if (!held_valid) return UINT32_MAX;
+    uint32_t window = click_window.load(std::memory_order_relaxed);
+    uint32_t age = now_ms - held_since;
+    if (age < window) return window - age;
+    flush_held();
+    update_int();
+    return UINT32_MAX;
+}
+
+void fp_report_repeat(uint8_t index, uint16_t count)
+{
+    // A repeat follows its press; a tick with none due leaves the press in
+    // its click window
+    if (count) flush_held();
+    fp_stat_set(FP_STAT_REPEATS, fp_stat_get(FP_STAT_REPEATS) + count);
+    // Not enabled: the hold reaches the master as its press and release
+    if (!(features.load(std::memory_order_relaxed) & FP_FEATURE_REPEAT)) {
+        rep_pending = 0;
+        update_int();
+        return;
+    }
+    if (rep_pending && index != rep_button) flush_repeats(true);
+    rep_button = index;
+    rep_pending += count;
+    flush_repeats(false);
+    update_int();
+}
+
+void fp_report_encoder(int32_t counts)
+{
+    enc_count.fetch_add(counts, std::memory_order_relaxed);
+    update_int();
+}
+
+void fp_set_page(uint8_t page, uint8_t count, bool by_user)
+{
+    page_shown.store((uint16_t)(page << 8) | count, std::memory_order_relaxed);
+    // INT_PAGE only for a master that enabled it: nothing else clears it
+    if (by_user && (features.load(std::memory_order_relaxed) & FP_FEATURE_PAGES))
+        page_changed.store(true, std::memory_order_relaxed);
+    update_int();
+}
+
+int fp_page_request()
+{
+    return page_req.exchange(-1, std::memory_order_relaxed);
+}
+
+int fp_label_take(char * text)
+{
+    uint64_t dirty = label_dirty.load(std::memory_order_acquire);
+    if (!dirty) return -1;
+    int button = __builtin_ctzll(dirty);
+    // Cleared before the copy: a write that comes after sets it again
+    label_dirty.fetch_and(~(1ull << button), std::memory_order_acq_rel);
+    fp_label_t * l = &labels[button];
+    uint32_t seq;
+    do {
+        seq = l->seq.load(std::memory_order_acquire);
+        memcpy(text, l->text, FP_LABEL_MAX);
+        std::atomic_thread_fence(std::memory_order_acquire);
+    } while ((seq & 1) || l->seq.load(std::memory_order_relaxed) != seq);
+    text[FP_LABEL_MAX - 1] = 0;
+    return button;
+}
+
+void fp_set_ready()
+{
+    ready_pending.store(true, std::memory_order_relaxed);
+    update_int();
+}
+
+void fp_bus_reset()
+{
+    if (!inflight_valid.load(std::memory_order_relaxed)) return;
+    int n = 0;
+    for (int i = 0; i < inflight_n; i++)
+        if (inflight[i].state <= FP_STATE_PRESS) inflight[n++] = inflight[i];
+    inflight_n = n;
+    inflight_valid.store(n > 0, std::memory_order_relaxed);
+    redeliver.store(n > 0, std::memory_order_relaxed);
+    update_int();
+}
+
+uint32_t fp_queue_pushed()
+{
+    return q_head.load(std::memory_order_acquire);
+}
+
+uint32_t fp_queue_taken()
+{
+    return q_tail.load(std::memory_order_acquire);
+}
+
+uint16_t fp_int_pending()
+{
+    return int_mask();
+}
+
+static const char * const stat_names[] = {
+    "words", "uptime_s", "events", "dropped", "polls",
+    "req_max_us", "frame_ms", "free_heap", "loop_overruns",
+    "mem_warn", "heap_min", "boot_ms", "bus_recov", "recov_max_us",
+    "enc_detents", "enc_reads", "repeats", "page_us",
+    "labels", "label_us", "clicks"
+};
+static_assert(sizeof(stat_names) / sizeof(stat_names[0]) == FP_STAT_COUNT, "a name per REG_STATS word");
+
+// Single writer per word: a plain load/store pair, no read-modify-write
+void fp_stat_set(fp_stat_t id, uint32_t value)
+{
+    stats[id].store(value, std::memory_order_relaxed);
+}
+
+void fp_stat_inc(fp_stat_t id)
+{
+    stats[id].store(stats[id].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+void fp_stat_max(fp_stat_t id, uint32_t value)
+{
+    if (value > stats[id].load(std::memory_order_relaxed))
+        stats[id].store(value, std::memory_order_relaxed);
+}
+
+uint32_t fp_stat_get(fp_stat_t id)
+{
+    return stats[id].load(std::memory_order_relaxed);
+}
+
+const char * fp_stat_name(fp_stat_t id)
+{
+    return id < FP_STAT_COUNT ? stat_names[id] : "?";
+}
@@ -0,0 +1,228 @@
+#ifndef FP_PROTO_H
+#define FP_PROTO_H
+
+#include <stdint.h>
+
+/* Pico front panel protocol (g0orx/pico_frontpanel) register logic, without
+ * any Arduino dependency: main.cpp feeds it the bytes of the Wire1 slave
+ * callbacks, and it can be compiled on a host as it is. */
+
+// Register addresses (same as pico_frontpanel)
+#define REG_CONFIG   0x00  // write 2B (+ extensions, see REG_CAPS); read back 6B
+#define REG_RESET    0x01
+#define REG_INT_MASK 0x02
+#define REG_ENCODER  0x03  // encoder number (1B) + signed count since the last read (1B)
+#define REG_SWITCH   0x04
+#define REG_TOUCH    0x05  // repurposed: button_index (1B) + state (1B) + repeat count (2B) + 1B pad
+#define REG_LED      0x06
+#define REG_PAGE     0x07  // page shown (1B) + page count (1B); write 1B to show a page
+#define REG_LABEL    0x08  // write only: label records, see fp_label_take()
+#define REG_CAPS     0x09  // read only: version (1B) + FP_FEATURE_* (2B LE) + max batch (1B)
+#define REG_STATS    0x10  // read only, REG_STATS + n reads from word n, see fp_stat_t
+
+// Interrupt mask bits
+#define INT_ENC   0x0001  // encoder counts pending (REG_ENCODER)
+#define INT_TS    0x0100  // button event (touch/button slot)
+#define INT_PAGE  0x0200  // the user changed page on the panel (REG_PAGE)
+#define INT_READY 0x8000  // device ready after boot
+
+// REG_TOUCH state byte
+#define FP_STATE_RELEASE 0
+#define FP_STATE_PRESS   1
+#define FP_STATE_REPEAT  2   // held button repeated `count` times (bytes 2-3, LE)
+#define FP_STATE_CLICK   3   // press and release in one event, held `count` ms
+
+// REG_CAPS: protocol version and extensions. The opt-in features are off
+// until a master enables them by writing REG_CONFIG with more bytes after
+// the pico_frontpanel two:
+//   [2-3] FP_FEATURE_* to enable (LE)
+//   [4]   click window, 10 ms units (0 = none)
+//   [5]   events per batched REG_TOUCH read, 1..FP_BATCH_MAX
+// The 2-byte write of a stock pico_frontpanel master turns them all off, and
+// without them a stock master sees only what pico_frontpanel sends: REG_TOUCH
+// states 0 and 1 (a held button is its press and its release), INT_ENC,
+// INT_TS and INT_READY. The other bits only tell the master what the slave
+// has; they are always on, in registers a stock master never reads. A
+// REG_CONFIG read returns those 6 bytes as the slave applied them. Version 2
+// slaves sent repeats and INT_PAGE unasked; version 3 makes them opt-in.
+#define FP_PROTO_VERSION 3
+#define FP_FEATURE_CLICK   0x0001  // opt-in: FP_STATE_CLICK events
+#define FP_FEATURE_BATCH   0x0002  // opt-in: several events per REG_TOUCH read
+#define FP_FEATURE_REPEAT  0x0100  // opt-in: FP_STATE_REPEAT events
+#define FP_FEATURE_ENCODER 0x0200  // REG_ENCODER counts (virtual encoder)
+#define FP_FEATURE_PAGES   0x0400  // REG_PAGE; opt-in: INT_PAGE
+#define FP_FEATURE_LABELS  0x0800  // REG_LABEL
+#define FP_FEATURE_STATS   0x1000  // REG_STATS
+#define FP_FEATURES_OPTIN  (FP_FEATURE_CLICK | FP_FEATURE_BATCH | FP_FEATURE_REPEAT | FP_FEATURE_PAGES)
+#define FP_FEATURES        (FP_FEATURES_OPTIN | FP_FEATURE_ENCODER | FP_FEATURE_LABELS | \
+                            FP_FEATURE_STATS)
+
+// FP_FEATURE_BATCH: a REG_TOUCH read is [n] then `batch` records of
+// [button, state, count LE 2B], the first n of them events (n = 0: queue
+// empty), always 1 + 4 * batch bytes
+#ifndef FP_BATCH_MAX
+#define FP_BATCH_MAX 8
+#endif
+#define FP_BATCH_RECORD 4
+
+// Button events waiting for the master; a full queue drops the new event
+#ifndef FP_QUEUE_DEPTH
+#define FP_QUEUE_DEPTH 16  // power of 2
+#endif
+
+// REG_LABEL: one label per button, up to FP_LABEL_MAX - 1 characters
+#ifndef FP_LABEL_MAX
+#define FP_LABEL_MAX 12
+#endif
+#define FP_LABEL_BUTTONS 64
+// Longest master write taken from the slave callback (Wire1 buffers 128)
+#ifndef FP_RX_MAX
+#define FP_RX_MAX 128
+#endif
+
+// T41 encoder the virtual encoder (venc.cpp) stands for, REG_ENCODER byte 0
+#ifndef FP_ENCODER_ID
+#define FP_ENCODER_ID 1
+#endif
+
+// REG_STATS block: FP_STAT_COUNT little-endian uint32 words. Each word is
+// written by one task only, so a master read never sees a torn value (the
+// block as a whole is not a snapshot).
+typedef enum {
+    FP_STAT_LAYOUT = 0,      // FP_STAT_COUNT, grows when words are appended
+    FP_STAT_UPTIME_S,        // set by the loop: stops if the UI loop hangs
+    FP_STAT_EVENTS,          // button events generated
+    FP_STAT_DROPPED,         // events lost to a full queue
+    FP_STAT_POLLS,           // REG_INT_MASK reads served
+    FP_STAT_REQUEST_MAX_US,  // longest onRequest callback
+    FP_STAT_FRAME_MS,        // last LVGL refresh (render + flush)
+    FP_STAT_FREE_HEAP,       // bytes
+    FP_STAT_LOOP_OVERRUNS,   // lv_timer_handler() passes over the loop budget
+    FP_STAT_MEM_WARN,        // MEMMON_WARN_* bits, see memmon.h
+    FP_STAT_HEAP_MIN,        // internal heap low-water mark, bytes
+    FP_STAT_BOOT_MS,         // app start -> INT_READY; 0 while not ready
+    FP_STAT_BUS_RECOVERIES,  // I2C bus recoveries: touch bus low 16 bits, slave bus high 16
+    FP_STAT_BUS_RECOVERY_US, // longest bus recovery
+    FP_STAT_ENC_DETENTS,     // encoder detents delivered (absolute)
+    FP_STAT_ENC_READS,       // REG_ENCODER reads that carried counts
+    FP_STAT_REPEATS,         // auto-repeats generated (events carry several)
+    FP_STAT_PAGE_US,         // last page switch: request -> frame on the panel
+    FP_STAT_LABELS,          // label records received in REG_LABEL writes
+    FP_STAT_LABEL_US,        // last label write -> frame on the panel
+    FP_STAT_CLICKS,          // press/release pairs sent as one FP_STATE_CLICK
+    FP_STAT_COUNT
+} fp_stat_t;
+
+// Drives the INT line: called with the electrical level (polarity applied)
+typedef void (*fp_int_cb_t)(bool high);
+
+void fp_init(fp_int_cb_t set_int);
+
+// Master write (register byte + data), from the slave receive callback
+void fp_receive(const uint8_t * data, int len);
+
+// Master read of the selected register: fills `out` (FP_TX_MAX bytes at most),
+// returns the byte count
+int fp_request(uint8_t * out, int max);
+
+// Longest reply of fp_request(): the REG_STATS block or a full batch
+#define FP_TX_MAX (FP_STAT_COUNT * 4 > 1 + FP_BATCH_MAX * FP_BATCH_RECORD ? \
+                   FP_STAT_COUNT * 4 : 1 + FP_BATCH_MAX * FP_BATCH_RECORD)
+
+// The same write and read without the I2C transaction around them (register
+// selection, the last REG_TOUCH read kept for redelivery): for the serial
+// link, which carries events in its own frames (fp_take_events())
+void fp_write(const uint8_t * data, int len);
+int fp_read(uint8_t reg, uint8_t * out, int max);
+
+// Pop up to `max` events as FP_BATCH_RECORD-byte records [button, state,
+// count LE], clicks merged as for REG_TOUCH. The queue has one consumer: the
+// serial link calls this only while the I2C callbacks leave REG_TOUCH alone.
+int fp_take_events(uint8_t * out, int max);
+
+// Give back events fp_take_events() returned that may not have reached the
+// host (the link was switched off or the host went away): the next events
+// taken, by either consumer, start with them. As after fp_bus_reset(), only
+// presses and releases come back, clicks and repeats are gone. Consumer
+// only; up to FP_QUEUE_DEPTH events.
+void fp_return_events(const uint8_t * recs, int n);
+
+// Register selected by the last master write
+uint8_t fp_selected_register();
+
+// Queue a button event and assert INT. Call from the UI task only (single
+// producer; the I2C callbacks are the single consumer). False if dropped.
+bool fp_report_button(uint8_t index, uint8_t state);
+
+// Press of a momentary button at `now_ms`. With FP_FEATURE_CLICK and a
+// click window, the press is held back for the window: released within it,
+// it goes out as one FP_STATE_CLICK event; held longer (a hold), it is
+// queued when the window ends and the release follows separately. UI task
+// only. False if dropped.
+bool fp_report_press(uint8_t index, uint32_t now_ms);
+
+// Release of a momentary button pressed `held_ms` before. With
+// FP_FEATURE_CLICK, a release still queued right behind its press when the
+// master reads REG_TOUCH goes out with it as one FP_STATE_CLICK event; a
+// press the master has already read keeps its separate release. UI task only.
+bool fp_report_release(uint8_t index, uint16_t held_ms);
+
+// From the loop: queues a press held back longer than the click window.
+// Returns the ms until it is due (UINT32_MAX: none held back). UI task.
+uint32_t fp_click_poll(uint32_t now_ms);
+
+// `count` more auto-repeats of a held button (0: only retry queueing the
+// pending ones). They are coalesced: one FP_STATE_REPEAT event waits in the
+// queue at a time, and the repeats made while it waits go in the next one.
+// A full queue loses nothing, the repeats wait. UI task only.
+void fp_report_repeat(uint8_t index, uint16_t count);
+
+// Add signed encoder counts and assert INT_ENC. UI task only. A REG_ENCODER
+// read takes up to +-127 of the sum; the rest waits for the next read.
+void fp_report_encoder(int32_t counts);
+
+// Page shown and the number of pages, for REG_PAGE reads. `by_user`: the
+// panel changed it, raise INT_PAGE (cleared by the next REG_PAGE read).
+// UI task only.
+void fp_set_page(uint8_t page, uint8_t count, bool by_user);
+
+// Page selected by a REG_PAGE write since the last call, or -1. UI task.
+int fp_page_request();
+
+// Next button whose label a REG_LABEL write changed, or -1. Its text is
+// copied to `text` (FP_LABEL_MAX bytes, NUL terminated; "" = back to the
+// built-in label). A button written twice before the call gives the last
+// text once. UI task only.
+//
+// A REG_LABEL write is any number of records [button, length, text...]
+// (no NUL); a longer text is cut to FP_LABEL_MAX - 1 characters.
+int fp_label_take(char * text);
+
+// The UI takes input: raise INT_READY (cleared by the next REG_INT_MASK read)
+void fp_set_ready();
+
+// The slave bus was recovered. An event popped by a REG_TOUCH read that no
+// later transaction confirmed may never have reached the master: the next
+// REG_TOUCH read sends it again if it is a press or a release. A click or a
+// repeat is not sent again, as the master acts on every copy. Call with the
+// Wire1 callbacks stopped.
+void fp_bus_reset();
+
+// Queue positions, free running: events pushed so far, and events taken by
+// REG_TOUCH reads or the serial link (a click takes two). Any task.
+uint32_t fp_queue_pushed();
+uint32_t fp_queue_taken();
+
+// The INT_* bits a REG_INT_MASK read would return now, without clearing any
+uint16_t fp_int_pending();
+
+// Statistics words, lock-free (one writer per word)
+void fp_stat_set(fp_stat_t id, uint32_t value);
+void fp_stat_inc(fp_stat_t id);
+void fp_stat_max(fp_stat_t id, uint32_t value);
+uint32_t fp_stat_get(fp_stat_t id);
+
+// Short name of a word ("events", "dropped"...), as the test master prints it
+const char * fp_stat_name(fp_stat_t id);
+
+#endif
@@ -0,0 +1,198 @@
+/*******************************************************************************
+ * I2C bus recovery for Wire (GT911) and Wire1 (front panel slave)
+ *
+ * Every I2C_RECOVER_POLL_MS an LVGL timer samples SDA and SCL of both buses.
+ * It runs in the loop task, which also does the touch reads, so the touch
+ * bus is always between transfers when sampled. The slave bus is driven by
+ * the master at any time: a sample only counts while no transaction reached
+ * the slave since the previous one. The touch reads are also checked for
+ * impossible data (more than 5 points, coordinates past the panel).
+ *
+ * Recovery, without a reboot:
+ * - touch bus: Wire.end(), bus clear on the pins, touch_init() (Wire.begin()
+ *   and the GT911 reset and configuration);
+ * - slave bus: Wire1.end(), bus clear if a line is still low once our slave
+ *   let go, fp_bus_reset() so a press or release that may have been cut off
+ *   is sent again, Wire1 started again. The slave should never need to
+ *   clock the master's bus; the pulses are for a third device holding SDA.
+ *   Wire1.begin() corrupts Wire on core 3.3.6, so the touch bus is
+ *   restarted after it.
+ *
+ * The button event queue lives in fp_proto.cpp and is untouched by either.
+ * Counts and the longest recovery go to REG_STATS, details to "bus".
+ ******************************************************************************/
+#include <Arduino.h>
+#include <Wire.h>
+#include <lvgl.h>
+
+#include "i2c_recover.h"
+#include "bus_guard.h"
+#include "touch.h"
+#include "fp_proto.h"
+#include "console.h"
+
+typedef struct {
+    int sda;
+    int scl;
+} gpio_pair_t;
+
+static bool pin_sda(void * ctx) { return digitalRead(((gpio_pair_t *)ctx)->sda); }
+static bool pin_scl(void * ctx) { return digitalRead(((gpio_pair_t *)ctx)->scl); }
+static void pull_sda(void * ctx, bool low) { digitalWrite(((gpio_pair_t *)ctx)->sda, low ? LOW : HIGH); }
+static void pull_scl(void * ctx, bool low) { digitalWrite(((gpio_pair_t *)ctx)->scl, low ? LOW : HIGH); }
+static void wait_us(void * ctx, uint32_t us) { delayMicroseconds(us); }
+
+static gpio_pair_t touch_gpio, slave_gpio;
+static bus_pins_t touch_pins = { pin_sda, pin_scl, pull_sda, pull_scl, wait_us, &touch_gpio };
+static bus_pins_t slave_pins = { pin_sda, pin_scl, pull_sda, pull_scl, wait_us, &slave_gpio };
+
+static bus_guard_t touch_guard, slave_guard;
+static i2c_slave_begin_fn_t slave_begin = NULL;
+static lv_timer_t * timer = NULL;
+static bool touch_pending = false;               // impossible reads: recover at the next tick
+static volatile uint32_t slave_activity = 0;     // receive callbacks
+static uint32_t slave_activity_seen = 0;
+
+static const char * clear_name(bus_clear_t r)
+{
+    switch (r) {
+        case BUS_CLEAR_OK:      return "free";
+        case BUS_CLEAR_SCL_LOW: return "SCL held low";
+        default:                return "SDA held low";
+    }
+}
+
+// Detached pins as open drain with pull-up, released
+static void pins_to_gpio(const gpio_pair_t * g)
+{
+    pinMode(g->sda, OUTPUT_OPEN_DRAIN | PULLUP);
+    pinMode(g->scl, OUTPUT_OPEN_DRAIN | PULLUP);
+    digitalWrite(g->sda, HIGH);
+    digitalWrite(g->scl, HIGH);
+}
+
+static void publish()
+{
+    fp_stat_set(FP_STAT_BUS_RECOVERIES, (touch_guard.recoveries & 0xFFFF) | (slave_guard.recoveries << 16));
+    uint32_t max_us = touch_guard.max_us > slave_guard.max_us ? touch_guard.max_us : slave_guard.max_us;
+    fp_stat_set(FP_STAT_BUS_RECOVERY_US, max_us);
+}
+
+static void recover_touch(const char * why)
+{
+    uint32_t t0 = micros();
+    touch_bus_end();
+    pins_to_gpio(&touch_gpio);
+    int pulses = 0;
+    bus_clear_t r = bus_clear(&touch_pins, &pulses);
+    touch_init();
+    uint32_t us = micros() - t0;
+    bus_guard_recovered(&touch_guard, r == BUS_CLEAR_OK, pulses, us, millis());
+    touch_pending = false;
+    publish();
+    Serial.printf("I2C touch bus: %s, recovered in %u us (%d pulses, %s)\n",
+                  why, (unsigned)us, pulses, clear_name(r));
+}
+
+static void recover_slave(const char * why)
+{
+    uint32_t t0 = micros();
+    Wire1.end();
+    pins_to_gpio(&slave_gpio);
+    int pulses = 0;
+    bus_clear_t r = BUS_CLEAR_OK;
+    delayMicroseconds(BUS_GUARD_HALF_US);
+    if (!pin_sda(&slave_gpio) || !pin_scl(&slave_gpio))
+        r = bus_clear(&slave_pins, &pulses);
+    fp_bus_reset();   // before the callbacks can run again
+    slave_begin();
+    uint32_t us = micros() - t0;
+    bus_guard_recovered(&slave_guard, r == BUS_CLEAR_OK, pulses, us, millis());
+    publish();
+    Serial.printf("I2C slave bus: %s, recovered in %u us (%d pulses, %s)\n",
+                  why, (unsigned)us, pulses, clear_name(r));
+    // Wire1.begin() leaves Wire reading 0xFF (see docs/done_changes.md)
+    if (touch_gpio.sda >= 0) recover_touch("restart after slave bus");
+}
+
+static void recover_timer_cb(lv_timer_t * t)
+{
+    uint32_t now = millis();
+
+    if (touch_pending) {
+        recover_touch("impossible touch data");
+    } else if (touch_gpio.sda >= 0 &&
+               bus_guard_sample(&touch_guard, pin_sda(&touch_gpio), pin_scl(&touch_gpio), now)) {
+        recover_touch("line stuck low");
+    }
+
+    // Any transaction since the last tick means the slave bus is moving
+    uint32_t activity = slave_activity;
+    bool idle = activity == slave_activity_seen;
+    slave_activity_seen = activity;
+    bool sda = pin_sda(&slave_gpio), scl = pin_scl(&slave_gpio);
+    if (bus_guard_sample(&slave_guard, sda || !idle, scl || !idle, now))
+        recover_slave("line stuck low");
+}
+
+void i2c_recover_touch_read(bool sane)
+{
+    if (bus_guard_transfer(&touch_guard, sane, millis()) && !touch_pending) {
+        touch_pending = true;
+        if (timer) lv_timer_ready(timer);
+    }
+}
+
+void i2c_recover_slave_activity()
+{
+    slave_activity = slave_activity + 1;
+}
+
+static void print_guard(const bus_guard_t * g)
+{
+    Serial.printf("  %-6s %lu recovered, %lu failed, %lu stuck, %lu bad reads, %lu pulses; last %lu us, max %lu us\n",
+                  g->name, (unsigned long)g->recoveries, (unsigned long)g->failed,
+                  (unsigned long)g->stuck_detected, (unsigned long)g->bad_transfers, (unsigned long)g->pulses,
+                  (unsigned long)g->last_us, (unsigned long)g->max_us);
+}
+
+static void bus_cmd(const char * args)
+{
+#ifdef I2C_FAULT_INJECT
+    // Hold SDA low with the driver stopped, as a device cut off mid-byte would
+    if (strcmp(args, "inject touch") == 0 || strcmp(args, "inject slave") == 0) {
+        bool touch = args[7] == 't';
+        const gpio_pair_t * g = touch ? &touch_gpio : &slave_gpio;
+        if (touch) touch_bus_end(); else Wire1.end();
+        pins_to_gpio(g);
+        digitalWrite(g->sda, LOW);
+        Serial.printf("I2C %s bus: SDA held low\n", touch ? "touch" : "slave");
+        return;
+    }
+    // Start Wire1 again after Wire: the core 3.3.6 bug that left every GT911 read 0xFF
+    if (strcmp(args, "inject ff") == 0) {
+        Wire1.end();
+        slave_begin();
+        Serial.println("I2C slave restarted after Wire");
+        return;
+    }
+#endif
+    Serial.println("I2C buses:");
+    print_guard(&touch_guard);
+    print_guard(&slave_guard);
+}
+
+void i2c_recover_init(int slave_sda, int slave_scl, i2c_slave_begin_fn_t begin)
+{
+    touch_gpio = { touch_i2c_sda, touch_i2c_scl };
+    slave_gpio = { slave_sda, slave_scl };
+    slave_begin = begin;
+    bus_guard_init(&touch_guard, "touch");
+    bus_guard_init(&slave_guard, "slave");
+    timer = lv_timer_create(recover_timer_cb, I2C_RECOVER_POLL_MS, NULL);
+#ifdef I2C_FAULT_INJECT
+    console_add("bus", bus_cmd, "I2C bus recoveries; 'bus inject touch|slave|ff' makes a fault");
+#else
+    console_add("bus", bus_cmd, "I2C bus recoveries");
+#endif
+}
@@ -0,0 +1,27 @@
+#ifndef I2C_RECOVER_H
+#define I2C_RECOVER_H
+
+#include <stdint.h>
+
+// Watchdog for the two I2C buses: Wire (GT911 touch, master) and Wire1
+// (front panel slave). See bus_guard.cpp for what counts as a fault.
+
+// Period of the idle line sampling
+#ifndef I2C_RECOVER_POLL_MS
+#define I2C_RECOVER_POLL_MS 100
+#endif
+
+// Restarts the Wire1 slave (Wire1.begin() and its callbacks)
+typedef void (*i2c_slave_begin_fn_t)();
+
+// Call after the display driver, touch and slave are up (starts the timer
+// and the "bus" console command)
+void i2c_recover_init(int slave_sda, int slave_scl, i2c_slave_begin_fn_t slave_begin);
+
+// From touch_touched() after each GT911 read: false for impossible data
+void i2c_recover_touch_read(bool sane);
+
+// From the Wire1 receive callback: a transaction reached the slave
+void i2c_recover_slave_activity();
+
+#endif
@@ -0,0 +1,141 @@
+/*******************************************************************************
+ * Button image encoding benchmark (build flag IMG_BENCH)
+ *
+ * Builds the 6x3 grid once per encoding of the button art and times full
+ * screen renders. Flushing is replaced by a no-op while timing so the numbers
+ * are LVGL decode + blend time only, not SPI transfer time.
+ *
+ * The text_* rows draw the default art plus the 18 labels, once per label
+ * mode (see LABEL_MODE in main.cpp). text_* minus rgb565a8 is the label cost;
+ * divide by 18 for the per-button repaint cost.
+ *
+ * CSV columns:
+ *   name, cf, flash_bytes, decode_ram_bytes, first_draw_us, avg_draw_us
+ ******************************************************************************/
+#include <Arduino.h>
+#include <lvgl.h>
+
+#include "img_bench.h"
+
+#ifdef IMG_BENCH
+
+#include "img_rle.h"
+#include "button_4_106x40.h"
+#include "button_4_106x40_variants.h"
+#if LABEL_MODE != 0
+#include "baked_labels.h"
+#endif
+
+#define IMG_BENCH_REPEAT 20
+#define IMG_BENCH_COLS   3
+#define IMG_BENCH_ROWS   6
+
+enum {
+    TEXT_NONE,
+    TEXT_DEFAULT,   // lv_label, LV_FONT_DEFAULT
+    TEXT_SUBSET,    // lv_label, label_font
+    TEXT_BAKED,     // A8 bitmaps
+};
+
+typedef struct {
+    const char * name;
+    const lv_img_dsc_t * img;
+    int text;
+} img_bench_variant_t;
+
+static const img_bench_variant_t variants[] = {
+    { "rgb565a8",     &button_4_106x40,     TEXT_NONE },
+    { "indexed4",     &button_4_106x40_i4,  TEXT_NONE },
+    { "indexed8",     &button_4_106x40_i8,  TEXT_NONE },
+    { "chroma",       &button_4_106x40_ck,  TEXT_NONE },
+    { "rle",          &button_4_106x40_rle, TEXT_NONE },
+    { "text_default", &button_4_106x40,     TEXT_DEFAULT },
+#if LABEL_MODE != 0
+    { "text_subset",  &button_4_106x40,     TEXT_SUBSET },
+    { "text_baked",   &button_4_106x40,     TEXT_BAKED },
+#endif
+};
+
+static void bench_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p)
+{
+    lv_disp_flush_ready(disp);
+}
+
+static void build_grid(lv_obj_t * scr, const lv_img_dsc_t * img, int text, const char * const * labels)
+{
+    lv_coord_t w = 240 / IMG_BENCH_COLS;
+    lv_coord_t h = 320 / IMG_BENCH_ROWS;
+    for (int i = 0; i < IMG_BENCH_COLS * IMG_BENCH_ROWS; i++) {
+        lv_obj_t * bg = lv_obj_create(scr);
+        lv_obj_set_pos(bg, (i % IMG_BENCH_COLS) * w, (i / IMG_BENCH_COLS) * h);
+        lv_obj_set_size(bg, w, h);
+        lv_obj_set_style_bg_color(bg, lv_color_hex(0xFFE8D0), 0);
+        lv_obj_set_style_radius(bg, 0, 0);
+        lv_obj_set_style_pad_all(bg, 0, 0);
+        lv_obj_clear_flag(bg, LV_OBJ_FLAG_SCROLLABLE);
+
+        lv_obj_t * img_obj = lv_img_create(bg);
+        lv_img_set_src(img_obj, img);
+        lv_obj_center(img_obj);
+
+        if (text == TEXT_DEFAULT || text == TEXT_SUBSET) {
+            lv_obj_t * label = lv_label_create(img_obj);
+            lv_label_set_text(label, labels[i]);
+#if LABEL_MODE != 0
+            if (text == TEXT_SUBSET) lv_obj_set_style_text_font(label, &label_font, 0);
+#endif
+            lv_obj_set_style_text_color(label, lv_color_hex(0x000000), 0);
+            lv_obj_center(label);
+        }
+#if LABEL_MODE != 0
+        else if (text == TEXT_BAKED) {
+            lv_obj_t * label = lv_img_create(img_obj);
+            lv_img_set_src(label, &baked_labels[i]);
+            lv_obj_set_style_img_recolor(label, lv_color_hex(0x000000), 0);
+            lv_obj_set_style_img_recolor_opa(label, LV_OPA_COVER, 0);
+            lv_obj_center(label);
+        }
+#endif
+    }
+}
+
+void img_bench_run(const char * const * labels)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    void (*flush_cb)(lv_disp_drv_t *, const lv_area_t *, lv_color_t *) = disp->driver->flush_cb;
+    lv_obj_t * prev = lv_scr_act();
+
+    Serial.println("name,cf,flash_bytes,decode_ram_bytes,first_draw_us,avg_draw_us");
+    for (size_t v = 0; v < sizeof(variants) / sizeof(variants[0]); v++) {
+        const lv_img_dsc_t * img = variants[v].img;
+        lv_obj_t * scr = lv_obj_create(NULL);
+        build_grid(scr, img, variants[v].text, labels);
+        lv_scr_load(scr);
+
+        disp->driver->flush_cb = bench_flush;
+        img_rle_ram_peak = 0;
+        lv_img_cache_invalidate_src(img);
+
+        uint32_t t0 = micros();
+        lv_refr_now(disp);
+        uint32_t first_us = micros() - t0;
+
+        uint32_t total_us = 0;
+        for (int r = 0; r < IMG_BENCH_REPEAT; r++) {
+            lv_obj_invalidate(scr);
+            t0 = micros();
+            lv_refr_now(disp);
+            total_us += micros() - t0;
+        }
+        disp->driver->flush_cb = flush_cb;
+
+        Serial.printf("%s,%u,%u,%u,%u,%u\n", variants[v].name, (unsigned)img->header.cf,
+                      (unsigned)img->data_size, (unsigned)img_rle_ram_peak,
+                      (unsigned)first_us, (unsigned)(total_us / IMG_BENCH_REPEAT));
+
+        lv_scr_load(prev);
+        lv_obj_del(scr);
+    }
+}
+
+#endif /* IMG_BENCH */
@@ -0,0 +1,9 @@
+#ifndef IMG_BENCH_H
+#define IMG_BENCH_H
+
+// Build with -DIMG_BENCH to time every button image encoding and label
+// rendering mode at boot. Prints one CSV line per case on Serial, then the
+// normal UI starts. labels: the 18 button label strings.
+void img_bench_run(const char * const * labels);
+
+#endif
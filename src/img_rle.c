@@ -0,0 +1,84 @@
+/*******************************************************************************
+ * LVGL image decoder for IMG_RLE_CF images.
+ *
+ * Stream of packets, each starting with a header byte:
+ *   bit 7 set:   run of ((h & 0x7F) + 1) copies of the following 3-byte pixel
+ *   bit 7 clear: ((h & 0x7F) + 1) literal 3-byte pixels follow
+ * A pixel is RGB565 (2 bytes, same order as lv_color_t) + alpha (1 byte), i.e.
+ * exactly the LV_IMG_CF_TRUE_COLOR_ALPHA layout, so the image is expanded once
+ * on open and LVGL blends it like any other true colour + alpha image.
+ ******************************************************************************/
+#include <lvgl.h>
+#include <string.h>
+#include "img_rle.h"
+
+uint32_t img_rle_ram_bytes = 0;
+uint32_t img_rle_ram_peak  = 0;
+
+static lv_res_t rle_info(lv_img_decoder_t * decoder, const void * src, lv_img_header_t * header)
+{
+    LV_UNUSED(decoder);
+    if (lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE) return LV_RES_INV;
+
+    const lv_img_dsc_t * img = (const lv_img_dsc_t *)src;
+    if (img->header.cf != IMG_RLE_CF) return LV_RES_INV;
+
+    *header = img->header;
+    header->cf = LV_IMG_CF_RAW_ALPHA;  /* drawn as TRUE_COLOR_ALPHA once decoded */
+    return LV_RES_OK;
+}
+
+static lv_res_t rle_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(decoder);
+    const lv_img_dsc_t * img = (const lv_img_dsc_t *)dsc->src;
+    uint32_t out_size = (uint32_t)img->header.w * img->header.h * LV_IMG_PX_SIZE_ALPHA_BYTE;
+
+    uint8_t * out = (uint8_t *)lv_mem_alloc(out_size);
+    if (out == NULL) return LV_RES_INV;
+
+    const uint8_t * in  = img->data;
+    const uint8_t * end = img->data + img->data_size;
+    uint32_t pos = 0;
+    while (in < end && pos < out_size) {
+        uint8_t  h = *in++;
+        uint32_t n = (uint32_t)(h & 0x7F) + 1;
+        if (pos + n * LV_IMG_PX_SIZE_ALPHA_BYTE > out_size) break;
+        /* A packet cut short by the end of the data ends the stream */
+        if ((uint32_t)(end - in) < ((h & 0x80) ? 1 : n) * LV_IMG_PX_SIZE_ALPHA_BYTE) break;
+        if (h & 0x80) {
+            for (uint32_t i = 0; i < n; i++, pos += LV_IMG_PX_SIZE_ALPHA_BYTE)
+                memcpy(out + pos, in, LV_IMG_PX_SIZE_ALPHA_BYTE);
+            in += LV_IMG_PX_SIZE_ALPHA_BYTE;
+        } else {
+            memcpy(out + pos, in, n * LV_IMG_PX_SIZE_ALPHA_BYTE);
+            in  += n * LV_IMG_PX_SIZE_ALPHA_BYTE;
+            pos += n * LV_IMG_PX_SIZE_ALPHA_BYTE;
+        }
+    }
+    if (pos < out_size) memset(out + pos, 0, out_size - pos);  /* truncated stream: transparent */
+
+    img_rle_ram_bytes += out_size;
+    if (img_rle_ram_bytes > img_rle_ram_peak) img_rle_ram_peak = img_rle_ram_bytes;
+
+    dsc->img_data = out;
+    return LV_RES_OK;
+}
+
+static void rle_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(decoder);
+    if (dsc->img_data == NULL) return;
+    const lv_img_dsc_t * img = (const lv_img_dsc_t *)dsc->src;
+    img_rle_ram_bytes -= (uint32_t)img->header.w * img->header.h * LV_IMG_PX_SIZE_ALPHA_BYTE;
+    lv_mem_free((void *)dsc->img_data);
+    dsc->img_data = NULL;
+}
+
+void img_rle_init(void)
+{
+    lv_img_decoder_t * dec = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(dec, rle_info);
+    lv_img_decoder_set_open_cb(dec, rle_open);
+    lv_img_decoder_set_close_cb(dec, rle_close);
+}
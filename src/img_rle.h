@@ -0,0 +1,24 @@
+#ifndef IMG_RLE_H
+#define IMG_RLE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <lvgl.h>
+
+/* Colour format tag of RLE-compressed RGB565+A8 images (tools/encode_button.py) */
+#define IMG_RLE_CF LV_IMG_CF_USER_ENCODED_0
+
+/* Register the RLE decoder with LVGL; call once after lv_init() */
+void img_rle_init(void);
+
+/* Bytes of LVGL heap currently / at most held by decoded RLE images */
+extern uint32_t img_rle_ram_bytes;
+extern uint32_t img_rle_ram_peak;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IMG_RLE_H */
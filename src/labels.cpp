@@ -0,0 +1,146 @@
+/*******************************************************************************
+ * Master-driven button labels
+ *
+ * A REG_LABEL write carries one or more [button, length, text] records. The
+ * slave callback leaves them in fp_proto's per-button slots; the loop takes
+ * each changed one, copies it into the button's fixed text buffer and calls
+ * the show callback, which re-points the lv_label at that buffer. LVGL then
+ * invalidates the label's old and new area only, inside its cell, and the
+ * refresh timer is made ready so the repaint does not wait for its period.
+ * Memory is fixed: LABELS_MAX_BUTTONS x FP_LABEL_MAX bytes here and the same
+ * in fp_proto, nothing allocated per update.
+ *
+ * Each batch is timed from the slave callback to the end of the refresh that
+ * shows it (REG_STATS label_us). The apply time, that refresh and the loop
+ * overruns while it ran are kept for the last batch, which is what a touch
+ * read waits behind; the "labels" console command prints them.
+ ******************************************************************************/
+#include <Arduino.h>
+#include <atomic>
+#include <lvgl.h>
+
+#include "labels.h"
+#include "fp_proto.h"
+#include "console.h"
+
+static char text[LABELS_MAX_BUTTONS][FP_LABEL_MAX];
+static bool custom[LABELS_MAX_BUTTONS];
+static int count = 0;
+static const char * (*builtin_cb)(int);
+static labels_show_cb_t show_cb;
+
+static std::atomic<uint32_t> rx_us(0);      // set by the slave callback
+
+typedef struct {
+    uint32_t updates;          // labels applied
+    uint32_t batches;
+    uint32_t ignored;          // records for buttons that do not exist
+    uint32_t last_n;           // labels in the last batch
+    uint32_t last_apply_us;    // labels_poll() for the last batch
+    uint32_t max_apply_us;
+    uint32_t last_frame_ms;    // the refresh that showed it
+    uint32_t last_overruns;    // loop overruns during that loop pass
+    uint32_t last_us, max_us;  // write received -> frame done
+} labels_stats_t;
+
+static labels_stats_t stats;
+
+// Batch applied: 1 = waiting for its refresh, 2 = refreshed, loop pass ending
+static int batch_state = 0;
+static uint32_t batch_rx_us;
+static uint32_t batch_overruns;
+
+static void set_text(int button, const char * s)
+{
+    strncpy(text[button], s, FP_LABEL_MAX - 1);
+    text[button][FP_LABEL_MAX - 1] = 0;
+}
+
+static void labels_cmd(const char * args)
+{
+    Serial.printf("Labels: %lu applied in %lu batches, %lu for no button\n",
+                  (unsigned long)stats.updates, (unsigned long)stats.batches,
+                  (unsigned long)stats.ignored);
+    Serial.printf("  last batch: %lu labels, applied in %lu us (max %lu), frame %lu ms, "
+                  "loop overruns %lu\n",
+                  (unsigned long)stats.last_n, (unsigned long)stats.last_apply_us,
+                  (unsigned long)stats.max_apply_us, (unsigned long)stats.last_frame_ms,
+                  (unsigned long)stats.last_overruns);
+    Serial.printf("  write -> pixels: last %lu us, max %lu us\n",
+                  (unsigned long)stats.last_us, (unsigned long)stats.max_us);
+    for (int i = 0; i < count; i++)
+        if (custom[i]) Serial.printf("  %2d \"%s\"\n", i, text[i]);
+}
+
+void labels_init(int n, const char * (*builtin)(int), labels_show_cb_t show)
+{
+    count = n > LABELS_MAX_BUTTONS ? LABELS_MAX_BUTTONS : n;
+    builtin_cb = builtin;
+    show_cb = show;
+    for (int i = 0; i < count; i++)
+        set_text(i, builtin(i));
+    console_add("labels", labels_cmd, "labels set by the master, update timings");
+}
+
+const char * labels_text(int button)
+{
+    return text[button];
+}
+
+bool labels_custom(int button)
+{
+    return custom[button];
+}
+
+void labels_received()
+{
+    rx_us.store(micros(), std::memory_order_relaxed);
+}
+
+void labels_poll()
+{
+    if (batch_state == 2) {
+        stats.last_overruns = fp_stat_get(FP_STAT_LOOP_OVERRUNS) - batch_overruns;
+        batch_state = 0;
+    }
+
+    char buf[FP_LABEL_MAX];
+    int button = fp_label_take(buf);
+    if (button < 0) return;
+
+    uint32_t t0 = micros();
+    uint32_t n = 0;
+    for (; button >= 0; button = fp_label_take(buf)) {
+        if (button >= count) {
+            stats.ignored++;
+            continue;
+        }
+        custom[button] = buf[0] != 0;
+        set_text(button, custom[button] ? buf : builtin_cb(button));
+        show_cb(button);
+        n++;
+    }
+    if (!n) return;
+
+    uint32_t us = micros() - t0;
+    stats.updates += n;
+    stats.batches++;
+    stats.last_n = n;
+    stats.last_apply_us = us;
+    if (us > stats.max_apply_us) stats.max_apply_us = us;
+    batch_state = 1;
+    batch_rx_us = rx_us.load(std::memory_order_relaxed);
+    batch_overruns = fp_stat_get(FP_STAT_LOOP_OVERRUNS);
+    lv_timer_ready(_lv_disp_get_refr_timer(lv_disp_get_default()));
+}
+
+void labels_frame()
+{
+    if (batch_state != 1) return;
+    batch_state = 2;
+    uint32_t us = micros() - batch_rx_us;
+    stats.last_us = us;
+    if (us > stats.max_us) stats.max_us = us;
+    stats.last_frame_ms = fp_stat_get(FP_STAT_FRAME_MS);
+    fp_stat_set(FP_STAT_LABEL_US, us);
+}
@@ -0,0 +1,37 @@
+#ifndef LABELS_H
+#define LABELS_H
+
+#include <stdint.h>
+
+// Button labels the master can rewrite through REG_LABEL. Every button has a
+// fixed FP_LABEL_MAX buffer holding the text on screen, shown with
+// lv_label_set_text_static(): a new label is a copy into that buffer and a
+// repaint of the label, with no allocation.
+
+#ifndef LABELS_MAX_BUTTONS
+#define LABELS_MAX_BUTTONS 64
+#endif
+
+// Puts `text` on button `button`'s label object if it exists (its page is
+// built); otherwise the page build picks it up from labels_text()
+typedef void (*labels_show_cb_t)(int button);
+
+// `count` buttons, each starting with its built-in label
+void labels_init(int count, const char * (*builtin)(int button), labels_show_cb_t show);
+
+// Text of a button, in its fixed buffer (stable pointer)
+const char * labels_text(int button);
+
+// The master replaced the built-in label
+bool labels_custom(int button);
+
+// From the slave receive callback: a REG_LABEL write just arrived
+void labels_received();
+
+// From the loop: apply the label writes (UI task)
+void labels_poll();
+
+// End of each LVGL refresh (monitor_cb): times the update it puts on screen
+void labels_frame();
+
+#endif
@@ -0,0 +1,263 @@
+/*******************************************************************************
+ * LVGL memory from fixed size classes (see lv_pool.h for lv_conf.h setup)
+ *
+ * Each class is an arena of equal blocks with a singly linked free list, so
+ * alloc and free are O(1): pop/push the list, find the class of a pointer by
+ * comparing it with at most LV_POOL_MAX_CLASSES arena bounds. There is no
+ * external fragmentation; the cost is the unused tail of each block, which
+ * lv_pool_waste_pct() reports. A request goes to the smallest class that
+ * fits, to the next larger class when that one is full (a spill), and to
+ * malloc() only when no class can take it. Built without a class table it
+ * sends everything to malloc() and only keeps the counters.
+ *
+ * LVGL runs in the loop task only, so there is no locking.
+ ******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+#include "lv_pool.h"
+
+#if defined(ESP_PLATFORM)
+#include "esp_cpu.h"
+#define POOL_CYCLES() esp_cpu_get_cycle_count()
+#else
+#define POOL_CYCLES() 0
+#endif
+
+typedef struct { uint16_t block, count; } pool_class_def_t;
+#ifdef LV_POOL_CLASS_TABLE
+static const pool_class_def_t class_defs[] = { LV_POOL_CLASS_TABLE };
+#define NUM_CLASSES (int)(sizeof(class_defs) / sizeof(class_defs[0]))
+#else
+static const pool_class_def_t class_defs[] = { { 0, 0 } };
+#define NUM_CLASSES 0
+#endif
+
+typedef struct free_block { struct free_block * next; } free_block_t;
+
+/* Blocks are rounded up to 8 bytes, so that every block (and the free list
+ * link in a free one) is aligned as malloc() would align it, and the arena
+ * is whole uint64_t words */
+#define POOL_ALIGN 8
+_Static_assert(sizeof(free_block_t) <= POOL_ALIGN, "a free block holds its link");
+#define BLOCK_BYTES(i) ((class_defs[i].block ? ((uint32_t)class_defs[i].block + POOL_ALIGN - 1) \
+                                             : POOL_ALIGN) & ~(uint32_t)(POOL_ALIGN - 1))
+#define DEF_BYTES(i)   (BLOCK_BYTES(i) * class_defs[i].count)
+
+typedef struct {
+    uint8_t *      start;
+    uint8_t *      end;
+    free_block_t * free;
+    uint16_t *     req;     /* requested size per block, 0 = free */
+} pool_class_t;
+
+/* Heap fallback blocks carry their requested size in front */
+#define HEAP_HDR 8
+
+static uint32_t arena_words(void)
+{
+    uint32_t n = 0;
+    for (int i = 0; i < NUM_CLASSES; i++) n += DEF_BYTES(i);
+    return n / sizeof(uint64_t);
+}
+
+static uint64_t * arena = NULL;
+static uint16_t * req_sizes = NULL;
+static pool_class_t classes[LV_POOL_MAX_CLASSES];
+static lv_pool_stats_t stats;
+static uint32_t pool_req = 0;   /* requested bytes held in pool blocks */
+
+static int hist_bucket(size_t size)
+{
+    size_t b = (size - 1) / LV_POOL_HIST_STEP;
+    return b < LV_POOL_HIST_BUCKETS - 1 ? (int)b : LV_POOL_HIST_BUCKETS - 1;
+}
+
+static void account(size_t size, int sign)
+{
+    int b = hist_bucket(size);
+    if (sign > 0) {
+        stats.req_bytes += size;
+        if (stats.req_bytes > stats.req_peak) stats.req_peak = stats.req_bytes;
+        if (++stats.hist_live[b] > stats.hist_peak[b]) stats.hist_peak[b] = stats.hist_live[b];
+    } else {
+        stats.req_bytes -= size;
+        stats.hist_live[b]--;
+    }
+}
+
+/* Arena and size table come from malloc once, at the first LVGL allocation
+ * (lv_init), so they land in internal RAM like LV_MEM_SIZE would */
+static int pool_init(void)
+{
+    uint32_t blocks = 0;
+    stats.active = 1;
+    if (NUM_CLASSES == 0) return 1;
+    for (int i = 0; i < NUM_CLASSES; i++) blocks += class_defs[i].count;
+    arena = (uint64_t *)malloc(arena_words() * sizeof(uint64_t));
+    req_sizes = (uint16_t *)calloc(blocks, sizeof(uint16_t));
+    if (!arena || !req_sizes) {
+        stats.active = 0;
+        return 0;
+    }
+
+    uint8_t * p = (uint8_t *)arena;
+    uint16_t * r = req_sizes;
+    int n = NUM_CLASSES < LV_POOL_MAX_CLASSES ? NUM_CLASSES : LV_POOL_MAX_CLASSES;
+    for (int i = 0; i < n; i++) {
+        pool_class_t * c = &classes[i];
+        c->start = p;
+        c->end = p + DEF_BYTES(i);
+        c->req = r;
+        c->free = NULL;
+        for (int k = class_defs[i].count - 1; k >= 0; k--) {
+            free_block_t * f = (free_block_t *)(p + (uint32_t)k * BLOCK_BYTES(i));
+            f->next = c->free;
+            c->free = f;
+        }
+        stats.cls[i].block = BLOCK_BYTES(i);
+        stats.cls[i].count = class_defs[i].count;
+        p = c->end;
+        r += class_defs[i].count;
+    }
+    stats.pool_bytes = (uint32_t)(p - (uint8_t *)arena);
+    stats.classes = n;
+    return 1;
+}
+
+static int class_of(const void * ptr)
+{
+    const uint8_t * p = (const uint8_t *)ptr;
+    for (int i = 0; i < stats.classes; i++)
+        if (p >= classes[i].start && p < classes[i].end) return i;
+    return -1;
+}
+
+static void * heap_alloc(size_t size)
+{
+    uint8_t * h = (uint8_t *)malloc(size + HEAP_HDR);
+    if (!h) return NULL;
+    *(uint32_t *)h = (uint32_t)size;
+    stats.heap_allocs++;
+    stats.heap_live++;
+    return h + HEAP_HDR;
+}
+
+static void * do_alloc(size_t size)
+{
+    if (!stats.active && !pool_init()) return NULL;
+    if (size == 0) size = 1;
+
+    for (int i = 0; i < stats.classes; i++) {
+        pool_class_t * c = &classes[i];
+        if (size > stats.cls[i].block) continue;
+        if (!c->free) {
+            stats.cls[i].spills++;   /* counted on each full class passed */
+            continue;
+        }
+        free_block_t * f = c->free;
+        c->free = f->next;
+        c->req[((uint8_t *)f - c->start) / stats.cls[i].block] = (uint16_t)size;
+        if (++stats.cls[i].used > stats.cls[i].peak) stats.cls[i].peak = stats.cls[i].used;
+        stats.cls[i].allocs++;
+        stats.block_bytes += stats.cls[i].block;
+        if (stats.block_bytes > stats.block_peak) stats.block_peak = stats.block_bytes;
+        pool_req += size;
+        account(size, 1);
+        return f;
+    }
+
+    void * p = heap_alloc(size);
+    if (p) account(size, 1);
+    return p;
+}
+
+static void note_cycles(uint32_t t0)
+{
+    uint32_t c = POOL_CYCLES() - t0;
+    stats.alloc_n++;
+    stats.alloc_cycles_sum += c;
+    if (c > stats.alloc_cycles_max) stats.alloc_cycles_max = c;
+}
+
+void * lv_pool_alloc(size_t size)
+{
+    uint32_t t0 = POOL_CYCLES();
+    void * p = do_alloc(size);
+    note_cycles(t0);
+    return p;
+}
+
+void lv_pool_free(void * p)
+{
+    if (!p) return;
+    int i = class_of(p);
+    if (i < 0) {
+        uint8_t * h = (uint8_t *)p - HEAP_HDR;
+        account(*(uint32_t *)h, -1);
+        stats.heap_live--;
+        free(h);
+        return;
+    }
+    pool_class_t * c = &classes[i];
+    uint16_t * req = &c->req[((uint8_t *)p - c->start) / stats.cls[i].block];
+    account(*req, -1);
+    pool_req -= *req;
+    *req = 0;
+    stats.cls[i].used--;
+    stats.block_bytes -= stats.cls[i].block;
+    free_block_t * f = (free_block_t *)p;
+    f->next = c->free;
+    c->free = f;
+}
+
+void * lv_pool_realloc(void * p, size_t size)
+{
+    if (!p) return lv_pool_alloc(size);
+    if (size == 0) size = 1;
+
+    size_t old;
+    int i = class_of(p);
+    if (i >= 0) {
+        pool_class_t * c = &classes[i];
+        uint16_t * req = &c->req[((uint8_t *)p - c->start) / stats.cls[i].block];
+        old = *req;
+        /* Fits the block it already has (LVGL grows arrays one entry at a time) */
+        if (size <= stats.cls[i].block) {
+            account(old, -1);
+            account(size, 1);
+            pool_req = pool_req - old + size;
+            *req = (uint16_t)size;
+            return p;
+        }
+    } else {
+        old = *(uint32_t *)((uint8_t *)p - HEAP_HDR);
+    }
+
+    uint32_t t0 = POOL_CYCLES();
+    void * n = do_alloc(size);
+    note_cycles(t0);
+    if (!n) return NULL;
+    memcpy(n, p, old < size ? old : size);
+    lv_pool_free(p);
+    return n;
+}
+
+const lv_pool_stats_t * lv_pool_stats(void)
+{
+    return &stats;
+}
+
+void lv_pool_reset_peaks(void)
+{
+    for (int i = 0; i < stats.classes; i++) stats.cls[i].peak = stats.cls[i].used;
+    for (int b = 0; b < LV_POOL_HIST_BUCKETS; b++) stats.hist_peak[b] = stats.hist_live[b];
+    stats.req_peak = stats.req_bytes;
+    stats.block_peak = stats.block_bytes;
+    stats.alloc_cycles_max = 0;
+}
+
+uint32_t lv_pool_waste_pct(void)
+{
+    if (stats.block_bytes == 0) return 0;
+    return 100 - (uint32_t)((uint64_t)pool_req * 100 / stats.block_bytes);
+}
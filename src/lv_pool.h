@@ -0,0 +1,97 @@
+#ifndef LV_POOL_H
+#define LV_POOL_H
+
+/* Size-class pool allocator for LVGL (LV_MEM_CUSTOM backend).
+ *
+ * Enable it in Arduino/libraries/lv_conf.h (the LVGL library cannot see the
+ * sketch headers, so the prototypes go there too):
+ *
+ *   #define LV_MEM_CUSTOM 1
+ *   #define LV_MEM_CUSTOM_INCLUDE <stddef.h>
+ *   #define LV_MEM_CUSTOM_ALLOC   lv_pool_alloc
+ *   #define LV_MEM_CUSTOM_FREE    lv_pool_free
+ *   #define LV_MEM_CUSTOM_REALLOC lv_pool_realloc
+ *   #ifdef __cplusplus
+ *   extern "C" {
+ *   #endif
+ *   void * lv_pool_alloc(size_t size);
+ *   void   lv_pool_free(void * p);
+ *   void * lv_pool_realloc(void * p, size_t size);
+ *   #ifdef __cplusplus
+ *   }
+ *   #endif
+ *
+ * Plain C with no Arduino dependency; on ESP32 it also counts CPU cycles
+ * per allocation. */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Block size and count per class, smallest first, e.g.
+ *
+ *   #define LV_POOL_CLASS_TABLE { 16, 192 }, { 32, 192 }, { 64, 128 }, ...
+ *
+ * in lv_conf.h or the build flags. Set it from the histogram measured on the
+ * board ("mem pool" on the console, after the pages and labels have been in
+ * use), which also prints a table to start from. Block sizes are rounded up
+ * to a multiple of 8 (65528 at most), the alignment LVGL expects of
+ * malloc(). Without a table lv_pool only profiles: every request goes to
+ * malloc() and is counted in the histogram. */
+#define LV_POOL_MAX_CLASSES 12
+
+/* Request size histogram: 16-byte buckets up to LV_POOL_HIST_MAX, then one
+ * bucket for everything larger */
+#define LV_POOL_HIST_STEP    16
+#define LV_POOL_HIST_MAX     1024
+#define LV_POOL_HIST_BUCKETS (LV_POOL_HIST_MAX / LV_POOL_HIST_STEP + 1)
+
+typedef struct {
+    uint16_t block;       /* bytes per block */
+    uint16_t count;       /* blocks */
+    uint16_t used;        /* blocks in use now */
+    uint16_t peak;        /* most blocks in use at once */
+    uint32_t allocs;      /* allocations served */
+    uint32_t spills;      /* requests for this class served by a larger one */
+} lv_pool_class_stats_t;
+
+typedef struct {
+    int active;                  /* lv_pool is the LVGL allocator */
+    int classes;                 /* 0: profiling only, see LV_POOL_CLASS_TABLE */
+    lv_pool_class_stats_t cls[LV_POOL_MAX_CLASSES];
+    uint32_t heap_allocs;        /* no class could take it: malloc() */
+    uint32_t heap_live;          /* such blocks in use now */
+    uint32_t req_bytes;          /* requested bytes in use now */
+    uint32_t req_peak;           /* most requested bytes in use at once */
+    uint32_t block_bytes;        /* pool block bytes in use now */
+    uint32_t block_peak;
+    uint32_t pool_bytes;         /* all pool arenas */
+    uint32_t alloc_n;            /* lv_pool_alloc / growing realloc calls */
+    uint32_t alloc_cycles_sum;   /* CPU cycles spent in them (ESP32 only) */
+    uint32_t alloc_cycles_max;
+    uint16_t hist_live[LV_POOL_HIST_BUCKETS];  /* live requests per size bucket */
+    uint16_t hist_peak[LV_POOL_HIST_BUCKETS];  /* most live at once per bucket */
+} lv_pool_stats_t;
+
+void * lv_pool_alloc(size_t size);
+void   lv_pool_free(void * p);
+void * lv_pool_realloc(void * p, size_t size);
+
+/* Read-only view of the counters; active == 0 until the first allocation */
+const lv_pool_stats_t * lv_pool_stats(void);
+
+/* Start the peaks (bytes, per class, per bucket) and the cycle maximum over
+ * from what is in use now, to measure one stretch of use */
+void lv_pool_reset_peaks(void);
+
+/* Bytes wasted inside used blocks (block size - requested), in % */
+uint32_t lv_pool_waste_pct(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -12,12 +12,64 @@
  ******************************************************************************/
 #include "touch.h"
 #include "button_4_106x40.h"
+#include "button_4_106x40_variants.h"
+#include "img_rle.h"
+#include "img_bench.h"
+#include "theme.h"
+#include "pacing.h"
+#include "power.h"
+#include "bench.h"
+#include "fp_proto.h"
+#include "console.h"
+#include "flush_prof.h"
+#include "memmon.h"
+#include "mem_soak.h"
+#include "spi_probe.h"
+#include "boot.h"
+#include "persist.h"
+#include "i2c_recover.h"
+#include "venc.h"
+#include "repeat.h"
+#include "pages.h"
+#include "labels.h"
+#include "uart_link.h"
+#include "script.h"
+
+/* Button art encoding: button_4_106x40 (RGB565A8) or one of the variants
+ * generated by tools/encode_button.py (_i4, _i8, _ck, _rle). An asset of the
+ * same name in the theme partition (tools/assets.py pack) replaces it. */
+#ifndef BUTTON_IMG
+#define BUTTON_IMG button_4_106x40
+#endif
+#define STR_(x) #x
+#define STR(x) STR_(x)
+
+/* Button label rendering, assets for 1 and 2 come from tools/bake_labels.py:
+ * 0 = lv_label with LV_FONT_DEFAULT
+ * 1 = lv_label with label_font (only the glyphs used by button_labels)
+ * 2 = pre-rendered alpha bitmaps, no font engine at runtime */
+#ifndef LABEL_MODE
+#define LABEL_MODE 0
+#endif
+#if LABEL_MODE != 0
+#include "baked_labels.h"
+#endif
 
 /*******************************************************************************
  * Display config - ESP32-2432S032C (CYD 3.2")
  ******************************************************************************/
 #define TFT_BL 27
 
+#if UART_LINK && UART_LINK_PORT == 2 && UART_LINK_TX == TFT_BL
+#error "UART_LINK_TX is the backlight pin (TFT_BL)"
+#endif
+
+/* Display SPI clock in Hz; GFX_NOT_DEFINED keeps the Arduino_GFX default
+ * (40 MHz on ESP32). Build with -DSPI_PROBE to find what a panel sustains. */
+#ifndef TFT_SPI_HZ
+#define TFT_SPI_HZ GFX_NOT_DEFINED
+#endif
+
 #if defined(DISPLAY_DEV_KIT)
 Arduino_GFX *gfx = create_default_Arduino_GFX();
 #else
@@ -39,6 +91,9 @@ void my_disp_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color
 {
     uint32_t w = (area->x2 - area->x1 + 1);
     uint32_t h = (area->y2 - area->y1 + 1);
+#if defined(BENCH_MODE) || defined(FLUSH_PROF)
+    uint32_t t0 = micros();
+#endif
 
 #if (LV_COLOR_16_SWAP != 0)
     gfx->draw16bitBeRGBBitmap(area->x1, area->y1, (uint16_t *)&color_p->full, w, h);
@@ -46,25 +101,73 @@ void my_disp_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color
     gfx->draw16bitRGBBitmap(area->x1, area->y1, (uint16_t *)&color_p->full, w, h);
 #endif
 
+#ifdef BENCH_MODE
+    bench_flush(w * h, micros() - t0);
+#endif
+#ifdef FLUSH_PROF
+    if (flush_prof_record(area, micros() - t0, lv_disp_flush_is_last(disp)))
+        gfx->drawRect(area->x1, area->y1, w, h, FLUSH_OVERLAY_COLOR);
+#endif
     lv_disp_flush_ready(disp);
 }
 
-void my_touchpad_read(lv_indev_drv_t *indev_driver, lv_indev_data_t *data)
+static bool grid_complete = false;   // all buttons built, see build_timer_cb()
+
+/* End of each LVGL refresh: render + flush time for REG_STATS. The first one
+ * after the grid is complete puts the real UI on screen: boot is done. */
+static void my_disp_monitor(lv_disp_drv_t *disp, uint32_t time_ms, uint32_t px)
 {
-    bool has_sig = touch_has_signal();
-    bool touched = false;
-    if (has_sig) touched = touch_touched();
+    fp_stat_set(FP_STAT_FRAME_MS, time_ms);
+    if (grid_complete && !boot_is_ready()) boot_ready();
+    pages_frame();
+    labels_frame();
+}
 
-    if (has_sig && touched)
-    {
-        data->state = LV_INDEV_STATE_PR;
-        data->point.x = touch_last_x;
-        data->point.y = touch_last_y;
-    }
-    else
-    {
-        data->state = LV_INDEV_STATE_REL;
+/* GPIO wired to the touch controller INT output, or -1. TOUCH_GT911_INT is not
+ * wired on this board, so by default touch is polled by the LVGL indev timer
+ * (LV_INDEV_DEF_READ_PERIOD); with a pin the loop wakes and reads it at once. */
+#ifndef TOUCH_WAKE_PIN
+#define TOUCH_WAKE_PIN -1
+#endif
+
+static lv_timer_t * touch_read_timer = NULL;
+static lv_indev_t * touch_indev = NULL;
+
+#if TOUCH_WAKE_PIN >= 0
+static void IRAM_ATTR touch_wake_isr()
+{
+    pacing_wake_isr(PACING_WAKE_TOUCH);
+}
+#endif
+
+static void cancel_press(const char * why);
+
+void my_touchpad_read(lv_indev_drv_t *indev_driver, lv_indev_data_t *data)
+{
+#ifdef BENCH_MODE
+    if (bench_touch(data)) return;
+#endif
+    // A touch injected from the console (script.cpp) stands for the panel
+    if (!script_touch(data)) {
+        bool has_sig = touch_has_signal();
+        bool touched = false;
+        if (has_sig) touched = touch_touched();
+
+        if (has_sig && touched)
+        {
+            data->state = LV_INDEV_STATE_PR;
+            data->point.x = touch_last_x;
+            data->point.y = touch_last_y;
+        }
+        else
+        {
+            data->state = LV_INDEV_STATE_REL;
+        }
     }
+
+    // A slide that becomes the virtual encoder ends the button press
+    if (venc_touch(data->state == LV_INDEV_STATE_PR, data->point.y, millis()))
+        cancel_press("slide, virtual encoder");
 }
 
 /*******************************************************************************
@@ -81,6 +184,13 @@ void my_touchpad_read(lv_indev_drv_t *indev_driver, lv_indev_data_t *data)
 #define BTN_WIDTH  (SCREEN_WIDTH  / NUM_COLS)   // 80
 #define BTN_HEIGHT (SCREEN_HEIGHT / NUM_ROWS)   // 53
 
+/* Pages of NUM_ROWS x NUM_COLS buttons (src/pages.h). Button i of page p is
+ * button p * PAGE_BUTTONS + i in REG_TOUCH, so page 0 keeps the indexes
+ * 0-17 the master knows. */
+#define PAGE_BUTTONS (NUM_ROWS * NUM_COLS)
+#define PAGE_COUNT 3
+#define NUM_BUTTONS (PAGE_COUNT * PAGE_BUTTONS)
+
 static const char * button_labels[18] = {
     "Select", "Menu",    "Band+",
     "Zoom",   "Display", "Band-",
@@ -90,16 +200,56 @@ static const char * button_labels[18] = {
     "User 1", "User 2",  "User 3"
 };
 
-static const bool is_toggle[18] = {
+// Pages 1 and up; their labels always use LV_FONT_DEFAULT (LABEL_MODE 1 and 2
+// assets only cover button_labels)
+static const char * page_labels[PAGE_COUNT - 1][PAGE_BUTTONS] = {
+    {
+        "CW Opts",  "RF Set",   "VFO Sel",
+        "EEPROM",   "AGC",      "Spectrum",
+        "Noise Fl", "Mic Gain", "Mic Comp",
+        "EQ Rx",    "EQ Tx",    "Calibrate",
+        "Bearing",  "Keyer",    "Freq Opt",
+        "Cal Freq", "Mute",     "Lock"
+    },
+    {
+        "Mem 1",    "Mem 2",    "Mem 3",
+        "Mem 4",    "Mem 5",    "Mem 6",
+        "Store",    "Recall",   "Clear",
+        "Split",    "RIT",      "XIT",
+        "VFO A/B",  "A=B",      "Tune",
+        "Macro 1",  "Macro 2",  "Macro 3"
+    }
+};
+
+static const bool is_toggle[NUM_BUTTONS] = {
     true,  false, true,
     false, true,  false,
     true,  false, true,
     false, true,  false,
     true,  false, true,
-    false, true,  false
+    false, true,  false,
+
+    false, false, false,
+    false, true,  false,
+    false, false, false,
+    false, false, false,
+    false, false, false,
+    false, true,  true,
+
+    false, false, false,
+    false, false, false,
+    false, false, false,
+    true,  true,  true,
+    false, false, false,
+    false, false, false
 };
 
-lv_obj_t * buttons[18];
+static const char * button_label(int i)
+{
+    return i < PAGE_BUTTONS ? button_labels[i] : page_labels[i / PAGE_BUTTONS - 1][i % PAGE_BUTTONS];
+}
+
+lv_obj_t * buttons[NUM_BUTTONS];
 
 static const char *TAG = "CHIP_DETECT";
 
@@ -132,91 +282,77 @@ void detect_chip(void) {
 #define I2C_SLAVE_SCL  22
 #define I2C_INT_PIN    26   // active-LOW output, connect to master INT input
 
-// Register addresses (same as pico_frontpanel)
-#define REG_CONFIG   0x00
-#define REG_RESET    0x01
-#define REG_INT_MASK 0x02
-#define REG_ENCODER  0x03
-#define REG_SWITCH   0x04
-#define REG_TOUCH    0x05  // repurposed: button_index (1B) + state (1B) + 3B pad
-#define REG_LED      0x06
-
-// Interrupt mask bits
-#define INT_TS    0x0100  // button event (touch/button slot)
-#define INT_READY 0x8000  // device ready after boot
-
-static volatile uint16_t fp_int_mask        = 0;
-static volatile uint8_t  fp_event_button    = 0xFF;
-static volatile uint8_t  fp_event_state     = 0;
-static volatile uint8_t  fp_last_reg        = 0xFF;
-static volatile bool     fp_int_active_high = false;
-
-static void fp_assert_int() {
-    digitalWrite(I2C_INT_PIN, fp_int_active_high ? HIGH : LOW);
-}
-
-static void fp_clear_int() {
-    fp_int_mask = 0;
-    digitalWrite(I2C_INT_PIN, fp_int_active_high ? LOW : HIGH);
+// Register map, event queue and REG_STATS live in fp_proto.cpp
+static void fp_set_int(bool high) {
+    digitalWrite(I2C_INT_PIN, high ? HIGH : LOW);
+    uart_link_kick();
 }
 
 void i2c_slave_receive(int num_bytes) {
-    if (num_bytes == 0) return;
-    fp_last_reg = Wire1.read();
-    num_bytes--;
-    if (fp_last_reg == REG_CONFIG && num_bytes >= 2) {
-        uint16_t cfg = Wire1.read() | ((uint16_t)Wire1.read() << 8);
-        fp_int_active_high = (cfg >> 8) & 1;
-        num_bytes -= 2;
+    uint8_t buf[FP_RX_MAX];
+    int n = 0;
+    while (Wire1.available()) {
+        uint8_t b = Wire1.read();
+        if (n < (int)sizeof(buf)) buf[n++] = b;
     }
-    while (Wire1.available()) Wire1.read();
+    if (n == 0) return;
+    i2c_recover_slave_activity();
+    if (uart_link_active()) return;   // the serial link owns the registers
+    fp_receive(buf, n);
+    if (buf[0] == REG_LABEL) labels_received();
+    // Selecting REG_INT_MASK for a read is the master's periodic poll: it is
+    // answered from the callbacks and must not keep the panel out of idle
+    bool poll = (buf[0] == REG_INT_MASK && n == 1);
+    if (!poll) pacing_wake(PACING_WAKE_I2C);
 }
 
 void i2c_slave_request() {
-    switch (fp_last_reg) {
-        case REG_INT_MASK:
-            Wire1.write(fp_int_mask & 0xFF);
-            Wire1.write((fp_int_mask >> 8) & 0xFF);
-            if (fp_int_mask == 0 || fp_int_mask == INT_READY)
-                fp_clear_int();
-            // If INT_TS: keep INT asserted until master reads REG_TOUCH
-            break;
-        case REG_ENCODER:
-            Wire1.write(0); Wire1.write(0);  // no encoders
-            fp_clear_int();
-            break;
-        case REG_SWITCH:
-            Wire1.write(0);  // no encoder switches
-            fp_clear_int();
-            break;
-        case REG_TOUCH:
-            Wire1.write(fp_event_button);
-            Wire1.write(fp_event_state);
-            Wire1.write(0); Wire1.write(0); Wire1.write(0);
-            fp_clear_int();
-            break;
-        default:
-            Wire1.write(0);
-            break;
+    if (uart_link_active()) {
+        Wire1.write((uint8_t)0);
+        return;
     }
+    uint32_t t0 = micros();
+    uint8_t buf[FP_TX_MAX];
+    int n = fp_request(buf, sizeof(buf));
+    Wire1.write(buf, n);
+    if (fp_selected_register() != REG_INT_MASK) pacing_wake(PACING_WAKE_I2C);
+    fp_stat_max(FP_STAT_REQUEST_MAX_US, micros() - t0);
 }
 
 // Called from btn_event_cb to report a button press/release to the master
 static void i2c_report_button(uint8_t index, uint8_t state) {
-    fp_event_button = index;
-    fp_event_state  = state;
-    fp_int_mask     = INT_TS;
-    fp_assert_int();
+    if (fp_report_button(index, state))
+        boot_event();
+    else
+        Serial.printf("I2C event queue full, button %d dropped\n", index);
 }
 
-void i2c_slave_init() {
-    pinMode(I2C_INT_PIN, OUTPUT);
-    fp_clear_int();
+// Press and release of a momentary button: with FP_FEATURE_CLICK the master
+// gets a quick tap as one click event carrying the press duration
+static void i2c_report_press(uint8_t index) {
+    if (fp_report_press(index, millis()))
+        boot_event();
+    else
+        Serial.printf("I2C event queue full, button %d dropped\n", index);
+}
+
+static void i2c_report_release(uint8_t index, uint32_t held_ms) {
+    if (!fp_report_release(index, held_ms > 0xFFFF ? 0xFFFF : held_ms))
+        Serial.printf("I2C event queue full, button %d dropped\n", index);
+}
+
+// Also run by the bus recovery (i2c_recover.cpp) to restart the slave
+static void i2c_slave_begin() {
     Wire1.begin((uint8_t)I2C_SLAVE_ADDR, I2C_SLAVE_SDA, I2C_SLAVE_SCL);
     Wire1.onReceive(i2c_slave_receive);
     Wire1.onRequest(i2c_slave_request);
+}
+
+void i2c_slave_init() {
+    pinMode(I2C_INT_PIN, OUTPUT);
+    fp_init(fp_set_int);
+    i2c_slave_begin();
     // NOTE: INT_READY signal suppressed here; GPIO26 may be wired to GT911 INT
-    // fp_int_mask = INT_READY; fp_assert_int();
     Serial.println("I2C slave: addr=0x20 SDA=21 SCL=22 INT=26 (active-LOW)");
 }
 
@@ -226,11 +362,27 @@ void i2c_slave_init() {
 /* Structure for button user data */
 typedef struct {
     lv_obj_t * bg;
+    lv_obj_t * label;    // lv_label, or the baked lv_img (LABEL_MODE 2)
     int index;
     bool toggle_state;
+    bool baked;
 } btn_data_t;
 
-static btn_data_t btn_data[18];
+static btn_data_t btn_data[NUM_BUTTONS];
+
+// Toggle states restored from NVS by setup(), bit i = button i checked
+static uint64_t toggles_saved = 0;
+
+static uint64_t toggle_bitmap()
+{
+    uint64_t bits = 0;
+    for (int i = 0; i < NUM_BUTTONS; i++)
+        if (btn_data[i].toggle_state) bits |= 1ull << i;
+    return bits;
+}
+
+static btn_data_t * pressed_btn = NULL;
+static uint32_t pressed_ms;   // millis() of the last LV_EVENT_PRESSED
 
 static void btn_event_cb(lv_event_t * e)
 {
@@ -238,6 +390,27 @@ static void btn_event_cb(lv_event_t * e)
     btn_data_t * data = (btn_data_t *)lv_event_get_user_data(e);
     int idx = data->index;
 
+#ifdef BENCH_MODE
+    bench_event(code);
+#endif
+
+    if (code == LV_EVENT_DELETE) {   // page evicted from the cache
+        buttons[idx] = NULL;
+        data->label = NULL;
+        return;
+    }
+    if (code == LV_EVENT_PRESSED) {
+        pressed_btn = data;
+        pressed_ms = millis();
+        venc_press(idx);
+    }
+    else if (code == LV_EVENT_LONG_PRESSED) {
+        venc_long_pressed();
+    }
+    else if (code == LV_EVENT_RELEASED || code == LV_EVENT_PRESS_LOST) {
+        pressed_btn = NULL;
+    }
+
     if (is_toggle[idx]) {
         /* Toggle button: 3 colors - warm amber (inactive), orange (active), white (pressed) */
         if (code == LV_EVENT_PRESSED) {
@@ -247,13 +420,14 @@ static void btn_event_cb(lv_event_t * e)
             data->toggle_state = !data->toggle_state;
             if (data->toggle_state) {
                 lv_obj_set_style_bg_color(data->bg, lv_color_hex(0xFF6600), 0);
-                Serial.printf("Button %d (%s) toggled -> CHECKED\n", idx, button_labels[idx]);
+                Serial.printf("Button %d (%s) toggled -> CHECKED\n", idx, button_label(idx));
                 i2c_report_button(idx, 1);
             } else {
                 lv_obj_set_style_bg_color(data->bg, lv_color_hex(0xFFE8D0), 0);
-                Serial.printf("Button %d (%s) toggled -> UNCHECKED\n", idx, button_labels[idx]);
+                Serial.printf("Button %d (%s) toggled -> UNCHECKED\n", idx, button_label(idx));
                 i2c_report_button(idx, 0);
             }
+            persist_set(toggle_bitmap());
         }
         else if (code == LV_EVENT_RELEASED || code == LV_EVENT_PRESS_LOST) {
             if (data->toggle_state) {
@@ -262,43 +436,246 @@ static void btn_event_cb(lv_event_t * e)
                 lv_obj_set_style_bg_color(data->bg, lv_color_hex(0xFFE8D0), 0);
             }
         }
+    } else if (venc_is_zone(idx)) {
+        /* Momentary encoder zone: a drag turns the virtual encoder, so the press is only
+         * reported once it ends as a tap */
+        if (code == LV_EVENT_PRESSED) {
+            lv_obj_set_style_bg_color(data->bg, lv_color_hex(0xFFF8F0), 0);
+        }
+        else if (code == LV_EVENT_CLICKED) {
+            Serial.printf("Button %d (%s) tapped\n", idx, button_label(idx));
+            i2c_report_press(idx);
+            i2c_report_release(idx, millis() - pressed_ms);
+        }
+        else if (code == LV_EVENT_RELEASED || code == LV_EVENT_PRESS_LOST) {
+            lv_obj_set_style_bg_color(data->bg, lv_color_hex(0xFFE8D0), 0);
+        }
     } else {
         /* Momentary button: white when pressed, warm amber when released */
         if (code == LV_EVENT_PRESSED) {
             lv_obj_set_style_bg_color(data->bg, lv_color_hex(0xFFF8F0), 0);
-            Serial.printf("Button %d (%s) pressed\n", idx, button_labels[idx]);
-            i2c_report_button(idx, 1);
+            Serial.printf("Button %d (%s) pressed\n", idx, button_label(idx));
+            i2c_report_press(idx);
+            if (repeat_enabled(idx)) repeat_start(idx);
         }
         else if (code == LV_EVENT_RELEASED || code == LV_EVENT_PRESS_LOST) {
+            uint32_t repeats = repeat_stop();
             lv_obj_set_style_bg_color(data->bg, lv_color_hex(0xFFE8D0), 0);
-            Serial.printf("Button %d (%s) released\n", idx, button_labels[idx]);
-            i2c_report_button(idx, 0);
+            if (repeats)
+                Serial.printf("Button %d (%s) released after %u repeats\n", idx, button_label(idx), repeats);
+            else
+                Serial.printf("Button %d (%s) released\n", idx, button_label(idx));
+            i2c_report_release(idx, millis() - pressed_ms);
         }
     }
 }
 
+// The pressed button loses the press as if the finger had slid off it: the
+// momentary release is reported, a toggle does not toggle, and LVGL ignores
+// the touch until it is lifted
+static void cancel_press(const char * why)
+{
+    if (!pressed_btn) return;
+    Serial.printf("Button %d (%s): %s\n", pressed_btn->index, button_label(pressed_btn->index), why);
+    lv_event_send(buttons[pressed_btn->index], LV_EVENT_PRESS_LOST, touch_indev);
+    lv_indev_wait_release(touch_indev);
+}
+
+// For the console's tap and state commands (script.cpp), from its task
+static void button_info(int i, script_button_t * out)
+{
+    out->x = i % NUM_COLS * BTN_WIDTH + BTN_WIDTH / 2;
+    out->y = i % PAGE_BUTTONS / NUM_COLS * BTN_HEIGHT + BTN_HEIGHT / 2;
+    out->page = i / PAGE_BUTTONS;
+    out->shown = out->page == pages_current();
+    out->toggle = is_toggle[i];
+    out->checked = btn_data[i].toggle_state;
+    out->pressed = pressed_btn == &btn_data[i];
+}
+
 // ────────────────────────────────────────────────
+static const lv_img_dsc_t * btn_img;
+
+// lv_label on the button's fixed text buffer (labels.cpp). The subset font
+// only has the glyphs of the built-in page 0 labels, so a label the master
+// sets uses LV_FONT_DEFAULT.
+static lv_obj_t * create_text_label(lv_obj_t * img_btn, int i)
+{
+    lv_obj_t * label = lv_label_create(img_btn);
+    lv_label_set_text_static(label, labels_text(i));
+#if LABEL_MODE == 1
+    if (i < PAGE_BUTTONS && !labels_custom(i)) lv_obj_set_style_text_font(label, &label_font, 0);
+#endif
+    lv_obj_set_style_text_color(label, lv_color_hex(0x000000), 0);
+    lv_obj_center(label);
+    return label;
+}
+
+// A label changed (labels.cpp): only this label's area is repainted
+static void show_label(int i)
+{
+    btn_data_t * data = &btn_data[i];
+    if (!data->label) return;   // page not built: create_button() reads the text
+#if LABEL_MODE == 2
+    if (data->baked) {   // once per button: the bitmap becomes a text label
+        lv_obj_del(data->label);
+        data->label = create_text_label(buttons[i], i);
+        data->baked = false;
+        return;
+    }
+#endif
+#if LABEL_MODE == 1
+    if (i < PAGE_BUTTONS)
+        lv_obj_set_style_text_font(data->label, labels_custom(i) ? LV_FONT_DEFAULT : &label_font, 0);
+#endif
+    lv_label_set_text_static(data->label, labels_text(i));
+}
+
+// Background object for color state, image button on top, label on that
+// (following the working project pattern)
+static void create_button(lv_obj_t * scr, int i)
+{
+    int row = i % PAGE_BUTTONS / NUM_COLS;
+    int col = i % NUM_COLS;
+
+    // Background object for color state
+    lv_obj_t * bg = lv_obj_create(scr);
+    lv_obj_set_pos(bg, col * BTN_WIDTH, row * BTN_HEIGHT);
+    lv_obj_set_size(bg, BTN_WIDTH, BTN_HEIGHT);
+    bool checked = btn_data[i].toggle_state;
+    lv_obj_set_style_bg_color(bg, lv_color_hex(checked ? 0xFF6600 : 0xFFE8D0), 0);  // orange / warm amber
+    lv_obj_set_style_bg_opa(bg, LV_OPA_COVER, 0);
+    lv_obj_set_style_border_width(bg, 1, 0);
+    lv_obj_set_style_border_color(bg, lv_color_hex(0x404040), 0);
+    lv_obj_set_style_border_opa(bg, LV_OPA_70, 0);
+    lv_obj_set_style_radius(bg, 0, 0);
+    lv_obj_set_style_pad_all(bg, 0, 0);
+    lv_obj_clear_flag(bg, LV_OBJ_FLAG_SCROLLABLE);
+
+    // Image button on top of background
+    lv_obj_t * img_btn = lv_imgbtn_create(bg);
+    lv_imgbtn_set_src(img_btn, LV_IMGBTN_STATE_RELEASED, btn_img, NULL, NULL);
+    lv_imgbtn_set_src(img_btn, LV_IMGBTN_STATE_PRESSED, btn_img, NULL, NULL);
+    lv_obj_align(img_btn, LV_ALIGN_CENTER, 0, 0);
+
+    // Transparent imgbtn background so bg color shows through
+    lv_obj_set_style_bg_opa(img_btn, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_shadow_width(img_btn, 0, 0);
+
+    // Text label
+    lv_obj_t * label;
+    btn_data[i].baked = false;
+#if LABEL_MODE == 2
+    if (i < PAGE_BUTTONS && !labels_custom(i)) {
+        label = lv_img_create(img_btn);
+        lv_img_set_src(label, &baked_labels[i]);
+        lv_obj_set_style_img_recolor(label, lv_color_hex(0x000000), 0);
+        lv_obj_set_style_img_recolor_opa(label, LV_OPA_COVER, 0);
+        lv_obj_center(label);
+        btn_data[i].baked = true;
+    } else
+#endif
+    label = create_text_label(img_btn, i);
+
+    // Setup button data (index and toggle state are set once, by setup())
+    btn_data[i].bg = bg;
+    btn_data[i].label = label;
+    buttons[i] = img_btn;
+
+    // Event callback
+    lv_obj_add_event_cb(img_btn, btn_event_cb, LV_EVENT_ALL, &btn_data[i]);
+}
+
+// Pages after the first are built on their first visit (pages.cpp)
+static void build_page(int page, lv_obj_t * scr)
+{
+    for (int i = 0; i < PAGE_BUTTONS; i++)
+        create_button(scr, page * PAGE_BUTTONS + i);
+}
+
+static void page_leave(int page)
+{
+    cancel_press("page change");
+}
+
+/* The grid is built one row per loop pass after setup() returns, behind the
+ * splash. Refresh and touch stay paused until it is complete, so LVGL's
+ * first frame is the whole grid; INT_READY follows that frame. */
+static int buttons_built = 0;
+
+static void build_timer_cb(lv_timer_t * t)
+{
+    for (int c = 0; c < NUM_COLS && buttons_built < PAGE_BUTTONS; c++)
+        create_button(lv_scr_act(), buttons_built++);
+    if (buttons_built < PAGE_BUTTONS) return;
+
+    lv_timer_del(t);
+    boot_mark("build");
+    pages_boot_built();
+    Serial.println("Setup complete - 18 buttons created");
+    grid_complete = true;
+    lv_timer_resume(_lv_disp_get_refr_timer(lv_disp_get_default()));
+    lv_timer_resume(touch_read_timer);
+
+#ifdef MEM_SOAK
+    mem_soak_run();
+#endif
+#ifdef BENCH_MODE
+    bench_start(buttons, 18);
+#endif
+}
+
 void setup()
 {
     Serial.begin(115200);
-    Serial.println("6x3 Button Grid - LVGL 8.3.11");
+    pacing_init();
 
-    detect_chip();
+    // I2C slave init FIRST: the master polls from power-on and gets "not
+    // ready" (no INT_READY, boot_ms 0) until the grid is up. It must also
+    // precede touch_init(): Wire1.begin() corrupts Wire (GT911 I2C bus) if
+    // called after it.
+    i2c_slave_init();
+    uart_link_init();
+    boot_mark("i2c");
+
+    // Saved toggle states before the splash, which draws them
+    toggles_saved = persist_load();
+    for (int i = 0; i < NUM_BUTTONS; i++) {
+        btn_data[i].index = i;
+        btn_data[i].toggle_state = is_toggle[i] && ((toggles_saved >> i) & 1);
+    }
+    boot_mark("nvs");
+
+    Serial.println("6x3 Button Grid - LVGL 8.3.11");
 
     // Init Display
-    gfx->begin();
+    gfx->begin(TFT_SPI_HZ);
+#if defined(SPI_PROBE) && !defined(DISPLAY_DEV_KIT)
+    // The probe's patterns are for the eye: backlight on first
 #ifdef TFT_BL
-    pinMode(TFT_BL, OUTPUT);
-    digitalWrite(TFT_BL, HIGH);
-    analogWrite(TFT_BL, 100);
+    power_backlight_init(TFT_BL);
 #endif
+    spi_probe_run(gfx, bus, TFT_SPI_HZ);
+#endif
+    boot_mark("display");
 
-    // I2C slave init FIRST — Wire1.begin() corrupts Wire (GT911 I2C bus) if called after touch_init()
-    i2c_slave_init();
+    // Grid from flash before the backlight comes on, so the panel's
+    // power-on RAM content is never seen
+    boot_splash(gfx, button_labels, NUM_COLS, NUM_ROWS, (uint32_t)toggles_saved);
+#if defined(TFT_BL) && !(defined(SPI_PROBE) && !defined(DISPLAY_DEV_KIT))
+    power_backlight_init(TFT_BL);
+#endif
+    boot_mark("splash");
+
+    detect_chip();
 
     lv_init();
-    delay(20);
+    img_rle_init();
+    theme_init();
+    // No settling delay: gfx->begin() above already waited out the GT911
+    // power-on time (the ST7789 sleep-out alone is 120 ms)
     touch_init();
+    boot_mark("lvgl+touch");
 
     screenWidth = gfx->width();
     screenHeight = gfx->height();
@@ -326,67 +703,85 @@ void setup()
     disp_drv.ver_res = screenHeight;
     disp_drv.flush_cb = my_disp_flush;
     disp_drv.draw_buf = &draw_buf;
+    disp_drv.monitor_cb = my_disp_monitor;
     lv_disp_drv_register(&disp_drv);
+#ifdef FLUSH_PROF
+    flush_prof_init();
+#endif
+    memmon_init(sizeof(lv_color_t) * screenWidth * screenHeight / 2);
+    persist_init();
 
     /* Initialize the touch input driver */
     static lv_indev_drv_t indev_drv;
     lv_indev_drv_init(&indev_drv);
     indev_drv.type = LV_INDEV_TYPE_POINTER;
     indev_drv.read_cb = my_touchpad_read;
-    lv_indev_drv_register(&indev_drv);
-
-    // (I2C slave already initialized above, before touch_init)
-
-    // ── Create all 18 buttons in a 6x3 grid ──
-    // Following the working project pattern: background obj + imgbtn on top
-    for (int i = 0; i < 18; i++) {
-        int row = i / NUM_COLS;
-        int col = i % NUM_COLS;
-
-        // Background object for color state
-        lv_obj_t * bg = lv_obj_create(lv_scr_act());
-        lv_obj_set_pos(bg, col * BTN_WIDTH, row * BTN_HEIGHT);
-        lv_obj_set_size(bg, BTN_WIDTH, BTN_HEIGHT);
-        lv_obj_set_style_bg_color(bg, lv_color_hex(0xFFE8D0), 0);  // warm amber inactive
-        lv_obj_set_style_bg_opa(bg, LV_OPA_COVER, 0);
-        lv_obj_set_style_border_width(bg, 1, 0);
-        lv_obj_set_style_border_color(bg, lv_color_hex(0x404040), 0);
-        lv_obj_set_style_border_opa(bg, LV_OPA_70, 0);
-        lv_obj_set_style_radius(bg, 0, 0);
-        lv_obj_set_style_pad_all(bg, 0, 0);
-        lv_obj_clear_flag(bg, LV_OBJ_FLAG_SCROLLABLE);
-
-        // Image button on top of background
-        lv_obj_t * img_btn = lv_imgbtn_create(bg);
-        lv_imgbtn_set_src(img_btn, LV_IMGBTN_STATE_RELEASED, &button_4_106x40, NULL, NULL);
-        lv_imgbtn_set_src(img_btn, LV_IMGBTN_STATE_PRESSED, &button_4_106x40, NULL, NULL);
-        lv_obj_align(img_btn, LV_ALIGN_CENTER, 0, 0);
-
-        // Transparent imgbtn background so bg color shows through
-        lv_obj_set_style_bg_opa(img_btn, LV_OPA_TRANSP, 0);
-        lv_obj_set_style_shadow_width(img_btn, 0, 0);
-
-        // Text label
-        lv_obj_t * label = lv_label_create(img_btn);
-        lv_label_set_text(label, button_labels[i]);
-        lv_obj_set_style_text_color(label, lv_color_hex(0x000000), 0);
-        lv_obj_center(label);
-
-        // Setup button data
-        btn_data[i].bg = bg;
-        btn_data[i].index = i;
-        btn_data[i].toggle_state = false;
-        buttons[i] = img_btn;
+    touch_indev = lv_indev_drv_register(&indev_drv);
+    touch_read_timer = indev_drv.read_timer;
+    // Same phase as the refresh timer: the touch read and the redraw it causes
+    // share one wakeup, and the read runs first (newer timers run first)
+    touch_read_timer->last_run = _lv_disp_get_refr_timer(lv_disp_get_default())->last_run;
+    power_init(touch_read_timer);
+#if TOUCH_WAKE_PIN >= 0
+    pinMode(TOUCH_WAKE_PIN, INPUT_PULLUP);
+    attachInterrupt(TOUCH_WAKE_PIN, touch_wake_isr, FALLING);
+#endif
+    i2c_recover_init(I2C_SLAVE_SDA, I2C_SLAVE_SCL, i2c_slave_begin);
 
-        // Event callback
-        lv_obj_add_event_cb(img_btn, btn_event_cb, LV_EVENT_ALL, &btn_data[i]);
-    }
+#ifdef IMG_BENCH
+    img_bench_run(button_labels);
+#endif
 
-    Serial.println("Setup complete - 18 buttons created");
+    // Button art from the theme partition if it has it, else the built-in array
+    btn_img = theme_get(STR(BUTTON_IMG), &BUTTON_IMG);
+
+    lv_timer_pause(_lv_disp_get_refr_timer(lv_disp_get_default()));
+    lv_timer_pause(touch_read_timer);
+    pages_init(PAGE_COUNT, build_page, page_leave);
+    labels_init(NUM_BUTTONS, button_label, show_label);
+    script_init(NUM_BUTTONS, SCREEN_WIDTH, SCREEN_HEIGHT, button_info);
+    lv_timer_create(build_timer_cb, 0, NULL);
+    // Every command is registered: the console reads Serial in its own task
+    console_start();
+    boot_mark("drivers");
 }
 
+/* A lv_timer_handler() pass longer than this counts as a loop overrun
+ * (FP_STAT_LOOP_OVERRUNS): touch and redraws were late by at least a frame */
+#ifndef LOOP_BUDGET_MS
+#define LOOP_BUDGET_MS 33
+#endif
+
 void loop()
 {
-    lv_timer_handler();
-    delay(5);
+    uint32_t t0 = millis();
+    uint32_t ms = lv_timer_handler();
+    uint32_t now = millis();
+    if (now - t0 > LOOP_BUDGET_MS) fp_stat_inc(FP_STAT_LOOP_OVERRUNS);
+    fp_stat_set(FP_STAT_UPTIME_S, now / 1000);
+    fp_stat_set(FP_STAT_FREE_HEAP, ESP.getFreeHeap());
+
+    // Console commands that use LVGL, handed over by the console task
+    console_poll();
+
+    // Idle power state; on wake-up run LVGL again at once to redraw
+    if (power_update()) ms = 0;
+
+    // A momentary press held back for the master's click window goes out
+    // when the window ends, even if LVGL has nothing to do before then
+    uint32_t click_due = fp_click_poll(now);
+    if (click_due < ms) ms = click_due;
+
+    // Sleep until the next LVGL timer is due, or until I2C/touch wakes us
+    uint32_t why = pacing_wait(ms);
+
+    // Master activity counts as UI activity (keeps or brings the panel out of idle)
+    if (why & PACING_WAKE_I2C) lv_disp_trig_activity(NULL);
+
+    // A page selected by the master in REG_PAGE, labels it wrote in REG_LABEL
+    pages_poll();
+    labels_poll();
+
+    // Touch INT: read the panel now rather than at the next indev period
+    if ((why & PACING_WAKE_TOUCH) && touch_read_timer) lv_timer_ready(touch_read_timer);
 }
@@ -0,0 +1,188 @@
+/*******************************************************************************
+ * LVGL allocator soak (build flag MEM_SOAK)
+ *
+ * Plays MEM_SOAK_OPS random operations, from a fixed seed, on a screen that is
+ * never loaded: labels created, re-texted and deleted, local styles set and
+ * removed, containers with children built and torn down, event callbacks
+ * added. This is the allocation pattern of pages and dynamic labels, without
+ * drawing. Then it deletes everything and prints one MEM_SOAK_CSV_HEADER row.
+ *
+ * The same seed gives the same operations whatever the allocator, so a build
+ * with the built-in TLSF pool (LV_MEM_CUSTOM 0), one with LV_MEM_CUSTOM 1 on
+ * the system heap and one on lv_pool can be compared row by row:
+ *
+ *   op_us        time per operation, allocator included
+ *   alloc_*      lv_pool only: allocation count and CPU cycles
+ *   peak_bytes   most bytes held above the start of the soak. lv_pool:
+ *                block bytes, its peaks restarted at the soak start. TLSF and
+ *                system heap: in use after each operation, the highest of
+ *                those (max_used and the heap low-water mark count since
+ *                boot and cannot be restarted)
+ *   frag_pct     lv_pool: space wasted inside used blocks;
+ *                TLSF: lv_mem_monitor frag_pct; system: 100 - largest/free
+ *   leak_bytes   memory still held after everything was deleted
+ ******************************************************************************/
+#include <Arduino.h>
+#include <lvgl.h>
+#include "esp_heap_caps.h"
+
+#include "mem_soak.h"
+#include "lv_pool.h"
+
+#ifdef MEM_SOAK
+
+#define SOAK_MAX_OBJS 48
+
+typedef struct {
+    const char * name;
+    uint32_t in_use;      // bytes held now
+    uint32_t peak;
+    uint32_t frag_pct;
+} soak_mem_t;
+
+static uint32_t rng = MEM_SOAK_SEED;
+
+static uint32_t rnd(uint32_t n)
+{
+    rng = rng * 1664525u + 1013904223u;
+    return (rng >> 8) % n;
+}
+
+static soak_mem_t mem_state()
+{
+    soak_mem_t m;
+    const lv_pool_stats_t * ps = lv_pool_stats();
+    if (ps->classes) {
+        m.name = "lv_pool";
+        m.in_use = ps->block_bytes;
+        m.peak = ps->block_peak;
+        m.frag_pct = lv_pool_waste_pct();
+        return m;
+    }
+#if LV_MEM_CUSTOM == 0
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    m.name = "lvgl_tlsf";
+    m.in_use = mon.total_size - mon.free_size;
+    m.frag_pct = mon.frag_pct;
+#else
+    uint32_t free_b = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    m.name = ps->active ? "lv_pool_profile" : "system";
+    m.in_use = heap_caps_get_total_size(MALLOC_CAP_INTERNAL) - free_b;
+    m.frag_pct = free_b ? 100 - heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL) * 100 / free_b : 0;
+#endif
+    m.peak = m.in_use;
+    return m;
+}
+
+static void soak_event_cb(lv_event_t * e)
+{
+}
+
+static void random_text(char * buf, int max)
+{
+    int n = 1 + rnd(max - 1);
+    for (int i = 0; i < n; i++) buf[i] = 'a' + rnd(26);
+    buf[n] = 0;
+}
+
+void mem_soak_run()
+{
+    static lv_obj_t * objs[SOAK_MAX_OBJS];
+    static bool is_label[SOAK_MAX_OBJS];
+    char text[41];
+
+    Serial.println("MEM_SOAK start");
+    lv_pool_reset_peaks();
+    soak_mem_t before = mem_state();
+    const lv_pool_stats_t * ps = lv_pool_stats();
+    uint32_t alloc_n0 = ps->alloc_n, cycles0 = ps->alloc_cycles_sum, heap0 = ps->heap_allocs;
+    uint32_t peak = before.in_use;
+
+    lv_obj_t * scr = lv_obj_create(NULL);
+    memset(objs, 0, sizeof(objs));
+    uint32_t us_sum = 0, us_max = 0;
+
+    for (uint32_t op = 0; op < MEM_SOAK_OPS; op++) {
+        int slot = rnd(SOAK_MAX_OBJS);
+        lv_obj_t * o = objs[slot];
+        uint32_t kind = rnd(8);
+        uint32_t t0 = micros();
+
+        if (!o) {
+            if (kind < 5) {                  // label
+                o = lv_label_create(scr);
+                random_text(text, sizeof(text));
+                lv_label_set_text(o, text);
+                is_label[slot] = true;
+            } else {                         // container with a few labelled children
+                o = lv_obj_create(scr);
+                lv_obj_set_size(o, 80, 53);
+                int children = 1 + rnd(6);
+                for (int i = 0; i < children; i++) {
+                    lv_obj_t * l = lv_label_create(o);
+                    random_text(text, 12);
+                    lv_label_set_text(l, text);
+                }
+                is_label[slot] = false;
+            }
+            objs[slot] = o;
+        } else {
+            switch (kind) {
+                case 0: case 1:
+                    lv_obj_del(o);
+                    objs[slot] = NULL;
+                    break;
+                case 2:
+                    if (is_label[slot]) {
+                        random_text(text, sizeof(text));
+                        lv_label_set_text(o, text);
+                    } else {
+                        lv_obj_clean(o);
+                    }
+                    break;
+                case 3:
+                    lv_obj_set_style_bg_color(o, lv_color_hex(rng & 0xFFFFFF), 0);
+                    break;
+                case 4:
+                    lv_obj_set_style_border_width(o, rnd(4), 0);
+                    lv_obj_set_style_pad_all(o, rnd(8), 0);
+                    break;
+                case 5:
+                    lv_obj_set_style_text_color(o, lv_color_hex(rng & 0xFFFFFF), LV_STATE_PRESSED);
+                    break;
+                case 6:
+                    lv_obj_add_event_cb(o, soak_event_cb, LV_EVENT_CLICKED, NULL);
+                    break;
+                default:
+                    lv_obj_remove_style_all(o);
+                    break;
+            }
+        }
+
+        uint32_t us = micros() - t0;
+        us_sum += us;
+        if (us > us_max) us_max = us;
+        if (!ps->classes) {
+            uint32_t in_use = mem_state().in_use;
+            if (in_use > peak) peak = in_use;
+        }
+    }
+
+    soak_mem_t during = mem_state();
+    if (!ps->classes) during.peak = peak;
+    lv_obj_del(scr);
+    soak_mem_t after = mem_state();
+
+    uint32_t alloc_n = ps->alloc_n - alloc_n0;
+    Serial.println(MEM_SOAK_CSV_HEADER);
+    Serial.printf("%s,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%ld\n", during.name,
+                  (unsigned long)MEM_SOAK_OPS, (unsigned long)(us_sum / MEM_SOAK_OPS),
+                  (unsigned long)us_max, (unsigned long)alloc_n,
+                  (unsigned long)(alloc_n ? (ps->alloc_cycles_sum - cycles0) / alloc_n : 0),
+                  (unsigned long)ps->alloc_cycles_max, (unsigned long)(during.peak - before.in_use),
+                  (unsigned long)during.frag_pct, (unsigned long)(ps->heap_allocs - heap0),
+                  (long)after.in_use - (long)before.in_use);
+}
+
+#endif
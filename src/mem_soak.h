@@ -0,0 +1,20 @@
+#ifndef MEM_SOAK_H
+#define MEM_SOAK_H
+
+// One row per run; build once per allocator and compare the rows
+#define MEM_SOAK_CSV_HEADER "allocator,ops,op_us_avg,op_us_max,alloc_n,alloc_cycles_avg," \
+                            "alloc_cycles_max,peak_bytes,frag_pct,heap_fallbacks,leak_bytes"
+
+#ifndef MEM_SOAK_OPS
+#define MEM_SOAK_OPS 20000
+#endif
+#ifndef MEM_SOAK_SEED
+#define MEM_SOAK_SEED 12345
+#endif
+
+#ifdef MEM_SOAK
+// Randomized LVGL object churn on an off-screen screen; call at the end of setup()
+void mem_soak_run();
+#endif
+
+#endif
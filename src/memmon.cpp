@@ -0,0 +1,240 @@
+/*******************************************************************************
+ * Memory accounting: internal and DMA-capable heap, the LVGL pool
+ * (lv_mem_monitor) and task stack high-water marks.
+ *
+ * An LVGL timer runs memmon_check() every MEMMON_PERIOD_MS and publishes the
+ * MEMMON_WARN_* bits and the internal heap low-water mark in REG_STATS, so
+ * the master sees a panel running short of memory without a USB cable. The
+ * "mem" console command prints the full report, including what the
+ * internal heap would look like with other draw buffer setups.
+ ******************************************************************************/
+#include <Arduino.h>
+#include <lvgl.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_heap_caps.h"
+
+#include "memmon.h"
+#include "fp_proto.h"
+#include "console.h"
+#include "lv_pool.h"
+
+#define MEMMON_MAX_TASKS 24
+
+static uint32_t draw_buf_bytes = 0;
+static uint32_t warn_reported = 0;
+
+// Stacks checked against MEMMON_STACK_WARN: the ones this firmware sizes or
+// loads (loop, I2C slave callbacks, serial link, console); system task
+// stacks are only printed
+static bool watched_task(const char * name)
+{
+    return strcmp(name, "loopTask") == 0 || strncmp(name, "i2c", 3) == 0 ||
+           strcmp(name, "fp_link") == 0 || strcmp(name, "console") == 0;
+}
+
+typedef struct {
+    const char * name;
+    uint32_t hwm;        // bytes never used
+} task_stack_t;
+
+static int task_stacks(task_stack_t * out, int max)
+{
+#if configUSE_TRACE_FACILITY
+    static TaskStatus_t st[MEMMON_MAX_TASKS];
+    int n = uxTaskGetSystemState(st, MEMMON_MAX_TASKS, NULL);
+    for (int i = 0; i < n && i < max; i++) {
+        out[i].name = st[i].pcTaskName;
+        out[i].hwm  = st[i].usStackHighWaterMark;
+    }
+    return n < max ? n : max;
+#else
+    // Without the trace facility only tasks known by name can be found
+    static const char * names[] = { "loopTask", "i2c_slave_task", "fp_link", "console", "IDLE0", "IDLE1", "esp_timer" };
+    int n = 0;
+    for (unsigned i = 0; i < sizeof(names) / sizeof(names[0]) && n < max; i++) {
+        TaskHandle_t h = xTaskGetHandle(names[i]);
+        if (!h) continue;
+        out[n].name = names[i];
+        out[n].hwm  = uxTaskGetStackHighWaterMark(h);
+        n++;
+    }
+    return n;
+#endif
+}
+
+uint32_t memmon_check()
+{
+    uint32_t warn = 0;
+
+    if (heap_caps_get_free_size(MALLOC_CAP_INTERNAL) < MEMMON_HEAP_WARN) warn |= MEMMON_WARN_HEAP;
+    if (heap_caps_get_largest_free_block(MALLOC_CAP_DMA) < MEMMON_DMA_WARN) warn |= MEMMON_WARN_DMA;
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    if (mon.total_size) {   // zero when LV_MEM_CUSTOM uses the system heap
+        if (mon.free_size < MEMMON_LV_FREE_WARN) warn |= MEMMON_WARN_LV_FREE;
+        if (mon.frag_pct > MEMMON_LV_FRAG_WARN) warn |= MEMMON_WARN_LV_FRAG;
+    }
+    // lv_pool cannot fragment; it runs low when a size class is full
+    const lv_pool_stats_t * ps = lv_pool_stats();
+    for (int i = 0; i < ps->classes; i++)
+        if (ps->cls[i].used == ps->cls[i].count) warn |= MEMMON_WARN_LV_FREE;
+
+    task_stack_t ts[MEMMON_MAX_TASKS];
+    int n = task_stacks(ts, MEMMON_MAX_TASKS);
+    for (int i = 0; i < n; i++)
+        if (watched_task(ts[i].name) && ts[i].hwm < MEMMON_STACK_WARN) warn |= MEMMON_WARN_STACK;
+
+    fp_stat_set(FP_STAT_MEM_WARN, warn);
+    fp_stat_set(FP_STAT_HEAP_MIN, heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL));
+
+    if (warn & ~warn_reported)
+        Serial.printf("MEM warning 0x%02lx, run 'mem' for details\n", (unsigned long)warn);
+    warn_reported = warn;
+    return warn;
+}
+
+uint32_t memmon_lv_used()
+{
+    const lv_pool_stats_t * ps = lv_pool_stats();
+    if (ps->classes) return ps->block_bytes;
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    if (mon.total_size) return mon.total_size - mon.free_size;
+    return heap_caps_get_total_size(MALLOC_CAP_INTERNAL) - heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+}
+
+static void print_heap(const char * name, uint32_t caps)
+{
+    Serial.printf("  %-9s free %7u  min %7u  largest %7u  total %7u\n", name,
+                  (unsigned)heap_caps_get_free_size(caps),
+                  (unsigned)heap_caps_get_minimum_free_size(caps),
+                  (unsigned)heap_caps_get_largest_free_block(caps),
+                  (unsigned)heap_caps_get_total_size(caps));
+}
+
+// Other draw buffer setups, as fractions of the screen. Headroom is the
+// internal heap low-water mark if this buffer had been allocated instead.
+static void print_draw_buf_options()
+{
+    static const struct { uint8_t div; uint8_t bufs; } opts[] = {
+        { 2, 1 }, { 4, 1 }, { 4, 2 }, { 10, 1 }, { 10, 2 }, { 20, 2 },
+    };
+    lv_disp_t * disp = lv_disp_get_default();
+    uint32_t screen_px = (uint32_t)lv_disp_get_hor_res(disp) * lv_disp_get_ver_res(disp);
+    uint32_t min_free = heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL);
+
+    Serial.printf("  draw buffer now %lu bytes\n", (unsigned long)draw_buf_bytes);
+    Serial.println("  setup        bytes  flushes/full-redraw  heap-min-after");
+    for (unsigned i = 0; i < sizeof(opts) / sizeof(opts[0]); i++) {
+        uint32_t buf_px = screen_px / opts[i].div;
+        uint32_t bytes = buf_px * sizeof(lv_color_t) * opts[i].bufs;
+        int32_t after = (int32_t)(min_free + draw_buf_bytes) - (int32_t)bytes;
+        Serial.printf("  1/%-2u x%u  %8lu  %19lu  %14ld %s\n", opts[i].div, opts[i].bufs,
+                      (unsigned long)bytes, (unsigned long)((screen_px + buf_px - 1) / buf_px),
+                      (long)after, after >= MEMMON_HEAP_WARN ? "ok" : "LOW");
+    }
+}
+
+static void print_pool()
+{
+    const lv_pool_stats_t * ps = lv_pool_stats();
+    if (!ps->active) return;
+    if (ps->classes)
+        Serial.printf("  lv_pool   arena %lu  blocks in use %lu (peak %lu)  requested %lu (peak %lu)  waste %lu%%\n",
+                      (unsigned long)ps->pool_bytes, (unsigned long)ps->block_bytes, (unsigned long)ps->block_peak,
+                      (unsigned long)ps->req_bytes, (unsigned long)ps->req_peak, (unsigned long)lv_pool_waste_pct());
+    else
+        Serial.printf("  lv_pool   profiling only (no class table)  requested %lu (peak %lu)\n",
+                      (unsigned long)ps->req_bytes, (unsigned long)ps->req_peak);
+    Serial.printf("  lv_pool   allocs %lu  cycles avg %lu max %lu  to heap %lu (live %lu)\n",
+                  (unsigned long)ps->alloc_n,
+                  (unsigned long)(ps->alloc_n ? ps->alloc_cycles_sum / ps->alloc_n : 0),
+                  (unsigned long)ps->alloc_cycles_max, (unsigned long)ps->heap_allocs,
+                  (unsigned long)ps->heap_live);
+    if (!ps->classes) return;
+    Serial.println("  class  blocks  used  peak   allocs  spills");
+    for (int i = 0; i < ps->classes; i++)
+        Serial.printf("  %5u  %6u  %4u  %4u  %7lu  %6lu\n", ps->cls[i].block, ps->cls[i].count,
+                      ps->cls[i].used, ps->cls[i].peak, (unsigned long)ps->cls[i].allocs,
+                      (unsigned long)ps->cls[i].spills);
+}
+
+// Live and peak requests per size bucket: the profile to size the classes
+// from. The table printed after it gives each power-of-2 class the peaks of
+// its buckets added up, plus a quarter; the peaks were not all at the same
+// time, so it errs large. Requests over LV_POOL_HIST_MAX stay on the heap.
+static void print_pool_profile()
+{
+    const lv_pool_stats_t * ps = lv_pool_stats();
+    if (!ps->active) {
+        Serial.println("lv_pool is not the LVGL allocator (see lv_pool.h)");
+        return;
+    }
+    Serial.println("size,live,peak");
+    for (int b = 0; b < LV_POOL_HIST_BUCKETS; b++) {
+        if (ps->hist_peak[b] == 0) continue;
+        if (b == LV_POOL_HIST_BUCKETS - 1)
+            Serial.printf(">%d,%u,%u\n", LV_POOL_HIST_MAX, ps->hist_live[b], ps->hist_peak[b]);
+        else
+            Serial.printf("%d,%u,%u\n", (b + 1) * LV_POOL_HIST_STEP, ps->hist_live[b], ps->hist_peak[b]);
+    }
+    Serial.print("#define LV_POOL_CLASS_TABLE");
+    int b = 0;
+    const char * sep = " ";
+    for (int block = LV_POOL_HIST_STEP; block <= LV_POOL_HIST_MAX; block *= 2) {
+        uint32_t n = 0;
+        for (; b < LV_POOL_HIST_BUCKETS - 1 && (b + 1) * LV_POOL_HIST_STEP <= block; b++) n += ps->hist_peak[b];
+        if (!n) continue;
+        Serial.printf("%s{ %d, %lu }", sep, block, (unsigned long)((n * 5 + 3) / 4));
+        sep = ", ";
+    }
+    Serial.println();
+}
+
+void memmon_print()
+{
+    uint32_t warn = memmon_check();
+
+    Serial.printf("MEM warnings 0x%02lx\n", (unsigned long)warn);
+    print_heap("internal", MALLOC_CAP_INTERNAL);
+    print_heap("dma", MALLOC_CAP_DMA);
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    Serial.printf("  lvgl      total %u  free %u  biggest %u  max_used %u  used %u%%  frag %u%%\n",
+                  (unsigned)mon.total_size, (unsigned)mon.free_size, (unsigned)mon.free_biggest_size,
+                  (unsigned)mon.max_used, mon.used_pct, mon.frag_pct);
+    print_pool();
+
+    task_stack_t ts[MEMMON_MAX_TASKS];
+    int n = task_stacks(ts, MEMMON_MAX_TASKS);
+    Serial.println("  task              stack-free");
+    for (int i = 0; i < n; i++)
+        Serial.printf("  %-16s %7lu%s\n", ts[i].name, (unsigned long)ts[i].hwm,
+                      watched_task(ts[i].name) && ts[i].hwm < MEMMON_STACK_WARN ? "  LOW" : "");
+
+    print_draw_buf_options();
+}
+
+static void memmon_timer_cb(lv_timer_t * t)
+{
+    memmon_check();
+}
+
+static void mem_cmd(const char * args)
+{
+    if (strcmp(args, "pool") == 0)
+        print_pool_profile();
+    else
+        memmon_print();
+}
+
+void memmon_init(uint32_t buf_bytes)
+{
+    draw_buf_bytes = buf_bytes;
+    lv_timer_create(memmon_timer_cb, MEMMON_PERIOD_MS, NULL);
+    console_add("mem", mem_cmd, "heap, LVGL pool, task stacks, draw buffers; 'mem pool': lv_pool size profile");
+    memmon_check();
+}
@@ -0,0 +1,48 @@
+#ifndef MEMMON_H
+#define MEMMON_H
+
+#include <stdint.h>
+
+// Thresholds: going below (or above, for fragmentation) sets a MEMMON_WARN_*
+// bit in FP_STAT_MEM_WARN, readable by the master in REG_STATS
+#ifndef MEMMON_HEAP_WARN
+#define MEMMON_HEAP_WARN 16384      // free internal heap, bytes
+#endif
+#ifndef MEMMON_DMA_WARN
+#define MEMMON_DMA_WARN 8192        // largest free DMA-capable block, bytes
+#endif
+#ifndef MEMMON_LV_FREE_WARN
+#define MEMMON_LV_FREE_WARN 4096    // free LVGL pool, bytes
+#endif
+#ifndef MEMMON_LV_FRAG_WARN
+#define MEMMON_LV_FRAG_WARN 50      // LVGL pool fragmentation, %
+#endif
+#ifndef MEMMON_STACK_WARN
+#define MEMMON_STACK_WARN 512       // stack never used by a watched task, bytes
+#endif
+#ifndef MEMMON_PERIOD_MS
+#define MEMMON_PERIOD_MS 1000
+#endif
+
+#define MEMMON_WARN_HEAP     0x01
+#define MEMMON_WARN_DMA      0x02
+#define MEMMON_WARN_LV_FREE  0x04
+#define MEMMON_WARN_LV_FRAG  0x08
+#define MEMMON_WARN_STACK    0x10
+
+// Start the periodic check (an LVGL timer) and the "mem" console command.
+// `draw_buf_bytes` is the LVGL draw buffer allocated in setup().
+void memmon_init(uint32_t draw_buf_bytes);
+
+// Run the checks now; returns the MEMMON_WARN_* bits
+uint32_t memmon_check();
+
+// Bytes of LVGL memory in use: lv_pool blocks, the LVGL pool, or the internal
+// heap when LV_MEM_CUSTOM puts LVGL on it. A difference of two calls is what
+// a piece of UI costs.
+uint32_t memmon_lv_used();
+
+// Full report on Serial: heaps, LVGL pool, task stacks, draw buffer options
+void memmon_print();
+
+#endif
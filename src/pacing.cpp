@@ -0,0 +1,100 @@
+/*******************************************************************************
+ * Loop pacing: sleep exactly until the next LVGL timer is due, or until an
+ * I2C access / touch interrupt needs the loop, instead of a fixed delay(5).
+ *
+ * Build with -DPACING_FIXED_DELAY_MS=5 to get the old loop back with the same
+ * counters, and -DPACING_STATS to print them every PACING_STATS_PERIOD_MS.
+ ******************************************************************************/
+#include <Arduino.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "pacing.h"
+
+#ifndef PACING_STATS_PERIOD_MS
+#define PACING_STATS_PERIOD_MS 10000
+#endif
+
+pacing_stats_t pacing_stats;
+
+static SemaphoreHandle_t wake_sem = NULL;
+static portMUX_TYPE wake_mux = portMUX_INITIALIZER_UNLOCKED;
+static volatile uint32_t wake_reasons = 0;
+static volatile uint32_t wake_t0 = 0;     // micros() of the oldest pending wake
+static uint32_t awake_since = 0;
+static uint32_t stats_since = 0;
+
+void pacing_init()
+{
+    wake_sem = xSemaphoreCreateBinary();
+    awake_since = stats_since = micros();
+}
+
+void pacing_wake(uint32_t reason)
+{
+    portENTER_CRITICAL(&wake_mux);
+    if (wake_reasons == 0) wake_t0 = micros();
+    wake_reasons |= reason;
+    portEXIT_CRITICAL(&wake_mux);
+    xSemaphoreGive(wake_sem);
+}
+
+void IRAM_ATTR pacing_wake_isr(uint32_t reason)
+{
+    BaseType_t woken = pdFALSE;
+    portENTER_CRITICAL_ISR(&wake_mux);
+    if (wake_reasons == 0) wake_t0 = micros();
+    wake_reasons |= reason;
+    portEXIT_CRITICAL_ISR(&wake_mux);
+    xSemaphoreGiveFromISR(wake_sem, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+uint32_t pacing_wait(uint32_t ms)
+{
+    pacing_stats.busy_us += micros() - awake_since;
+
+#ifdef PACING_FIXED_DELAY_MS
+    (void)ms;
+    delay(PACING_FIXED_DELAY_MS);
+#else
+    if (ms > PACING_MAX_SLEEP_MS) ms = PACING_MAX_SLEEP_MS;  // also LV_NO_TIMER_READY
+    // +1 tick: a take of n ticks can return up to a tick early, which would
+    // find no timer ready and cost an extra wakeup
+    if (ms > 0) xSemaphoreTake(wake_sem, pdMS_TO_TICKS(ms) + 1);
+#endif
+
+    portENTER_CRITICAL(&wake_mux);
+    uint32_t why = wake_reasons;
+    uint32_t t0 = wake_t0;
+    wake_reasons = 0;
+    portEXIT_CRITICAL(&wake_mux);
+
+    awake_since = micros();
+    pacing_stats.wakeups++;
+    if (why) {
+        uint32_t lat = awake_since - t0;
+        if (lat > pacing_stats.wake_latency_max_us) pacing_stats.wake_latency_max_us = lat;
+        if (why & PACING_WAKE_I2C) pacing_stats.i2c_wakes++;
+        if (why & PACING_WAKE_TOUCH) pacing_stats.touch_wakes++;
+    }
+
+#ifdef PACING_STATS
+    if (awake_since - stats_since >= PACING_STATS_PERIOD_MS * 1000UL) pacing_print_stats();
+#endif
+    return why;
+}
+
+void pacing_print_stats()
+{
+    uint32_t now = micros();
+    float s = (now - stats_since) / 1e6f;
+    if (s <= 0) return;
+    Serial.printf("Loop: %.1f wakeups/s (i2c %lu, touch %lu), busy %.1f%%, max wake latency %lu us\n",
+                  pacing_stats.wakeups / s,
+                  (unsigned long)pacing_stats.i2c_wakes, (unsigned long)pacing_stats.touch_wakes,
+                  pacing_stats.busy_us / (s * 1e4f),
+                  (unsigned long)pacing_stats.wake_latency_max_us);
+    memset(&pacing_stats, 0, sizeof(pacing_stats));
+    stats_since = now;
+}
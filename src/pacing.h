@@ -0,0 +1,39 @@
+#ifndef PACING_H
+#define PACING_H
+
+#include <stdint.h>
+
+// Upper bound on one sleep, also used when LVGL has no timer pending
+#ifndef PACING_MAX_SLEEP_MS
+#define PACING_MAX_SLEEP_MS 1000
+#endif
+
+// Wake reasons, returned by pacing_wait()
+#define PACING_WAKE_I2C   0x01  // master accessed the front panel registers
+#define PACING_WAKE_TOUCH 0x02  // touch controller INT (only if TOUCH_WAKE_PIN is wired), injected touch
+#define PACING_WAKE_CONSOLE 0x04  // the console task handed a line to the loop
+
+typedef struct {
+    uint32_t wakeups;              // loop iterations
+    uint32_t i2c_wakes;            // wakeups with PACING_WAKE_I2C pending
+    uint32_t touch_wakes;          // wakeups with PACING_WAKE_TOUCH pending
+    uint32_t wake_latency_max_us;  // event signalled -> loop running again
+    uint32_t busy_us;              // time spent outside pacing_wait()
+} pacing_stats_t;
+
+extern pacing_stats_t pacing_stats;
+
+void pacing_init();
+
+// Wake the loop early; pacing_wake() from tasks (Wire1 callbacks), the _isr one from GPIO interrupts
+void pacing_wake(uint32_t reason);
+void pacing_wake_isr(uint32_t reason);
+
+// Sleep up to `ms` (the lv_timer_handler() return value) or until woken.
+// Returns the PACING_WAKE_* reasons that ended the sleep, 0 on timeout.
+uint32_t pacing_wait(uint32_t ms);
+
+// Print the counters as rates over the time since the last call, then reset them
+void pacing_print_stats();
+
+#endif
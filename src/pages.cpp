@@ -0,0 +1,213 @@
+/*******************************************************************************
+ * Button pages: lazily built, cached LVGL screens
+ *
+ * Each page is an LVGL screen of its own. The first visit builds it (timed,
+ * and its LVGL memory measured with memmon_lv_used()); later visits only
+ * lv_scr_load() it, which costs one full-screen render and flush and no
+ * allocation. The built pages may hold PAGES_CACHE_BYTES together: before a
+ * build that would not fit, the least recently shown pages are deleted. The
+ * cost of a page not built yet is taken as the largest cost measured so far
+ * (page 0 is measured at boot).
+ *
+ * A switch is timed from the request (swipe or REG_PAGE write seen by the
+ * loop) to the end of the refresh that puts the page on the panel, so it
+ * includes the build on a cold visit. The last one is REG_STATS page_us; the
+ * "page" console command prints the table.
+ *
+ * Cached pages are not snapshots: with no PSRAM on this board a 150 KB
+ * full-screen bitmap per page does not fit next to the draw buffer, while a
+ * page of LVGL objects is a few KB and redraws the same.
+ ******************************************************************************/
+#include <Arduino.h>
+#include <stdlib.h>
+
+#include "pages.h"
+#include "fp_proto.h"
+#include "memmon.h"
+#include "venc.h"
+#include "console.h"
+
+typedef struct {
+    lv_obj_t * scr;       // NULL: not built, or evicted
+    uint32_t bytes;       // LVGL memory measured at the last build
+    uint32_t build_us;
+    uint32_t builds;
+    uint32_t shown_at;    // switch count when last shown, for the LRU
+} page_t;
+
+typedef struct {
+    uint32_t switches;
+    uint32_t evictions;
+    uint32_t warm_last_us, warm_max_us;   // page was cached
+    uint32_t cold_last_us, cold_max_us;   // page was built by the switch
+} pages_stats_t;
+
+static page_t pages[PAGES_MAX];
+static pages_stats_t stats;
+static int count = 1;
+static int current = 0;
+static bool ready = false;
+static uint32_t boot_used;
+static pages_build_cb_t build_cb;
+static pages_leave_cb_t leave_cb;
+
+static bool switch_pending = false;
+static bool switch_cold;
+static uint32_t switch_t0;
+
+static uint32_t cached_bytes()
+{
+    uint32_t sum = 0;
+    for (int i = 0; i < count; i++)
+        if (pages[i].scr) sum += pages[i].bytes;
+    return sum;
+}
+
+static uint32_t page_estimate()
+{
+    uint32_t est = 0;
+    for (int i = 0; i < count; i++)
+        if (pages[i].bytes > est) est = pages[i].bytes;
+    return est;
+}
+
+static bool evict_lru()
+{
+    int lru = -1;
+    for (int i = 0; i < count; i++)
+        if (pages[i].scr && i != current && (lru < 0 || pages[i].shown_at < pages[lru].shown_at))
+            lru = i;
+    if (lru < 0) return false;
+    lv_obj_del(pages[lru].scr);
+    pages[lru].scr = NULL;
+    stats.evictions++;
+    Serial.printf("Page %d evicted (%lu bytes)\n", lru, (unsigned long)pages[lru].bytes);
+    return true;
+}
+
+static void gesture_cb(lv_event_t * e)
+{
+    if (venc_active()) return;
+    lv_dir_t dir = lv_indev_get_gesture_dir(lv_indev_get_act());
+    if (dir == LV_DIR_LEFT)
+        pages_show((current + 1) % count, true);
+    else if (dir == LV_DIR_RIGHT)
+        pages_show((current + count - 1) % count, true);
+}
+
+// Swipes reach the screen through the buttons (LV_OBJ_FLAG_GESTURE_BUBBLE is
+// on by default); a scrollable screen would take the drag as a scroll first
+static void setup_screen(lv_obj_t * scr)
+{
+    lv_obj_clear_flag(scr, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_event_cb(scr, gesture_cb, LV_EVENT_GESTURE, NULL);
+}
+
+static void build(int page)
+{
+    uint32_t need = page_estimate();
+    while (cached_bytes() + need > PAGES_CACHE_BYTES && evict_lru()) {}
+
+    uint32_t t0 = micros();
+    uint32_t before = memmon_lv_used();
+    lv_obj_t * scr = lv_obj_create(NULL);
+    setup_screen(scr);
+    build_cb(page, scr);
+    uint32_t after = memmon_lv_used();
+    pages[page].scr = scr;
+    pages[page].bytes = after > before ? after - before : 0;
+    pages[page].build_us = micros() - t0;
+    pages[page].builds++;
+}
+
+static void page_cmd(const char * args)
+{
+    if (*args) {
+        if (!pages_show(atoi(args), true)) Serial.println("No such page");
+        return;
+    }
+    Serial.printf("Page %d of %d; cache %lu of %u bytes; %lu switches, %lu evictions\n",
+                  current, count, (unsigned long)cached_bytes(), PAGES_CACHE_BYTES,
+                  (unsigned long)stats.switches, (unsigned long)stats.evictions);
+    Serial.println("  page  cached   bytes  build_us  builds");
+    for (int i = 0; i < count; i++)
+        Serial.printf("  %4d  %6s  %6lu  %8lu  %6lu\n", i, pages[i].scr ? "yes" : "-",
+                      (unsigned long)pages[i].bytes, (unsigned long)pages[i].build_us,
+                      (unsigned long)pages[i].builds);
+    Serial.printf("  switch to a cached page: last %lu us, max %lu us\n",
+                  (unsigned long)stats.warm_last_us, (unsigned long)stats.warm_max_us);
+    Serial.printf("  switch with a build:     last %lu us, max %lu us\n",
+                  (unsigned long)stats.cold_last_us, (unsigned long)stats.cold_max_us);
+}
+
+void pages_init(int n, pages_build_cb_t build, pages_leave_cb_t leave)
+{
+    count = n < 1 ? 1 : n > PAGES_MAX ? PAGES_MAX : n;
+    build_cb = build;
+    leave_cb = leave;
+    pages[0].scr = lv_scr_act();
+    setup_screen(pages[0].scr);
+    boot_used = memmon_lv_used();
+    fp_set_page(0, count, false);
+    console_add("page", page_cmd, "button pages: [n] shows page n");
+}
+
+void pages_boot_built()
+{
+    uint32_t used = memmon_lv_used();
+    pages[0].bytes = used > boot_used ? used - boot_used : 0;
+    pages[0].builds = 1;
+    ready = true;
+}
+
+bool pages_show(int page, bool by_user)
+{
+    if (!ready || page < 0 || page >= count) return false;
+    if (page == current) return true;
+
+    uint32_t t0 = micros();
+    if (leave_cb) leave_cb(current);
+    bool cold = !pages[page].scr;
+    if (cold) build(page);
+    lv_scr_load(pages[page].scr);
+    current = page;
+    pages[page].shown_at = ++stats.switches;
+    fp_set_page(page, count, by_user);
+
+    switch_pending = true;
+    switch_cold = cold;
+    switch_t0 = t0;
+    // Render now rather than at the next refresh period
+    lv_timer_ready(_lv_disp_get_refr_timer(lv_disp_get_default()));
+    return true;
+}
+
+int pages_current()
+{
+    return current;
+}
+
+void pages_poll()
+{
+    if (!ready) return;
+    int page = fp_page_request();
+    if (page >= 0 && !pages_show(page, false))
+        Serial.printf("Master selected page %d, there are %d\n", page, count);
+}
+
+void pages_frame()
+{
+    if (!switch_pending) return;
+    switch_pending = false;
+    uint32_t us = micros() - switch_t0;
+    if (switch_cold) {
+        stats.cold_last_us = us;
+        if (us > stats.cold_max_us) stats.cold_max_us = us;
+    } else {
+        stats.warm_last_us = us;
+        if (us > stats.warm_max_us) stats.warm_max_us = us;
+    }
+    fp_stat_set(FP_STAT_PAGE_US, us);
+    Serial.printf("Page %d on screen in %lu us (%s)\n", current, (unsigned long)us,
+                  switch_cold ? "built" : "cached");
+}
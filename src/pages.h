@@ -0,0 +1,44 @@
+#ifndef PAGES_H
+#define PAGES_H
+
+#include <lvgl.h>
+
+// Button pages. Page 0 is the grid the boot builds; every other page is built
+// on its first visit as its own LVGL screen and kept, so showing it again is
+// a screen load and one redraw, with no object created. Pages are changed by
+// a horizontal swipe on the panel or by the master through REG_PAGE.
+
+#ifndef PAGES_MAX
+#define PAGES_MAX 8
+#endif
+// LVGL memory the built pages may hold together (the shown page included).
+// Building a page that would not fit first deletes the least recently shown
+// ones; they are built again on their next visit.
+#ifndef PAGES_CACHE_BYTES
+#define PAGES_CACHE_BYTES 24576
+#endif
+
+// Fill `scr` with the buttons of `page`
+typedef void (*pages_build_cb_t)(int page, lv_obj_t * scr);
+// The shown page is about to change (cancel a press on it)
+typedef void (*pages_leave_cb_t)(int page);
+
+// Before the boot builds page 0 on the active screen, so its cost is measured
+void pages_init(int count, pages_build_cb_t build, pages_leave_cb_t leave);
+
+// Page 0 is complete: page changes are accepted from now on
+void pages_boot_built();
+
+// Show a page (UI task). `by_user`: changed on the panel, the master gets
+// INT_PAGE. False for a page that does not exist or before the boot is done.
+bool pages_show(int page, bool by_user);
+
+int pages_current();
+
+// From the loop: show the page the master selected in REG_PAGE, if any
+void pages_poll();
+
+// End of each LVGL refresh (monitor_cb): times the page switch it completes
+void pages_frame();
+
+#endif
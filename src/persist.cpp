@@ -0,0 +1,122 @@
+/*******************************************************************************
+ * Toggle state in NVS
+ *
+ * All toggle buttons, on every page, live in one uint64 bitmap stored under
+ * one key, so a save is one NVS entry whatever changed. A panel saved by an
+ * older firmware has page 0 in the uint32 key PERSIST_KEY_V1, read when the
+ * new key is not there yet. Changes only update the pending
+ * bitmap; a PERSIST_POLL_MS LVGL timer writes it once the user has stopped
+ * for PERSIST_DELAY_MS, at most once per PERSIST_MIN_INTERVAL_MS, and not at
+ * all when it went back to the stored value (a double toggle). A burst of
+ * taps costs one write; the state is on flash at most DELAY + MIN_INTERVAL
+ * after the user stops, which is what a power cut can lose.
+ * tools/persist_sim.py runs the same policy over a heavy-use trace and
+ * reports the writes per hour.
+ *
+ * persist_load() is a single read of an already initialised NVS (the
+ * Arduino core runs nvs_flash_init() before setup()), well under a
+ * millisecond, so the splash can show the restored state right away.
+ ******************************************************************************/
+#include <Arduino.h>
+#include <Preferences.h>
+#include <lvgl.h>
+
+#include "persist.h"
+#include "console.h"
+
+#define PERSIST_NAMESPACE "panel"
+#define PERSIST_KEY       "toggles64"
+#define PERSIST_KEY_V1    "toggles"
+
+static Preferences prefs;
+static persist_stats_t stats;
+static uint64_t stored = 0;       // bitmap in NVS
+static uint64_t pending = 0;      // bitmap to write
+static uint32_t last_change = 0;  // millis() of the last persist_set()
+static uint32_t last_write = 0;
+static bool dirty = false;
+static bool written = false;      // no write yet since boot: no rate cap
+
+uint64_t persist_load()
+{
+    uint32_t t0 = micros();
+    if (prefs.begin(PERSIST_NAMESPACE, true)) {
+        if (prefs.isKey(PERSIST_KEY))
+            stored = prefs.getULong64(PERSIST_KEY, 0);
+        else
+            stored = prefs.getUInt(PERSIST_KEY_V1, 0);
+        prefs.end();
+    }
+    pending = stored;
+    Serial.printf("Persist: toggles 0x%llx restored in %u us\n", (unsigned long long)stored, (unsigned)(micros() - t0));
+    return stored;
+}
+
+static void write_pending()
+{
+    uint32_t t0 = micros();
+    if (!prefs.begin(PERSIST_NAMESPACE, false)) {
+        Serial.println("Persist: NVS open failed");
+        return;
+    }
+    size_t ok = prefs.putULong64(PERSIST_KEY, pending);
+    prefs.end();
+    if (!ok) {
+        Serial.println("Persist: NVS write failed");
+        return;
+    }
+    stored = pending;
+    dirty = false;
+    written = true;
+    last_write = millis();
+    stats.writes++;
+    Serial.printf("Persist: toggles 0x%llx saved in %u us (%lu writes, %lu changes)\n",
+                  (unsigned long long)stored, (unsigned)(micros() - t0), (unsigned long)stats.writes,
+                  (unsigned long)stats.changes);
+}
+
+static void persist_timer_cb(lv_timer_t * t)
+{
+    if (!dirty) return;
+    uint32_t now = millis();
+    if (now - last_change < PERSIST_DELAY_MS) return;
+    if (written && now - last_write < PERSIST_MIN_INTERVAL_MS) return;
+    write_pending();
+}
+
+void persist_set(uint64_t bitmap)
+{
+    if (bitmap == pending) return;
+    pending = bitmap;
+    last_change = millis();
+    stats.changes++;
+    if (dirty && pending == stored) stats.skipped++;
+    dirty = pending != stored;
+}
+
+void persist_flush()
+{
+    if (dirty) write_pending();
+}
+
+static void persist_cmd(const char * args)
+{
+    if (strcmp(args, "save") == 0) {
+        persist_flush();
+        return;
+    }
+    float hours = millis() / 3600000.0f;
+    Serial.printf("Toggles: stored 0x%llx, pending 0x%llx%s\n",
+                  (unsigned long long)stored, (unsigned long long)pending, dirty ? " (dirty)" : "");
+    Serial.printf("  %lu changes, %lu NVS writes, %lu reverted before a write; %.1f writes/h\n",
+                  (unsigned long)stats.changes, (unsigned long)stats.writes, (unsigned long)stats.skipped,
+                  stats.writes / hours);
+    Serial.printf("  policy: %lu ms quiet, %lu ms between writes\n",
+                  (unsigned long)PERSIST_DELAY_MS, (unsigned long)PERSIST_MIN_INTERVAL_MS);
+}
+
+void persist_init()
+{
+    lv_timer_create(persist_timer_cb, PERSIST_POLL_MS, NULL);
+    console_add("persist", persist_cmd, "toggle state in NVS: [save]");
+}
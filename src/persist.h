@@ -0,0 +1,40 @@
+#ifndef PERSIST_H
+#define PERSIST_H
+
+#include <stdint.h>
+
+// Write policy for the toggle bitmap (tools/persist_sim.py reads these):
+// a change is written once there were no further changes for DELAY, and
+// never sooner than MIN_INTERVAL after the previous write. A bitmap equal to
+// the stored one is not written at all.
+#ifndef PERSIST_DELAY_MS
+#define PERSIST_DELAY_MS 5000
+#endif
+#ifndef PERSIST_MIN_INTERVAL_MS
+#define PERSIST_MIN_INTERVAL_MS 30000
+#endif
+#ifndef PERSIST_POLL_MS
+#define PERSIST_POLL_MS 1000
+#endif
+
+typedef struct {
+    uint32_t changes;   // persist_set() calls that changed the pending bitmap
+    uint32_t writes;    // NVS writes
+    uint32_t skipped;   // pending bitmap went back to the stored one: no write
+} persist_stats_t;
+
+// Read the stored bitmap (bit i = toggle button i checked, buttons of all
+// pages), 0 if none.
+// One NVS read, call early in setup().
+uint64_t persist_load();
+
+// Start the write timer and the "persist" console command (after lv_init)
+void persist_init();
+
+// New toggle bitmap; written later according to the policy above
+void persist_set(uint64_t bitmap);
+
+// Write a pending change now, ignoring the delays
+void persist_flush();
+
+#endif
@@ -0,0 +1,159 @@
+/*******************************************************************************
+ * Idle power state.
+ *
+ * ACTIVE -> IDLE after POWER_IDLE_AFTER_MS without activity: CPU clock down to
+ * POWER_IDLE_CPU_MHZ, backlight to POWER_BL_IDLE, display refresh timer paused
+ * and the touch poll slowed to POWER_IDLE_POLL_MS.
+ * IDLE -> ACTIVE as soon as LVGL sees activity: a touch press (the indev read
+ * stamps it) or lv_disp_trig_activity() from the loop on an I2C wake. The
+ * press that wakes the panel is processed normally, not swallowed.
+ *
+ * The clock is lowered by releasing an ESP_PM_CPU_FREQ_MAX lock when power
+ * management is enabled (CONFIG_PM_ENABLE), else with setCpuFrequencyMhz().
+ * Build with -DPOWER_STATS to print the counters every POWER_STATS_PERIOD_MS.
+ ******************************************************************************/
+#include <Arduino.h>
+#include <string.h>
+#include "power.h"
+
+#if CONFIG_PM_ENABLE
+#include "esp_pm.h"
+#endif
+
+#ifndef POWER_STATS_PERIOD_MS
+#define POWER_STATS_PERIOD_MS 60000
+#endif
+
+power_stats_t power_stats;
+
+static int bl_pin = -1;
+static bool idle = false;
+static lv_timer_t * refr_timer = NULL;
+static lv_timer_t * touch_timer = NULL;
+static uint32_t touch_period = 0;
+static uint32_t state_since = 0;    // millis() of the last residency update
+static uint32_t idle_since = 0;     // millis() when idle was entered
+static uint32_t stats_since = 0;
+#if CONFIG_PM_ENABLE
+static esp_pm_lock_handle_t cpu_lock = NULL;
+#else
+static uint32_t active_mhz = 240;
+#endif
+
+void power_backlight_init(int pin)
+{
+    bl_pin = pin;
+    ledcAttach(bl_pin, POWER_BL_FREQ, 8);
+    ledcWrite(bl_pin, POWER_BL_ACTIVE);
+}
+
+void power_init(lv_timer_t * touch_read_timer)
+{
+    refr_timer = _lv_disp_get_refr_timer(lv_disp_get_default());
+    touch_timer = touch_read_timer;
+    touch_period = touch_timer ? touch_timer->period : 0;
+
+#if CONFIG_PM_ENABLE
+    esp_pm_config_t cfg = {
+        .max_freq_mhz = (int)getCpuFrequencyMhz(),
+        .min_freq_mhz = POWER_IDLE_CPU_MHZ,
+        .light_sleep_enable = false,
+    };
+    if (esp_pm_configure(&cfg) == ESP_OK &&
+        esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "ui", &cpu_lock) == ESP_OK) {
+        esp_pm_lock_acquire(cpu_lock);
+    } else {
+        Serial.println("Power: esp_pm unavailable, CPU clock stays up");
+    }
+#else
+    active_mhz = getCpuFrequencyMhz();
+#endif
+    state_since = stats_since = millis();
+    Serial.printf("Power: idle after %d ms at %d MHz, backlight %d -> %d\n",
+                  POWER_IDLE_AFTER_MS, POWER_IDLE_CPU_MHZ, POWER_BL_ACTIVE, POWER_BL_IDLE);
+}
+
+static void account(uint32_t now)
+{
+    if (idle) power_stats.idle_ms += now - state_since;
+    else power_stats.active_ms += now - state_since;
+    state_since = now;
+}
+
+static void enter_idle()
+{
+    idle_since = millis();
+    account(idle_since);
+    idle = true;
+    power_stats.idle_entries++;
+
+    if (refr_timer) lv_timer_pause(refr_timer);
+    if (touch_timer) lv_timer_set_period(touch_timer, POWER_IDLE_POLL_MS);
+    if (bl_pin >= 0) ledcWrite(bl_pin, POWER_BL_IDLE);
+#if CONFIG_PM_ENABLE
+    if (cpu_lock) esp_pm_lock_release(cpu_lock);
+#else
+    setCpuFrequencyMhz(POWER_IDLE_CPU_MHZ);
+#endif
+}
+
+static void leave_idle()
+{
+    uint32_t t0 = micros();
+#if CONFIG_PM_ENABLE
+    if (cpu_lock) esp_pm_lock_acquire(cpu_lock);
+#else
+    setCpuFrequencyMhz(active_mhz);
+#endif
+    if (bl_pin >= 0) ledcWrite(bl_pin, POWER_BL_ACTIVE);
+    if (touch_timer) lv_timer_set_period(touch_timer, touch_period);
+    if (refr_timer) {
+        // Redraw now, with the touch read back in phase with the refresh
+        lv_timer_resume(refr_timer);
+        lv_timer_ready(refr_timer);
+        if (touch_timer) touch_timer->last_run = refr_timer->last_run;
+    }
+    uint32_t restore_us = micros() - t0;
+    if (restore_us > power_stats.wake_restore_max_us) power_stats.wake_restore_max_us = restore_us;
+
+    account(millis());
+    idle = false;
+}
+
+bool power_update()
+{
+    uint32_t inactive = lv_disp_get_inactive_time(NULL);
+    bool woke = false;
+
+    if (!idle && inactive >= POWER_IDLE_AFTER_MS) {
+        enter_idle();
+    } else if (idle && inactive < millis() - idle_since) {
+        // Activity since we went idle; inactive = time since that activity
+        if (inactive > power_stats.wake_detect_max_ms) power_stats.wake_detect_max_ms = inactive;
+        leave_idle();
+        woke = true;
+    }
+
+#ifdef POWER_STATS
+    if (millis() - stats_since >= POWER_STATS_PERIOD_MS) power_print_stats();
+#endif
+    return woke;
+}
+
+bool power_is_idle()
+{
+    return idle;
+}
+
+void power_print_stats()
+{
+    uint32_t now = millis();
+    account(now);
+    uint32_t total = power_stats.active_ms + power_stats.idle_ms;
+    Serial.printf("Power: idle %.1f%% of %lu s, %lu idle entries, wake detect max %lu ms, restore max %lu us\n",
+                  total ? power_stats.idle_ms * 100.0f / total : 0.0f, (unsigned long)(total / 1000),
+                  (unsigned long)power_stats.idle_entries, (unsigned long)power_stats.wake_detect_max_ms,
+                  (unsigned long)power_stats.wake_restore_max_us);
+    memset(&power_stats, 0, sizeof(power_stats));
+    stats_since = now;
+}
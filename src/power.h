@@ -0,0 +1,54 @@
+#ifndef POWER_H
+#define POWER_H
+
+#include <lvgl.h>
+
+// Inactivity (no touch, no I2C access other than polls) before going idle
+#ifndef POWER_IDLE_AFTER_MS
+#define POWER_IDLE_AFTER_MS 30000
+#endif
+// CPU clock while idle; 80 keeps APB at 80 MHz so I2C/SPI timing is unchanged
+#ifndef POWER_IDLE_CPU_MHZ
+#define POWER_IDLE_CPU_MHZ 80
+#endif
+// Backlight duty (8 bit) active / idle, LEDC frequency
+#ifndef POWER_BL_ACTIVE
+#define POWER_BL_ACTIVE 100
+#endif
+#ifndef POWER_BL_IDLE
+#define POWER_BL_IDLE 10
+#endif
+#ifndef POWER_BL_FREQ
+#define POWER_BL_FREQ 1000
+#endif
+// Touch poll period while idle: the worst-case touch detection delay
+#ifndef POWER_IDLE_POLL_MS
+#define POWER_IDLE_POLL_MS 50
+#endif
+
+typedef struct {
+    uint32_t active_ms;           // residency
+    uint32_t idle_ms;
+    uint32_t idle_entries;
+    uint32_t wake_detect_max_ms;  // activity -> noticed by power_update()
+    uint32_t wake_restore_max_us; // clock, backlight and refresh back on
+} power_stats_t;
+
+extern power_stats_t power_stats;
+
+// Backlight on LEDC at POWER_BL_ACTIVE; call where the display is brought up
+void power_backlight_init(int pin);
+
+// Call once the LVGL display and touch input are registered
+void power_init(lv_timer_t * touch_read_timer);
+
+// Enter or leave the idle state; call every loop pass after lv_timer_handler().
+// Returns true when it just woke up, so the loop should run LVGL again at once.
+bool power_update();
+
+bool power_is_idle();
+
+// Print residency and wake latency since the last call, then reset them
+void power_print_stats();
+
+#endif
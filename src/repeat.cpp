@@ -0,0 +1,64 @@
+/*******************************************************************************
+ * Auto-repeat for held momentary buttons
+ *
+ * A REPEAT_TICK_MS LVGL timer runs only while a repeating button is held.
+ * Each tick counts the repeats that fell due since the previous one and
+ * hands them to fp_report_repeat(), which keeps at most one repeat event in
+ * the master's queue: a master polling every 20 ms during a fast repeat
+ * reads one event carrying a count, not one event per repeat. Nothing is
+ * redrawn per repeat; the button stays in its pressed colour for the hold.
+ ******************************************************************************/
+#include <lvgl.h>
+
+#include "repeat.h"
+#include "fp_proto.h"
+
+static lv_timer_t * timer = NULL;
+static int button = -1;
+static uint32_t pressed_ms;
+static uint32_t next_ms;        // next repeat due, ms after the press
+static uint32_t repeats;
+
+bool repeat_enabled(int b)
+{
+    return b >= 0 && b < 32 && ((REPEAT_MASK >> b) & 1);
+}
+
+uint32_t repeat_interval_ms(uint32_t held_ms)
+{
+    if (held_ms < REPEAT_DELAY_MS) return 0;
+    uint32_t t = held_ms - REPEAT_DELAY_MS;
+    if (t >= REPEAT_RAMP_MS) return REPEAT_FAST_MS;
+    return REPEAT_SLOW_MS - (REPEAT_SLOW_MS - REPEAT_FAST_MS) * t / REPEAT_RAMP_MS;
+}
+
+static void repeat_timer_cb(lv_timer_t * t)
+{
+    uint32_t held = lv_tick_elaps(pressed_ms);
+    uint32_t n = 0;
+    while (held >= next_ms) {
+        n++;
+        next_ms += repeat_interval_ms(next_ms);
+    }
+    repeats += n;
+    fp_report_repeat(button, n > 0xFFFF ? 0xFFFF : n);
+}
+
+void repeat_start(int b)
+{
+    repeat_stop();
+    button = b;
+    pressed_ms = lv_tick_get();
+    next_ms = REPEAT_DELAY_MS;
+    repeats = 0;
+    timer = lv_timer_create(repeat_timer_cb, REPEAT_TICK_MS, NULL);
+}
+
+uint32_t repeat_stop()
+{
+    if (!timer) return 0;
+    lv_timer_del(timer);
+    timer = NULL;
+    button = -1;
+    return repeats;
+}
@@ -0,0 +1,43 @@
+#ifndef REPEAT_H
+#define REPEAT_H
+
+#include <stdint.h>
+
+// Hold-to-repeat for momentary buttons: after REPEAT_DELAY_MS the held
+// button repeats every REPEAT_SLOW_MS, speeding up to every REPEAT_FAST_MS
+// over REPEAT_RAMP_MS. Repeats reach the master coalesced, as FP_STATE_REPEAT
+// events with a count (fp_report_repeat()).
+
+// Buttons that repeat (bit i = button i). Default: Band- and F Tun Inc.
+#ifndef REPEAT_MASK
+#define REPEAT_MASK ((1u << 5) | (1u << 11))
+#endif
+#ifndef REPEAT_DELAY_MS
+#define REPEAT_DELAY_MS 500
+#endif
+#ifndef REPEAT_SLOW_MS
+#define REPEAT_SLOW_MS 200
+#endif
+#ifndef REPEAT_FAST_MS
+#define REPEAT_FAST_MS 40
+#endif
+#ifndef REPEAT_RAMP_MS
+#define REPEAT_RAMP_MS 2000
+#endif
+// Timer period while a button is held
+#ifndef REPEAT_TICK_MS
+#define REPEAT_TICK_MS 20
+#endif
+
+bool repeat_enabled(int button);
+
+// Repeat interval `held_ms` after the press (0 before the first repeat)
+uint32_t repeat_interval_ms(uint32_t held_ms);
+
+// Press on a repeating button: starts the timer
+void repeat_start(int button);
+
+// Release or press lost: stops the timer, returns the repeats of this hold
+uint32_t repeat_stop();
+
+#endif
@@ -0,0 +1,286 @@
+/*******************************************************************************
+ * Scripted input and state queries on the console (commands in script.h)
+ *
+ * The console task posts one touch at a time: a start point, an end point
+ * and a duration. The LVGL touch read (script_touch() in my_touchpad_read)
+ * plays it: pressed, with the point moved along the line, until the duration
+ * is over, then one release. The task waits for that release and returns,
+ * so a script's taps never overlap. The loop is woken with
+ * PACING_WAKE_TOUCH so the first read is not an indev period late, and the
+ * touch ends idle power mode like a finger does.
+ *
+ * ping times three steps from the command: the touch read that reported the
+ * press, the event reaching fp_proto's queue, and a REG_TOUCH read (or the
+ * serial link) taking it. The last two are seen by the task polling the
+ * queue positions every tick, so they are up to a tick late.
+ ******************************************************************************/
+#include <Arduino.h>
+#include <atomic>
+#include <stdlib.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "script.h"
+#include "console.h"
+#include "fp_proto.h"
+#include "labels.h"
+#include "pacing.h"
+#include "pages.h"
+#include "uart_link.h"
+
+// A posted touch the touch read has not started by then is taken back: the
+// grid is not up yet, or the loop is stuck
+#define SCRIPT_START_TIMEOUT_MS 1000
+#define SCRIPT_PING_MAX 1000
+
+enum { TOUCH_IDLE, TOUCH_POSTED, TOUCH_ON, TOUCH_DONE };
+
+typedef struct {
+    int16_t x0, y0, x1, y1;
+    uint16_t ms;
+} gesture_t;
+
+static int count, width, height;
+static script_button_cb_t info_cb;
+
+static gesture_t gesture;                     // set by the task before TOUCH_POSTED
+static std::atomic<int> touch_state(TOUCH_IDLE);
+static std::atomic<uint32_t> touch_seen_us(0);
+static uint32_t touch_start_ms;               // touch read side
+static int16_t touch_x, touch_y;
+
+// A ping in progress: when the tap's first event got queued and taken
+typedef struct {
+    uint32_t pos;                  // its queue position
+    uint32_t t0_us;                // command
+    uint32_t queued_us, taken_us;  // since t0_us; 0 while not yet
+} ping_t;
+
+static void ping_check(ping_t * p)
+{
+    if (!p) return;
+    uint32_t us = micros() - p->t0_us;
+    if (!p->queued_us && (int32_t)(fp_queue_pushed() - p->pos) > 0) p->queued_us = us;
+    if (!p->taken_us && (int32_t)(fp_queue_taken() - p->pos) > 0) p->taken_us = us;
+}
+
+bool script_touch(lv_indev_data_t * data)
+{
+    int st = touch_state.load(std::memory_order_acquire);
+    if (st == TOUCH_POSTED) {
+        touch_start_ms = millis();
+        touch_seen_us.store(micros(), std::memory_order_relaxed);
+        touch_state.store(TOUCH_ON, std::memory_order_relaxed);
+        st = TOUCH_ON;
+    }
+    if (st != TOUCH_ON) return false;
+
+    uint32_t t = millis() - touch_start_ms;
+    if (t < gesture.ms) {
+        touch_x = gesture.x0 + (int32_t)(gesture.x1 - gesture.x0) * (int32_t)t / gesture.ms;
+        touch_y = gesture.y0 + (int32_t)(gesture.y1 - gesture.y0) * (int32_t)t / gesture.ms;
+        data->state = LV_INDEV_STATE_PR;
+    } else {
+        data->state = LV_INDEV_STATE_REL;
+        touch_state.store(TOUCH_DONE, std::memory_order_release);
+    }
+    data->point.x = touch_x;
+    data->point.y = touch_y;
+    return true;
+}
+
+// Play a touch and wait until it is released, following `ping` meanwhile;
+// false if the touch read never started it
+static bool play(int x0, int y0, int x1, int y1, int ms, ping_t * ping = nullptr)
+{
+    gesture = { (int16_t)x0, (int16_t)y0, (int16_t)x1, (int16_t)y1, (uint16_t)ms };
+    touch_state.store(TOUCH_POSTED, std::memory_order_release);
+    pacing_wake(PACING_WAKE_TOUCH);
+    uint32_t t0 = millis();
+    while (touch_state.load(std::memory_order_acquire) != TOUCH_DONE) {
+        if (millis() - t0 > SCRIPT_START_TIMEOUT_MS) {
+            int expect = TOUCH_POSTED;
+            if (touch_state.compare_exchange_strong(expect, TOUCH_IDLE)) return false;
+        }
+        ping_check(ping);
+        vTaskDelay(1);
+    }
+    touch_state.store(TOUCH_IDLE, std::memory_order_relaxed);
+    return true;
+}
+
+// Up to `max` integers from `args` into `v`; returns how many were given
+static int parse_ints(const char * args, int * v, int max)
+{
+    int n = 0;
+    while (n < max) {
+        char * end;
+        long x = strtol(args, &end, 0);
+        if (end == args) break;
+        v[n++] = (int)x;
+        args = end;
+    }
+    return n;
+}
+
+static bool valid_ms(int ms)
+{
+    if (ms >= 1 && ms <= 10000) return true;
+    Serial.printf("error: %d ms, 1 to 10000\n", ms);
+    return false;
+}
+
+// The button, if it can be tapped now
+static bool tappable(int button, script_button_t * b)
+{
+    if (button < 0 || button >= count) {
+        Serial.printf("error: no button %d, 0 to %d\n", button, count - 1);
+        return false;
+    }
+    info_cb(button, b);
+    if (b->shown) return true;
+    Serial.printf("error: button %d is on page %d, page %d is shown\n", button, b->page, pages_current());
+    return false;
+}
+
+static void tap_cmd(const char * args)
+{
+    int v[2] = { -1, SCRIPT_TAP_MS };
+    script_button_t b;
+    if (parse_ints(args, v, 2) < 1) {
+        Serial.println("error: tap N [ms]");
+        return;
+    }
+    if (!tappable(v[0], &b) || !valid_ms(v[1])) return;
+    if (!play(b.x, b.y, b.x, b.y, v[1])) {
+        Serial.println("error: no touch read, the panel is not up");
+        return;
+    }
+    Serial.printf("ok tap %d (%s) %d ms\n", v[0], labels_text(v[0]), v[1]);
+}
+
+static void touch_cmd(const char * args)
+{
+    int v[5] = { -1, -1, SCRIPT_TAP_MS, -1, -1 };
+    int n = parse_ints(args, v, 5);
+    if (n < 5) {
+        v[3] = v[0];
+        v[4] = v[1];
+    }
+    if (n < 2 || n == 4) {
+        Serial.println("error: touch X Y [ms] [X2 Y2]");
+        return;
+    }
+    for (int i = 0; i < 5; i += 3)
+        if (v[i] < 0 || v[i] >= width || v[i + 1] < 0 || v[i + 1] >= height) {
+            Serial.printf("error: %d,%d is off the %dx%d screen\n", v[i], v[i + 1], width, height);
+            return;
+        }
+    if (!valid_ms(v[2])) return;
+    if (!play(v[0], v[1], v[3], v[4], v[2])) {
+        Serial.println("error: no touch read, the panel is not up");
+        return;
+    }
+    Serial.printf("ok touch %d,%d -> %d,%d %d ms\n", v[0], v[1], v[3], v[4], v[2]);
+}
+
+static void state_cmd(const char * args)
+{
+    int button;
+    if (parse_ints(args, &button, 1) == 1) {
+        script_button_t b;
+        if (button < 0 || button >= count) {
+            Serial.printf("error: no button %d, 0 to %d\n", button, count - 1);
+            return;
+        }
+        info_cb(button, &b);
+        Serial.printf("ok button %d (%s): %s, %s, page %d%s, at %d,%d\n", button, labels_text(button),
+                      b.toggle ? (b.checked ? "toggle checked" : "toggle unchecked") : "momentary",
+                      b.pressed ? "pressed" : "released", b.page, b.shown ? " (shown)" : "", b.x, b.y);
+        return;
+    }
+    int pressed = -1;
+    for (int i = 0; i < count && pressed < 0; i++) {
+        script_button_t b;
+        info_cb(i, &b);
+        if (b.pressed) pressed = i;
+    }
+    uint32_t pushed = fp_queue_pushed(), taken = fp_queue_taken();
+    Serial.printf("panel: page %d, pressed %d, INT 0x%04x, transport %s\n", pages_current(), pressed,
+                  fp_int_pending(), uart_link_active() ? "serial" : "I2C");
+    Serial.printf("ok queue: pushed %lu taken %lu waiting %lu/%d events %lu dropped %lu\n",
+                  (unsigned long)pushed, (unsigned long)taken, (unsigned long)(pushed - taken),
+                  FP_QUEUE_DEPTH, (unsigned long)fp_stat_get(FP_STAT_EVENTS),
+                  (unsigned long)fp_stat_get(FP_STAT_DROPPED));
+}
+
+static void stats_cmd(const char * args)
+{
+    Serial.print("ok stats:");
+    for (int i = 0; i < FP_STAT_COUNT; i++)
+        Serial.printf(" %s=%lu", fp_stat_name((fp_stat_t)i), (unsigned long)fp_stat_get((fp_stat_t)i));
+    Serial.println();
+}
+
+static void ping_cmd(const char * args)
+{
+    int v[2] = { 1, 1 };
+    script_button_t b;
+    parse_ints(args, v, 2);
+    if (!tappable(v[0], &b)) return;
+    if (v[1] < 1 || v[1] > SCRIPT_PING_MAX) {
+        Serial.printf("error: count 1 to %d\n", SCRIPT_PING_MAX);
+        return;
+    }
+    uint32_t n = 0, lost = 0, sum_us = 0, max_us = 0, min_us = UINT32_MAX;
+    for (int i = 0; i < v[1]; i++) {
+        ping_t p = { fp_queue_pushed(), (uint32_t)micros(), 0, 0 };
+        if (!play(b.x, b.y, b.x, b.y, SCRIPT_TAP_MS, &p)) {
+            Serial.println("error: no touch read, the panel is not up");
+            return;
+        }
+        while (!p.taken_us && micros() - p.t0_us < SCRIPT_PING_TIMEOUT_MS * 1000UL) {
+            vTaskDelay(1);
+            ping_check(&p);
+        }
+        uint32_t seen = touch_seen_us.load(std::memory_order_relaxed) - p.t0_us;
+        uint32_t queued = p.queued_us, taken = p.taken_us;
+        if (!queued) {
+            Serial.printf("ping %d: touch %lu us, no event queued\n", v[0], (unsigned long)seen);
+            lost++;
+            continue;
+        }
+        if (!taken) {
+            Serial.printf("ping %d: touch %lu us, queued %lu us, not taken in %d ms (no master polling?)\n",
+                          v[0], (unsigned long)seen, (unsigned long)queued, SCRIPT_PING_TIMEOUT_MS);
+            lost++;
+            continue;
+        }
+        Serial.printf("ping %d: touch %lu us, queued %lu us, taken %lu us\n", v[0],
+                      (unsigned long)seen, (unsigned long)queued, (unsigned long)taken);
+        n++;
+        sum_us += taken;
+        if (taken > max_us) max_us = taken;
+        if (taken < min_us) min_us = taken;
+    }
+    if (!n) {
+        Serial.printf("error: ping %d: no event taken\n", v[0]);
+        return;
+    }
+    Serial.printf("ok ping %d: %lu taken, %lu not, command -> taken min %lu avg %lu max %lu us\n",
+                  v[0], (unsigned long)n, (unsigned long)lost, (unsigned long)min_us,
+                  (unsigned long)(sum_us / n), (unsigned long)max_us);
+}
+
+void script_init(int n, int w, int h, script_button_cb_t info)
+{
+    count = n;
+    width = w;
+    height = h;
+    info_cb = info;
+    console_add_task("tap", tap_cmd, "tap N [ms]: press button N");
+    console_add_task("touch", touch_cmd, "touch X Y [ms] [X2 Y2]: press at X,Y, slide to X2,Y2");
+    console_add_task("state", state_cmd, "[N]: panel and queue state, or button N");
+    console_add_task("stats", stats_cmd, "REG_STATS words");
+    console_add_task("ping", ping_cmd, "ping [N] [count]: tap N, time it to the master's read");
+}
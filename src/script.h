@@ -0,0 +1,49 @@
+#ifndef SCRIPT_H
+#define SCRIPT_H
+
+#include <stdint.h>
+#include <lvgl.h>
+
+// Scripted input and state queries on the console, for tests run from a PC
+// (tools/soak.py) instead of a finger on the glass. Injected touches go
+// through the normal touch read, so LVGL, the button callbacks, the click
+// window and the event queue see exactly what a real touch gives.
+//
+//   tap N [ms]              press button N (centre of its cell) for ms (80)
+//   touch X Y [ms] [X2 Y2]  press at X,Y; with X2 Y2 slide there (encoder)
+//   state [N]               panel, queue and INT state; or button N
+//   stats                   the REG_STATS words, by name
+//   ping [N] [count]        tap N (1) and time it to the master's read
+//
+// The commands run in the console task and return once the touch is over;
+// the last line they print starts with "ok" or "error", for a driver to
+// wait on.
+
+#ifndef SCRIPT_TAP_MS
+#define SCRIPT_TAP_MS 80
+#endif
+// ping: longest wait for a master (or the serial link) to take the event
+#ifndef SCRIPT_PING_TIMEOUT_MS
+#define SCRIPT_PING_TIMEOUT_MS 2000
+#endif
+
+typedef struct {
+    int16_t x, y;        // centre of the cell, screen coordinates
+    uint8_t page;
+    bool shown;          // its page is on screen
+    bool toggle;
+    bool checked;        // toggle state
+    bool pressed;        // held now (by a finger or an injected touch)
+} script_button_t;
+
+typedef void (*script_button_cb_t)(int button, script_button_t * out);
+
+// `count` buttons on a `width` x `height` screen; `info` describes one (read
+// from the console task: plain fields, no LVGL calls)
+void script_init(int count, int width, int height, script_button_cb_t info);
+
+// From the touch read_cb: fills `data` and returns true while an injected
+// touch is on, and the real panel is not read
+bool script_touch(lv_indev_data_t * data);
+
+#endif
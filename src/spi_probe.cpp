@@ -0,0 +1,105 @@
+/*******************************************************************************
+ * Display SPI clock probe (build flag SPI_PROBE)
+ *
+ * At boot, before LVGL, restarts the display bus at each SPI_PROBE_STEPS
+ * frequency and times three patterns:
+ *
+ *   fill_full   gfx->fillScreen(), the same pixel repeated
+ *   blit_full   full screen of draw16bitRGBBitmap() strips, as LVGL flushes
+ *   cell        one 80x53 button cell bitmap, the usual per-press flush
+ *
+ * and prints one SPI_PROBE_CSV_HEADER row per step, MB/s being pixel bytes
+ * over time. blit_full_us is the full-screen refresh time at that clock.
+ *
+ * The panel has no MISO line, so nothing can be read back: each step leaves
+ * a high-contrast pattern labelled with its frequency on screen for
+ * SPI_PROBE_HOLD_MS. The fastest step whose pattern is clean, and whose
+ * MB/s still grew over the previous step, is the one to put in TFT_SPI_HZ.
+ ******************************************************************************/
+#include <Arduino.h>
+#include <Arduino_GFX_Library.h>
+#include "esp_heap_caps.h"
+
+#include "spi_probe.h"
+
+#ifdef SPI_PROBE
+
+#define PROBE_STRIP_H 40
+#define PROBE_CELL_W  80
+#define PROBE_CELL_H  53
+#define PROBE_REPEAT  4
+
+static const int32_t steps[] = { SPI_PROBE_STEPS };
+#define PROBE_STEPS (int)(sizeof(steps) / sizeof(steps[0]))
+
+// Colour bars in the top half, alternating 0x5555 / 0xAAAA pixels (every
+// data bit toggles between neighbours) in the bottom half of the strip
+static void fill_pattern(uint16_t * buf, int w, int h)
+{
+    static const uint16_t bars[] = { 0xF800, 0x07E0, 0x001F, 0xFFFF, 0x0000, 0xFFE0, 0x07FF, 0xF81F };
+    for (int y = 0; y < h; y++)
+        for (int x = 0; x < w; x++)
+            buf[y * w + x] = y < h / 2 ? bars[x * 8 / w] : ((x ^ y) & 1 ? 0x5555 : 0xAAAA);
+}
+
+static float mbps(uint32_t px, uint32_t us)
+{
+    return us ? px * 2.0f / us : 0.0f;
+}
+
+void spi_probe_run(Arduino_GFX * gfx, Arduino_DataBus * bus, int32_t run_hz)
+{
+    int w = gfx->width(), h = gfx->height();
+    uint16_t * strip = (uint16_t *)heap_caps_malloc(w * PROBE_STRIP_H * 2, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!strip) {
+        Serial.println("SPI probe: no memory for the pattern");
+        return;
+    }
+    fill_pattern(strip, w, PROBE_STRIP_H);
+
+    Serial.println("SPI probe start");
+    Serial.println(SPI_PROBE_CSV_HEADER);
+
+    for (int s = 0; s < PROBE_STEPS; s++) {
+        bus->begin(steps[s]);
+
+        uint32_t t0 = micros();
+        for (int r = 0; r < PROBE_REPEAT; r++) gfx->fillScreen(r & 1 ? RGB565_WHITE : RGB565_BLACK);
+        uint32_t fill_us = (micros() - t0) / PROBE_REPEAT;
+
+        t0 = micros();
+        for (int r = 0; r < PROBE_REPEAT; r++)
+            for (int y = 0; y < h; y += PROBE_STRIP_H)
+                gfx->draw16bitRGBBitmap(0, y, strip, w, min(PROBE_STRIP_H, h - y));
+        uint32_t blit_us = (micros() - t0) / PROBE_REPEAT;
+
+        // The strip buffer read as a contiguous 80x53 bitmap
+        t0 = micros();
+        for (int r = 0; r < PROBE_REPEAT; r++)
+            gfx->draw16bitRGBBitmap((r % 3) * PROBE_CELL_W, 0, strip, PROBE_CELL_W, PROBE_CELL_H);
+        uint32_t cell_us = (micros() - t0) / PROBE_REPEAT;
+
+        Serial.printf("%ld,%lu,%.2f,%lu,%.2f,%lu,%.2f\n", (long)steps[s],
+                      (unsigned long)fill_us, mbps(w * h, fill_us),
+                      (unsigned long)blit_us, mbps(w * h, blit_us),
+                      (unsigned long)cell_us, mbps(PROBE_CELL_W * PROBE_CELL_H, cell_us));
+
+        // Pattern left up for the visual check
+        for (int y = 0; y < h; y += PROBE_STRIP_H)
+            gfx->draw16bitRGBBitmap(0, y, strip, w, min(PROBE_STRIP_H, h - y));
+        char text[24];
+        snprintf(text, sizeof(text), "SPI %.1f MHz", steps[s] / 1e6f);
+        gfx->fillRect(0, h / 2 - 12, w, 24, RGB565_BLACK);
+        gfx->setTextColor(RGB565_WHITE);
+        gfx->setCursor(8, h / 2 - 4);
+        gfx->print(text);
+        delay(SPI_PROBE_HOLD_MS);
+    }
+
+    heap_caps_free(strip);
+    bus->begin(run_hz);
+    gfx->fillScreen(RGB565_BLACK);
+    Serial.println("SPI probe done");
+}
+
+#endif
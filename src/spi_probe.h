@@ -0,0 +1,25 @@
+#ifndef SPI_PROBE_H
+#define SPI_PROBE_H
+
+#include <Arduino_GFX_Library.h>
+
+// One row per SPI frequency
+#define SPI_PROBE_CSV_HEADER "hz,fill_full_us,fill_MBps,blit_full_us,blit_MBps,cell_us,cell_MBps"
+
+// Frequencies tried, in Hz. The ESP32 SPI clock is 80 MHz / n, so other
+// values are rounded down by the driver.
+#ifndef SPI_PROBE_STEPS
+#define SPI_PROBE_STEPS 10000000, 16000000, 20000000, 26666666, 40000000, 80000000
+#endif
+// Test pattern stays on screen this long per step, to judge stability by eye
+#ifndef SPI_PROBE_HOLD_MS
+#define SPI_PROBE_HOLD_MS 1500
+#endif
+
+#ifdef SPI_PROBE
+// Run the stepped-frequency probe on a started display, then put the bus
+// back to `run_hz` (GFX_NOT_DEFINED: the library default). Call before LVGL.
+void spi_probe_run(Arduino_GFX * gfx, Arduino_DataBus * bus, int32_t run_hz);
+#endif
+
+#endif
@@ -0,0 +1,167 @@
+/*******************************************************************************
+ * Theme assets memory-mapped from the "theme" flash data partition.
+ *
+ * Container, little-endian, written by `tools/assets.py pack`:
+ *   header  16 bytes        "THM1", u16 version, u16 asset count,
+ *                           u32 total size, u32 CRC-32 of bytes [16, total size)
+ *   index   count x 48      char name[32], u32 offset, u32 size,
+ *                           u16 w, u16 h, u8 format, u8 pad[3]
+ *   blobs                   pixel data, each on a THEME_ALIGN boundary
+ * The partition is mapped once through the flash cache and the descriptors
+ * point straight into it, so pixel data costs no RAM; only the
+ * THEME_MAX_ASSETS descriptors below do.
+ ******************************************************************************/
+#include <Arduino.h>
+#include <string.h>
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+#include "theme.h"
+#include "img_rle.h"
+
+#define THEME_MAGIC       0x314D4854  // "THM1"
+#define THEME_VERSION     1
+#define THEME_ALIGN       32          // flash cache line
+
+// Asset formats, same numbering as FORMATS in tools/assets.py
+enum {
+    THEME_FMT_RGB565A8 = 1,
+    THEME_FMT_INDEXED_4BIT,
+    THEME_FMT_INDEXED_8BIT,
+    THEME_FMT_CHROMA_KEYED,
+    THEME_FMT_RLE,
+    THEME_FMT_ALPHA_8BIT,
+};
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;
+    uint32_t total_size;
+    uint32_t crc;
+} theme_header_t;
+
+typedef struct {
+    char     name[32];
+    uint32_t offset;
+    uint32_t size;
+    uint16_t w;
+    uint16_t h;
+    uint8_t  format;
+    uint8_t  pad[3];
+} theme_entry_t;
+
+static_assert(sizeof(theme_header_t) == 16, "theme header layout");
+static_assert(sizeof(theme_entry_t) == 48, "theme index layout");
+
+static lv_img_dsc_t theme_imgs[THEME_MAX_ASSETS];
+static const theme_entry_t * theme_index = NULL;
+static uint16_t theme_count = 0;
+
+static bool theme_cf(uint8_t format, lv_img_cf_t * cf)
+{
+    switch (format) {
+        case THEME_FMT_RGB565A8:     *cf = LV_IMG_CF_RGB565A8;                break;
+        case THEME_FMT_INDEXED_4BIT: *cf = LV_IMG_CF_INDEXED_4BIT;            break;
+        case THEME_FMT_INDEXED_8BIT: *cf = LV_IMG_CF_INDEXED_8BIT;            break;
+        case THEME_FMT_CHROMA_KEYED: *cf = LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED; break;
+        case THEME_FMT_RLE:          *cf = IMG_RLE_CF;                        break;
+        case THEME_FMT_ALPHA_8BIT:   *cf = LV_IMG_CF_ALPHA_8BIT;              break;
+        default: return false;
+    }
+    return true;
+}
+
+// Bytes an image of the format needs, palette included; 0 for RLE, whose
+// length depends on the content (img_rle.c stops at the end of the data)
+static uint32_t theme_min_size(uint8_t format, uint32_t w, uint32_t h)
+{
+    switch (format) {
+        case THEME_FMT_RGB565A8:     return w * h * LV_IMG_PX_SIZE_ALPHA_BYTE;
+        case THEME_FMT_INDEXED_4BIT: return 16 * sizeof(lv_color32_t) + (w + 1) / 2 * h;
+        case THEME_FMT_INDEXED_8BIT: return 256 * sizeof(lv_color32_t) + w * h;
+        case THEME_FMT_CHROMA_KEYED: return w * h * sizeof(lv_color_t);
+        case THEME_FMT_ALPHA_8BIT:   return w * h;
+        default:                     return 0;
+    }
+}
+
+static const char * theme_check(const uint8_t * base, uint32_t part_size)
+{
+    const theme_header_t * hdr = (const theme_header_t *)base;
+    if (hdr->magic != THEME_MAGIC) return "no theme";
+    if (hdr->version != THEME_VERSION) return "unsupported version";
+    if (hdr->count > THEME_MAX_ASSETS) return "too many assets";
+    uint32_t index_end = sizeof(theme_header_t) + hdr->count * sizeof(theme_entry_t);
+    if (hdr->total_size > part_size || hdr->total_size < index_end) return "bad size";
+    if (esp_rom_crc32_le(0, base + sizeof(theme_header_t), hdr->total_size - sizeof(theme_header_t)) != hdr->crc)
+        return "CRC mismatch";
+
+    const theme_entry_t * e = (const theme_entry_t *)(base + sizeof(theme_header_t));
+    for (int i = 0; i < hdr->count; i++, e++) {
+        lv_img_cf_t cf;
+        if (memchr(e->name, 0, sizeof(e->name)) == NULL) return "bad asset name";
+        if (e->offset < index_end || e->offset % THEME_ALIGN != 0 || e->offset > hdr->total_size ||
+            e->size > hdr->total_size - e->offset) return "bad asset offset";
+        if (!theme_cf(e->format, &cf)) return "unknown asset format";
+        if (e->w == 0 || e->h == 0) return "empty asset";
+        if (e->size < theme_min_size(e->format, e->w, e->h)) return "asset smaller than its image";
+    }
+    return NULL;
+}
+
+bool theme_init()
+{
+    const esp_partition_t * part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+        (esp_partition_subtype_t)THEME_PARTITION_SUBTYPE, THEME_PARTITION_LABEL);
+    if (part == NULL) {
+        Serial.println("Theme: no partition, using built-in assets");
+        return false;
+    }
+
+    uint32_t t0 = micros();
+    const void * map;
+    esp_partition_mmap_handle_t handle;
+    if (esp_partition_mmap(part, 0, part->size, ESP_PARTITION_MMAP_DATA, &map, &handle) != ESP_OK) {
+        Serial.println("Theme: mmap failed, using built-in assets");
+        return false;
+    }
+
+    const uint8_t * base = (const uint8_t *)map;
+    const char * err = theme_check(base, part->size);
+    if (err != NULL) {
+        Serial.printf("Theme: %s, using built-in assets\n", err);
+        esp_partition_munmap(handle);
+        return false;
+    }
+
+    // Stays mapped for the lifetime of the firmware: LVGL draws from it
+    const theme_header_t * hdr = (const theme_header_t *)base;
+    theme_index = (const theme_entry_t *)(base + sizeof(theme_header_t));
+    theme_count = hdr->count;
+    for (int i = 0; i < theme_count; i++) {
+        const theme_entry_t * e = &theme_index[i];
+        lv_img_cf_t cf = LV_IMG_CF_UNKNOWN;
+        theme_cf(e->format, &cf);
+        theme_imgs[i].header.always_zero = 0;
+        theme_imgs[i].header.reserved = 0;
+        theme_imgs[i].header.cf = cf;
+        theme_imgs[i].header.w = e->w;
+        theme_imgs[i].header.h = e->h;
+        theme_imgs[i].data_size = e->size;
+        theme_imgs[i].data = base + e->offset;
+    }
+    Serial.printf("Theme: %d assets, %u bytes at 0x%06x mapped in %u us\n",
+                  theme_count, (unsigned)hdr->total_size, (unsigned)part->address,
+                  (unsigned)(micros() - t0));
+    return true;
+}
+
+const lv_img_dsc_t * theme_get(const char * name, const lv_img_dsc_t * fallback)
+{
+    for (int i = 0; i < theme_count; i++) {
+        if (strncmp(theme_index[i].name, name, sizeof(theme_index[i].name)) == 0) {
+            return &theme_imgs[i];
+        }
+    }
+    return fallback;
+}
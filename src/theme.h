@@ -0,0 +1,19 @@
+#ifndef THEME_H
+#define THEME_H
+
+#include <lvgl.h>
+
+// Flash data partition holding the theme container (see partitions.csv)
+#define THEME_PARTITION_LABEL   "theme"
+#define THEME_PARTITION_SUBTYPE 0x40
+#define THEME_MAX_ASSETS        16
+
+// Map and validate the theme partition; call once after lv_init().
+// Returns false (and theme_get() returns its fallbacks) if it is missing or invalid.
+bool theme_init();
+
+// Image named `name` in the theme (the C symbol of the built-in asset, e.g.
+// "button_4_106x40_i4"), or `fallback` if the theme does not have it.
+const lv_img_dsc_t * theme_get(const char * name, const lv_img_dsc_t * fallback);
+
+#endif
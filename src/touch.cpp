@@ -9,6 +9,7 @@
 
 #include <Arduino_GFX_Library.h>
 #include "touch.h"
+#include "i2c_recover.h"
 
 extern Arduino_GFX *gfx;
 
@@ -53,6 +54,14 @@ extern Arduino_GFX *gfx;
 
 int16_t touch_last_x = 0, touch_last_y = 0;
 
+#if defined(TOUCH_GT911)
+const int touch_i2c_sda = TOUCH_GT911_SDA, touch_i2c_scl = TOUCH_GT911_SCL;
+#elif defined(TOUCH_FT6X36) && defined(TOUCH_FT6X36_SDA)
+const int touch_i2c_sda = TOUCH_FT6X36_SDA, touch_i2c_scl = TOUCH_FT6X36_SCL;
+#else
+const int touch_i2c_sda = -1, touch_i2c_scl = -1;
+#endif
+
 #if defined(TOUCH_FT6X36)
 #include <Wire.h>
 #include <FT6X36.h>
@@ -133,6 +142,13 @@ void touch_init()
 #endif
 }
 
+void touch_bus_end()
+{
+#if defined(TOUCH_GT911) || defined(TOUCH_FT6X36)
+  Wire.end();
+#endif
+}
+
 bool touch_has_signal()
 {
 #if defined(TOUCH_FT6X36)
@@ -165,7 +181,12 @@ bool touch_touched()
 
 #elif defined(TOUCH_GT911)
   ts.read();
-  if (ts.isTouched)
+  // A bus returning 0xFF bytes reads as 15 points at 65535/65535
+  bool sane = ts.touches <= 5 &&
+              (!ts.isTouched || (ts.points[0].x <= max(TOUCH_MAP_X1, TOUCH_MAP_X2) &&
+                                 ts.points[0].y <= max(TOUCH_MAP_Y1, TOUCH_MAP_Y2)));
+  i2c_recover_touch_read(sane);
+  if (sane && ts.isTouched)
   {
 #if defined(TOUCH_SWAP_XY)
     touch_last_x = map(ts.points[0].y, TOUCH_MAP_X1, TOUCH_MAP_X2, 0, gfx->width() - 1);
@@ -13,4 +13,9 @@ bool touch_touched();
 bool touch_released();
 void touch_init();
 
+// Touch controller I2C pins (-1 if not on I2C) and driver stop, for the bus
+// recovery in i2c_recover.cpp; touch_init() starts the bus again
+extern const int touch_i2c_sda, touch_i2c_scl;
+void touch_bus_end();
+
 #endif
@@ -0,0 +1,150 @@
+/*******************************************************************************
+ * Serial link on a UART: the fp_link task
+ *
+ * A task of its own runs fp_link: it sleeps until the UART receives (the
+ * onReceive callback), fp_proto queues an event or raises a flag (the INT
+ * callback in main.cpp calls uart_link_kick()), or the frame in flight is
+ * due again. Events are therefore pushed within a task switch of being
+ * queued, with no poll period in between.
+ *
+ * Switching to the link stops the I2C side from touching the event queue
+ * (main.cpp checks uart_link_active() in the Wire1 callbacks). Switching
+ * back is done by the task once no frame is in flight: the events frame
+ * out is acknowledged, or the host is given up on and its presses and
+ * releases go back to the queue (fp_link.cpp), so the I2C master gets
+ * them. The link stays active until then, at most FP_LINK_RETRIES_MAX
+ * retries. The UART is only started when the link is first selected, so
+ * the pins stay free otherwise.
+ ******************************************************************************/
+#include <Arduino.h>
+#include <atomic>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "uart_link.h"
+
+#if UART_LINK
+
+#include "fp_link.h"
+#include "console.h"
+
+#ifndef UART_LINK_STACK
+#define UART_LINK_STACK 3072
+#endif
+#ifndef UART_LINK_PRIO
+#define UART_LINK_PRIO 2   // above the loop (1): events leave as soon as queued
+#endif
+
+#if UART_LINK_PORT == 0
+#define LINK_PORT Serial
+#else
+#define LINK_PORT Serial2
+#endif
+
+static TaskHandle_t task = NULL;
+static std::atomic<bool> active(false);   // written by the task only
+static std::atomic<bool> wanted(false);   // uart_link_select()
+static bool port_started = false;
+
+static void port_write(const uint8_t * data, int len)
+{
+    LINK_PORT.write(data, len);
+}
+
+// On the USB port the serial link takes the console's input
+static void set_active(bool on)
+{
+    active.store(on, std::memory_order_relaxed);
+    console_hold(on && UART_LINK_PORT == 0);
+    Serial.printf("Front panel link: %s\n", on ? "serial" : "I2C");
+}
+
+static void link_task(void * arg)
+{
+    uint8_t buf[64];
+    for (;;) {
+        TickType_t wait = portMAX_DELAY;
+        bool want = wanted.load(std::memory_order_relaxed);
+        if (want && !active.load(std::memory_order_relaxed)) set_active(true);
+        if (active.load(std::memory_order_relaxed)) {
+            int n;
+            while ((n = LINK_PORT.available()) > 0) {
+                n = LINK_PORT.read(buf, n < (int)sizeof(buf) ? n : sizeof(buf));
+                fp_link_input(buf, n, millis());
+            }
+            fp_link_hold(!want);
+            uint32_t due = fp_link_poll(millis());
+            if (!want && fp_link_idle()) {
+                set_active(false);
+                due = UINT32_MAX;
+            }
+            if (due != UINT32_MAX) wait = pdMS_TO_TICKS(due) + 1;
+        }
+        ulTaskNotifyTake(pdTRUE, wait);
+    }
+}
+
+static void on_receive()
+{
+    if (task) xTaskNotifyGive(task);
+}
+
+void uart_link_kick()
+{
+    if (task && active.load(std::memory_order_relaxed)) xTaskNotifyGive(task);
+}
+
+bool uart_link_active()
+{
+    return active.load(std::memory_order_relaxed);
+}
+
+void uart_link_select(bool on)
+{
+    if (on && !port_started) {
+#if UART_LINK_PORT == 0
+        LINK_PORT.updateBaudRate(UART_LINK_BAUD);
+#else
+        LINK_PORT.begin(UART_LINK_BAUD, SERIAL_8N1, UART_LINK_RX, UART_LINK_TX);
+#endif
+        LINK_PORT.onReceive(on_receive);
+        port_started = true;
+    }
+    wanted.store(on, std::memory_order_relaxed);
+    if (task) xTaskNotifyGive(task);
+}
+
+static void link_cmd(const char * args)
+{
+    if (strcmp(args, "uart") == 0) {
+        uart_link_select(true);
+        return;
+    }
+    if (strcmp(args, "i2c") == 0) {
+        uart_link_select(false);
+        return;
+    }
+    const fp_link_stats_t * s = fp_link_stats();
+    Serial.printf("Link: %s%s; serial %s at %d baud, host %s\n", active ? "serial" : "I2C",
+                  active.load() != wanted.load() ? " (switching)" : "",
+                  UART_LINK_PORT == 0 ? "USB" : "UART2", UART_LINK_BAUD,
+                  fp_link_connected() ? "connected" : "not seen");
+    Serial.printf("  frames out %lu (retries %lu), in %lu (dups %lu, bad %lu)\n",
+                  (unsigned long)s->tx_frames, (unsigned long)s->retries,
+                  (unsigned long)s->rx_frames, (unsigned long)s->rx_dups,
+                  (unsigned long)s->crc_errors);
+    Serial.printf("  events acknowledged %lu, longest send -> ACK %lu ms, hosts lost %lu\n",
+                  (unsigned long)s->events, (unsigned long)s->ack_max_ms,
+                  (unsigned long)s->hosts_lost);
+}
+
+void uart_link_init()
+{
+    fp_link_init(port_write);
+    xTaskCreate(link_task, "fp_link", UART_LINK_STACK, NULL, UART_LINK_PRIO, &task);
+    console_add("link", link_cmd, "front panel transport: [uart | i2c]");
+    if (UART_LINK == 2) uart_link_select(true);
+}
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef UART_LINK_H
+#define UART_LINK_H
+
+#include <stdint.h>
+
+// The serial link (fp_link.h) on a UART. While it is on, it is the panel's
+// master: the I2C slave answers every read with 0 and ignores writes, so the
+// event queue has one consumer. "link uart" / "link i2c" on the console
+// switch at run time; back to I2C once no serial frame is in flight.
+
+// 0: not built; 1: built, I2C at boot; 2: built and on at boot
+#ifndef UART_LINK
+#define UART_LINK 1
+#endif
+// 2: UART2 on the pins below; 0: the USB serial port, shared with the
+// console (its input goes to the link while the link is on, and the host
+// skips the log text between frames)
+#ifndef UART_LINK_PORT
+#define UART_LINK_PORT 2
+#endif
+// TX: GPIO17, UART2's default TX (the blue pad of the CYD's RGB LED, which
+// the firmware leaves off). Not 27: that is the backlight (TFT_BL)
+#ifndef UART_LINK_TX
+#define UART_LINK_TX 17
+#endif
+#ifndef UART_LINK_RX
+#define UART_LINK_RX 35
+#endif
+#ifndef UART_LINK_BAUD
+#define UART_LINK_BAUD 921600
+#endif
+
+#if UART_LINK
+
+void uart_link_init();
+
+// Link on (true) or I2C (false). The link task makes the switch: to I2C
+// once the frame in flight is acknowledged or given up (fp_link.h)
+void uart_link_select(bool on);
+
+// The link owns the registers (until the switch to I2C is done)
+bool uart_link_active();
+
+// An event was queued or a flag raised (fp_proto INT callback): send it now
+void uart_link_kick();
+
+#else
+
+static inline void uart_link_init() {}
+static inline bool uart_link_active() { return false; }
+static inline void uart_link_kick() {}
+
+#endif
+
+#endif
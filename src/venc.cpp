@@ -0,0 +1,94 @@
+/*******************************************************************************
+ * Virtual encoder from touch slides
+ *
+ * A press becomes an encoder slide in two ways: a vertical drag that starts
+ * on a zone cell (VENC_ZONE_MASK), or a vertical slide after LVGL's long
+ * press on any other button. From then on the panel is a tuning knob until
+ * the finger lifts, wherever it goes: each touch read converts the vertical
+ * movement into detents, scaled by the slide speed, and adds them to the
+ * REG_ENCODER count. The master reads the sum, so one read after a fast
+ * swipe carries dozens of detents.
+ *
+ * Sub-detent movement is kept in 1/256 detent units, so slow slides still
+ * add up, and detents are counted on floor boundaries like the notches of a
+ * real encoder: sliding back over a distance undoes its counts.
+ ******************************************************************************/
+#include "venc.h"
+#include "fp_proto.h"
+
+static bool pressed_before = false;
+static bool armed = false;     // a slide from here would start the encoder
+static bool active = false;
+static int16_t start_y, last_y;
+static uint32_t last_ms;
+static int32_t frac = 0;       // 1/256 detents not reported yet
+
+bool venc_is_zone(int button)
+{
+    return button >= 0 && button < 32 && ((VENC_ZONE_MASK >> button) & 1);
+}
+
+void venc_press(int button)
+{
+    armed = venc_is_zone(button);
+}
+
+void venc_long_pressed()
+{
+    if (active) return;
+    armed = true;
+    start_y = last_y;
+}
+
+bool venc_active()
+{
+    return active;
+}
+
+uint32_t venc_gain_x16(uint32_t speed)
+{
+    if (speed <= VENC_ACCEL_FROM) return 16;
+    if (speed >= VENC_ACCEL_TO) return VENC_ACCEL_MAX * 16;
+    return 16 + (speed - VENC_ACCEL_FROM) * (VENC_ACCEL_MAX - 1) * 16 / (VENC_ACCEL_TO - VENC_ACCEL_FROM);
+}
+
+bool venc_touch(bool pressed, int16_t y, uint32_t ms)
+{
+    if (!pressed) {
+        pressed_before = armed = active = false;
+        frac = 0;
+        return false;
+    }
+    if (!pressed_before) {
+        pressed_before = true;
+        start_y = last_y = y;
+        last_ms = ms;
+        return false;
+    }
+
+    if (!active) {
+        last_y = y;
+        last_ms = ms;
+        int dy = y - start_y;
+        if (!armed || (dy < VENC_START_PX && dy > -VENC_START_PX)) return false;
+        active = true;
+        frac = 0;
+        return true;
+    }
+
+    int32_t dy = last_y - y;   // screen y grows downwards, up is positive
+    uint32_t dt = ms - last_ms;
+    if (dy == 0) {
+        last_ms = ms;
+        return false;
+    }
+    uint32_t speed = (uint32_t)(dy < 0 ? -dy : dy) * 1000 / (dt ? dt : 1);
+    uint32_t gain = venc_gain_x16(speed);
+    frac += dy * (int32_t)gain * 16 / VENC_PX_PER_DETENT;
+    int32_t detents = frac >> 8;    // floor: sliding back returns to the same count
+    frac -= detents * 256;
+    last_y = y;
+    last_ms = ms;
+    if (detents) fp_report_encoder(detents);
+    return false;
+}
@@ -0,0 +1,51 @@
+#ifndef VENC_H
+#define VENC_H
+
+#include <stdint.h>
+
+// Virtual encoder: vertical slides on the touch panel become signed encoder
+// counts for REG_ENCODER. Up is positive.
+
+// Buttons whose cell is an encoder zone (bit i = button i): a vertical drag
+// starting there turns the encoder at once. Default: Main Incr.
+#ifndef VENC_ZONE_MASK
+#define VENC_ZONE_MASK (1u << 8)
+#endif
+// Movement that starts the encoder, from the press (zone) or from where the
+// long press fired (any other button)
+#ifndef VENC_START_PX
+#define VENC_START_PX 12
+#endif
+// Slide per detent at the base rate
+#ifndef VENC_PX_PER_DETENT
+#define VENC_PX_PER_DETENT 6
+#endif
+// Acceleration: gain 1 up to ACCEL_FROM px/s, rising linearly to ACCEL_MAX
+// at ACCEL_TO px/s and above
+#ifndef VENC_ACCEL_FROM
+#define VENC_ACCEL_FROM 150
+#endif
+#ifndef VENC_ACCEL_TO
+#define VENC_ACCEL_TO 1200
+#endif
+#ifndef VENC_ACCEL_MAX
+#define VENC_ACCEL_MAX 8
+#endif
+
+bool venc_is_zone(int button);
+
+// From the button events: a press on `button` began; its long press fired
+void venc_press(int button);
+void venc_long_pressed();
+
+// Every touch read: true once, when the press becomes an encoder slide. The
+// caller then cancels the button press. Counts go to fp_report_encoder().
+bool venc_touch(bool pressed, int16_t y, uint32_t ms);
+
+// The current press is an encoder slide
+bool venc_active();
+
+// Gain for a slide speed, x16 (exposed for the host check of the curve)
+uint32_t venc_gain_x16(uint32_t px_per_s);
+
+#endif
@@ -6,8 +6,27 @@
  * Implements the pico_frontpanel protocol (g0orx/pico_frontpanel).
  * Displays button events on the built-in SSD1306 OLED.
  *
- * Polling mode: REG_INT_MASK is read every POLL_INTERVAL_MS.
+ * Polling mode: REG_INT_MASK is read every POLL_INTERVAL_MS, or with
+ * ADAPTIVE_POLL every POLL_FAST_MS for POLL_HOLD_MS after an event, then
+ * twice as long each idle poll up to POLL_IDLE_MS.
  * No INT wire required between boards.
+ * The I2C transactions of a poll run one per loop() pass, each bounded by
+ * I2C_TIMEOUT_MS and tried up to I2C_RETRIES more times (see the
+ * transaction engine below): a slave that NAKs or stops answering costs a
+ * failed poll, not a hung master. The OLED is redrawn between polls, at most
+ * every OLED_MIN_MS, with the achieved poll rate and the event latency
+ * bound on its last two lines.
+ * The slave's REG_STATS health block and the master's own counters are
+ * printed every STATS_INTERVAL_MS.
+ * Type a page number (0-9) on Serial to show that page on the panel; 'l'
+ * sends band/mode/filter labels, 'b' a burst of 18 labels in one write and
+ * 'r' restores the built-in labels.
+ * The master reads REG_CAPS at start and enables the extensions the slave
+ * has (a stock slave has none, and is then driven as pico_frontpanel):
+ * - USE_CLICKS: a tap shorter than CLICK_WINDOW_MS is read as one CLICK
+ *   event instead of a PRESS and a REL; the press of a hold arrives
+ *   CLICK_WINDOW_MS late.
+ * - BATCH_EVENTS: one REG_TOUCH read takes up to that many events.
  *
  * Wiring (Heltec WiFi Kit 32 -> ESP32 slave):
  *   GPIO 21 (SDA) -> ESP32 GPIO 21 (SDA)
@@ -28,7 +47,21 @@
 #define SLAVE_SCL   22
 
 // ── Polling interval ───────────────────────────────────────────────────────
-#define POLL_INTERVAL_MS  20   // poll REG_INT_MASK every 20 ms (50 Hz)
+#define POLL_INTERVAL_MS  20   // poll REG_INT_MASK every 20 ms (50 Hz) without ADAPTIVE_POLL
+#define ADAPTIVE_POLL     1    // poll faster after an event, slower when idle
+#define POLL_FAST_MS      5    // period after an event
+#define POLL_HOLD_MS      250  // ... for this long (a tap's release comes within it)
+#define POLL_IDLE_MS      40   // longest period, idle or after a failed poll
+#define STATS_INTERVAL_MS 5000 // read REG_STATS every 5 s (0 = never)
+#define USE_CLICKS        1    // enable FP_FEATURE_CLICK if the slave has it
+#define CLICK_WINDOW_MS   150  // taps up to this long become one event (10 ms steps)
+#define BATCH_EVENTS      4    // events per REG_TOUCH read if the slave can (1 = off)
+
+// ── Transactions and display ──────────────────────────────────────────────
+#define I2C_TIMEOUT_MS    25   // one Wire call; a 128-byte write takes 12 ms at 100 kHz
+#define I2C_RETRIES       2    // more tries of a transaction the slave did not answer
+#define OLED_MIN_MS       200  // redraw the OLED at most 5 times a second
+#define RATE_WINDOW_MS    1000 // poll rate and latency on the OLED, over this window
 
 // ── Register addresses (pico_frontpanel protocol) ──────────────────────────
 #define REG_CONFIG   0x00
@@ -36,72 +69,494 @@
 #define REG_INT_MASK 0x02
 #define REG_ENCODER  0x03
 #define REG_SWITCH   0x04
-#define REG_TOUCH    0x05  // repurposed: button_index(1B) + state(1B) + 3B pad
+#define REG_TOUCH    0x05  // repurposed: button_index(1B) + state(1B) + count(2B) + pad
 #define REG_LED      0x06
+#define REG_PAGE     0x07  // page shown (1B) + page count (1B); write 1B to select
+#define REG_LABEL    0x08  // write: [button, length, text]... ("" = built-in label)
+#define REG_CAPS     0x09  // version (1B) + feature bits (2B) + max batch (1B); stock slave: 0
+#define REG_STATS    0x10  // read only: uint32 LE words, see src/fp_proto.h
 
 // ── Interrupt mask bits ────────────────────────────────────────────────────
+#define INT_ENC   0x0001
 #define INT_TS    0x0100
+#define INT_PAGE  0x0200
 #define INT_READY 0x8000
 
-// ── Button labels (must match slave) ──────────────────────────────────────
-static const char *BTN_LABELS[18] = {
+// ── REG_CAPS feature bits; the opt-in ones are enabled by REG_CONFIG ──────
+#define FP_FEATURE_CLICK   0x0001  // opt-in: state 3, press + release, count = ms held
+#define FP_FEATURE_BATCH   0x0002  // opt-in: [n] + records of 4B per REG_TOUCH read
+#define FP_FEATURE_REPEAT  0x0100  // opt-in: state 2, count = repeats
+#define FP_FEATURE_ENCODER 0x0200
+#define FP_FEATURE_PAGES   0x0400  // REG_PAGE; opt-in: INT_PAGE
+#define FP_FEATURE_LABELS  0x0800
+#define FP_FEATURE_STATS   0x1000
+#define BATCH_MAX          8       // records this master can take in one read
+
+static uint16_t features = 0;      // enabled on the slave
+static uint8_t batch = 1;
+
+// ── Button labels (must match slave), 18 per page ─────────────────────────
+static const char *BTN_LABELS[] = {
     "Select", "Menu",    "Band+",
     "Zoom",   "Display", "Band-",
     "Mode",   "Demod",   "MainIncr",
     "Noise",  "Notch",   "FTunInc",
     "Filter", "Decode",  "DirFreq",
-    "User1",  "User2",   "User3"
+    "User1",  "User2",   "User3",
+
+    "CWOpts", "RFSet",   "VFOSel",
+    "EEPROM", "AGC",     "Spectrum",
+    "NoiseFl", "MicGain", "MicComp",
+    "EQRx",   "EQTx",    "Calibrate",
+    "Bearing", "Keyer",  "FreqOpt",
+    "CalFreq", "Mute",   "Lock",
+
+    "Mem1",   "Mem2",    "Mem3",
+    "Mem4",   "Mem5",    "Mem6",
+    "Store",  "Recall",  "Clear",
+    "Split",  "RIT",     "XIT",
+    "VFOA/B", "A=B",     "Tune",
+    "Macro1", "Macro2",  "Macro3"
 };
+#define BTN_LABELS_COUNT (sizeof(BTN_LABELS) / sizeof(BTN_LABELS[0]))
+
+// REG_STATS words, in slave order (word 0 is the word count)
+static const char *STAT_NAMES[] = {
+    "words", "uptime_s", "events", "dropped", "polls",
+    "req_max_us", "frame_ms", "free_heap", "loop_overruns",
+    "mem_warn", "heap_min", "boot_ms", "bus_recov", "recov_max_us",
+    "enc_detents", "enc_reads", "repeats", "page_us",
+    "labels", "label_us", "clicks"
+};
+#define STAT_NAMES_COUNT (sizeof(STAT_NAMES) / sizeof(STAT_NAMES[0]))
+
+// ── Master counters ────────────────────────────────────────────────────────
+// Latency is a bound the master can measure without a clock on the slave:
+// an event read now was not pending at the start of the last poll that
+// found INT_TS clear, so it waited at most that long.
+typedef struct {
+    uint32_t polls, events;
+    uint32_t lat_sum_us, lat_max_us, lat_n;
+    uint32_t tr, tr_sum_us, tr_max_us;     // I2C transactions
+    uint32_t retries, failed;              // failed: jobs given up
+} master_stats_t;
+
+static master_stats_t win, logged;          // OLED window, serial log
+static uint32_t rate_polls = 0;             // polls in the last full window
+static uint32_t rate_failed = 0;
+static uint32_t rate_lat_avg_us = 0, rate_lat_max_us = 0;
+static uint32_t oled_us = 0;                // last redraw
+
+static void stats_latency(uint32_t us) {
+    master_stats_t *s[2] = { &win, &logged };
+    for (int i = 0; i < 2; i++) {
+        s[i]->lat_sum_us += us;
+        s[i]->lat_n++;
+        if (us > s[i]->lat_max_us) s[i]->lat_max_us = us;
+    }
+}
 
 // ── OLED display helpers ───────────────────────────────────────────────────
 static char oled_line1[32] = "Waiting...";
 static char oled_line2[32] = "";
 static char oled_line3[32] = "";
+static bool oled_dirty = true;
 static uint32_t event_count = 0;
+static uint16_t poll_period = POLL_INTERVAL_MS;
 
 void oled_refresh() {
+    char poll_line[32], lat_line[32];
+    snprintf(poll_line, sizeof(poll_line), "Poll %lu/s @%ums  err %lu", (unsigned long)rate_polls,
+             poll_period, (unsigned long)rate_failed);
+    snprintf(lat_line, sizeof(lat_line), "Lat %lu.%lu / %lu.%lu ms", (unsigned long)(rate_lat_avg_us / 1000),
+             (unsigned long)(rate_lat_avg_us / 100 % 10), (unsigned long)(rate_lat_max_us / 1000),
+             (unsigned long)(rate_lat_max_us / 100 % 10));
     Heltec.display->clear();
     Heltec.display->setFont(ArialMT_Plain_10);
-    Heltec.display->drawString(0, 0,  "FP I2C Master Test");
-    Heltec.display->drawString(0, 14, oled_line1);
-    Heltec.display->drawString(0, 28, oled_line2);
-    Heltec.display->drawString(0, 42, oled_line3);
+    Heltec.display->drawString(0, 0,  oled_line1);
+    Heltec.display->drawString(0, 12, oled_line2);
+    Heltec.display->drawString(0, 24, oled_line3);
+    Heltec.display->drawString(0, 40, poll_line);
+    Heltec.display->drawString(0, 52, lat_line);
     Heltec.display->display();
 }
 
-// ── I2C helpers ────────────────────────────────────────────────────────────
-static uint8_t read_byte() {
-    while (!Wire.available()) { delayMicroseconds(10); }
-    return Wire.read();
+// Redraw if something changed, not more often than OLED_MIN_MS. Called
+// between polls only: a redraw takes a few ms and must not sit between the
+// transactions of one.
+static void oled_service() {
+    static uint32_t last = 0;
+    if (!oled_dirty || millis() - last < OLED_MIN_MS) return;
+    uint32_t t0 = micros();
+    oled_refresh();
+    oled_us = micros() - t0;
+    last = millis();
+    oled_dirty = false;
 }
 
-static uint16_t read_int_mask() {
-    Wire.beginTransmission(SLAVE_ADDR);
-    Wire.write(REG_INT_MASK);
-    if (Wire.endTransmission(true) != 0) return 0;  // bus error
-    Wire.requestFrom(SLAVE_ADDR, 2);
-    uint16_t mask = read_byte();
-    mask |= ((uint16_t)read_byte() << 8);
-    return mask;
+// ── I2C transaction engine ─────────────────────────────────────────────────
+// A job is a write (the register, and data for a register write) and, if
+// rx_len, a read of the reply. i2c_step() does one transaction: the loop
+// gets control back between the write and the read, and Wire gives up on
+// a call after I2C_TIMEOUT_MS. A write the slave NAKs and a read it does
+// not answer at all are tried again, I2C_RETRIES times; a short read is
+// not, since the slave may have taken events for it. Reads and writes are
+// separate transactions with a stop, as pico_frontpanel masters do them.
+enum { I2C_WRITE, I2C_READ, I2C_DONE, I2C_FAILED };
+
+typedef struct {
+    uint8_t tx[128];
+    uint8_t tx_len, rx_len;
+    uint8_t rx[STAT_NAMES_COUNT * 4];
+    uint8_t state, tries;
+} i2c_job_t;
+
+static void i2c_begin(i2c_job_t *j, const uint8_t *tx, uint8_t tx_len, uint8_t rx_len) {
+    memcpy(j->tx, tx, tx_len);
+    j->tx_len = tx_len;
+    j->rx_len = rx_len;
+    j->state = I2C_WRITE;
+    j->tries = 0;
 }
 
-static void read_button_event(uint8_t *btn_index, uint8_t *btn_state) {
-    Wire.beginTransmission(SLAVE_ADDR);
-    Wire.write(REG_TOUCH);
-    Wire.endTransmission(true);
-    Wire.requestFrom(SLAVE_ADDR, 5);
-    *btn_index = read_byte();
-    *btn_state = read_byte();
-    read_byte(); read_byte(); read_byte();  // discard padding
+static void i2c_timed(uint32_t t0) {
+    uint32_t us = micros() - t0;
+    master_stats_t *s[2] = { &win, &logged };
+    for (int i = 0; i < 2; i++) {
+        s[i]->tr++;
+        s[i]->tr_sum_us += us;
+        if (us > s[i]->tr_max_us) s[i]->tr_max_us = us;
+    }
+}
+
+// A failed transaction: again from the write, or the job fails
+static void i2c_retry(i2c_job_t *j, bool again) {
+    if (again && j->tries++ < I2C_RETRIES) {
+        win.retries++;
+        logged.retries++;
+        j->state = I2C_WRITE;
+        return;
+    }
+    win.failed++;
+    logged.failed++;
+    j->state = I2C_FAILED;
+}
+
+// One transaction of the job; true once it is done or has failed
+static bool i2c_step(i2c_job_t *j) {
+    uint32_t t0 = micros();
+    if (j->state == I2C_WRITE) {
+        Wire.beginTransmission(SLAVE_ADDR);
+        Wire.write(j->tx, j->tx_len);
+        uint8_t err = Wire.endTransmission(true);
+        i2c_timed(t0);
+        if (err) i2c_retry(j, true);
+        else j->state = j->rx_len ? I2C_READ : I2C_DONE;
+    } else if (j->state == I2C_READ) {
+        uint8_t n = Wire.requestFrom((uint8_t)SLAVE_ADDR, j->rx_len);
+        i2c_timed(t0);
+        for (uint8_t i = 0; i < n; i++) {
+            int c = Wire.read();
+            if (i < sizeof(j->rx)) j->rx[i] = c;
+        }
+        if (n == j->rx_len) j->state = I2C_DONE;
+        else i2c_retry(j, n == 0);
+    }
+    return j->state == I2C_DONE || j->state == I2C_FAILED;
 }
 
+// The whole job at once, for setup and the commands between polls
+static bool i2c_run(i2c_job_t *j) {
+    while (!i2c_step(j)) {}
+    return j->state == I2C_DONE;
+}
+
+static i2c_job_t cmd_job;
+
+static bool i2c_read_reg(uint8_t reg, uint8_t *out, uint8_t len) {
+    i2c_begin(&cmd_job, &reg, 1, len);
+    if (!i2c_run(&cmd_job)) return false;
+    memcpy(out, cmd_job.rx, len);
+    return true;
+}
+
+static bool i2c_write(const uint8_t *data, uint8_t len) {
+    i2c_begin(&cmd_job, data, len, 0);
+    return i2c_run(&cmd_job);
+}
+
+// ── Registers ──────────────────────────────────────────────────────────────
+static void read_stats() {
+    uint8_t b[STAT_NAMES_COUNT * 4];
+    if (!i2c_read_reg(REG_STATS, b, sizeof(b))) {
+        Serial.println("Stats: no reply");
+        return;
+    }
+    Serial.print("Stats:");
+    for (uint8_t i = 0; i < STAT_NAMES_COUNT; i++) {
+        uint32_t v = b[4 * i] | (uint32_t)b[4 * i + 1] << 8 | (uint32_t)b[4 * i + 2] << 16 |
+                     (uint32_t)b[4 * i + 3] << 24;
+        Serial.printf(" %s=%lu", STAT_NAMES[i], (unsigned long)v);
+    }
+    Serial.println();
+}
+
+// The master's counters since the last line
+static void print_master_stats() {
+    master_stats_t &s = logged;
+    Serial.printf("Master: polls %lu (%lu/s), period %u ms, events %lu, latency avg %lu max %lu us, "
+                  "I2C %lu (avg %lu max %lu us), retries %lu, failed %lu, OLED %lu us\n",
+                  (unsigned long)s.polls, (unsigned long)(s.polls * 1000UL / STATS_INTERVAL_MS), poll_period,
+                  (unsigned long)s.events, (unsigned long)(s.lat_n ? s.lat_sum_us / s.lat_n : 0),
+                  (unsigned long)s.lat_max_us, (unsigned long)s.tr,
+                  (unsigned long)(s.tr ? s.tr_sum_us / s.tr : 0), (unsigned long)s.tr_max_us,
+                  (unsigned long)s.retries, (unsigned long)s.failed, (unsigned long)oled_us);
+    memset(&logged, 0, sizeof(logged));
+}
+
+static void select_page(uint8_t page) {
+    uint8_t b[2] = { REG_PAGE, page };
+    i2c_write(b, 2);
+}
+
+// One REG_LABEL write: `n` labels, texts up to 11 characters. The whole
+// write must fit the 128-byte Wire buffer of both sides.
+static void send_labels(const uint8_t *buttons, const char *const *texts, int n) {
+    uint8_t b[128];
+    int len = 0;
+    b[len++] = REG_LABEL;
+    for (int i = 0; i < n; i++) {
+        uint8_t text_len = strlen(texts[i]);
+        if (len + 2 + text_len > (int)sizeof(b)) break;
+        b[len++] = buttons[i];
+        b[len++] = text_len;
+        memcpy(b + len, texts[i], text_len);
+        len += text_len;
+    }
+    i2c_write(b, len);
+}
+
+static void label_demo(char c) {
+    static const uint8_t ctx_buttons[] = { 2, 6, 12 };          // Band+, Mode, Filter
+    static const char *ctx_texts[] = { "40m", "USB", "2.7k" };
+    uint8_t buttons[18];
+    const char *texts[18];
+    static char burst[18][6];
+    static uint8_t round = 0;
+
+    switch (c) {
+    case 'l':
+        send_labels(ctx_buttons, ctx_texts, 3);
+        break;
+    case 'r':
+        for (int i = 0; i < 18; i++) { buttons[i] = i; texts[i] = ""; }
+        send_labels(buttons, texts, 18);
+        break;
+    case 'b':   // 18 x (2 + 5) = 126 bytes
+        round++;
+        for (int i = 0; i < 18; i++) {
+            snprintf(burst[i], sizeof(burst[i]), "%c%02d%02d", 'A' + round % 26, round % 100, i);
+            buttons[i] = i;
+            texts[i] = burst[i];
+        }
+        send_labels(buttons, texts, 18);
+        break;
+    }
+    Serial.printf("Labels '%c' sent\n", c);
+}
+
+// Protocol version, feature bits and largest batch; all 0 from a slave
+// without REG_CAPS, which answers unknown registers with a single 0
+static uint16_t read_caps(uint8_t *version, uint8_t *max_batch) {
+    *version = *max_batch = 0;
+    uint8_t b[4];
+    if (!i2c_read_reg(REG_CAPS, b, 4) || b[0] == 0 || b[0] == 0xFF) return 0;
+    *version = b[0];
+    *max_batch = *version >= 2 ? b[3] : 1;
+    return b[1] | ((uint16_t)b[2] << 8);
+}
+
+// Config: int_active_high=0 (active-LOW, not used in polling mode). With no
+// extension this is the stock 2-byte write.
 static void send_config() {
-    // Config: int_active_high=0 (active-LOW, not used in polling mode)
-    Wire.beginTransmission(SLAVE_ADDR);
-    Wire.write(REG_CONFIG);
-    Wire.write(0x00);  // low byte
-    Wire.write(0x00);  // high byte
-    Wire.endTransmission(true);
+    uint8_t b[7] = { REG_CONFIG, 0x00, 0x00 };  // low byte, high byte
+    uint8_t len = 3;
+    if (features) {
+        b[len++] = features & 0xFF;
+        b[len++] = features >> 8;
+        b[len++] = CLICK_WINDOW_MS / 10;
+        b[len++] = batch;
+    }
+    i2c_write(b, len);
+}
+
+// REG_CONFIG as the slave applied it (protocol v2): false if it differs
+static bool check_config() {
+    uint8_t b[6];
+    if (!i2c_read_reg(REG_CONFIG, b, 6)) return false;
+    return (b[2] | ((uint16_t)b[3] << 8)) == features && b[5] == batch &&
+           b[4] == ((features & FP_FEATURE_CLICK) ? CLICK_WINDOW_MS / 10 : 0);
+}
+
+static void negotiate() {
+    uint8_t version, max_batch;
+    uint16_t caps = read_caps(&version, &max_batch);
+    // Repeats and page changes are shown; without them a hold is a press
+    // and a release, and a page change is seen only by reading REG_PAGE.
+    // A version 2 slave sends both unasked and would not echo them back.
+    features = version >= 3 ? caps & (FP_FEATURE_REPEAT | FP_FEATURE_PAGES) : 0;
+    if (USE_CLICKS) features |= caps & FP_FEATURE_CLICK;
+    batch = max_batch < BATCH_EVENTS ? max_batch : BATCH_EVENTS;
+    if (batch > BATCH_MAX) batch = BATCH_MAX;
+    if (batch > 1) features |= caps & FP_FEATURE_BATCH;
+    if (!(features & FP_FEATURE_BATCH)) batch = 1;
+    send_config();
+    Serial.printf("Slave protocol v%d, features 0x%04X, max batch %d; enabled 0x%04X, batch %d\n",
+                  version, caps, max_batch, features, batch);
+    if (version >= 2 && !check_config()) {
+        Serial.println("Slave did not take the config, using the stock protocol");
+        features = 0;
+        batch = 1;
+        send_config();
+    }
+}
+
+static void show_button_event(uint8_t btn_index, uint8_t btn_state, uint16_t count) {
+    if (btn_index == 0xFF) return;  // queue was empty
+    event_count++;
+    const char *label = (btn_index < BTN_LABELS_COUNT) ? BTN_LABELS[btn_index] : "??";
+    char state_str[16];
+    if (btn_state == 2)
+        snprintf(state_str, sizeof(state_str), "REPEAT x%u", count);
+    else if (btn_state == 3)
+        snprintf(state_str, sizeof(state_str), "CLICK %ums", count);
+    else
+        snprintf(state_str, sizeof(state_str), "%s", btn_state ? "PRESS" : "REL");
+
+    Serial.printf("Button %d (%s): %s  [event #%lu]\n",
+                  btn_index, label, state_str, event_count);
+
+    snprintf(oled_line1, sizeof(oled_line1), "#%lu", event_count);
+    snprintf(oled_line2, sizeof(oled_line2), "Btn%d: %s", btn_index, label);
+    snprintf(oled_line3, sizeof(oled_line3), "%s", state_str);
+    oled_dirty = true;
+}
+
+// ── Poll state machine ─────────────────────────────────────────────────────
+// REG_INT_MASK, then one read per pending flag: encoder, page, buttons.
+// Each loop() pass runs one transaction of it.
+enum { POLL_IDLE, POLL_MASK, POLL_ENCODER, POLL_PAGE, POLL_TOUCH };
+
+static uint8_t poll_state = POLL_IDLE;
+static uint16_t poll_mask;
+static uint32_t poll_start_us;
+static uint32_t last_poll_ms = 0;
+static uint32_t last_event_ms = 0;
+static uint32_t quiet_since_us = 0;    // start of the last poll with INT_TS clear
+static uint32_t poll_events;
+static i2c_job_t poll_job;
+
+static void poll_read(uint8_t state, uint8_t reg, uint8_t len) {
+    poll_state = state;
+    i2c_begin(&poll_job, &reg, 1, len);
+}
+
+static void poll_end(bool ok) {
+    win.polls++;
+    logged.polls++;
+    if (poll_events) last_event_ms = millis();
+    if (!ADAPTIVE_POLL) poll_period = POLL_INTERVAL_MS;
+    else if (!ok) poll_period = POLL_IDLE_MS;
+    else if (millis() - last_event_ms < POLL_HOLD_MS) poll_period = POLL_FAST_MS;
+    else poll_period = poll_period * 2 < POLL_IDLE_MS ? poll_period * 2 : POLL_IDLE_MS;
+    poll_state = POLL_IDLE;
+}
+
+// The next pending flag's read, or the end of the poll
+static void poll_next() {
+    if (poll_mask & INT_ENC) poll_read(POLL_ENCODER, REG_ENCODER, 2);
+    else if (poll_mask & INT_PAGE) poll_read(POLL_PAGE, REG_PAGE, 2);
+    else if (poll_mask & INT_TS)
+        poll_read(POLL_TOUCH, REG_TOUCH, (features & FP_FEATURE_BATCH) ? 1 + batch * 4 : 5);
+    else poll_end(true);
+}
+
+static void took_events(const uint8_t *b) {
+    uint32_t now = micros();
+    int n = 0;
+    if (features & FP_FEATURE_BATCH) {
+        // The number of events, then always `batch` records
+        n = b[0] < batch ? b[0] : batch;
+        for (int i = 0; i < n; i++) {
+            const uint8_t *r = b + 1 + i * 4;
+            show_button_event(r[0], r[1], r[2] | ((uint16_t)r[3] << 8));
+        }
+    } else if (b[0] != 0xFF) {
+        n = 1;
+        show_button_event(b[0], b[1], b[2] | ((uint16_t)b[3] << 8));  // b[4]: padding
+    }
+    for (int i = 0; i < n; i++) stats_latency(now - quiet_since_us);
+    poll_events += n;
+    win.events += n;
+    logged.events += n;
+}
+
+static void poll_step() {
+    if (poll_state == POLL_IDLE) {
+        uint32_t period = ADAPTIVE_POLL ? poll_period : POLL_INTERVAL_MS;
+        if (millis() - last_poll_ms < period) return;
+        last_poll_ms = millis();
+        poll_start_us = micros();
+        poll_events = 0;
+        poll_read(POLL_MASK, REG_INT_MASK, 2);
+        return;
+    }
+    if (!i2c_step(&poll_job)) return;
+    if (poll_job.state == I2C_FAILED) {
+        // Nothing read this poll; a later poll reads what is still pending
+        poll_end(false);
+        return;
+    }
+
+    const uint8_t *b = poll_job.rx;
+    switch (poll_state) {
+    case POLL_MASK:
+        poll_mask = b[0] | ((uint16_t)b[1] << 8);
+        if (!(poll_mask & INT_TS)) quiet_since_us = poll_start_us;
+        if (poll_mask & INT_READY) {
+            Serial.println("Slave ready signal received");
+            snprintf(oled_line1, sizeof(oled_line1), "Slave READY");
+            snprintf(oled_line2, sizeof(oled_line2), "");
+            snprintf(oled_line3, sizeof(oled_line3), "");
+            oled_dirty = true;
+        }
+        break;
+    case POLL_ENCODER: {
+        static long enc_total = 0;
+        int8_t count = (int8_t)b[1];
+        enc_total += count;
+        Serial.printf("Encoder %d: %+d  [total %ld]\n", b[0], count, enc_total);
+        snprintf(oled_line1, sizeof(oled_line1), "Encoder %d", b[0]);
+        snprintf(oled_line2, sizeof(oled_line2), "%+d", count);
+        snprintf(oled_line3, sizeof(oled_line3), "total %ld", enc_total);
+        oled_dirty = true;
+        poll_mask &= ~INT_ENC;
+        break;
+    }
+    case POLL_PAGE:
+        Serial.printf("Page %d of %d shown on the panel\n", b[0], b[1]);
+        snprintf(oled_line1, sizeof(oled_line1), "Page %d/%d", b[0], b[1]);
+        snprintf(oled_line2, sizeof(oled_line2), "");
+        snprintf(oled_line3, sizeof(oled_line3), "");
+        oled_dirty = true;
+        poll_mask &= ~INT_PAGE;
+        break;
+    case POLL_TOUCH:
+        took_events(b);
+        poll_mask &= ~INT_TS;
+        break;
+    }
+    poll_next();
 }
 
 // ── Setup ──────────────────────────────────────────────────────────────────
@@ -114,50 +569,60 @@ void setup() {
 
     Wire.begin(SLAVE_SDA, SLAVE_SCL);
     Wire.setClock(100000);
+    Wire.setTimeOut(I2C_TIMEOUT_MS);
 
     delay(200);
-    send_config();
-    Serial.printf("Config sent. Polling every %d ms...\n", POLL_INTERVAL_MS);
+    negotiate();
+    if (ADAPTIVE_POLL)
+        Serial.printf("Config sent. Polling every %d-%d ms...\n", POLL_FAST_MS, POLL_IDLE_MS);
+    else
+        Serial.printf("Config sent. Polling every %d ms...\n", POLL_INTERVAL_MS);
 
     snprintf(oled_line1, sizeof(oled_line1), "Slave: 0x%02X", SLAVE_ADDR);
-    snprintf(oled_line2, sizeof(oled_line2), "Poll: %dms", POLL_INTERVAL_MS);
+    snprintf(oled_line2, sizeof(oled_line2), "FP I2C Master Test");
     snprintf(oled_line3, sizeof(oled_line3), "Waiting...");
     oled_refresh();
+    // Count from the first poll: a stock slave fails the REG_CAPS read
+    memset(&win, 0, sizeof(win));
+    memset(&logged, 0, sizeof(logged));
+    quiet_since_us = micros();
 }
 
 // ── Loop ───────────────────────────────────────────────────────────────────
 void loop() {
-    static uint32_t last_poll = 0;
+    static uint32_t last_stats = 0;
+    static uint32_t last_window = 0;
 
-    if (millis() - last_poll < POLL_INTERVAL_MS) return;
-    last_poll = millis();
+    poll_step();
+    // The rest only between polls, so nothing comes between a register
+    // select and its read
+    if (poll_state != POLL_IDLE) return;
 
-    uint16_t mask = read_int_mask();
-    if (mask == 0) return;  // nothing pending
-
-    if (mask & INT_READY) {
-        Serial.println("Slave ready signal received");
-        snprintf(oled_line1, sizeof(oled_line1), "Slave READY");
-        snprintf(oled_line2, sizeof(oled_line2), "");
-        snprintf(oled_line3, sizeof(oled_line3), "");
-        oled_refresh();
+    if (millis() - last_window >= RATE_WINDOW_MS) {
+        last_window = millis();
+        rate_polls = win.polls * 1000UL / RATE_WINDOW_MS;
+        rate_failed = win.failed;
+        rate_lat_avg_us = win.lat_n ? win.lat_sum_us / win.lat_n : 0;
+        rate_lat_max_us = win.lat_max_us;
+        memset(&win, 0, sizeof(win));
+        oled_dirty = true;
     }
 
-    if (mask & INT_TS) {
-        uint8_t btn_index = 0xFF;
-        uint8_t btn_state = 0;
-        read_button_event(&btn_index, &btn_state);
-
-        event_count++;
-        const char *label = (btn_index < 18) ? BTN_LABELS[btn_index] : "??";
-        const char *state_str = btn_state ? "PRESS" : "REL";
-
-        Serial.printf("Button %d (%s): %s  [event #%lu]\n",
-                      btn_index, label, state_str, event_count);
+    if (Serial.available()) {
+        int c = Serial.read();
+        if (c >= '0' && c <= '9') {
+            select_page(c - '0');
+            Serial.printf("Page %c selected\n", c);
+        } else if (c == 'l' || c == 'b' || c == 'r') {
+            label_demo(c);
+        }
+    }
 
-        snprintf(oled_line1, sizeof(oled_line1), "#%lu", event_count);
-        snprintf(oled_line2, sizeof(oled_line2), "Btn%d: %s", btn_index, label);
-        snprintf(oled_line3, sizeof(oled_line3), "%s", state_str);
-        oled_refresh();
+    if (STATS_INTERVAL_MS && millis() - last_stats >= STATS_INTERVAL_MS) {
+        last_stats = millis();
+        read_stats();
+        print_master_stats();
     }
+
+    oled_service();
 }
@@ -0,0 +1,374 @@
+/*******************************************************************************
+ * I2C bus recovery on a simulated open-drain bus: src/bus_guard.cpp as it is
+ *
+ * bus_clear() gets the pins of a bus whose lines are the wired AND of what
+ * the master (bus_clear) and the devices on it pull, in simulated time:
+ * delay_us() advances the clock, and a device sees every SCL and SDA edge.
+ * The cases:
+ *  - a slave transmitter cut off mid-read, every bit position (1 to 8 data
+ *    bits left, or only its ACK slot) and every byte value: the bus must be
+ *    free after at most 9 pulses, with the device idle;
+ *  - a slave receiver cut off while it drives its ACK;
+ *  - a device stretching the clock for 300 us: cleared; SCL held low:
+ *    BUS_CLEAR_SCL_LOW after about 1 ms; SDA shorted to ground:
+ *    BUS_CLEAR_SDA_LOW after 9 pulses;
+ *  - the guard: a recovery on the BUS_GUARD_BAD_READS-th bad transfer in a
+ *    row and not before, a failed recovery retried BUS_GUARD_RETRY_MS later
+ *    and not before, a stuck line found BUS_GUARD_STUCK_MS after the first
+ *    low sample;
+ *  - idle sampling of the slave bus while a master polls it at random
+ *    periods, lines sampled mid-transfer at random levels: never a
+ *    recovery. The sampling is src/i2c_recover.cpp's: a sample counts only
+ *    if no transaction reached the slave since the previous tick.
+ * Exit status 1 on any violation.
+ *
+ *   g++ -std=gnu++17 -O2 -I src test/host/bus_guard_sim.cpp src/bus_guard.cpp \
+ *       -o /tmp/bus_guard_sim
+ *   /tmp/bus_guard_sim [-r seed] [-n sampling ticks]
+ ******************************************************************************/
+#include <random>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "bus_guard.h"
+
+#define VIOLATIONS_SHOWN  20
+#define POLL_MS           100     // I2C_RECOVER_POLL_MS
+#define STRETCH_US        300
+#define HZ                100000  // bit time of the master's traffic
+
+static uint32_t violations = 0;
+
+static void violation(const char * fmt, ...)
+{
+    if (++violations > VIOLATIONS_SHOWN) return;
+    va_list ap;
+    va_start(ap, fmt);
+    printf("violation: ");
+    vprintf(fmt, ap);
+    printf("\n");
+    va_end(ap);
+    if (violations == VIOLATIONS_SHOWN) printf("(no more shown)\n");
+}
+
+/* ------------------------------------------------------------------ bus -- */
+
+// A device on the bus. The slave transmitter drives data bit `bit` (0 = MSB)
+// of `byte` while it is in TX; bit 8 is the ACK slot, where it lets go and
+// the master's level decides whether it sends another byte. A receiver in
+// ACK holds SDA low until the next SCL fall. A STOP (SDA rising while SCL is
+// high) makes every device idle.
+enum { DEV_IDLE, DEV_TX, DEV_ACK };
+
+typedef struct {
+    int state = DEV_IDLE;
+    uint8_t byte = 0;
+    int bit = 0;
+    bool acked = false;
+} device_t;
+
+class SimBus {
+public:
+    uint64_t t_ns = 0;
+    device_t dev;
+    bool master_sda = false, master_scl = false;   // pulled low
+    bool sda_short = false, scl_short = false;
+    uint64_t scl_stretch_until_ns = 0;
+    int stops = 0;
+
+    bool sda() const
+    {
+        bool low = master_sda || sda_short || (dev.state == DEV_TX && dev.bit < 8 && !(dev.byte >> (7 - dev.bit) & 1)) ||
+                   dev.state == DEV_ACK;
+        return !low;
+    }
+
+    bool scl() const
+    {
+        return !(master_scl || scl_short || t_ns < scl_stretch_until_ns);
+    }
+
+    // Every change of the master's pulls and of time goes through here, so
+    // the device sees each edge of the lines
+    void step(bool new_sda, bool new_scl, uint64_t dt_ns)
+    {
+        bool sda0 = sda(), scl0 = scl();
+        master_sda = new_sda;
+        master_scl = new_scl;
+        t_ns += dt_ns;
+        edges(sda0, scl0);
+    }
+
+private:
+    void edges(bool sda0, bool scl0)
+    {
+        bool s = scl();
+        if (scl0 && !s) scl_fell();
+        else if (!scl0 && s) scl_rose();
+        // The device may have let go of SDA on the fall: a STOP needs SCL high
+        if (s && scl0 && !sda0 && sda()) {
+            stops++;
+            dev.state = DEV_IDLE;
+        }
+    }
+
+    void scl_rose()
+    {
+        if (dev.state == DEV_TX && dev.bit == 8) dev.acked = !sda();
+    }
+
+    void scl_fell()
+    {
+        if (dev.state == DEV_ACK) {
+            dev.state = DEV_IDLE;
+        } else if (dev.state == DEV_TX) {
+            if (dev.bit < 8) {
+                dev.bit++;
+            } else if (dev.acked) {
+                dev.byte = 0;   // the next byte: zeros, the worst case
+                dev.bit = 0;
+            } else {
+                dev.state = DEV_IDLE;
+            }
+        }
+    }
+};
+
+static bool pin_sda(void * ctx) { return ((SimBus *)ctx)->sda(); }
+static bool pin_scl(void * ctx) { return ((SimBus *)ctx)->scl(); }
+
+static void pull_sda(void * ctx, bool low)
+{
+    SimBus * b = (SimBus *)ctx;
+    b->step(low, b->master_scl, 0);
+}
+
+static void pull_scl(void * ctx, bool low)
+{
+    SimBus * b = (SimBus *)ctx;
+    b->step(b->master_sda, low, 0);
+}
+
+static void wait_us(void * ctx, uint32_t us)
+{
+    SimBus * b = (SimBus *)ctx;
+    b->step(b->master_sda, b->master_scl, us * 1000ULL);
+}
+
+static bus_clear_t clear(SimBus * b, int * pulses)
+{
+    bus_pins_t pins = { pin_sda, pin_scl, pull_sda, pull_scl, wait_us, b };
+    return bus_clear(&pins, pulses);
+}
+
+static const char * clear_name(bus_clear_t r)
+{
+    switch (r) {
+        case BUS_CLEAR_OK:      return "free";
+        case BUS_CLEAR_SCL_LOW: return "SCL held low";
+        default:                return "SDA held low";
+    }
+}
+
+/* ---------------------------------------------------------- bus clear -- */
+
+static void cut_off_cases()
+{
+    int cases = 0, max_pulses = 0;
+    uint64_t max_ns = 0;
+    for (int bit = 0; bit <= 8; bit++) {
+        for (int v = 0; v < 256; v++) {
+            SimBus b;
+            b.dev.state = DEV_TX;
+            b.dev.byte = v;
+            b.dev.bit = bit;
+            int pulses;
+            bus_clear_t r = clear(&b, &pulses);
+            cases++;
+            if (r != BUS_CLEAR_OK || b.dev.state != DEV_IDLE || !b.sda() || !b.scl())
+                violation("cut off at bit %d of 0x%02x: %s, device %s", bit, v, clear_name(r),
+                          b.dev.state == DEV_IDLE ? "idle" : "still sending");
+            if (pulses > 9) violation("cut off at bit %d of 0x%02x: %d pulses", bit, v, pulses);
+            if (b.stops != 1) violation("cut off at bit %d of 0x%02x: %d STOPs", bit, v, b.stops);
+            if (pulses > max_pulses) max_pulses = pulses;
+            if (b.t_ns > max_ns) max_ns = b.t_ns;
+        }
+    }
+    printf("cut-off transmitter: %d cases (9 positions x 256 bytes), all freed, at most %d pulses, "
+           "%.0f us\n", cases, max_pulses, max_ns / 1000.0);
+
+    SimBus b;
+    b.dev.state = DEV_ACK;
+    int pulses;
+    bus_clear_t r = clear(&b, &pulses);
+    if (r != BUS_CLEAR_OK || b.dev.state != DEV_IDLE || pulses != 1)
+        violation("receiver in its ACK: %s after %d pulses", clear_name(r), pulses);
+    printf("cut-off receiver in ACK: %s, %d pulse\n", clear_name(r), pulses);
+
+    // A bus already free: only the STOP
+    SimBus idle;
+    r = clear(&idle, &pulses);
+    if (r != BUS_CLEAR_OK || pulses != 0) violation("free bus: %s after %d pulses", clear_name(r), pulses);
+}
+
+static void line_faults()
+{
+    int pulses;
+    SimBus stretch;
+    stretch.dev.state = DEV_TX;
+    stretch.scl_stretch_until_ns = STRETCH_US * 1000ULL;
+    bus_clear_t r = clear(&stretch, &pulses);
+    if (r != BUS_CLEAR_OK) violation("clock stretched %d us: %s", STRETCH_US, clear_name(r));
+    printf("clock stretched %d us: %s after %.0f us\n", STRETCH_US, clear_name(r), stretch.t_ns / 1000.0);
+
+    SimBus scl;
+    scl.scl_short = true;
+    r = clear(&scl, &pulses);
+    if (r != BUS_CLEAR_SCL_LOW) violation("SCL held low: %s", clear_name(r));
+    if (scl.t_ns < 900000 || scl.t_ns > 1200000) violation("SCL held low: gave up after %.0f us", scl.t_ns / 1000.0);
+    printf("SCL held low: %s after %.0f us\n", clear_name(r), scl.t_ns / 1000.0);
+
+    SimBus sda;
+    sda.sda_short = true;
+    r = clear(&sda, &pulses);
+    if (r != BUS_CLEAR_SDA_LOW || pulses != 9) violation("SDA shorted: %s after %d pulses", clear_name(r), pulses);
+    printf("SDA shorted: %s after %d pulses, %.0f us\n", clear_name(r), pulses, sda.t_ns / 1000.0);
+}
+
+/* -------------------------------------------------------------- guard -- */
+
+static void bad_runs()
+{
+    bus_guard_t g;
+    bus_guard_init(&g, "test");
+    uint32_t now = 0;
+    // Runs one short of the limit, broken by a good transfer: never
+    for (int run = 0; run < 100; run++) {
+        for (int i = 0; i < BUS_GUARD_BAD_READS - 1; i++)
+            if (bus_guard_transfer(&g, false, now += 10)) violation("recovery after %d bad transfers", i + 1);
+        bus_guard_transfer(&g, true, now += 10);
+    }
+    for (int i = 1; i <= BUS_GUARD_BAD_READS; i++) {
+        bool go = bus_guard_transfer(&g, false, now += 10);
+        if (go != (i == BUS_GUARD_BAD_READS)) violation("bad transfer %d: recovery %s", i, go ? "asked" : "not asked");
+    }
+
+    // A recovery that failed: nothing for BUS_GUARD_RETRY_MS, then again
+    bus_guard_recovered(&g, false, 9, 1000, now);
+    uint32_t failed_at = now, retry = 0;
+    for (int i = 0; i < 1000 && !retry; i++)
+        if (bus_guard_transfer(&g, false, now += 10)) retry = now - failed_at;
+    if (retry < BUS_GUARD_RETRY_MS || retry > BUS_GUARD_RETRY_MS + 10)
+        violation("failed recovery retried after %u ms, expected %d", retry, BUS_GUARD_RETRY_MS);
+
+    // One that worked: the next run recovers at once
+    bus_guard_recovered(&g, true, 3, 500, now);
+    int n = 0;
+    while (!bus_guard_transfer(&g, false, now += 10) && n < 100) n++;
+    if (n + 1 != BUS_GUARD_BAD_READS) violation("after a recovery: %d bad transfers to the next", n + 1);
+    if (g.recoveries != 1 || g.failed != 1 || g.pulses != 12)
+        violation("counts: %u recovered, %u failed, %u pulses", g.recoveries, g.failed, g.pulses);
+    printf("bad transfers: recovery on bad transfer %d in a row, a failed one retried after %u ms\n",
+           BUS_GUARD_BAD_READS, retry);
+}
+
+static void stuck_lines()
+{
+    bus_guard_t g;
+    bus_guard_init(&g, "test");
+    uint32_t now = 1000, first_low = 0, found = 0;
+    // One low sample between high ones is traffic, not a stuck line
+    for (int i = 0; i < 1000; i++)
+        if (bus_guard_sample(&g, i % 2, true, now += POLL_MS)) violation("alternating samples: stuck at %u", now);
+    bus_guard_sample(&g, true, true, now += POLL_MS);
+    first_low = now + POLL_MS;
+    for (int i = 0; i < 10 && !found; i++)
+        if (bus_guard_sample(&g, false, true, now += POLL_MS)) found = now - first_low;
+    if (found < BUS_GUARD_STUCK_MS || found >= BUS_GUARD_STUCK_MS + POLL_MS)
+        violation("stuck SDA found %u ms after the first low sample", found);
+
+    // Still stuck after a failed recovery: asked again once the back-off is over
+    bus_guard_recovered(&g, false, 9, 1000, now);
+    uint32_t failed_at = now, again = 0;
+    for (int i = 0; i < 100 && !again; i++)
+        if (bus_guard_sample(&g, true, false, now += POLL_MS)) again = now - failed_at;
+    if (again < BUS_GUARD_RETRY_MS) violation("stuck SCL: recovery again %u ms after a failed one", again);
+    printf("stuck line: found %u ms after the first low sample, again %u ms after a failed recovery\n",
+           found, again);
+}
+
+// A master polling the slave bus: transactions of a 2-byte write and a
+// 2-85-byte read at random periods, back to back up to several ticks apart.
+// Lines are sampled every POLL_MS; a sample inside a transaction sees random
+// levels. The write reaches the slave at its end (the receive callback, as
+// in main.cpp); the read does not count as activity. A second guard, fed
+// every sample, shows what the activity rule is there for.
+static void idle_sampling(uint32_t seed, uint32_t ticks)
+{
+    std::mt19937 rng(seed);
+    bus_guard_t g, raw;
+    bus_guard_init(&g, "slave");
+    bus_guard_init(&raw, "raw");
+    const uint64_t byte_us = 9 * 1000000ULL / HZ;
+    uint64_t start = 0, write_end = 0, end = 0;
+    bool counted = false;
+    uint32_t activity = 0, seen = 0, inside = 0;
+
+    auto next_transaction = [&](uint64_t after) {
+        int kind = rng() % 4;
+        start = after + (kind == 0 ? 0 : kind == 1 ? rng() % 5000 : kind == 2 ? rng() % 50000 : rng() % 400000);
+        write_end = start + 3 * byte_us;
+        end = write_end + (1 + 2 + rng() % 84) * byte_us;
+        counted = false;
+    };
+    next_transaction(0);
+
+    for (uint32_t tick = 1; tick <= ticks; tick++) {
+        uint64_t at = tick * (uint64_t)POLL_MS * 1000;
+        for (;;) {
+            if (!counted && write_end <= at) {
+                activity++;
+                counted = true;
+            }
+            if (end > at) break;
+            next_transaction(end);
+        }
+        bool busy = start <= at && at < end;
+        bool sda = busy ? rng() % 2 : true, scl = busy ? rng() % 2 : true;
+        inside += busy;
+        bool idle = activity == seen;
+        seen = activity;
+        uint32_t now = (uint32_t)(at / 1000);
+        if (bus_guard_sample(&g, sda || !idle, scl || !idle, now))
+            violation("idle sampling: recovery at tick %u (%s)", tick, busy ? "mid-transfer" : "idle bus");
+        if (bus_guard_sample(&raw, sda, scl, now)) bus_guard_recovered(&raw, true, 0, 0, now);
+    }
+    printf("idle sampling: %u ticks, %u inside a transfer, %u recoveries asked "
+           "(%u without the activity rule)\n", ticks, inside, g.stuck_detected, raw.stuck_detected);
+}
+
+/* ------------------------------------------------------------------ main -- */
+
+int main(int argc, char ** argv)
+{
+    uint32_t seed = 1, ticks = 1000000;
+    int opt;
+    while ((opt = getopt(argc, argv, "r:n:")) != -1) {
+        switch (opt) {
+            case 'r': seed = strtoul(optarg, nullptr, 0); break;
+            case 'n': ticks = strtoul(optarg, nullptr, 0); break;
+            default:
+                fprintf(stderr, "options: see the top of test/host/bus_guard_sim.cpp\n");
+                return 2;
+        }
+    }
+    cut_off_cases();
+    line_faults();
+    bad_runs();
+    stuck_lines();
+    idle_sampling(seed, ticks);
+    printf("%s: %u violations\n", violations ? "FAIL" : "PASS", violations);
+    return violations ? 1 : 0;
+}
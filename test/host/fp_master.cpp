@@ -0,0 +1,1328 @@
+/*******************************************************************************
+ * Front panel master on a host: load generator and protocol conformance
+ * check, the gate before new firmware goes into a radio
+ *
+ * Plays the T41 side of the protocol (README "Protocol") against
+ *  - the slave simulated on the host (default): src/fp_proto.cpp as it is in
+ *    the firmware, called the way main.cpp's Wire1 callbacks call it, each
+ *    transaction taking its time on a -k Hz bus. A producer thread reports
+ *    what the UI task reports (presses, releases, toggles, auto-repeats,
+ *    encoder counts, page changes) at the same time, so reads race updates
+ *    as they do on the panel. With -O the slave is the one before
+ *    src/fp_proto.cpp (OldSlave); or
+ *  - a panel on a Linux i2c-dev adapter (-d /dev/i2c-1), with taps injected
+ *    through its console (-i /dev/ttyUSB0, src/script.h) so that the events
+ *    it must send are known. Without -i it polls while someone taps the
+ *    glass, and only the replies are checked.
+ *
+ * Every event the master reads is matched against the producer's log: loss,
+ * duplicates, disorder, a click with the wrong hold time, a repeat of a
+ * button not held are violations, as are a reply of the wrong length (sim),
+ * a state or INT bit the master did not enable (a stock master knows states
+ * 0 and 1, INT_ENC, INT_TS and INT_READY), a REG_TOUCH pad byte that is not
+ * 0, INT_TS with nothing to read, a REG_CONFIG readback that
+ * differs from the write, an unknown register not reading 0, a bus error,
+ * encoder counts or repeats that do not add up, and a REG_STATS poll count
+ * that is not ours. Reported: events per second, latency from the report
+ * (the tap command with -i) to the read that took the event, polls.
+ * Exit status 1 on any violation.
+ *
+ *   g++ -std=gnu++17 -O2 -pthread -I src test/host/fp_master.cpp \
+ *       src/fp_proto.cpp -o /tmp/fp_master
+ *   /tmp/fp_master -s 60                      # the Heltec master's 20 ms poll
+ *   /tmp/fp_master -p 0 -l flood -b 8         # throughput, back to back
+ *   /tmp/fp_master -d /dev/i2c-1 -i /dev/ttyUSB0 -s 600
+ *
+ * Polling (default: REG_INT_MASK every 20 ms, then one REG_TOUCH read if
+ * INT_TS, as test/front_panel_i2c):
+ *   -p MS       poll period; 0: back to back, no gap between transactions
+ *   -A MIN,MAX  adaptive: MIN ms for ADAPT_HOLD_MS after an event, then the
+ *               period doubles every poll up to MAX
+ *   -D          drain: read REG_TOUCH until it is empty on each INT_TS
+ *   -m          no mask: read REG_TOUCH every poll without REG_INT_MASK
+ *               (which is read every 10th poll for encoder and page)
+ *   -b N        batched reads of N events (FP_FEATURE_BATCH)
+ *   -c MS       clicks with an MS click window (FP_FEATURE_CLICK)
+ *   -S          stock master, as test/front_panel_i2c with the pico_frontpanel
+ *               protocol only: REG_CONFIG written with its 2 bytes, no
+ *               REG_CAPS, readback or REG_STATS; without -S the master
+ *               enables repeats and INT_PAGE (protocol version 3 slaves)
+ * Load (sim; -i always taps like tools/soak.py):
+ *   -l human    taps, holds with repeats, toggles, encoder, pages (default)
+ *   -l N        N events per second, momentary taps
+ *   -l flood    events as fast as the queue takes them (retried when full)
+ *   -T FILE     replay a button trace (see read_trace()): a panel serial
+ *               log or a CSV, at its own pace; it sets the run length
+ *   -w FILE     write the events the load made as a panel serial log, a
+ *               trace -T plays again
+ *   -M          mid-update: the producer reports at the start of a
+ *               REG_TOUCH read, while the master's read is on the bus
+ *   -x P        lost reads: with probability P a REG_TOUCH read that took
+ *               events never reaches the master, and the slave recovers its
+ *               bus (fp_bus_reset()): its presses and releases must come
+ *               again, once; its clicks and repeats are gone for good
+ *   -O          old slave: the pico_frontpanel slave main.cpp had before
+ *               src/fp_proto.cpp (6d80064), one event slot that a new event
+ *               overwrites. Overwritten events are counted, not violations
+ * Other: -s seconds of load (default 10), -k bus clock Hz (sim, default
+ * 100000), -t us from address to reply (sim: the slave's onRequest, default
+ * 0), -a slave address (default 0x20), -r seed.
+ *
+ * The compatibility matrix (docs/done_changes.md) is -S and the default
+ * master against -O and the default slave, -T test/host/traces/human_300s.log.
+ ******************************************************************************/
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <unistd.h>
+#include <linux/i2c-dev.h>
+
+#include "fp_proto.h"
+
+#define SLAVE_ADDR       0x20
+#define BUTTONS          54
+#define PAGE_BUTTONS     18
+#define PAGES            3
+#define EXPECT_MAX       (1 << 21)  // events logged; the load stops there
+#define RESYNC_WINDOW    64         // events looked ahead for one read
+#define DRAIN_MAX        64         // REG_TOUCH reads per poll with -D
+#define ADAPT_HOLD_MS    250        // -A: fast polls after an event
+#define SETTLE_MS        2000       // after the load, to read what is left
+#define VIOLATIONS_SHOWN 20
+#define REPEAT_DELAY_MS  500        // as src/repeat.h, at a fixed rate
+#define REPEAT_PERIOD_MS 100
+#define REPEAT_TICK_MS   20
+#define REG_UNKNOWN      0x0C
+#define SIM_SLACK_US     500
+
+enum { LOAD_HUMAN, LOAD_RATE, LOAD_FLOOD };
+
+static uint64_t now_us()
+{
+    using namespace std::chrono;
+    return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+static void sleep_until_us(uint64_t t)
+{
+    uint64_t now = now_us();
+    if (t > now) std::this_thread::sleep_for(std::chrono::microseconds(t - now));
+}
+
+static uint32_t violations = 0;
+
+static void violation(const char * fmt, ...)
+{
+    if (++violations > VIOLATIONS_SHOWN) return;
+    va_list ap;
+    va_start(ap, fmt);
+    printf("violation: ");
+    vprintf(fmt, ap);
+    printf("\n");
+    va_end(ap);
+    if (violations == VIOLATIONS_SHOWN) printf("(no more shown)\n");
+}
+
+/* ------------------------------------------------------ the producer's log -- */
+
+// What the slave was made to send, in order: press and release of a
+// momentary button (a click is both), press or release of a toggle
+typedef struct {
+    uint8_t button, state;
+    bool momentary;
+    uint16_t held_ms;             // release of a momentary button
+    uint16_t repeats;             // release: auto-repeats of the hold
+    uint64_t t_us;                // reported (-i: tap command sent)
+    std::atomic<bool> dropped;    // not queued after all
+    bool alone;                   // master: a momentary press read as such
+} expect_t;
+
+static expect_t * expected;
+static std::atomic<uint32_t> expected_n(0);
+
+// Producer only. Logged before it is reported, so the master never reads
+// an event that is not in the log yet.
+static expect_t * log_event(uint8_t button, uint8_t state, uint16_t held_ms, uint64_t t, bool momentary = false)
+{
+    uint32_t n = expected_n.load(std::memory_order_relaxed);
+    expect_t * e = &expected[n];
+    e->button = button;
+    e->state = state;
+    e->momentary = momentary;
+    e->held_ms = held_ms;
+    e->repeats = 0;
+    e->t_us = t;
+    e->dropped.store(false, std::memory_order_relaxed);
+    expected_n.store(n + 1, std::memory_order_release);
+    return e;
+}
+
+static bool log_full()
+{
+    return expected_n.load(std::memory_order_relaxed) + 2 >= EXPECT_MAX;
+}
+
+/* ---------------------------------------------------------------- buses -- */
+
+class Bus {
+public:
+    virtual ~Bus() {}
+    // One write transaction: register byte + data. False: NAK, bus error
+    virtual bool write(const uint8_t * data, int len) = 0;
+    // One read transaction of `len` bytes (0xFF past the slave's reply, as
+    // on the wire): the length of the slave's reply, which only the sim
+    // knows (a real bus says len), -1 on a bus error
+    virtual int read(uint8_t * out, int len) = 0;
+    uint64_t transactions = 0, bytes = 0;
+};
+
+// The slave of main.cpp before src/fp_proto.cpp (6d80064), callback for
+// callback: one event slot, INT_TS set by each event and cleared by any
+// REG_TOUCH, REG_ENCODER or REG_SWITCH read, REG_TOUCH read again giving
+// the last event again, 0 for any other register, no INT_READY (it was left
+// out, the INT pin shared with the touch controller). The UI reported
+// presses, releases and toggles only. Each report and each callback is
+// atomic here; on the panel a read could also catch a report half written.
+class OldSlave {
+public:
+    // The event the log entry `e` stands for; an unread one it overwrites
+    // is lost
+    bool report(expect_t * e, uint8_t index, uint8_t state)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (unread) {
+            unread->dropped = true;
+            overwritten++;
+        }
+        unread = e;
+        button = index;
+        this->state = state;
+        mask = INT_TS;
+        return true;
+    }
+
+    void receive(const uint8_t * data, int)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        reg = data[0];
+    }
+
+    int request(uint8_t * out)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        int n = 0;
+        switch (reg) {
+            case REG_INT_MASK:
+                out[n++] = mask & 0xFF;
+                out[n++] = mask >> 8;
+                // INT_TS stays until REG_TOUCH is read
+                if (mask == 0 || mask == INT_READY) mask = 0;
+                break;
+            case REG_ENCODER:
+                out[n++] = 0;
+                out[n++] = 0;
+                mask = 0;
+                break;
+            case REG_SWITCH:
+                out[n++] = 0;
+                mask = 0;
+                break;
+            case REG_TOUCH:
+                out[n++] = button;
+                out[n++] = state;
+                out[n++] = 0;
+                out[n++] = 0;
+                out[n++] = 0;
+                mask = 0;
+                unread = nullptr;
+                break;
+            default:
+                out[n++] = 0;
+                break;
+        }
+        return n;
+    }
+
+    uint16_t pending()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return mask;
+    }
+
+    uint32_t overwritten = 0;
+
+private:
+    std::mutex mutex;
+    uint8_t reg = 0xFF, button = 0xFF, state = 0;
+    uint16_t mask = 0;
+    expect_t * unread = nullptr;
+};
+
+static OldSlave * old_slave;
+
+static void slave_receive(const uint8_t * data, int len)
+{
+    if (old_slave) old_slave->receive(data, len);
+    else fp_receive(data, len);
+}
+
+static int slave_request(uint8_t * out, int max)
+{
+    return old_slave ? old_slave->request(out) : fp_request(out, max);
+}
+
+// fp_proto behind the Wire1 callbacks: the address byte goes out, the
+// slave's onRequest fills the reply, its bytes go out; a write is taken at
+// the stop. 9 bits a byte, 2 for start and stop. The bus keeps to the
+// clock on average: the master sleeps once it is SIM_SLACK_US ahead, as a
+// host sleep can take longer than a short transaction.
+class SimBus : public Bus {
+public:
+    SimBus(long hz, int turnaround) : hz(hz), turnaround(turnaround) {}
+
+    bool write(const uint8_t * data, int len) override
+    {
+        if (data[0] == REG_TOUCH) touch_selects++;
+        wire(1 + len);
+        slave_receive(data, len);
+        transactions++;
+        return true;
+    }
+
+    int read(uint8_t * out, int len) override
+    {
+        uint8_t buf[FP_TX_MAX];
+        wire(1);
+        advance(turnaround);
+        int n = slave_request(buf, sizeof(buf));
+        wire(len);
+        for (int i = 0; i < len; i++) out[i] = i < n ? buf[i] : 0xFF;
+        transactions++;
+        return n;
+    }
+
+    // REG_TOUCH selections so far, for -M
+    std::atomic<uint32_t> touch_selects{ 0 };
+
+private:
+    void wire(int n)
+    {
+        bytes += n;
+        advance((n * 9 + 2) * 1000000LL / hz);
+    }
+
+    void advance(uint64_t us)
+    {
+        uint64_t now = now_us();
+        if (busy_until < now) busy_until = now;
+        busy_until += us;
+        if (busy_until > now + SIM_SLACK_US) sleep_until_us(busy_until);
+    }
+
+    long hz;
+    int turnaround;
+    uint64_t busy_until = 0;
+};
+
+// Linux i2c-dev: each write() and read() is one transaction with a stop,
+// as the test master's Wire calls
+class DevBus : public Bus {
+public:
+    bool open(const char * path, int addr)
+    {
+        fd = ::open(path, O_RDWR);
+        if (fd < 0 || ioctl(fd, I2C_SLAVE, addr) < 0) {
+            perror(path);
+            return false;
+        }
+        return true;
+    }
+
+    bool write(const uint8_t * data, int len) override
+    {
+        transactions++;
+        bytes += 1 + len;
+        return ::write(fd, data, len) == len;
+    }
+
+    int read(uint8_t * out, int len) override
+    {
+        transactions++;
+        bytes += 1 + len;
+        return ::read(fd, out, len) == len ? len : -1;
+    }
+
+private:
+    int fd = -1;
+};
+
+/* ------------------------------------------------------------- producers -- */
+
+static SimBus * sim;
+static int load = LOAD_HUMAN;
+static double rate = 0;
+static bool mid_update = false;
+static std::atomic<bool> load_on(true);
+
+// Totals of what the producer did, read after it is joined
+static uint32_t made_drops = 0, made_repeats = 0, made_full = 0;
+static int32_t made_encoder = 0;
+static int made_page = -1;
+
+// -M: hold the report back to the start of the next REG_TOUCH read
+static void wait_touch_read()
+{
+    uint32_t seen = sim->touch_selects.load(std::memory_order_relaxed);
+    uint64_t end = now_us() + 20000;
+    while (sim->touch_selects.load(std::memory_order_relaxed) == seen && now_us() < end)
+        std::this_thread::yield();
+}
+
+// The UI task's calls into the slave. The old slave had none but the
+// button report: a hold was its press and release, and there was no
+// encoder or page to report.
+static bool slave_button(expect_t * e, uint8_t b, uint8_t st)
+{
+    return old_slave ? old_slave->report(e, b, st) : fp_report_button(b, st);
+}
+
+static void slave_repeat(uint8_t b, uint16_t n)
+{
+    if (!old_slave) fp_report_repeat(b, n);
+}
+
+static void slave_encoder(int32_t c)
+{
+    if (!old_slave) fp_report_encoder(c);
+}
+
+static void slave_page(uint8_t page, bool by_user)
+{
+    if (!old_slave) fp_set_page(page, PAGES, by_user);
+}
+
+static void slave_click_poll(uint64_t t)
+{
+    if (!old_slave) fp_click_poll(t / 1000);
+}
+
+static void press(uint8_t b, uint64_t t)
+{
+    expect_t * e = log_event(b, FP_STATE_PRESS, 0, t, true);
+    if (old_slave ? !old_slave->report(e, b, FP_STATE_PRESS) : !fp_report_press(b, t / 1000)) {
+        e->dropped = true;
+        made_drops++;
+    }
+}
+
+static void release(uint8_t b, uint16_t held, uint64_t t, uint16_t repeats = 0)
+{
+    expect_t * e = log_event(b, FP_STATE_RELEASE, held, t, true);
+    e->repeats = repeats;
+    if (old_slave ? !old_slave->report(e, b, FP_STATE_RELEASE) : !fp_report_release(b, held)) {
+        e->dropped = true;
+        made_drops++;
+    }
+}
+
+// The UI task of the simulated panel. Buttons b % 6 == 5 are toggles,
+// b % 6 == 0 repeat while held: a REPEAT_TICK_MS timer hands the repeats due
+// to fp_report_repeat(), none on most ticks, as src/repeat.cpp.
+static void sim_producer(uint32_t seed)
+{
+    std::mt19937 rng(seed);
+    bool checked[BUTTONS] = {};
+    int page = 0, held = -1;
+    uint64_t t = now_us(), due = t, pressed_at = 0, release_at = 0, next_repeat = 0, next_tick = 0;
+    uint32_t flood_i = 0;
+    uint16_t hold_repeats = 0;
+    auto rnd = [&](int lo, int hi) { return lo + (int)(rng() % (hi - lo + 1)); };
+
+    slave_page(0, false);
+    while (load_on.load(std::memory_order_relaxed) && !log_full()) {
+        t = now_us();
+        slave_click_poll(t);
+
+        if (load == LOAD_FLOOD) {
+            uint8_t b = flood_i % BUTTONS, st = (flood_i / BUTTONS) & 1;
+            expect_t * e = log_event(b, st, 0, t);
+            bool queued;
+            while (!(queued = slave_button(e, b, st)) && load_on.load(std::memory_order_relaxed)) {
+                made_full++;
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+                e->t_us = now_us();
+            }
+            // Still full when the load ended
+            if (!queued) e->dropped = true;
+            flood_i++;
+            continue;
+        }
+
+        if (held >= 0 && held % 6 == 0 && t >= next_tick) {
+            uint16_t n = 0;
+            for (; t >= next_repeat; next_repeat += REPEAT_PERIOD_MS * 1000) n++;
+            slave_repeat(held, n);
+            made_repeats += n;
+            hold_repeats += n;
+            next_tick += REPEAT_TICK_MS * 1000;
+        }
+        if (held >= 0 && t >= release_at) {
+            if (mid_update) wait_touch_read();
+            release(held, (now_us() - pressed_at) / 1000, now_us(), hold_repeats);
+            held = -1;
+        }
+        if (held < 0 && t >= due) {
+            if (mid_update) wait_touch_read();
+            t = now_us();
+            if (load == LOAD_RATE) {
+                // A tap every 2 events: pressed half the time
+                uint64_t period = 2e6 / rate;
+                due += period;
+                held = rnd(0, BUTTONS - 1) / 6 * 6 + rnd(1, 4);
+                press(held, t);
+                pressed_at = t;
+                release_at = t + std::max<uint64_t>(period / 2, 1000);
+            } else {
+                int what = rnd(0, 99);
+                int b = page * PAGE_BUTTONS + rnd(0, PAGE_BUTTONS - 1);
+                if (what < 7) {
+                    int c = rnd(1, 5) * (rnd(0, 1) ? 1 : -1);
+                    slave_encoder(c);
+                    made_encoder += c;
+                    due = t + rnd(5, 50) * 1000;
+                } else if (what < 10) {
+                    page = (page + rnd(1, PAGES - 1)) % PAGES;
+                    slave_page(page, true);
+                    made_page = page;
+                    due = t + rnd(20, 200) * 1000;
+                } else if (b % 6 == 5) {
+                    checked[b] = !checked[b];
+                    expect_t * e = log_event(b, checked[b] ? FP_STATE_PRESS : FP_STATE_RELEASE, 0, t);
+                    if (!slave_button(e, b, checked[b])) {
+                        e->dropped = true;
+                        made_drops++;
+                    }
+                    due = t + rnd(0, 100) * 1000;
+                } else {
+                    // Mostly taps, some holds long enough to repeat
+                    int ms = what < 18 ? rnd(600, 1500) : rnd(40, 200);
+                    press(b, t);
+                    held = b;
+                    hold_repeats = 0;
+                    pressed_at = t;
+                    release_at = t + ms * 1000;
+                    next_repeat = t + REPEAT_DELAY_MS * 1000;
+                    next_tick = t + REPEAT_TICK_MS * 1000;
+                    due = release_at + rnd(0, 100) * 1000;
+                }
+            }
+        }
+
+        uint64_t next = held >= 0 ? std::min(release_at, next_tick) : due;
+        next = std::min(next, now_us() + 1000);   // the click window polls
+        sleep_until_us(next);
+    }
+    if (held >= 0) release(held, (now_us() - pressed_at) / 1000, now_us(), hold_repeats);
+}
+
+/* ---------------------------------------------------------------- traces -- */
+
+// A button trace: a panel serial log captured with timestamps (`pio device
+// monitor --filter time`: "hh:mm:ss.mmm > Button 5 (Band-) pressed", the
+// lines main.cpp prints), or a CSV of t_ms,button,state[,repeats] with
+// state 1 press, 0 release, t toggle and the repeats on a release. Lines
+// that are neither are skipped, so a whole log can be given.
+typedef struct {
+    uint32_t t_ms;
+    uint8_t  button;
+    char     what;       // 'p' press, 'r' release, 'c' checked, 'u' unchecked, 't' toggled
+    uint16_t repeats;    // release: auto-repeats of the hold
+} trace_event_t;
+
+static std::vector<trace_event_t> trace;
+
+static bool read_trace(const char * path)
+{
+    FILE * f = fopen(path, "r");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    char line[256], what[64], rest[64];
+    unsigned h, m, sec, ms, b, r;
+    int bad = 0;
+    while (fgets(line, sizeof(line), f)) {
+        trace_event_t ev = {};
+        const char * btn = strstr(line, "> Button ");
+        if (btn && sscanf(line, "%u:%u:%u.%u", &h, &m, &sec, &ms) == 4) {
+            const char * close = strchr(btn, ')');
+            if (sscanf(btn, "> Button %u", &b) != 1 || !close || sscanf(close + 1, "%63s", what) != 1) continue;
+            ev.t_ms = ((h * 60 + m) * 60 + sec) * 1000 + ms;
+            if (!strcmp(what, "pressed")) ev.what = 'p';
+            else if (!strcmp(what, "released")) ev.what = 'r';
+            else if (!strcmp(what, "toggled")) ev.what = strstr(close, "UNCHECKED") ? 'u' : 'c';
+            else if (!strcmp(what, "tapped")) ev.what = 'p';   // encoder zone: press and release at once
+            else continue;
+            if (ev.what == 'r' && sscanf(close + 1, " released after %u", &r) == 1) ev.repeats = r;
+        } else if (sscanf(line, "%u,%u,%63[^,\n]%63[^\n]", &ms, &b, what, rest) >= 3 && line[0] != '#') {
+            ev.t_ms = ms;
+            ev.what = what[0] == 't' ? 't' : what[0] == '1' ? 'p' : what[0] == '0' ? 'r' : 0;
+            if (!ev.what) continue;
+            if (ev.what == 'r' && sscanf(rest, ",%u", &r) == 1) ev.repeats = r;
+        } else {
+            continue;
+        }
+        if (b >= BUTTONS) {
+            bad++;
+            continue;
+        }
+        ev.button = b;
+        trace.push_back(ev);
+        if (!strcmp(what, "tapped")) {
+            ev.what = 'r';
+            trace.push_back(ev);
+        }
+    }
+    fclose(f);
+    if (bad) fprintf(stderr, "%s: %d events of buttons past %d skipped\n", path, bad, BUTTONS - 1);
+    if (trace.empty()) {
+        fprintf(stderr, "%s: no button events\n", path);
+        return false;
+    }
+    std::stable_sort(trace.begin(), trace.end(),
+                     [](const trace_event_t & a, const trace_event_t & b) { return a.t_ms < b.t_ms; });
+    return true;
+}
+
+// The UI task playing a trace at its own pace. A release with repeats
+// spreads them over the hold as sim_producer makes them, any left over
+// going out just before the release.
+static void trace_producer()
+{
+    bool checked[BUTTONS] = {};
+    uint64_t pressed_at[BUTTONS] = {};
+    uint64_t t0 = now_us(), next_repeat = 0, next_tick = 0;
+    uint32_t first = trace[0].t_ms;
+    int rep_button = -1;
+    uint16_t rep_left = 0, rep_done = 0;
+    size_t i = 0;
+
+    while (load_on.load(std::memory_order_relaxed) && !log_full() && i < trace.size()) {
+        uint64_t t = now_us();
+        slave_click_poll(t);
+        if (rep_button >= 0 && rep_left && t >= next_tick) {
+            uint16_t n = 0;
+            for (; t >= next_repeat && n < rep_left; next_repeat += REPEAT_PERIOD_MS * 1000) n++;
+            slave_repeat(rep_button, n);
+            rep_left -= n;
+            rep_done += n;
+            made_repeats += n;
+            next_tick += REPEAT_TICK_MS * 1000;
+        }
+        const trace_event_t & ev = trace[i];
+        uint64_t at = t0 + (uint64_t)(ev.t_ms - first) * 1000;
+        if (t >= at) {
+            uint8_t b = ev.button;
+            if (ev.what == 'p') {
+                press(b, t);
+                pressed_at[b] = t;
+                // The repeats of this hold, from its release
+                rep_button = -1;
+                for (size_t j = i + 1; j < trace.size(); j++) {
+                    if (trace[j].button != b) continue;
+                    if (trace[j].what == 'r' && trace[j].repeats) {
+                        rep_button = b;
+                        rep_left = trace[j].repeats;
+                        rep_done = 0;
+                        next_repeat = t + REPEAT_DELAY_MS * 1000;
+                        next_tick = t + REPEAT_TICK_MS * 1000;
+                    }
+                    break;
+                }
+            } else if (ev.what == 'r') {
+                uint16_t repeats = 0;
+                if (rep_button == b) {
+                    if (rep_left) slave_repeat(b, rep_left);
+                    made_repeats += rep_left;
+                    repeats = rep_done + rep_left;
+                    rep_button = -1;
+                }
+                release(b, pressed_at[b] ? (t - pressed_at[b]) / 1000 : 0, t, repeats);
+                pressed_at[b] = 0;
+            } else {
+                checked[b] = ev.what == 't' ? !checked[b] : ev.what == 'c';
+                expect_t * e = log_event(b, checked[b] ? FP_STATE_PRESS : FP_STATE_RELEASE, 0, t);
+                if (!slave_button(e, b, checked[b])) {
+                    e->dropped = true;
+                    made_drops++;
+                }
+            }
+            i++;
+            continue;
+        }
+        uint64_t next = rep_button >= 0 && rep_left ? std::min(at, next_tick) : at;
+        sleep_until_us(std::min(next, now_us() + 1000));   // the click window polls
+    }
+}
+
+// The events the producer made, as the panel's serial log would show them
+static bool write_trace(const char * path, uint64_t start)
+{
+    FILE * f = fopen(path, "w");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    fprintf(f, "# test/host/fp_master -w: the simulated UI's events, not a panel capture\n");
+    uint32_t n = expected_n.load(std::memory_order_acquire);
+    for (uint32_t i = 0; i < n; i++) {
+        const expect_t & e = expected[i];
+        uint32_t ms = e.t_us > start ? (e.t_us - start) / 1000 : 0;
+        fprintf(f, "%02u:%02u:%02u.%03u > Button %d (b%d) ", ms / 3600000, ms / 60000 % 60, ms / 1000 % 60,
+                ms % 1000, e.button, e.button);
+        if (!e.momentary) fprintf(f, "toggled -> %s\n", e.state ? "CHECKED" : "UNCHECKED");
+        else if (e.state == FP_STATE_PRESS) fprintf(f, "pressed\n");
+        else if (e.repeats) fprintf(f, "released after %u repeats\n", e.repeats);
+        else fprintf(f, "released\n");
+    }
+    fclose(f);
+    return true;
+}
+
+// The panel's console (src/script.h), for -i
+class Console {
+public:
+    bool open(const char * path)
+    {
+        fd = ::open(path, O_RDWR | O_NOCTTY);
+        if (fd < 0) {
+            perror(path);
+            return false;
+        }
+        if (isatty(fd)) {
+            struct termios tio;
+            tcgetattr(fd, &tio);
+            cfmakeraw(&tio);
+            cfsetspeed(&tio, B115200);
+            tcsetattr(fd, TCSANOW, &tio);
+            tcflush(fd, TCIFLUSH);
+        }
+        return true;
+    }
+
+    // Lines up to the one starting with "ok" or "error" (the panel's log
+    // goes by on the same port), all of them in `lines`
+    bool command(const char * text, std::vector<std::string> & lines, int timeout_ms = 10000)
+    {
+        lines.clear();
+        std::string cmd = std::string(text) + "\n";
+        if (::write(fd, cmd.data(), cmd.size()) != (ssize_t)cmd.size()) return false;
+        uint64_t end = now_us() + timeout_ms * 1000LL;
+        while (now_us() < end) {
+            size_t nl = buf.find('\n');
+            if (nl == std::string::npos) {
+                struct pollfd p = { fd, POLLIN, 0 };
+                char chunk[256];
+                int n;
+                if (poll(&p, 1, 100) > 0 && (n = ::read(fd, chunk, sizeof(chunk))) > 0) buf.append(chunk, n);
+                continue;
+            }
+            std::string line = buf.substr(0, nl);
+            buf.erase(0, nl + 1);
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            lines.push_back(line);
+            if (!line.compare(0, 2, "ok") || !line.compare(0, 5, "error")) return true;
+        }
+        return false;
+    }
+
+private:
+    int fd = -1;
+    std::string buf;
+};
+
+static Console console;
+static uint32_t inject_errors = 0;
+
+// Taps the buttons of the page on screen, as tools/soak.py
+static bool inject_setup(int * page, bool * momentary, bool * checked)
+{
+    std::vector<std::string> lines;
+    if (!console.command("state", lines)) {
+        printf("console: no answer to \"state\"\n");
+        return false;
+    }
+    *page = -1;
+    for (auto & l : lines) sscanf(l.c_str(), "panel: page %d", page);
+    if (*page < 0) return false;
+    for (int b = *page * PAGE_BUTTONS; b < (*page + 1) * PAGE_BUTTONS; b++) {
+        char cmd[24];
+        snprintf(cmd, sizeof(cmd), "state %d", b);
+        if (!console.command(cmd, lines) || lines.back().compare(0, 2, "ok")) {
+            printf("console: %s\n", lines.empty() ? "no answer" : lines.back().c_str());
+            return false;
+        }
+        momentary[b] = lines.back().find("momentary") != std::string::npos;
+        checked[b] = lines.back().find("toggle checked") != std::string::npos;
+    }
+    return true;
+}
+
+static void inject_producer(uint32_t seed, int page, const bool * momentary, bool * checked)
+{
+    std::mt19937 rng(seed);
+    std::vector<std::string> lines;
+    while (load_on.load(std::memory_order_relaxed) && !log_full()) {
+        int b = page * PAGE_BUTTONS + rng() % PAGE_BUTTONS;
+        int ms = 40 + rng() % 161;
+        uint64_t t = now_us();
+        expect_t * e[2] = { nullptr, nullptr };
+        if (momentary[b]) {
+            e[0] = log_event(b, FP_STATE_PRESS, 0, t, true);
+            e[1] = log_event(b, FP_STATE_RELEASE, ms, t + ms * 1000, true);
+        } else {
+            checked[b] = !checked[b];
+            e[0] = log_event(b, checked[b] ? FP_STATE_PRESS : FP_STATE_RELEASE, 0, t);
+        }
+        char cmd[32];
+        snprintf(cmd, sizeof(cmd), "tap %d %d", b, ms);
+        if (!console.command(cmd, lines) || lines.back().compare(0, 2, "ok")) {
+            if (inject_errors++ < VIOLATIONS_SHOWN)
+                printf("console: %s: %s\n", cmd, lines.empty() ? "no answer" : lines.back().c_str());
+            for (auto p : e)
+                if (p) p->dropped = true;
+            if (!momentary[b]) checked[b] = !checked[b];
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(rng() % 101));
+    }
+}
+
+/* ---------------------------------------------------------------- master -- */
+
+static Bus * bus;
+static uint16_t features = 0;      // enabled by REG_CONFIG
+static uint16_t slave_has = 0;      // REG_CAPS
+static bool stock = false;          // -S
+static int batch = 1;
+static int click_ms = 0;
+static bool exact_held = true;      // the sim reports the hold time itself
+static bool drain = false, no_mask = false;
+static bool watching = false;       // -d without -i: nothing to match against
+
+// Matching reads against the log
+static uint32_t k = 0;               // next expected event
+static uint8_t last_b = 0xFF, last_st;
+static uint32_t got = 0, lost = 0, dups = 0, unexpected = 0;
+static std::vector<uint32_t> latency;
+static uint32_t worst_us = 0, worst_event = 0;
+static bool held[BUTTONS];
+
+// Polling
+static uint32_t polls = 0, mask_reads = 0, touch_reads = 0, empty_touch = 0, lost_reads = 0;
+static uint32_t repeats_got = 0, clicks_got = 0, repeats_gone = 0, clicks_gone = 0;
+static int32_t encoder_got = 0;
+static int page_got = -1;
+static bool ready_seen = false;
+static double lost_read_p = 0;
+static std::mt19937 master_rng(1);
+
+static void reply_length(const char * reg, int n, int want)
+{
+    if (sim && n != want) violation("%s: %d bytes, expected %d", reg, n, want);
+}
+
+static int read_reg(uint8_t reg, uint8_t * out, int len)
+{
+    if (!bus->write(&reg, 1)) {
+        violation("bus error selecting register 0x%02x", reg);
+        return -1;
+    }
+    int n = bus->read(out, len);
+    if (n < 0) violation("bus error reading register 0x%02x", reg);
+    return n;
+}
+
+// The next logged event, if it is this one. `click_held`: -1 for a press or
+// release read as such, 0 for the press of a click, the click's count for
+// its release.
+static void match(uint8_t b, uint8_t st, int click_held, uint64_t t)
+{
+    if (watching) {
+        if (b < BUTTONS) held[b] = st == FP_STATE_PRESS;
+        got++;
+        return;
+    }
+    uint32_t n = expected_n.load(std::memory_order_acquire);
+    while (k < n && expected[k].dropped.load(std::memory_order_relaxed)) k++;
+    for (uint32_t j = k; j < n && j < k + RESYNC_WINDOW; j++) {
+        expect_t & e = expected[j];
+        if (e.dropped.load(std::memory_order_relaxed) || e.button != b || e.state != st) continue;
+        if (j > k) {
+            uint32_t skipped = 0;
+            for (uint32_t i = k; i < j; i++) skipped += !expected[i].dropped.load(std::memory_order_relaxed);
+            lost += skipped;
+            violation("%u events lost before event %u (button %d %s)", skipped, j, b,
+                      st ? "press" : "release");
+        }
+        if (click_held >= 0 && exact_held && e.held_ms != click_held)
+            violation("event %u: click of button %d held %d ms, released after %d", j, b, click_held, e.held_ms);
+        uint32_t us = t > e.t_us ? t - e.t_us : 0;
+        latency.push_back(us);
+        if (us > worst_us) {
+            worst_us = us;
+            worst_event = j;
+        }
+        if (b < BUTTONS) held[b] = st == FP_STATE_PRESS;
+        e.alone = click_held < 0 && st == FP_STATE_PRESS && e.momentary;
+        last_b = b;
+        last_st = st;
+        k = j + 1;
+        got++;
+        return;
+    }
+    if (b == last_b && st == last_st) {
+        dups++;
+        violation("button %d %s read twice (after event %u)", b, st ? "press" : "release", k);
+    } else {
+        unexpected++;
+        violation("button %d %s not reported (expected event %u of %u)", b, st ? "press" : "release", k, n);
+    }
+}
+
+static void took(const uint8_t * rec, uint64_t t)
+{
+    uint8_t b = rec[0], st = rec[1];
+    uint16_t count = rec[2] | rec[3] << 8;
+    if (b >= BUTTONS) {
+        violation("button %d in an event", b);
+        return;
+    }
+    switch (st) {
+        case FP_STATE_PRESS:
+        case FP_STATE_RELEASE:
+            if (count) violation("button %d %s with count %u", b, st ? "press" : "release", count);
+            match(b, st, -1, t);
+            break;
+        case FP_STATE_REPEAT:
+            if (!(features & FP_FEATURE_REPEAT)) violation("button %d repeat, repeats not enabled", b);
+            if (!count) violation("button %d repeat with count 0", b);
+            if (!held[b]) violation("button %d repeat, not held", b);
+            repeats_got += count;
+            break;
+        case FP_STATE_CLICK:
+            if (!(features & FP_FEATURE_CLICK)) violation("button %d click, clicks not enabled", b);
+            clicks_got++;
+            match(b, FP_STATE_PRESS, 0, t);
+            match(b, FP_STATE_RELEASE, count, t);
+            break;
+        default:
+            violation("button %d state %d", b, st);
+            break;
+    }
+}
+
+// An event of a lost read that the slave does not send again: a click or a
+// repeat. Its press and release leave the log, its repeats the totals.
+static void gone(const uint8_t * rec)
+{
+    uint8_t b = rec[0], st = rec[1];
+    uint16_t count = rec[2] | rec[3] << 8;
+    if (st == FP_STATE_REPEAT) {
+        repeats_gone += count;
+        return;
+    }
+    if (st != FP_STATE_CLICK) return;
+    clicks_gone++;
+    if (watching) return;
+    uint32_t n = expected_n.load(std::memory_order_acquire);
+    int found = 0;
+    for (uint32_t j = k; j < n && j < k + RESYNC_WINDOW && found < 2; j++) {
+        expect_t & e = expected[j];
+        if (e.dropped.load(std::memory_order_relaxed) || e.button != b) continue;
+        if (e.state == (found ? FP_STATE_RELEASE : FP_STATE_PRESS)) {
+            e.dropped = true;
+            found++;
+        }
+    }
+    if (found < 2) violation("lost click of button %d not in the log", b);
+}
+
+// One REG_TOUCH read: the events it took, -1 on a bus error
+static int read_touch(bool after_int)
+{
+    bool batched = features & FP_FEATURE_BATCH;
+    int len = batched ? 1 + batch * FP_BATCH_RECORD : FP_BATCH_RECORD + 1;
+    uint8_t buf[FP_TX_MAX];
+    int n = read_reg(REG_TOUCH, buf, len);
+    if (n < 0) return -1;
+    uint64_t t = now_us();
+    touch_reads++;
+    reply_length("REG_TOUCH", n, len);
+    if (!batched && buf[4]) violation("REG_TOUCH: pad byte %02x", buf[4]);
+
+    int events = batched ? buf[0] : buf[0] != 0xFF;
+    if (batched && events > batch) {
+        violation("REG_TOUCH: %d events in a batch of %d", events, batch);
+        events = batch;
+    }
+    if (events && lost_read_p > 0 && std::uniform_real_distribution<>(0, 1)(master_rng) < lost_read_p) {
+        // Gone on the wire; the slave's bus recovery must send the presses
+        // and releases again
+        lost_reads++;
+        for (int i = 0; i < events; i++) gone(buf + (batched ? 1 + i * FP_BATCH_RECORD : 0));
+        fp_bus_reset();
+        return 0;
+    }
+    for (int i = 0; i < events; i++) took(buf + (batched ? 1 + i * FP_BATCH_RECORD : 0), t);
+    if (!events) {
+        empty_touch++;
+        if (after_int) violation("INT_TS set, REG_TOUCH read empty");
+    }
+    return events;
+}
+
+// One poll; true if it took button events
+static bool poll_once()
+{
+    uint8_t buf[4];
+    uint16_t mask = INT_TS;
+    uint16_t known = INT_ENC | INT_TS | INT_READY | (features & FP_FEATURE_PAGES ? INT_PAGE : 0);
+    polls++;
+    if (!no_mask || polls % 10 == 1) {
+        int n = read_reg(REG_INT_MASK, buf, 2);
+        if (n < 0) return false;
+        mask_reads++;
+        reply_length("REG_INT_MASK", n, 2);
+        mask = buf[0] | buf[1] << 8;
+        if (mask & ~known) violation("INT mask 0x%04x: bits not enabled", mask);
+        if (mask & INT_READY) ready_seen = true;
+        if (no_mask) mask |= INT_TS;
+    }
+    int events = 0;
+    if (mask & INT_TS) {
+        int e = read_touch(!no_mask);
+        if (e > 0) events += e;
+        for (int i = 0; drain && e > 0 && i < DRAIN_MAX; i++)
+            if ((e = read_touch(false)) > 0) events += e;
+    }
+    if (mask & INT_ENC) {
+        int n = read_reg(REG_ENCODER, buf, 2);
+        if (n >= 0) {
+            reply_length("REG_ENCODER", n, 2);
+            if (buf[0] != FP_ENCODER_ID) violation("REG_ENCODER: encoder %d", buf[0]);
+            if (!buf[1]) violation("INT_ENC set, REG_ENCODER count 0");
+            encoder_got += (int8_t)buf[1];
+        }
+    }
+    if (mask & known & INT_PAGE) {
+        int n = read_reg(REG_PAGE, buf, 2);
+        if (n >= 0) {
+            reply_length("REG_PAGE", n, 2);
+            if (!buf[1] || buf[0] >= buf[1]) violation("REG_PAGE: page %d of %d", buf[0], buf[1]);
+            page_got = buf[0];
+        }
+    }
+    return events > 0;
+}
+
+/* ------------------------------------------------------------ conformance -- */
+
+// REG_CAPS, then REG_CONFIG written for the options and read back. A stock
+// master only writes the 2 pico_frontpanel bytes.
+static bool negotiate(int want_batch)
+{
+    uint8_t caps[4], cfg[8] = { REG_CONFIG, 0, 0 }, back[6];
+    int n;
+    if (stock) {
+        if (!bus->write(cfg, 3)) {
+            violation("bus error writing REG_CONFIG");
+            return false;
+        }
+        return true;
+    }
+    if ((n = read_reg(REG_CAPS, caps, 4)) < 0) return false;
+    // A slave without REG_CAPS reads 0 (pico_frontpanel: one byte)
+    if (caps[0]) reply_length("REG_CAPS", n, 4);
+    uint16_t have = caps[1] | caps[2] << 8;
+    printf("slave: protocol version %d, features 0x%04x, batch up to %d\n", caps[0], have, caps[3]);
+    if (caps[0] < 2) have = 0;
+    slave_has = have;
+    if ((have & FP_FEATURE_BATCH) && !caps[3]) violation("REG_CAPS: batched reads of 0 events");
+
+    // Version 2 sent repeats and INT_PAGE without being asked
+    features = (click_ms ? FP_FEATURE_CLICK : 0) | (want_batch > 1 ? FP_FEATURE_BATCH : 0);
+    if (caps[0] >= 3) features |= have & (FP_FEATURE_REPEAT | FP_FEATURE_PAGES);
+    if ((features & have) != features) {
+        printf("slave without %s\n", features & ~have & FP_FEATURE_CLICK ? "clicks" : "batched reads");
+        return false;
+    }
+    batch = want_batch > 1 ? std::min(want_batch, (int)caps[3]) : 1;
+    if (batch != want_batch) printf("batch of %d, the slave's largest\n", batch);
+    int len = 3;
+    if (features) {
+        cfg[len++] = features & 0xFF;
+        cfg[len++] = features >> 8;
+        cfg[len++] = click_ms / 10;
+        cfg[len++] = batch;
+    }
+    if (!bus->write(cfg, len)) {
+        violation("bus error writing REG_CONFIG");
+        return false;
+    }
+    if (caps[0] >= 2 && (n = read_reg(REG_CONFIG, back, 6)) >= 0) {
+        reply_length("REG_CONFIG", n, 6);
+        uint8_t want[6] = { 0, 0, (uint8_t)features, (uint8_t)(features >> 8), (uint8_t)(click_ms / 10),
+                            (uint8_t)batch };
+        if (memcmp(back, want, 6))
+            violation("REG_CONFIG reads back %02x %02x %02x %02x %02x %02x", back[0], back[1], back[2],
+                      back[3], back[4], back[5]);
+    }
+
+    uint8_t unknown[2];
+    if ((n = read_reg(REG_UNKNOWN, unknown, 2)) >= 0) {
+        reply_length("register 0x0c", n, 1);
+        if (unknown[0]) violation("register 0x%02x reads %02x, not 0", REG_UNKNOWN, unknown[0]);
+    }
+    return true;
+}
+
+// REG_STATS words, 0 for those the slave does not have
+static bool read_stats(uint32_t * words)
+{
+    if (!(slave_has & FP_FEATURE_STATS)) return false;
+    uint8_t buf[FP_STAT_COUNT * 4];
+    int n = read_reg(REG_STATS, buf, sizeof(buf));
+    if (n < 0) return false;
+    reply_length("REG_STATS", n, sizeof(buf));
+    for (int i = 0; i < FP_STAT_COUNT; i++)
+        words[i] = buf[4 * i] | buf[4 * i + 1] << 8 | buf[4 * i + 2] << 16 | (uint32_t)buf[4 * i + 3] << 24;
+    int count = std::min<uint32_t>(words[FP_STAT_LAYOUT], FP_STAT_COUNT);
+    if (sim && words[FP_STAT_LAYOUT] != FP_STAT_COUNT) violation("REG_STATS layout %u", words[FP_STAT_LAYOUT]);
+    for (int i = count; i < FP_STAT_COUNT; i++) words[i] = 0;
+    return count > FP_STAT_POLLS;
+}
+
+/* ------------------------------------------------------------------ main -- */
+
+int main(int argc, char ** argv)
+{
+    const char * dev = nullptr, * inject = nullptr, * trace_path = nullptr, * write_path = nullptr;
+    int addr = SLAVE_ADDR, period_ms = 20, fast_ms = 0, slow_ms = 0, want_batch = 1, turnaround = 0;
+    long hz = 100000;
+    double secs = 10;
+    uint32_t seed = 1;
+    int opt;
+    while ((opt = getopt(argc, argv, "d:i:a:p:A:Dmb:c:SOl:T:w:Mx:s:k:t:r:")) != -1) {
+        switch (opt) {
+            case 'd': dev = optarg; break;
+            case 'i': inject = optarg; break;
+            case 'a': addr = strtol(optarg, nullptr, 0); break;
+            case 'p': period_ms = atoi(optarg); break;
+            case 'A': if (sscanf(optarg, "%d,%d", &fast_ms, &slow_ms) != 2) fast_ms = slow_ms = 0; break;
+            case 'D': drain = true; break;
+            case 'm': no_mask = true; break;
+            case 'b': want_batch = atoi(optarg); break;
+            case 'c': click_ms = atoi(optarg) / 10 * 10; break;
+            case 'S': stock = true; break;
+            case 'O': old_slave = new OldSlave; break;
+            case 'l':
+                if (!strcmp(optarg, "human")) load = LOAD_HUMAN;
+                else if (!strcmp(optarg, "flood")) load = LOAD_FLOOD;
+                else if ((rate = atof(optarg)) > 0) load = LOAD_RATE;
+                else return fprintf(stderr, "-l human, flood or events per second\n"), 2;
+                break;
+            case 'T': trace_path = optarg; break;
+            case 'w': write_path = optarg; break;
+            case 'M': mid_update = true; break;
+            case 'x': lost_read_p = atof(optarg); break;
+            case 's': secs = atof(optarg); break;
+            case 'k': hz = atol(optarg); break;
+            case 't': turnaround = atoi(optarg); break;
+            case 'r': seed = strtoul(optarg, nullptr, 0); break;
+            default:
+                fprintf(stderr, "options: see the top of test/host/fp_master.cpp\n");
+                return 2;
+        }
+    }
+    if (dev && (mid_update || lost_read_p > 0 || load != LOAD_HUMAN || trace_path)) {
+        fprintf(stderr, "-M, -x, -l and -T need the simulated slave\n");
+        return 2;
+    }
+    if (stock && (click_ms || want_batch > 1)) {
+        fprintf(stderr, "-S: no clicks or batches in the stock protocol\n");
+        return 2;
+    }
+    // The old slave reads its last event again and has no bus recovery
+    if (old_slave && (dev || no_mask || drain || lost_read_p > 0)) {
+        fprintf(stderr, "-O: not with -d, -m, -D or -x\n");
+        return 2;
+    }
+    if (trace_path) {
+        if (!read_trace(trace_path)) return 1;
+        secs = (trace.back().t_ms - trace[0].t_ms) / 1000.0 + 0.5;
+    }
+    expected = new expect_t[EXPECT_MAX];
+    master_rng.seed(seed);
+
+    int page = 0;
+    bool momentary[BUTTONS] = {}, checked[BUTTONS] = {};
+    DevBus devbus;
+    if (dev) {
+        if (!devbus.open(dev, addr)) return 1;
+        bus = &devbus;
+        exact_held = false;
+        watching = !inject;
+        if (inject && (!console.open(inject) || !inject_setup(&page, momentary, checked))) return 1;
+    } else {
+        sim = new SimBus(hz, turnaround);
+        bus = sim;
+        if (!old_slave) {
+            fp_init(nullptr);
+            fp_set_ready();
+        }
+    }
+    printf("master: %s%s, ", stock ? "stock, " : "", dev ? dev : old_slave ? "old slave" : "simulated slave");
+    if (sim) printf("%ld Hz, ", hz);
+    if (fast_ms) printf("adaptive poll %d..%d ms", fast_ms, slow_ms);
+    else if (period_ms) printf("poll %d ms", period_ms);
+    else printf("back-to-back polls");
+    printf("%s%s%s, load %s", no_mask ? ", no mask" : "", drain ? ", drain" : "", mid_update ? ", mid-update" : "",
+           dev ? (inject ? "console taps" : "none (watching)") : trace_path ? trace_path :
+           load == LOAD_FLOOD ? "flood" : load == LOAD_RATE ? "steady" : "human");
+    if (trace_path) printf(" (%zu events)", trace.size());
+    if (load == LOAD_RATE) printf(" %.0f events/s", rate);
+    if (lost_read_p > 0) printf(", lost reads %g", lost_read_p);
+    printf(", %.0f s\n", secs);
+
+    if (!negotiate(want_batch)) return 1;
+    if (features & FP_FEATURE_BATCH) printf("reads: batch of %d", batch);
+    else printf("reads: stock");
+    if (click_ms) printf(", click window %d ms", click_ms);
+    printf("\n");
+    uint32_t stats0[FP_STAT_COUNT], stats1[FP_STAT_COUNT];
+    bool have_stats = read_stats(stats0);
+    uint32_t mask_reads0 = mask_reads;
+
+    std::thread producer;
+    if (sim && trace_path) producer = std::thread(trace_producer);
+    else if (sim) producer = std::thread(sim_producer, seed);
+    else if (inject) producer = std::thread(inject_producer, seed, page, momentary, checked);
+
+    uint64_t start = now_us(), load_end = start + (uint64_t)(secs * 1e6), settle_end = 0;
+    uint64_t last_event = 0, next = start, first_read = 0, last_read = 0;
+    int period = fast_ms ? slow_ms : period_ms;
+    while (true) {
+        uint64_t t = now_us();
+        if (!settle_end && t >= load_end) {
+            load_on = false;
+            if (producer.joinable()) producer.join();
+            settle_end = now_us() + SETTLE_MS * 1000;
+        }
+        if (settle_end) {
+            // Done once all logged events are read and nothing is pending
+            uint32_t n = expected_n.load(std::memory_order_acquire);
+            while (k < n && expected[k].dropped) k++;
+            uint16_t pending = !sim ? 0 : old_slave ? old_slave->pending() : fp_int_pending();
+            bool idle = !(pending & (INT_TS | INT_ENC | INT_PAGE));
+            if ((k >= n && idle) || t >= settle_end) break;
+        }
+        sleep_until_us(next);
+        uint64_t polled = now_us();
+        if (poll_once()) {
+            last_event = now_us();
+            if (!first_read) first_read = last_event;
+            last_read = last_event;
+        }
+        if (fast_ms) {
+            bool recent = last_event && polled - last_event < ADAPT_HOLD_MS * 1000;
+            period = recent ? fast_ms : std::min(period * 2, slow_ms);
+        }
+        next = polled + period * 1000LL;
+    }
+    uint64_t end = now_us();
+    if (have_stats) read_stats(stats1);
+    if (write_path && !write_trace(write_path, start)) return 1;
+
+    // What was never read
+    uint32_t n = expected_n.load(std::memory_order_acquire), never = 0, logged = 0;
+    for (uint32_t i = 0; i < n; i++) logged += !expected[i].dropped;
+    for (uint32_t i = k; i < n; i++) never += !expected[i].dropped;
+    if (never) {
+        lost += never;
+        violation("%u events never read", never);
+    }
+    // A tap released within the click window cannot have had its press read
+    // on its own (the producer reports nothing else meanwhile)
+    uint32_t split = 0;
+    for (uint32_t i = 0; click_ms && exact_held && i + 1 < k; i++) {
+        const expect_t & p = expected[i], & r = expected[i + 1];
+        if (p.alone && r.momentary && r.button == p.button && r.state == FP_STATE_RELEASE &&
+            r.held_ms + 2 < click_ms && !split++)
+            violation("event %u: button %d tapped %u ms, read as press and release, not a click", i,
+                      p.button, r.held_ms);
+    }
+    if (split > 1) violation("%u taps inside the click window read as press and release", split);
+    if (sim) {
+        // Not enabled, the repeats were never sent (the old slave had none)
+        uint32_t want_repeats = features & FP_FEATURE_REPEAT ? made_repeats : 0;
+        if (repeats_got + repeats_gone != want_repeats)
+            violation("%u repeats read, %u lost with their read, %u made", repeats_got, repeats_gone, want_repeats);
+        int32_t want_encoder = old_slave ? 0 : made_encoder;
+        if (encoder_got != want_encoder) violation("encoder %+d read, %+d turned", encoder_got, want_encoder);
+        if ((features & FP_FEATURE_PAGES) && made_page >= 0 && page_got != made_page)
+            violation("page %d read, page %d shown", page_got, made_page);
+        if (!old_slave && !ready_seen) violation("INT_READY never seen");
+        if (made_drops) violation("%u events dropped by a full queue: the master is too slow", made_drops);
+    }
+    if (have_stats) {
+        uint32_t polled = stats1[FP_STAT_POLLS] - stats0[FP_STAT_POLLS];
+        // Our own REG_INT_MASK reads, the one of read_stats() excluded
+        if (polled != mask_reads - mask_reads0)
+            violation("REG_STATS: %u polls, we polled %u", polled, mask_reads - mask_reads0);
+        if (!sim && stats1[FP_STAT_DROPPED] != stats0[FP_STAT_DROPPED])
+            violation("REG_STATS: %u events dropped", stats1[FP_STAT_DROPPED] - stats0[FP_STAT_DROPPED]);
+    }
+
+    double run = (end - start) / 1e6, reading = (last_read - first_read) / 1e6;
+    printf("events: %u logged, %u read in order; lost %u, duplicated %u, not reported %u\n",
+           logged, got, lost, dups, unexpected);
+    if (load == LOAD_FLOOD && sim)
+        printf("throughput: %.0f events/s (queue full %u times)\n", reading > 0 ? got / reading : 0, made_full);
+    else
+        printf("throughput: %.1f events/s over %.1f s\n", got / run, run);
+    if (!latency.empty()) {
+        std::sort(latency.begin(), latency.end());
+        const expect_t & w = expected[worst_event];
+        printf("latency, %s -> read: median %.2f ms, p99 %.2f ms, max %.2f ms (event %u, button %d %s)\n",
+               inject ? "tap command" : "report", latency[latency.size() / 2] / 1000.0,
+               latency[latency.size() * 99 / 100] / 1000.0, worst_us / 1000.0, worst_event, w.button,
+               w.state ? "press" : "release");
+    }
+    printf("polls: %u (%.0f/s), REG_TOUCH reads %u (%u empty), transactions %lu, %lu bytes",
+           polls, polls / run, touch_reads, empty_touch, (unsigned long)bus->transactions,
+           (unsigned long)bus->bytes);
+    if (sim) printf(", bus busy %.0f%%", bus->bytes * 9 * 100.0 / hz / run);
+    printf("\n");
+    printf("read: clicks %u, repeats %u, encoder %+d", clicks_got, repeats_got, encoder_got);
+    if (sim) printf(", lost reads %u", lost_reads);
+    printf("\n");
+    if (old_slave) printf("old slave: %u events overwritten before they were read\n", old_slave->overwritten);
+    if (clicks_gone || repeats_gone)
+        printf("lost with their read, not sent again: clicks %u, repeats %u\n", clicks_gone, repeats_gone);
+    if (inject_errors) printf("console: %u taps failed\n", inject_errors);
+    printf("%s: %u violations\n", violations ? "FAIL" : "PASS", violations);
+    return violations ? 1 : 0;
+}
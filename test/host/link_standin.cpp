@@ -0,0 +1,196 @@
+/*******************************************************************************
+ * Serial link stand-in: the panel side of fp_link on a pty, for the host
+ * client (tools/fp_link.py) without a board
+ *
+ * Builds src/fp_proto.cpp and src/fp_link.cpp as they are in the firmware:
+ * a producer thread reports button events the way the UI task does, a link
+ * thread runs fp_link the way the fp_link task does (woken by the INT
+ * callback, the line, or the retry time). Event i is button i % 54, state
+ * (i / 54) & 1, which the client's --bench checks for loss, duplicates and
+ * order. Measured here: events per second, and for each event the time from
+ * fp_report_button() to the ACK of the frame that carried it.
+ *
+ *   g++ -std=gnu++17 -O2 -pthread -I src test/host/link_standin.cpp \
+ *       src/fp_proto.cpp src/fp_link.cpp -o /tmp/link_standin
+ *   /tmp/link_standin -n 100000 &
+ *   python3 tools/fp_link.py /tmp/fp_link --bench 100000
+ *
+ * Options: -n events (default 10000), -r events per second (0: as fast as
+ * the queue takes them), -e probability that a frame is corrupted on the
+ * line, each way, -b line rate the panel's writes are paced to (default
+ * UART_LINK_BAUD, 921600; 0: as fast as the pty goes), -p pty link path
+ * (default /tmp/fp_link).
+ ******************************************************************************/
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "fp_proto.h"
+#include "fp_link.h"
+
+static int pty = -1;
+static int wake[2];
+static double noise = 0;
+static long baud = 921600;
+static std::mt19937 rng(1);
+static std::atomic<uint32_t> corrupted(0);
+
+static uint64_t now_us()
+{
+    using namespace std::chrono;
+    return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+static uint32_t now_ms()
+{
+    return now_us() / 1000;
+}
+
+// One byte of the frame flipped with probability `noise`
+static bool corrupt(uint8_t * data, int len)
+{
+    if (noise <= 0 || len <= 0 || std::uniform_real_distribution<>(0, 1)(rng) >= noise) return false;
+    data[rng() % len] ^= 1 << (rng() % 8);
+    corrupted++;
+    return true;
+}
+
+static void line_write(const uint8_t * data, int len)
+{
+    uint8_t f[FP_LINK_OVERHEAD + FP_LINK_PAYLOAD_MAX];
+    memcpy(f, data, len);
+    corrupt(f, len);
+    for (int off = 0; off < len;) {
+        int n = write(pty, f + off, len - off);
+        if (n <= 0) return;
+        off += n;
+    }
+    // The UART takes 10 bits a byte: the writer waits as Serial2.write() does
+    // once the TX buffer is full
+    if (baud > 0) usleep(len * 10000000LL / baud);
+}
+
+// The INT callback: fp_proto changed the mask, wake the link thread
+static void int_cb(bool)
+{
+    char c = 0;
+    if (write(wake[1], &c, 1) < 0) {}
+}
+
+int main(int argc, char ** argv)
+{
+    long count = 10000;
+    double rate = 0;
+    const char * path = "/tmp/fp_link";
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (!strcmp(argv[i], "-n")) count = atol(argv[i + 1]);
+        else if (!strcmp(argv[i], "-r")) rate = atof(argv[i + 1]);
+        else if (!strcmp(argv[i], "-e")) noise = atof(argv[i + 1]);
+        else if (!strcmp(argv[i], "-b")) baud = atol(argv[i + 1]);
+        else if (!strcmp(argv[i], "-p")) path = argv[i + 1];
+    }
+
+    pty = posix_openpt(O_RDWR | O_NOCTTY);
+    if (pty < 0 || grantpt(pty) || unlockpt(pty)) {
+        perror("pty");
+        return 1;
+    }
+    // Raw line, kept open so the master side does not see a hangup before
+    // the client opens it
+    int slave = open(ptsname(pty), O_RDWR | O_NOCTTY);
+    struct termios tio;
+    tcgetattr(slave, &tio);
+    cfmakeraw(&tio);
+    tcsetattr(slave, TCSANOW, &tio);
+    unlink(path);
+    if (symlink(ptsname(pty), path)) {
+        perror(path);
+        return 1;
+    }
+    if (pipe(wake)) return 1;
+    fcntl(wake[0], F_SETFL, O_NONBLOCK);
+    fcntl(wake[1], F_SETFL, O_NONBLOCK);
+    printf("link on %s (%s), %ld events, %ld baud%s\n", path, ptsname(pty), count, baud,
+           noise > 0 ? ", noisy line" : "");
+    fflush(stdout);
+
+    fp_init(int_cb);
+    fp_set_ready();
+    fp_link_init(line_write);
+
+    std::vector<uint64_t> reported(count);
+    std::atomic<bool> go(false);
+    uint32_t full = 0;
+    std::thread producer([&] {
+        while (!go) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        uint64_t start = now_us();
+        for (long i = 0; i < count; i++) {
+            if (rate > 0) {
+                uint64_t due = start + (uint64_t)(i * 1e6 / rate);
+                while (now_us() < due) std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+            reported[i] = now_us();
+            while (!fp_report_button(i % 54, (i / 54) & 1)) {
+                full++;
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+                reported[i] = now_us();
+            }
+        }
+    });
+
+    std::vector<uint32_t> latency;      // report -> ACK, us
+    latency.reserve(count);
+    uint64_t first = 0, last = 0;
+    uint32_t acked = 0, timeout = UINT32_MAX;
+    while (acked < (uint32_t)count) {
+        struct pollfd fds[2] = { { pty, POLLIN, 0 }, { wake[0], POLLIN, 0 } };
+        poll(fds, 2, timeout == UINT32_MAX ? 1000 : (int)timeout + 1);
+        uint8_t buf[256];
+        int n;
+        if (fds[0].revents & POLLIN) {
+            n = read(pty, buf, sizeof(buf));
+            if (n > 0) {
+                corrupt(buf, n);
+                fp_link_input(buf, n, now_ms());
+            }
+        }
+        while (read(wake[0], buf, sizeof(buf)) > 0) {}
+        if (fp_link_connected() && !go) {
+            first = now_us();
+            go = true;
+        }
+        timeout = fp_link_poll(now_ms());
+        uint32_t a = fp_link_stats()->events;
+        if (a > acked) {
+            uint64_t t = now_us();
+            for (; acked < a; acked++) latency.push_back(t - reported[acked]);
+            last = t;
+        }
+    }
+    producer.join();
+
+    const fp_link_stats_t * s = fp_link_stats();
+    std::sort(latency.begin(), latency.end());
+    double secs = (last - first) / 1e6;
+    printf("%ld events in %.3f s: %.0f events/s, %.1f events per frame\n", count, secs,
+           count / secs, (double)count / s->tx_frames);
+    printf("report -> ACK: median %u us, p99 %u us, max %u us\n", latency[latency.size() / 2],
+           latency[latency.size() * 99 / 100], latency.back());
+    printf("frames out %u (retries %u), in %u (dups %u, bad %u), corrupted %u, queue full %u\n",
+           s->tx_frames, s->retries, s->rx_frames, s->rx_dups, s->crc_errors,
+           (unsigned)corrupted, full);
+    // Let the client see the last ACK of its own before the pty goes
+    usleep(200000);
+    unlink(path);
+    return 0;
+}
@@ -0,0 +1,232 @@
+/*******************************************************************************
+ * LVGL pool allocator on a host: src/lv_pool.c as it is, under random use
+ *
+ * Plays seeded random alloc / realloc / free calls on a set of live blocks,
+ * with sizes shaped like LVGL's (mostly small structs and strings, arrays
+ * grown a few bytes at a time, now and then something larger than any
+ * class), and checks:
+ *  - every block is 8-byte aligned and keeps its own fill pattern until it
+ *    is freed (an overlap or a write past a block shows up there), realloc
+ *    keeps the old bytes;
+ *  - the counters follow the live blocks: requested bytes, block bytes,
+ *    blocks used per class, heap fallbacks, the size histogram;
+ *  - once everything is freed, all of them are back to 0.
+ * The same calls then run on malloc() / realloc() / free() for the time per
+ * call. Exit status 1 on any violation.
+ *
+ * The class table comes from the build flags, as on the board:
+ *
+ *   T='{16,192},{32,192},{64,128},{128,64},{256,16}'
+ *   gcc -std=gnu11 -O2 -I src -DLV_POOL_CLASS_TABLE="$T" -c src/lv_pool.c -o /tmp/lv_pool.o
+ *   g++ -std=gnu++17 -O2 -I src -DLV_POOL_CLASS_TABLE="$T" test/host/lv_pool_sim.cpp \
+ *       /tmp/lv_pool.o -o /tmp/lv_pool_sim
+ *   /tmp/lv_pool_sim [-r seed] [-n calls]
+ *
+ * Odd tables ({12,3}, or {12,3},{20,3}) with -fsanitize=address,undefined
+ * check the rounding of block sizes. Without a table it checks the
+ * profiling counters of the malloc() passthrough.
+ ******************************************************************************/
+#include <chrono>
+#include <random>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "lv_pool.h"
+
+#define SLOTS            512
+#define CHECK_EVERY      1000
+#define VIOLATIONS_SHOWN 20
+
+static uint32_t violations = 0;
+
+static void violation(const char * fmt, ...)
+{
+    if (++violations > VIOLATIONS_SHOWN) return;
+    va_list ap;
+    va_start(ap, fmt);
+    printf("violation: ");
+    vprintf(fmt, ap);
+    printf("\n");
+    va_end(ap);
+    if (violations == VIOLATIONS_SHOWN) printf("(no more shown)\n");
+}
+
+typedef struct {
+    uint8_t * p;
+    size_t size;
+    uint32_t id;     // fill pattern
+} slot_t;
+
+typedef struct {
+    void * (*alloc)(size_t);
+    void (*release)(void *);
+    void * (*resize)(void *, size_t);
+    bool pool;       // check lv_pool's counters
+} allocator_t;
+
+static uint8_t fill_byte(uint32_t id, size_t i)
+{
+    return (uint8_t)(id * 131 + i * 7 + 1);
+}
+
+static void fill(slot_t & s, size_t from)
+{
+    for (size_t i = from; i < s.size; i++) s.p[i] = fill_byte(s.id, i);
+}
+
+static void check_fill(const slot_t & s, size_t n, const char * when)
+{
+    for (size_t i = 0; i < n; i++)
+        if (s.p[i] != fill_byte(s.id, i)) {
+            violation("block %u (%zu bytes) %s: byte %zu overwritten", s.id, s.size, when, i);
+            return;
+        }
+}
+
+// LVGL-like request sizes: many 8-64 byte structs and strings, some
+// hundreds, a few over 1 KB (image caches, big labels)
+static size_t pick_size(std::mt19937 & rng)
+{
+    uint32_t r = rng() % 100;
+    if (r < 55) return 1 + rng() % 48;
+    if (r < 85) return 33 + rng() % 96;
+    if (r < 97) return 100 + rng() % 400;
+    return 1000 + rng() % 3000;
+}
+
+// The counters against the live blocks
+static void check_counters(const slot_t * slots, const char * when)
+{
+    const lv_pool_stats_t * ps = lv_pool_stats();
+    uint32_t req = 0, hist[LV_POOL_HIST_BUCKETS] = {};
+    for (int i = 0; i < SLOTS; i++) {
+        if (!slots[i].p) continue;
+        req += slots[i].size;
+        size_t b = (slots[i].size - 1) / LV_POOL_HIST_STEP;
+        hist[b < LV_POOL_HIST_BUCKETS - 1 ? b : LV_POOL_HIST_BUCKETS - 1]++;
+    }
+    if (ps->req_bytes != req) violation("%s: req_bytes %u, live %u", when, ps->req_bytes, req);
+    for (int b = 0; b < LV_POOL_HIST_BUCKETS; b++)
+        if (ps->hist_live[b] != hist[b]) {
+            violation("%s: histogram bucket %d: %u, live %u", when, b, ps->hist_live[b], hist[b]);
+            break;
+        }
+    uint32_t blocks = 0;
+    for (int c = 0; c < ps->classes; c++) {
+        if (ps->cls[c].used > ps->cls[c].count)
+            violation("%s: class %d: %u of %u blocks used", when, c, ps->cls[c].used, ps->cls[c].count);
+        if (ps->cls[c].block % 8) violation("class %d: block of %u bytes", c, ps->cls[c].block);
+        blocks += ps->cls[c].used * ps->cls[c].block;
+    }
+    if (ps->block_bytes != blocks) violation("%s: block_bytes %u, classes %u", when, ps->block_bytes, blocks);
+}
+
+// `calls` random calls; ns per call
+static double play(const allocator_t & a, uint32_t seed, uint32_t calls)
+{
+    static slot_t slots[SLOTS];
+    std::mt19937 rng(seed);
+    uint32_t next_id = 1;
+    double ns = 0;
+    auto since = [](std::chrono::steady_clock::time_point t0) {
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+    };
+    memset(slots, 0, sizeof(slots));
+
+    for (uint32_t n = 0; n < calls; n++) {
+        slot_t & s = slots[rng() % SLOTS];
+        uint32_t what = rng() % 10;
+        if (!s.p) {
+            size_t size = pick_size(rng);
+            auto t0 = std::chrono::steady_clock::now();
+            s.p = (uint8_t *)a.alloc(size);
+            ns += since(t0);
+            if (!s.p) {
+                violation("call %u: %zu bytes not allocated", n, size);
+                continue;
+            }
+            s.size = size;
+            s.id = next_id++;
+            fill(s, 0);
+        } else if (what < 5) {
+            check_fill(s, s.size, "at free");
+            auto t0 = std::chrono::steady_clock::now();
+            a.release(s.p);
+            ns += since(t0);
+            s.p = nullptr;
+        } else if (what < 8) {
+            // Mostly an array growing by an entry, sometimes any new size
+            size_t size = what < 7 ? s.size + 4 + rng() % 13 : pick_size(rng);
+            check_fill(s, s.size, "before realloc");
+            auto t0 = std::chrono::steady_clock::now();
+            uint8_t * p = (uint8_t *)a.resize(s.p, size);
+            ns += since(t0);
+            if (!p) {
+                violation("call %u: realloc to %zu bytes failed", n, size);
+                continue;
+            }
+            size_t kept = size < s.size ? size : s.size;
+            s.p = p;
+            check_fill(s, kept, "after realloc");
+            size_t old = s.size;
+            s.size = size;
+            if (size > old) fill(s, old);
+        } else {
+            check_fill(s, s.size, "in use");
+        }
+        if (s.p && ((uintptr_t)s.p & 7)) violation("call %u: block %u at %p, not 8-byte aligned", n, s.id, s.p);
+        if (a.pool && n % CHECK_EVERY == 0) check_counters(slots, "in use");
+    }
+
+    for (int i = 0; i < SLOTS; i++)
+        if (slots[i].p) {
+            check_fill(slots[i], slots[i].size, "at the end");
+            a.release(slots[i].p);
+            slots[i].p = nullptr;
+        }
+    if (a.pool) {
+        const lv_pool_stats_t * ps = lv_pool_stats();
+        check_counters(slots, "all freed");
+        if (ps->heap_live) violation("all freed: %u heap blocks live", ps->heap_live);
+        for (int c = 0; c < ps->classes; c++)
+            if (ps->cls[c].used) violation("all freed: class %d has %u blocks used", c, ps->cls[c].used);
+        if (lv_pool_waste_pct()) violation("all freed: waste %u%%", lv_pool_waste_pct());
+    }
+    return ns / calls;
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t seed = 1, calls = 2000000;
+    int opt;
+    while ((opt = getopt(argc, argv, "r:n:")) != -1) {
+        switch (opt) {
+            case 'r': seed = strtoul(optarg, nullptr, 0); break;
+            case 'n': calls = strtoul(optarg, nullptr, 0); break;
+            default:
+                fprintf(stderr, "options: see the top of test/host/lv_pool_sim.cpp\n");
+                return 2;
+        }
+    }
+
+    allocator_t pool = { lv_pool_alloc, lv_pool_free, lv_pool_realloc, true };
+    double pool_ns = play(pool, seed, calls);
+    const lv_pool_stats_t * ps = lv_pool_stats();
+
+    allocator_t sys = { malloc, free, realloc, false };
+    double sys_ns = play(sys, seed, calls);
+
+    printf("lv_pool: %d classes, %u arena bytes; %u calls, seed %u\n", ps->classes, ps->pool_bytes, calls, seed);
+    for (int c = 0; c < ps->classes; c++)
+        printf("  class %2d: %5u B x %4u, peak %4u, allocs %8u, spills %6u\n", c, ps->cls[c].block,
+               ps->cls[c].count, ps->cls[c].peak, ps->cls[c].allocs, ps->cls[c].spills);
+    printf("heap fallbacks %u, requested peak %u B, block peak %u B\n", ps->heap_allocs, ps->req_peak,
+           ps->block_peak);
+    printf("time per call: lv_pool %.1f ns, malloc %.1f ns\n", pool_ns, sys_ns);
+    printf("%s: %u violations\n", violations ? "FAIL" : "PASS", violations);
+    return violations ? 1 : 0;
+}
@@ -0,0 +1,349 @@
+"""Pixel kernels shared by the asset tools.
+
+Every kernel exists twice with the same signature and bit-identical output:
+a NumPy version and the original per-pixel Python loop (the `*_ref`
+functions, formerly in gen_button.py, rescale_from_c.py and encode_button.py).
+`assets.py bench` times one against the other; the loops are also the
+fallback when NumPy is not installed. Images are passed around as flat RGBA8888 bytes, row-major.
+"""
+import math
+import re
+
+try:
+    import numpy as np
+except ImportError:
+    np = None
+
+HEX = [f'0x{i:02x}' for i in range(256)]
+HEX_RE = re.compile(r'0x([0-9a-fA-F]{2})')
+
+
+# ── C array text ───────────────────────────────────────────────────────────
+def c_array_body(text):
+    """Text between the first '{' and '};' of a generated image source."""
+    return text[text.index('{') + 1:text.index('};')]
+
+
+def parse_c_bytes_ref(text):
+    return bytes(int(h, 16) for h in HEX_RE.findall(c_array_body(text)))
+
+
+def parse_c_bytes_np(text):
+    return bytes.fromhex(''.join(HEX_RE.findall(c_array_body(text))))
+
+
+def format_c_bytes_ref(data, per_row=16):
+    lines = []
+    for i in range(0, len(data), per_row):
+        chunk = data[i:i+per_row]
+        hex_vals = ', '.join(f'0x{b:02x}' for b in chunk)
+        comma = ',' if i + per_row < len(data) else ''
+        lines.append(f'  {hex_vals}{comma}\n')
+    return ''.join(lines)
+
+
+def format_c_bytes_np(data, per_row=16):
+    vals = [HEX[b] for b in data]
+    rows = [', '.join(vals[i:i+per_row]) for i in range(0, len(vals), per_row)]
+    return '  ' + ',\n  '.join(rows) + '\n' if rows else ''
+
+
+# ── RGB565A8 <-> RGBA8888 ──────────────────────────────────────────────────
+# RGB565A8: all RGB565 pixels first (little-endian), then all alpha bytes.
+# Expansion back to 8 bits replicates the top bits (0x1F -> 0xFF) unless
+# replicate=False, which is the plain shift the checked-in button art was
+# rescaled with (0x1F -> 0xF8).
+def rgba_to_rgb565a8_ref(rgba):
+    rgb_data = bytearray()
+    alpha_data = bytearray()
+    for i in range(0, len(rgba), 4):
+        r, g, b, a = rgba[i:i+4]
+        rgb565 = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+        rgb_data.append(rgb565 & 0xFF)
+        rgb_data.append((rgb565 >> 8) & 0xFF)
+        alpha_data.append(a)
+    return bytes(rgb_data + alpha_data)
+
+
+def rgba_to_rgb565a8_np(rgba):
+    px = np.frombuffer(rgba, dtype=np.uint8).reshape(-1, 4).astype(np.uint16)
+    c = ((px[:, 0] >> 3) << 11) | ((px[:, 1] >> 2) << 5) | (px[:, 2] >> 3)
+    return c.astype('<u2').tobytes() + px[:, 3].astype(np.uint8).tobytes()
+
+
+def rgb565a8_to_rgba_ref(data, n, replicate=True):
+    out = bytearray()
+    for i in range(n):
+        c = data[i * 2] | (data[i * 2 + 1] << 8)
+        r = (c >> 11) & 0x1F
+        g = (c >> 5) & 0x3F
+        b = c & 0x1F
+        if replicate:
+            px = ((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2))
+        else:
+            px = (r << 3, g << 2, b << 3)
+        out += bytes(px + (data[n * 2 + i],))
+    return bytes(out)
+
+
+def rgb565a8_to_rgba_np(data, n, replicate=True):
+    c = np.frombuffer(data, dtype='<u2', count=n).astype(np.uint16)
+    r = (c >> 11) & 0x1F
+    g = (c >> 5) & 0x3F
+    b = c & 0x1F
+    rep = 1 if replicate else 0
+    out = np.empty((n, 4), dtype=np.uint8)
+    out[:, 0] = (r << 3) | (r >> 2) * rep
+    out[:, 1] = (g << 2) | (g >> 4) * rep
+    out[:, 2] = (b << 3) | (b >> 2) * rep
+    out[:, 3] = np.frombuffer(data, dtype=np.uint8, count=n, offset=n * 2)
+    return out.tobytes()
+
+
+# ── Palette quantisation (median cut in RGBA space, indexed encodings) ─────
+def median_cut_ref(colors, n):
+    """colors: dict (r, g, b, a) -> count. Return up to n palette entries."""
+    boxes = [list(colors.items())]
+
+    def spread(box):
+        best = (0, 0)
+        for ch in range(4):
+            vals = [c[ch] for c, _ in box]
+            best = max(best, (max(vals) - min(vals), ch))
+        return best
+
+    while len(boxes) < n:
+        candidates = [(spread(b)[0] * sum(k for _, k in b), i)
+                      for i, b in enumerate(boxes) if len(b) > 1]
+        if not candidates:
+            break
+        _, i = max(candidates)
+        box = boxes.pop(i)
+        ch = spread(box)[1]
+        box.sort(key=lambda e: e[0][ch])
+        total = sum(k for _, k in box)
+        acc = 0
+        for cut, (_, k) in enumerate(box):
+            acc += k
+            if acc * 2 >= total:
+                break
+        cut = min(max(cut + 1, 1), len(box) - 1)
+        boxes.append(box[:cut])
+        boxes.append(box[cut:])
+
+    palette = []
+    for box in boxes:
+        total = sum(k for _, k in box)
+        palette.append(tuple(round(sum(c[ch] * k for c, k in box) / total)
+                             for ch in range(4)))
+    return palette
+
+
+def median_cut_np(colors, n):
+    """Same splits as median_cut_ref, with each box's score computed once."""
+    def box(c, w):
+        rng = c.max(axis=0) - c.min(axis=0)
+        ch = 3 - int(np.argmax(rng[::-1]))      # widest channel, ties to the last
+        return c, w, int(rng[ch]) * int(w.sum()), ch
+
+    boxes = [box(np.array(list(colors), dtype=np.int64).reshape(-1, 4),
+                 np.array(list(colors.values()), dtype=np.int64))]
+    while len(boxes) < n:
+        candidates = [(b[2], i) for i, b in enumerate(boxes) if len(b[0]) > 1]
+        if not candidates:
+            break
+        _, i = max(candidates)
+        c, w, _, ch = boxes.pop(i)
+        order = np.argsort(c[:, ch], kind='stable')
+        c, w = c[order], w[order]
+        acc = np.cumsum(w)
+        cut = int(np.argmax(acc * 2 >= acc[-1]))
+        cut = min(max(cut + 1, 1), len(c) - 1)
+        boxes.append(box(c[:cut], w[:cut]))
+        boxes.append(box(c[cut:], w[cut:]))
+
+    return [tuple(round(int((c[:, ch] * w).sum()) / int(w.sum())) for ch in range(4))
+            for c, w, _, _ in boxes]
+
+
+# ── Nearest palette entry (indexed encodings) ──────────────────────────────
+def nearest_ref(colors, palette):
+    """colors, palette: lists of RGBA tuples. Index of the closest entry."""
+    return [min(range(len(palette)),
+                key=lambda i: sum((p[ch] - palette[i][ch]) ** 2 for ch in range(4)))
+            for p in colors]
+
+
+def nearest_np(colors, palette):
+    c = np.asarray(colors, dtype=np.int32)[:, None, :]
+    p = np.asarray(palette, dtype=np.int32)[None, :, :]
+    return np.argmin(((c - p) ** 2).sum(axis=2), axis=1).tolist()
+
+
+# ── Procedural translucent plastic button ──────────────────────────────────
+def _clamp(v, lo=0, hi=255):
+    return max(lo, min(hi, int(v)))
+
+
+def button_rgba_ref(w, h, corner_r):
+    """Translucent plastic push button: top highlight, translucent middle,
+    bottom shadow, darker sides, specular strip and anti-aliased corners."""
+    out = bytearray()
+    for y in range(h):
+        for x in range(w):
+            nx = x / (w - 1)
+            ny = y / (h - 1)
+
+            dx = max(0, corner_r - x, x - (w - 1 - corner_r))
+            dy = max(0, corner_r - y, y - (h - 1 - corner_r))
+            dist = math.sqrt(dx * dx + dy * dy)
+            if dist > corner_r:
+                out += b'\0\0\0\0'
+                continue
+            edge_alpha = _clamp(255 * (corner_r - dist + 0.5))
+
+            if ny < 0.35:
+                t = ny / 0.35
+                r = _clamp(255 - t * 30)
+                g = _clamp(255 - t * 30)
+                b = _clamp(255 - t * 20)
+                a = _clamp(200 - t * 120)
+            elif ny < 0.65:
+                t = (ny - 0.35) / 0.30
+                r = _clamp(220 - t * 20)
+                g = _clamp(220 - t * 20)
+                b = _clamp(215 - t * 15)
+                a = _clamp(40 + t * 20)
+            else:
+                t = (ny - 0.65) / 0.35
+                r = _clamp(180 - t * 80)
+                g = _clamp(180 - t * 80)
+                b = _clamp(180 - t * 60)
+                a = _clamp(60 + t * 100)
+
+            edge_x = min(nx, 1.0 - nx) * 2.0
+            edge_factor = 0.7 + 0.3 * edge_x
+            r = _clamp(r * edge_factor)
+            g = _clamp(g * edge_factor)
+            b = _clamp(b * edge_factor)
+
+            if ny < 0.15:
+                spec = (0.15 - ny) / 0.15
+                hspec = max(0, 1.0 - abs(nx - 0.5) / 0.3)
+                spec *= hspec
+                r = _clamp(r + spec * 60)
+                g = _clamp(g + spec * 60)
+                b = _clamp(b + spec * 70)
+                a = _clamp(a + spec * 80)
+
+            if ny > 0.90:
+                t = (ny - 0.90) / 0.10
+                r = _clamp(r + t * 30)
+                g = _clamp(g + t * 30)
+                b = _clamp(b + t * 35)
+
+            out += bytes((r, g, b, _clamp(a * edge_alpha / 255)))
+    return bytes(out)
+
+
+def _clamp_np(v):
+    return np.clip(np.trunc(v), 0, 255)
+
+
+def button_rgba_np(w, h, corner_r):
+    y, x = np.mgrid[0:h, 0:w].astype(np.float64)
+    nx = x / (w - 1)
+    ny = y / (h - 1)
+
+    dx = np.maximum(0, np.maximum(corner_r - x, x - (w - 1 - corner_r)))
+    dy = np.maximum(0, np.maximum(corner_r - y, y - (h - 1 - corner_r)))
+    dist = np.sqrt(dx * dx + dy * dy)
+    edge_alpha = _clamp_np(255 * (corner_r - dist + 0.5))
+
+    top = ny < 0.35
+    mid = ~top & (ny < 0.65)
+    t_top = ny / 0.35
+    t_mid = (ny - 0.35) / 0.30
+    t_bot = (ny - 0.65) / 0.35
+    bands = (top, mid)
+    r = np.select(bands, [_clamp_np(255 - t_top * 30), _clamp_np(220 - t_mid * 20)], _clamp_np(180 - t_bot * 80))
+    g = np.select(bands, [_clamp_np(255 - t_top * 30), _clamp_np(220 - t_mid * 20)], _clamp_np(180 - t_bot * 80))
+    b = np.select(bands, [_clamp_np(255 - t_top * 20), _clamp_np(215 - t_mid * 15)], _clamp_np(180 - t_bot * 60))
+    a = np.select(bands, [_clamp_np(200 - t_top * 120), _clamp_np(40 + t_mid * 20)], _clamp_np(60 + t_bot * 100))
+
+    edge_factor = 0.7 + 0.3 * (np.minimum(nx, 1.0 - nx) * 2.0)
+    r = _clamp_np(r * edge_factor)
+    g = _clamp_np(g * edge_factor)
+    b = _clamp_np(b * edge_factor)
+
+    spec_rows = ny < 0.15
+    spec = (0.15 - ny) / 0.15 * np.maximum(0, 1.0 - np.abs(nx - 0.5) / 0.3)
+    r = np.where(spec_rows, _clamp_np(r + spec * 60), r)
+    g = np.where(spec_rows, _clamp_np(g + spec * 60), g)
+    b = np.where(spec_rows, _clamp_np(b + spec * 70), b)
+    a = np.where(spec_rows, _clamp_np(a + spec * 80), a)
+
+    low_rows = ny > 0.90
+    t_low = (ny - 0.90) / 0.10
+    r = np.where(low_rows, _clamp_np(r + t_low * 30), r)
+    g = np.where(low_rows, _clamp_np(g + t_low * 30), g)
+    b = np.where(low_rows, _clamp_np(b + t_low * 35), b)
+    a = _clamp_np(a * edge_alpha / 255)
+
+    out = np.stack([r, g, b, a], axis=-1)
+    out[dist > corner_r] = 0
+    return out.astype(np.uint8).tobytes()
+
+
+# ── Generated LVGL image sources ───────────────────────────────────────────
+def image_c_source(sym, cf, w, h, data, k, includes=()):
+    """C source of a const lv_img_dsc_t named `sym` over `data`."""
+    head = ''.join(f'#include "{inc}"\n' for inc in includes)
+    return (f'#include <lvgl.h>\n{head}\n'
+            '#ifndef LV_ATTRIBUTE_MEM_ALIGN\n'
+            '#define LV_ATTRIBUTE_MEM_ALIGN\n'
+            '#endif\n\n'
+            f'const LV_ATTRIBUTE_MEM_ALIGN uint8_t {sym}_map[] = {{\n'
+            f'{k.format_c_bytes(data)}'
+            '};\n\n'
+            f'const lv_img_dsc_t {sym} = {{\n'
+            f'  .header.cf = {cf},\n'
+            '  .header.always_zero = 0,\n'
+            '  .header.reserved = 0,\n'
+            f'  .header.w = {w},\n'
+            f'  .header.h = {h},\n'
+            f'  .data_size = {len(data)},\n'
+            f'  .data = {sym}_map,\n'
+            '};\n')
+
+
+def image_h_source(name, syms):
+    """Header declaring the lv_img_dsc_t symbols of one or more sources."""
+    guard = f'{name.upper()}_H'
+    decls = ''.join(f'extern const lv_img_dsc_t {sym};\n' for sym in syms)
+    return (f'#ifndef {guard}\n'
+            f'#define {guard}\n\n'
+            '#ifdef __cplusplus\n'
+            'extern "C" {\n'
+            '#endif\n\n'
+            '#include <lvgl.h>\n\n'
+            f'{decls}\n'
+            '#ifdef __cplusplus\n'
+            '}\n'
+            '#endif\n\n'
+            f'#endif /* {guard} */\n')
+
+
+# ── Kernel sets ────────────────────────────────────────────────────────────
+class Kernels:
+    def __init__(self, use_numpy):
+        self.numpy = bool(use_numpy and np is not None)
+        sfx = '_np' if self.numpy else '_ref'
+        g = globals()
+        for name in ('parse_c_bytes', 'format_c_bytes', 'rgba_to_rgb565a8',
+                     'rgb565a8_to_rgba', 'median_cut', 'nearest', 'button_rgba'):
+            setattr(self, name, g[name + sfx])
+
+
+FAST = Kernels(True)
+REF = Kernels(False)
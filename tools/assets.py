@@ -0,0 +1,363 @@
+"""Asset compiler: one entry point for every generated file in src/.
+
+  python assets.py build [--force] [--ref]   regenerate what changed
+  python assets.py bench [--repeat N]        full theme rebuild, loops vs NumPy
+  python assets.py pack [--button B] [-o F]  theme partition image (src/theme.cpp)
+
+The theme is built in steps (THEME below picks the inputs):
+
+  button    src/button_4_106x40.c/.h     base RGB565A8 art, rescaled from
+                                         `button_from` or drawn procedurally
+  variants  src/button_4_106x40_*.c      indexed / chroma-key / RLE encodings
+                                         (encode_button.py)
+  labels    src/label_font.c, baked_labels.c/.h   (bake_labels.py)
+  bootcell  src/boot_cell{,_on}.c/.h    pre-rendered cells for the boot splash
+                                         (boot_cell.py)
+
+`build` keeps a content-hash cache in tools/.asset_cache.json. A step only
+runs when the hash of its inputs, the theme and the tool sources changed,
+or when one of its outputs was edited by hand, and an output file is only
+rewritten when its text differs, so the Arduino build does not recompile
+untouched assets. The pixel work goes through asset_kernels.py: NumPy when
+it is installed, the plain loops with --ref or without NumPy.
+
+`pack` builds the theme into a temp dir instead of src/ and packs its images
+into the container the firmware maps from the "theme" flash partition, so a
+new look is flashed without rebuilding the sketch.
+"""
+import argparse
+import hashlib
+import json
+import os
+import re
+import shutil
+import struct
+import tempfile
+import time
+import zlib
+
+import asset_kernels
+from asset_kernels import FAST, REF, image_c_source, image_h_source
+import bake_labels
+import boot_cell
+import encode_button
+
+TOOLS_DIR = os.path.dirname(os.path.abspath(__file__))
+REPO_DIR = os.path.dirname(TOOLS_DIR)
+SRC_DIR = os.path.join(REPO_DIR, 'src')
+CACHE_PATH = os.path.join(TOOLS_DIR, '.asset_cache.json')
+
+THEME = {
+    # 'rescale': LANCZOS resize of `button_from` (an RGB565A8 C source), which
+    #            reproduces the checked-in art; needs Pillow.
+    # 'procedural': translucent plastic button drawn with corner radius `corner_r`.
+    'button': 'rescale',
+    'button_from': 'src/button_3_wip_2.c',
+    'button_from_size': [116, 68],
+    'corner_r': 8,
+    # LVGL lv_font_fmt_txt source the labels are baked from; step skipped if absent
+    'label_font': bake_labels.DEFAULT_FONT,
+}
+
+NAME = encode_button.NAME
+W = encode_button.W
+H = encode_button.H
+
+
+# ── Steps: (inputs, generator) or a string saying why the step is skipped ──
+def step_button(theme, src_dir):
+    if theme['button'] == 'procedural':
+        return [], lambda k: button_files(k.rgba_to_rgb565a8(k.button_rgba(W, H, theme['corner_r'])), k)
+    try:
+        from PIL import Image
+    except ImportError:
+        return 'Pillow not installed, keeping the checked-in art'
+    path = os.path.join(REPO_DIR, theme['button_from'])
+    sw, sh = theme['button_from_size']
+
+    def rescale(k):
+        with open(path, 'r') as f:
+            raw = k.parse_c_bytes(f.read())
+        img = Image.frombytes('RGBA', (sw, sh), k.rgb565a8_to_rgba(raw, sw * sh, replicate=False))
+        return button_files(k.rgba_to_rgb565a8(img.resize((W, H), Image.LANCZOS).tobytes()), k)
+    return [path], rescale
+
+
+def button_files(data, k):
+    return {f'{NAME}.c': image_c_source(NAME, 'LV_IMG_CF_RGB565A8', W, H, data, k),
+            f'{NAME}.h': image_h_source(NAME, [NAME])}
+
+
+def step_variants(theme, src_dir):
+    path = os.path.join(src_dir, f'{NAME}.c')
+
+    def variants(k):
+        with open(path, 'r') as f:
+            return encode_button.generate(f.read(), k)[0]
+    return [path], variants
+
+
+def step_labels(theme, src_dir):
+    font = theme['label_font']
+    if not os.path.exists(font):
+        return f'{font} not found'
+    main_cpp = os.path.join(REPO_DIR, 'src', 'main.cpp')
+
+    def labels(k):
+        with open(main_cpp, 'r') as f:
+            return bake_labels.generate(font, f.read(), k)[0]
+    return [font, main_cpp], labels
+
+
+def step_bootcell(theme, src_dir):
+    path = os.path.join(src_dir, f'{NAME}.c')
+
+    def cell(k):
+        with open(path, 'r') as f:
+            return boot_cell.generate(f.read(), k)
+    return [path], cell
+
+
+STEPS = [
+    ('button', step_button, ['assets.py', 'asset_kernels.py']),
+    ('variants', step_variants, ['encode_button.py', 'asset_kernels.py']),
+    ('labels', step_labels, ['bake_labels.py', 'asset_kernels.py']),
+    ('bootcell', step_bootcell, ['boot_cell.py', 'encode_button.py', 'asset_kernels.py']),
+]
+
+
+# ── Cache ──────────────────────────────────────────────────────────────────
+def sha256_file(path):
+    with open(path, 'rb') as f:
+        return hashlib.sha256(f.read()).hexdigest()
+
+
+def step_key(name, theme, inputs, code):
+    h = hashlib.sha256(name.encode())
+    h.update(json.dumps(theme, sort_keys=True).encode())
+    for path in [os.path.join(TOOLS_DIR, c) for c in code] + inputs:
+        h.update(os.path.relpath(path, REPO_DIR).encode())
+        h.update(sha256_file(path).encode())
+    return h.hexdigest()
+
+
+def load_cache():
+    try:
+        with open(CACHE_PATH, 'r') as f:
+            return json.load(f)
+    except (OSError, ValueError):
+        return {}
+
+
+def outputs_intact(entry, src_dir):
+    for name, digest in entry['outputs'].items():
+        path = os.path.join(src_dir, name)
+        if not os.path.exists(path) or sha256_file(path) != digest:
+            return False
+    return True
+
+
+# Outputs are written and read without newline translation, so the bytes
+# on disk are the text the cache hashed, on Windows too
+def write_if_changed(path, text):
+    if os.path.exists(path):
+        with open(path, 'r', newline='') as f:
+            if f.read() == text:
+                return False
+    with open(path, 'w', newline='') as f:
+        f.write(text)
+    return True
+
+
+def build(theme, kernels, src_dir, cache, force=False, quiet=False):
+    """Run the steps in order; return the number of files rewritten."""
+    written = 0
+    for name, step, code in STEPS:
+        spec = step(theme, src_dir)
+        if isinstance(spec, str):
+            if not quiet:
+                print(f'{name:<9} skipped: {spec}')
+            continue
+        inputs, generate = spec
+        key = step_key(name, theme, inputs, code)
+        entry = cache.get(name)
+        if not force and entry and entry['key'] == key and outputs_intact(entry, src_dir):
+            if not quiet:
+                print(f'{name:<9} up to date')
+            continue
+        files = generate(kernels)
+        changed = [n for n, text in files.items()
+                   if write_if_changed(os.path.join(src_dir, n), text)]
+        cache[name] = {'key': key,
+                       'outputs': {n: hashlib.sha256(t.encode()).hexdigest()
+                                   for n, t in files.items()}}
+        written += len(changed)
+        if not quiet:
+            print(f'{name:<9} {len(files)} files, {len(changed)} rewritten'
+                  + (f': {", ".join(changed)}' if changed else ''))
+    return written
+
+
+# ── Theme partition image ──────────────────────────────────────────────────
+# Layout and format numbers must match src/theme.cpp
+THEME_MAGIC = 0x314D4854       # "THM1"
+THEME_VERSION = 1
+THEME_ALIGN = 32
+THEME_MAX_ASSETS = 16
+HEADER = struct.Struct('<IHHII')
+ENTRY = struct.Struct('<32sIIHHB3x')
+FORMATS = {
+    'LV_IMG_CF_RGB565A8': 1,
+    'LV_IMG_CF_INDEXED_4BIT': 2,
+    'LV_IMG_CF_INDEXED_8BIT': 3,
+    'LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED': 4,
+    'IMG_RLE_CF': 5,
+    'LV_IMG_CF_ALPHA_8BIT': 6,
+}
+IMAGE_RE = re.compile(r'const lv_img_dsc_t (\w+) = \{\s*\.header\.cf = (\w+),.*?'
+                      r'\.header\.w = (\d+),\s*\.header\.h = (\d+)', re.S)
+
+
+def read_image_source(text, k):
+    """(name, format, w, h, data) of a generated single-image C source, or None."""
+    m = IMAGE_RE.search(text)
+    if not m or m.group(2) not in FORMATS:
+        return None
+    return m.group(1), FORMATS[m.group(2)], int(m.group(3)), int(m.group(4)), k.parse_c_bytes(text)
+
+
+def pack_theme(images):
+    """Container bytes: header, index, then each blob on a THEME_ALIGN boundary."""
+    if len(images) > THEME_MAX_ASSETS:
+        raise ValueError(f'{len(images)} assets, the firmware takes {THEME_MAX_ASSETS}')
+    offset = HEADER.size + ENTRY.size * len(images)
+    index = b''
+    blobs = b''
+    for name, fmt, w, h, data in images:
+        if len(name.encode()) >= 32:
+            raise ValueError(f'{name}: asset names are at most 31 bytes')
+        pad = -(offset + len(blobs)) % THEME_ALIGN
+        blobs += b'\0' * pad
+        index += ENTRY.pack(name.encode(), offset + len(blobs), len(data), w, h, fmt)
+        blobs += data
+    body = index + blobs
+    total = HEADER.size + len(body)
+    return HEADER.pack(THEME_MAGIC, THEME_VERSION, len(images), total, zlib.crc32(body)) + body
+
+
+def partition(csv_path, label):
+    """(offset, size) of a partition in an ESP-IDF partition table CSV."""
+    with open(csv_path, 'r') as f:
+        for line in f:
+            cols = [c.strip() for c in line.split('#')[0].split(',')]
+            if len(cols) >= 5 and cols[0] == label:
+                return int(cols[3], 0), int(cols[4], 0)
+    raise SystemExit(f'{csv_path}: no "{label}" partition')
+
+
+def pack(theme, out_path, csv_path):
+    offset, size = partition(csv_path, 'theme')
+    with tempfile.TemporaryDirectory() as tmp:
+        # Built-in art stays the input if the button step cannot run (no Pillow)
+        shutil.copy(os.path.join(SRC_DIR, f'{NAME}.c'), tmp)
+        rebuild_all(theme, FAST, tmp)
+        images = []
+        for name in sorted(os.listdir(tmp)):
+            if name.endswith('.c'):
+                with open(os.path.join(tmp, name), 'r') as f:
+                    img = read_image_source(f.read(), FAST)
+                if img:
+                    images.append(img)
+    blob = pack_theme(images)
+    if len(blob) > size:
+        raise SystemExit(f'theme is {len(blob)} bytes, the partition holds {size}')
+    with open(out_path, 'wb') as f:
+        f.write(blob)
+
+    for name, fmt, w, h, data in images:
+        print(f'{name:<24} {w:>3}x{h:<3} format {fmt} {len(data):>6} bytes')
+    print(f'{out_path}: {len(blob)} of {size} bytes, crc32 0x{zlib.crc32(blob[HEADER.size:]):08x}')
+    print(f'flash with: esptool.py --chip esp32 write_flash 0x{offset:x} {out_path}')
+
+
+# ── Benchmark ──────────────────────────────────────────────────────────────
+def rebuild_all(theme, kernels, src_dir):
+    """Uncached rebuild of every step into src_dir; return {file: text}."""
+    out = {}
+    timings = {}
+    for name, step, _ in STEPS:
+        spec = step(theme, src_dir)
+        if isinstance(spec, str):
+            continue
+        t0 = time.perf_counter()
+        files = spec[1](kernels)
+        timings[name] = time.perf_counter() - t0
+        for n, text in files.items():
+            with open(os.path.join(src_dir, n), 'w', newline='') as f:
+                f.write(text)
+        out.update(files)
+    return out, timings
+
+
+def bench(repeat):
+    if asset_kernels.np is None:
+        raise SystemExit('bench needs NumPy to compare against the loops')
+    # Both button sources are timed, so the procedural kernel is covered too
+    themes = [('rescale', dict(THEME, button='rescale')),
+              ('procedural', dict(THEME, button='procedural'))]
+    print(f'{"theme":<11} {"step":<9} {"loops ms":>9} {"numpy ms":>9} {"speedup":>8}')
+    for label, theme in themes:
+        best = {}
+        results = {}
+        for kname, kernels in (('ref', REF), ('np', FAST)):
+            for _ in range(repeat):
+                with tempfile.TemporaryDirectory() as tmp:
+                    files, timings = rebuild_all(theme, kernels, tmp)
+                for step, t in timings.items():
+                    best[(kname, step)] = min(best.get((kname, step), t), t)
+            results[kname] = files
+        if results['ref'] != results['np']:
+            raise SystemExit(f'{label}: NumPy and loop kernels produced different files')
+        total = {'ref': 0.0, 'np': 0.0}
+        for step in timings:
+            ref, fast = best[('ref', step)], best[('np', step)]
+            total['ref'] += ref
+            total['np'] += fast
+            print(f'{label:<11} {step:<9} {ref * 1e3:>9.1f} {fast * 1e3:>9.1f} {ref / fast:>7.1f}x')
+        print(f'{label:<11} {"total":<9} {total["ref"] * 1e3:>9.1f} {total["np"] * 1e3:>9.1f} '
+              f'{total["ref"] / total["np"]:>7.1f}x  ({len(results["np"])} files, identical)')
+
+    # No-op rebuild: everything cached, only hashing
+    with tempfile.TemporaryDirectory() as tmp:
+        cache = {}
+        build(THEME, FAST, tmp, cache, quiet=True)
+        t0 = time.perf_counter()
+        n = build(THEME, FAST, tmp, cache, quiet=True)
+        print(f'cached no-op build: {(time.perf_counter() - t0) * 1e3:.1f} ms, {n} files rewritten')
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    sub = parser.add_subparsers(dest='cmd', required=True)
+    p = sub.add_parser('build', help='regenerate changed assets into src/')
+    p.add_argument('--force', action='store_true', help='ignore the cache')
+    p.add_argument('--ref', action='store_true', help='use the pure-Python kernels')
+    p = sub.add_parser('bench', help='time a full theme rebuild, loops vs NumPy')
+    p.add_argument('--repeat', type=int, default=3)
+    p = sub.add_parser('pack', help='pack the theme images for the theme partition')
+    p.add_argument('--button', choices=['rescale', 'procedural'], default=THEME['button'])
+    p.add_argument('-o', '--output', default=os.path.join(REPO_DIR, 'theme.bin'))
+    p.add_argument('--partitions', default=os.path.join(REPO_DIR, 'partitions.csv'))
+    args = parser.parse_args()
+
+    if args.cmd == 'build':
+        kernels = REF if args.ref else FAST
+        print(f'kernels: {"numpy" if kernels.numpy else "python"}')
+        cache = load_cache()
+        build(THEME, kernels, SRC_DIR, cache, force=args.force)
+        with open(CACHE_PATH, 'w') as f:
+            json.dump(cache, f, indent=1, sort_keys=True)
+    elif args.cmd == 'bench':
+        bench(args.repeat)
+    else:
+        pack(dict(THEME, button=args.button), args.output, args.partitions)
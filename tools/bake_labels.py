@@ -0,0 +1,349 @@
+"""Bake the button labels at build time so the firmware skips the font engine.
+Reads the label strings from src/main.cpp (button_labels[]) and the glyphs
+from an LVGL v8 lv_font_fmt_txt font source (default lv_font_montserrat_14.c
+from the Arduino lvgl library), then writes:
+
+  src/label_font.c     subset font `label_font`: only the glyphs the labels use,
+                       with the kerning classes remapped (LABEL_MODE 1)
+  src/baked_labels.c   one LV_IMG_CF_ALPHA_8BIT bitmap per label, rendered with
+                       the same metrics and kerning as lv_label (LABEL_MODE 2)
+  src/baked_labels.h
+
+Usage: python bake_labels.py [path/to/lv_font_montserrat_14.c]
+Also run as the `labels` step of tools/assets.py.
+"""
+import io
+import re
+import os
+import sys
+
+from asset_kernels import FAST
+
+FONT_NAME = 'label_font'
+DEFAULT_FONT = os.path.join(os.path.expanduser('~'), 'Documents', 'Arduino',
+                            'libraries', 'lvgl', 'src', 'font',
+                            'lv_font_montserrat_14.c')
+
+
+# ── Parsing ────────────────────────────────────────────────────────────────
+def c_array(text, name):
+    """Return the integer values of `name[] = { ... };` (comments stripped)."""
+    m = re.search(r'\b' + name + r'\[\]\s*=\s*\{(.*?)\};', text, re.S)
+    if not m:
+        return None
+    body = re.sub(r'/\*.*?\*/', '', m.group(1), flags=re.S)
+    return [int(v, 0) for v in re.findall(r'-?(?:0x[0-9a-fA-F]+|\d+)', body)]
+
+
+def c_field(text, field):
+    m = re.search(r'\.' + field + r'\s*=\s*(-?\w+)', text)
+    return m.group(1) if m else None
+
+
+def parse_font(path):
+    with open(path, 'r', encoding='utf-8') as f:
+        text = f.read()
+
+    font = {'path': path}
+    font['bitmap'] = c_array(text, 'glyph_bitmap')
+    font['glyphs'] = []
+    dsc = re.search(r'glyph_dsc\[\]\s*=\s*\{(.*?)\n\};', text, re.S).group(1)
+    for g in re.findall(r'\{([^{}]*bitmap_index[^{}]*)\}', dsc):
+        font['glyphs'].append({k: int(v) for k, v in
+                               re.findall(r'\.(\w+)\s*=\s*(-?\d+)', g)})
+
+    font['cmap'] = {}      # unicode -> glyph id
+    cmaps = re.search(r'cmaps\[\]\s*=\s*\{(.*?)\n\};', text, re.S).group(1)
+    for c in re.findall(r'\{([^{}]*range_start[^{}]*)\}', cmaps):
+        start = int(c_field(c, 'range_start'))
+        length = int(c_field(c, 'range_length'))
+        gid0 = int(c_field(c, 'glyph_id_start'))
+        ctype = c_field(c, 'type')
+        ulist = c_field(c, 'unicode_list')
+        olist = c_field(c, 'glyph_id_ofs_list')
+        if ctype == 'LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY':
+            for i in range(length):
+                font['cmap'][start + i] = gid0 + i
+        elif ctype == 'LV_FONT_FMT_TXT_CMAP_SPARSE_TINY':
+            for i, ofs in enumerate(c_array(text, ulist)):
+                font['cmap'][start + ofs] = gid0 + i
+        elif ctype == 'LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL':
+            for i, ofs in enumerate(c_array(text, olist)):
+                font['cmap'][start + i] = gid0 + ofs
+        elif ctype == 'LV_FONT_FMT_TXT_CMAP_SPARSE_FULL':
+            for u, ofs in zip(c_array(text, ulist), c_array(text, olist)):
+                font['cmap'][start + u] = gid0 + ofs
+
+    font['bpp'] = int(c_field(text, 'bpp'))
+    font['bitmap_format'] = int(c_field(text, 'bitmap_format') or 0)
+    font['kern_scale'] = int(c_field(text, 'kern_scale') or 16)
+    font['line_height'] = int(c_field(text, 'line_height'))
+    font['base_line'] = int(c_field(text, 'base_line'))
+    font['underline_position'] = int(c_field(text, 'underline_position') or 0)
+    font['underline_thickness'] = int(c_field(text, 'underline_thickness') or 0)
+
+    font['kern'] = None
+    if c_field(text, 'kern_classes') == '1':
+        font['kern'] = {
+            'left': c_array(text, 'kern_left_class_mapping'),
+            'right': c_array(text, 'kern_right_class_mapping'),
+            'values': c_array(text, 'kern_class_values'),
+            'left_cnt': int(c_field(text, 'left_class_cnt')),
+            'right_cnt': int(c_field(text, 'right_class_cnt')),
+        }
+    elif c_field(text, 'kern_dsc') not in (None, 'NULL'):
+        print('warning: pair kerning is not supported, labels are baked without kerning')
+
+    if font['bitmap_format'] != 0:
+        raise ValueError(f'{path}: compressed fonts are not supported')
+    return font
+
+
+def parse_labels(text):
+    """Label strings of button_labels[] in the text of src/main.cpp."""
+    body = re.search(r'button_labels\[\d+\]\s*=\s*\{(.*?)\};', text, re.S).group(1)
+    return re.findall(r'"([^"]*)"', body)
+
+
+# ── Font metrics, same arithmetic as lv_font_get_glyph_dsc_fmt_txt() ──────
+def kern_value(font, gid_left, gid_right):
+    k = font['kern']
+    if k is None or gid_right is None:
+        return 0
+    lc = k['left'][gid_left]
+    rc = k['right'][gid_right]
+    if lc == 0 or rc == 0:
+        return 0
+    return k['values'][(lc - 1) * k['right_cnt'] + (rc - 1)]
+
+
+def glyph_advance(font, gid, gid_next):
+    kv = (kern_value(font, gid, gid_next) * font['kern_scale']) >> 4
+    return (font['glyphs'][gid]['adv_w'] + kv + 8) >> 4
+
+
+def glyph_pixels(font, gid):
+    """Yield (x, y, opa) for every non-zero pixel of a glyph box."""
+    g = font['glyphs'][gid]
+    bpp = font['bpp']
+    bits = g['bitmap_index'] * 8
+    data = font['bitmap']
+    mask = (1 << bpp) - 1
+    for y in range(g['box_h']):
+        for x in range(g['box_w']):
+            byte = data[bits >> 3]
+            v = (byte >> (8 - bpp - (bits & 7))) & mask
+            bits += bpp
+            if v:
+                yield x, y, v * 255 // mask
+
+
+def render_label(font, text):
+    gids = [font['cmap'][ord(ch)] for ch in text]
+    width = sum(glyph_advance(font, g, gids[i + 1] if i + 1 < len(gids) else None)
+                for i, g in enumerate(gids))
+    height = font['line_height']
+    alpha = bytearray(width * height)
+    x = 0
+    for i, gid in enumerate(gids):
+        g = font['glyphs'][gid]
+        ox = x + g['ofs_x']
+        oy = height - font['base_line'] - g['box_h'] - g['ofs_y']
+        for px, py, opa in glyph_pixels(font, gid):
+            tx, ty = ox + px, oy + py
+            if 0 <= tx < width and 0 <= ty < height:
+                a = alpha[ty * width + tx]
+                alpha[ty * width + tx] = a + opa - a * opa // 255
+        x += glyph_advance(font, gid, gids[i + 1] if i + 1 < len(gids) else None)
+    return width, height, alpha
+
+
+# ── Output ─────────────────────────────────────────────────────────────────
+def write_array(f, decl, data, k, signed=False):
+    f.write(f'{decl} = {{\n')
+    if signed:
+        for i in range(0, len(data), 16):
+            comma = ',' if i + 16 < len(data) else ''
+            f.write('  ' + ', '.join(str(v) for v in data[i:i+16]) + f'{comma}\n')
+    else:
+        f.write(k.format_c_bytes(bytes(data)))
+    f.write('};\n\n')
+
+
+def subset_font(font, chars, k=FAST):
+    """Return (C source, flash bytes) of a font holding only `chars`."""
+    cps = sorted(set(ord(c) for c in chars))
+    old_gids = [font['cmap'][cp] for cp in cps]
+    bpp = font['bpp']
+
+    bitmap = []
+    glyphs = [{'bitmap_index': 0, 'adv_w': 0, 'box_w': 0, 'box_h': 0, 'ofs_x': 0, 'ofs_y': 0}]
+    for gid in old_gids:
+        g = dict(font['glyphs'][gid])
+        nbytes = (g['box_w'] * g['box_h'] * bpp + 7) // 8
+        start = g['bitmap_index']
+        g['bitmap_index'] = len(bitmap)
+        bitmap += font['bitmap'][start:start + nbytes]
+        glyphs.append(g)
+
+    kern = font['kern']
+    if kern:
+        used_l = sorted(set(kern['left'][g] for g in old_gids) - {0})
+        used_r = sorted(set(kern['right'][g] for g in old_gids) - {0})
+        lmap = {c: i + 1 for i, c in enumerate(used_l)}
+        rmap = {c: i + 1 for i, c in enumerate(used_r)}
+        left = [0] + [lmap.get(kern['left'][g], 0) for g in old_gids]
+        right = [0] + [rmap.get(kern['right'][g], 0) for g in old_gids]
+        values = [kern['values'][(l - 1) * kern['right_cnt'] + (r - 1)]
+                  for l in used_l for r in used_r]
+
+    f = io.StringIO()
+    f.write(f'/* Subset of {os.path.basename(font["path"])} generated by tools/bake_labels.py */\n')
+    f.write('/* Glyphs: ' + ''.join(chr(cp) for cp in cps).replace('*/', '* /') + ' */\n')
+    f.write('#include <lvgl.h>\n\n')
+    write_array(f, 'static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[]', bitmap, k)
+    f.write('static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {\n')
+    for i, g in enumerate(glyphs):
+        comma = ',' if i + 1 < len(glyphs) else ''
+        f.write(f'  {{.bitmap_index = {g["bitmap_index"]}, .adv_w = {g["adv_w"]}, '
+                f'.box_w = {g["box_w"]}, .box_h = {g["box_h"]}, '
+                f'.ofs_x = {g["ofs_x"]}, .ofs_y = {g["ofs_y"]}}}{comma}\n')
+    f.write('};\n\n')
+    f.write('static const uint16_t unicode_list[] = {\n  ')
+    f.write(', '.join(str(cp - cps[0]) for cp in cps))
+    f.write('\n};\n\n')
+    f.write('static const lv_font_fmt_txt_cmap_t cmaps[] = {\n')
+    f.write(f'  {{\n    .range_start = {cps[0]}, .range_length = {cps[-1] - cps[0] + 1}, '
+            f'.glyph_id_start = 1,\n')
+    f.write(f'    .unicode_list = unicode_list, .glyph_id_ofs_list = NULL, '
+            f'.list_length = {len(cps)}, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY\n  }}\n')
+    f.write('};\n\n')
+    kern_bytes = 0
+    if kern:
+        write_array(f, 'static const uint8_t kern_left_class_mapping[]', left, k)
+        write_array(f, 'static const uint8_t kern_right_class_mapping[]', right, k)
+        write_array(f, 'static const int8_t kern_class_values[]', values or [0], k, signed=True)
+        f.write('static const lv_font_fmt_txt_kern_classes_t kern_classes = {\n')
+        f.write('  .class_pair_values   = kern_class_values,\n')
+        f.write('  .left_class_mapping  = kern_left_class_mapping,\n')
+        f.write('  .right_class_mapping = kern_right_class_mapping,\n')
+        f.write(f'  .left_class_cnt      = {len(used_l)},\n')
+        f.write(f'  .right_class_cnt     = {len(used_r)},\n')
+        f.write('};\n\n')
+        kern_bytes = len(left) + len(right) + len(values) + 8
+    f.write('static lv_font_fmt_txt_glyph_cache_t cache;\n')
+    f.write('static const lv_font_fmt_txt_dsc_t font_dsc = {\n')
+    f.write('  .glyph_bitmap = glyph_bitmap,\n')
+    f.write('  .glyph_dsc = glyph_dsc,\n')
+    f.write('  .cmaps = cmaps,\n')
+    f.write(f'  .kern_dsc = {"&kern_classes" if kern else "NULL"},\n')
+    f.write(f'  .kern_scale = {font["kern_scale"]},\n')
+    f.write('  .cmap_num = 1,\n')
+    f.write(f'  .bpp = {bpp},\n')
+    f.write(f'  .kern_classes = {1 if kern else 0},\n')
+    f.write('  .bitmap_format = 0,\n')
+    f.write('  .cache = &cache\n')
+    f.write('};\n\n')
+    f.write(f'const lv_font_t {FONT_NAME} = {{\n')
+    f.write('  .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,\n')
+    f.write('  .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,\n')
+    f.write(f'  .line_height = {font["line_height"]},\n')
+    f.write(f'  .base_line = {font["base_line"]},\n')
+    f.write('  .subpx = LV_FONT_SUBPX_NONE,\n')
+    f.write(f'  .underline_position = {font["underline_position"]},\n')
+    f.write(f'  .underline_thickness = {font["underline_thickness"]},\n')
+    f.write('  .dsc = &font_dsc\n')
+    f.write('};\n')
+
+    size = len(bitmap) + len(glyphs) * 8 + len(cps) * 2 + 16 + kern_bytes
+    return f.getvalue(), size
+
+
+def font_flash_size(font):
+    k = font['kern']
+    kern_bytes = (len(k['left']) + len(k['right']) + len(k['values']) + 8) if k else 0
+    return len(font['bitmap']) + len(font['glyphs']) * 8 + kern_bytes
+
+
+def baked_sources(labels, images, k=FAST):
+    """Return the text of (baked_labels.c, baked_labels.h)."""
+    f = io.StringIO()
+    f.write('/* Button labels pre-rendered by tools/bake_labels.py */\n')
+    f.write('#include <lvgl.h>\n')
+    f.write('#include "baked_labels.h"\n\n')
+    f.write('#ifndef LV_ATTRIBUTE_MEM_ALIGN\n')
+    f.write('#define LV_ATTRIBUTE_MEM_ALIGN\n')
+    f.write('#endif\n\n')
+    for i, (w, h, alpha) in enumerate(images):
+        f.write(f'/* "{labels[i]}" {w}x{h} */\n')
+        write_array(f, f'static const LV_ATTRIBUTE_MEM_ALIGN uint8_t baked_label_{i}_map[]',
+                    alpha or bytearray(1), k)
+    f.write(f'const lv_img_dsc_t baked_labels[BAKED_LABEL_COUNT] = {{\n')
+    for i, (w, h, alpha) in enumerate(images):
+        comma = ',' if i + 1 < len(images) else ''
+        f.write(f'  {{ .header.cf = LV_IMG_CF_ALPHA_8BIT, .header.always_zero = 0, '
+                f'.header.reserved = 0, .header.w = {w}, .header.h = {h}, '
+                f'.data_size = {len(alpha)}, .data = baked_label_{i}_map }}{comma}\n')
+    f.write('};\n')
+    src_c = f.getvalue()
+
+    f = io.StringIO()
+    f.write('#ifndef BAKED_LABELS_H\n')
+    f.write('#define BAKED_LABELS_H\n\n')
+    f.write('#ifdef __cplusplus\n')
+    f.write('extern "C" {\n')
+    f.write('#endif\n\n')
+    f.write('#include <lvgl.h>\n\n')
+    f.write(f'#define BAKED_LABEL_COUNT {len(labels)}\n\n')
+    f.write('/* Subset font with only the glyphs used by the labels (src/label_font.c) */\n')
+    f.write(f'extern const lv_font_t {FONT_NAME};\n\n')
+    f.write('/* One alpha-only bitmap per label, recoloured by the img_recolor style */\n')
+    f.write('extern const lv_img_dsc_t baked_labels[BAKED_LABEL_COUNT];\n\n')
+    f.write('#ifdef __cplusplus\n')
+    f.write('}\n')
+    f.write('#endif\n\n')
+    f.write('#endif /* BAKED_LABELS_H */\n')
+    return src_c, f.getvalue()
+
+
+def generate(font_path, main_cpp_text, k=FAST):
+    """Return ({file name: C source}, report lines)."""
+    labels = parse_labels(main_cpp_text)
+    font = parse_font(font_path)
+    missing = sorted(set(c for c in ''.join(labels) if ord(c) not in font['cmap']))
+    if missing:
+        raise ValueError(f'{font_path}: no glyph for {missing}')
+
+    src, subset_size = subset_font(font, ''.join(labels), k)
+    images = [render_label(font, text) for text in labels]
+    baked_c, baked_h = baked_sources(labels, images, k)
+    files = {f'{FONT_NAME}.c': src, 'baked_labels.c': baked_c, 'baked_labels.h': baked_h}
+
+    full_size = font_flash_size(font)
+    baked_size = sum(len(a) + 12 for _, _, a in images)
+    report = [
+        f'Labels: {len(labels)}, distinct glyphs: {len(set("".join(labels)))}',
+        f'{os.path.basename(font_path):<28} {full_size:>6} bytes (full font)',
+        f'{FONT_NAME + ".c":<28} {subset_size:>6} bytes (LABEL_MODE 1)',
+        f'{"baked_labels.c":<28} {baked_size:>6} bytes (LABEL_MODE 2)',
+        f'Flash saved if the full font is disabled in lv_conf.h: '
+        f'{full_size - subset_size} (mode 1), {full_size - baked_size} (mode 2)',
+    ]
+    return files, report
+
+
+if __name__ == '__main__':
+    script_dir = os.path.dirname(os.path.abspath(__file__))
+    src_dir = os.path.join(script_dir, '..', 'src')
+    font_path = sys.argv[1] if len(sys.argv) > 1 else DEFAULT_FONT
+
+    with open(os.path.join(src_dir, 'main.cpp'), 'r') as f:
+        main_cpp = f.read()
+    try:
+        files, report = generate(font_path, main_cpp)
+    except ValueError as e:
+        raise SystemExit(str(e))
+    for name, text in files.items():
+        with open(os.path.join(src_dir, name), 'w') as f:
+            f.write(text)
+    print('\n'.join(report))
@@ -0,0 +1,76 @@
+"""Pre-render one inactive button cell for the boot splash (src/boot.cpp).
+
+Composes what LVGL draws for a released, unchecked cell, without the label:
+the warm amber background, the 1 px 70 % dark border and the button art
+centred in it (clipped to the cell), alpha-blended in 8-bit and stored as
+little-endian RGB565 (LV_IMG_CF_TRUE_COLOR, LV_COLOR_16_SWAP 0):
+
+  boot_cell.c / boot_cell.h   80x53, 8480 bytes
+  boot_cell_on.c              the same on the checked (orange) background,
+                              for toggles restored from NVS (src/persist.cpp)
+
+The firmware blits it 18 times straight from flash and prints the labels
+with the Arduino_GFX built-in font until LVGL draws its first frame, so a
+close match is enough. Run as the `bootcell` step of tools/assets.py.
+"""
+from asset_kernels import FAST, image_c_source, image_h_source
+import encode_button
+
+NAME = 'boot_cell'
+CELL_W = 240 // 3          # BTN_WIDTH in main.cpp
+CELL_H = 320 // 6          # BTN_HEIGHT
+BG = 0xFFE8D0              # inactive background
+BG_ON = 0xFF6600           # checked toggle background
+BORDER = 0x404040
+BORDER_OPA = 178           # LV_OPA_70
+
+
+def rgb(hex_color):
+    return (hex_color >> 16) & 0xFF, (hex_color >> 8) & 0xFF, hex_color & 0xFF
+
+
+def mix(dst, src, a):
+    return tuple((s * a + d * (255 - a) + 127) // 255 for s, d in zip(src, dst))
+
+
+def to_rgb565(px):
+    r, g, b = px
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def compose(art_rgba, aw, ah, bg_color=BG):
+    """Cell pixels as (r, g, b) rows."""
+    bg, border = rgb(bg_color), rgb(BORDER)
+    cell = [[bg] * CELL_W for _ in range(CELL_H)]
+    for y in range(CELL_H):
+        for x in range(CELL_W):
+            if x == 0 or y == 0 or x == CELL_W - 1 or y == CELL_H - 1:
+                cell[y][x] = mix(bg, border, BORDER_OPA)
+    # LV_ALIGN_CENTER in the content area (inside the border); C division truncates
+    x0 = 1 + int((CELL_W - 2 - aw) / 2)
+    y0 = 1 + int((CELL_H - 2 - ah) / 2)
+    for y in range(ah):
+        for x in range(aw):
+            cx, cy = x0 + x, y0 + y
+            if 0 <= cx < CELL_W and 0 <= cy < CELL_H:
+                i = (y * aw + x) * 4
+                r, g, b, a = art_rgba[i:i + 4]
+                cell[cy][cx] = mix(cell[cy][cx], (r, g, b), a)
+    return cell
+
+
+def generate(src_text, k=FAST):
+    """Return {file name: C source} from the RGB565A8 button art source."""
+    raw = encode_button.read_rgb565a8(src_text, k)
+    art = k.rgb565a8_to_rgba(raw, encode_button.W * encode_button.H)
+    files = {}
+    for sym, bg in ((NAME, BG), (f'{NAME}_on', BG_ON)):
+        cell = compose(art, encode_button.W, encode_button.H, bg)
+        data = bytearray()
+        for row in cell:
+            for px in row:
+                c = to_rgb565(px)
+                data += bytes((c & 0xFF, c >> 8))
+        files[f'{sym}.c'] = image_c_source(sym, 'LV_IMG_CF_TRUE_COLOR', CELL_W, CELL_H, data, k)
+    files[f'{NAME}.h'] = image_h_source(NAME, [NAME, f'{NAME}_on'])
+    return files
@@ -0,0 +1,148 @@
+"""Re-encode the button bitmap into alternative LVGL v8 image formats.
+Reads src/button_4_106x40.c (LV_IMG_CF_RGB565A8) and writes, next to it:
+
+  button_4_106x40_i4.c   LV_IMG_CF_INDEXED_4BIT  (16 colour ARGB palette)
+  button_4_106x40_i8.c   LV_IMG_CF_INDEXED_8BIT  (256 colour ARGB palette)
+  button_4_106x40_ck.c   LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED (RGB565, alpha dropped)
+  button_4_106x40_rle.c  IMG_RLE_CF (RLE of RGB565+A8 pixels, see src/img_rle.c)
+  button_4_106x40_variants.h
+
+RGB565 byte order follows the source asset (little-endian, LV_COLOR_16_SWAP 0).
+The flash size of each variant is printed so it can be compared with the
+draw times reported by the on-device benchmark (build with -DIMG_BENCH).
+Also run as the `variants` step of tools/assets.py.
+"""
+import os
+
+from asset_kernels import FAST, image_c_source, image_h_source
+
+NAME = 'button_4_106x40'
+W = 106
+H = 40
+
+CHROMA_KEY = 0x07E0   # LV_COLOR_CHROMA_KEY default, lv_color_hex(0x00ff00)
+CHROMA_ALPHA_MIN = 128  # pixels below this alpha become the chroma key
+RLE_MAX_PACKET = 128
+
+
+def read_rgb565a8(text, k=FAST):
+    """Return the raw RGB565A8 bytes of a generated C image source."""
+    raw = k.parse_c_bytes(text)
+    if len(raw) != W * H * 3:
+        raise ValueError(f'{NAME}: expected {W * H * 3} bytes, got {len(raw)}')
+    return raw
+
+
+def pixel_pairs(raw):
+    """(rgb565, alpha) per pixel."""
+    n = W * H
+    return [(raw[i * 2] | (raw[i * 2 + 1] << 8), raw[n * 2 + i]) for i in range(n)]
+
+
+def quantize(raw, n, k):
+    flat = k.rgb565a8_to_rgba(raw, W * H)
+    rgba = [tuple(flat[i:i + 4]) for i in range(0, len(flat), 4)]
+    counts = {}
+    for p in rgba:
+        counts[p] = counts.get(p, 0) + 1
+    palette = k.median_cut(counts, n)
+    colors = list(counts)
+    nearest = dict(zip(colors, k.nearest(colors, palette)))
+    palette += [(0, 0, 0, 0)] * (n - len(palette))
+    return palette, [nearest[p] for p in rgba]
+
+
+def encode_indexed(raw, bpp, k):
+    palette, idx = quantize(raw, 1 << bpp, k)
+    data = bytearray()
+    for (r, g, b, a) in palette:
+        data += bytes((b, g, r, a))          # lv_color32_t in memory
+    per_byte = 8 // bpp
+    for y in range(H):
+        row = idx[y * W:(y + 1) * W]
+        for x in range(0, W, per_byte):
+            v = 0
+            for k in range(per_byte):
+                v <<= bpp
+                if x + k < W:
+                    v |= row[x + k]
+            data.append(v)
+    return data
+
+
+def encode_chroma_keyed(raw, k):
+    data = bytearray()
+    for c, a in pixel_pairs(raw):
+        if a < CHROMA_ALPHA_MIN:
+            c = CHROMA_KEY
+        elif c == CHROMA_KEY:
+            c ^= 0x0020                      # keep real pixels off the key colour
+        data += bytes((c & 0xFF, c >> 8))
+    return data
+
+
+def encode_rle(raw, k):
+    """Packets: header byte, bit 7 set = run of ((h & 0x7F) + 1) copies of one
+    3-byte pixel, bit 7 clear = ((h & 0x7F) + 1) literal 3-byte pixels."""
+    px = [bytes((c & 0xFF, c >> 8, a)) for c, a in pixel_pairs(raw)]
+    data = bytearray()
+    i = 0
+    n = len(px)
+    while i < n:
+        run = 1
+        while i + run < n and run < RLE_MAX_PACKET and px[i + run] == px[i]:
+            run += 1
+        if run >= 2:
+            data.append(0x80 | (run - 1))
+            data += px[i]
+            i += run
+            continue
+        start = i
+        while i < n and i - start < RLE_MAX_PACKET:
+            if i + 1 < n and px[i + 1] == px[i]:
+                break
+            i += 1
+        data.append(i - start - 1)
+        for p in px[start:i]:
+            data += p
+    return data
+
+
+VARIANTS = [
+    # suffix, LVGL colour format, encoder
+    ('i4',  'LV_IMG_CF_INDEXED_4BIT',             lambda raw, k: encode_indexed(raw, 4, k)),
+    ('i8',  'LV_IMG_CF_INDEXED_8BIT',             lambda raw, k: encode_indexed(raw, 8, k)),
+    ('ck',  'LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED',  encode_chroma_keyed),
+    ('rle', 'IMG_RLE_CF',                         encode_rle),
+]
+
+
+def generate(src_text, k=FAST):
+    """Return ({file name: C source}, [(symbol, format, flash bytes)])."""
+    raw = read_rgb565a8(src_text, k)
+    files = {}
+    sizes = []
+    for suffix, cf, encode in VARIANTS:
+        sym = f'{NAME}_{suffix}'
+        data = encode(raw, k)
+        includes = ['img_rle.h'] if cf == 'IMG_RLE_CF' else []
+        files[f'{sym}.c'] = image_c_source(sym, cf, W, H, data, k, includes)
+        sizes.append((sym, cf, len(data)))
+    files[f'{NAME}_variants.h'] = image_h_source(f'{NAME}_variants', [s for s, _, _ in sizes])
+    return files, sizes
+
+
+if __name__ == '__main__':
+    script_dir = os.path.dirname(os.path.abspath(__file__))
+    src_dir = os.path.join(script_dir, '..', 'src')
+    with open(os.path.join(src_dir, f'{NAME}.c'), 'r') as f:
+        files, sizes = generate(f.read())
+    for name, text in files.items():
+        with open(os.path.join(src_dir, name), 'w') as f:
+            f.write(text)
+
+    print(f'{"variant":<24} {"format":<36} {"flash":>6}')
+    print(f'{NAME:<24} {"LV_IMG_CF_RGB565A8":<36} {W * H * 3:>6}')
+    for sym, cf, size in sizes:
+        print(f'{sym:<24} {cf:<36} {size:>6}')
+    print(f'Generated {len(sizes)} variants and {NAME}_variants.h in {src_dir}')
@@ -0,0 +1,214 @@
+"""Host side of the front panel serial link (src/fp_link.h).
+
+Opens the panel's serial port (UART2 through a USB adapter, the panel's own
+USB port with UART_LINK_PORT 0, or the pty of test/host/link_standin.cpp),
+says FP_LINK_HELLO and prints what the panel pushes: button events and
+REG_INT_MASK / REG_ENCODER / REG_PAGE state. Every frame is acknowledged, a
+repeated sequence number (the panel did not get our ACK) is acknowledged
+again and dropped. After HELLO it writes REG_CONFIG to turn on repeat events
+and INT_PAGE, which the panel sends only to a master that asks (no clicks,
+one event per frame record, as a stock master).
+
+  --read REG        read a register (hex or decimal) and print the bytes
+  --write REG B..   write bytes to a register, as an I2C write would
+  --bench N         count N events, check they are the stand-in's pattern
+                    (event i: button i % 54, state (i / 54) & 1) and
+                    report events per second
+
+Linux only (termios).
+"""
+import argparse
+import os
+import select
+import sys
+import termios
+import time
+import tty
+
+SOF = 0xA5
+EVENTS, STATE, DATA, ACK = 0x01, 0x02, 0x03, 0x04
+WRITE, READ, HELLO = 0x10, 0x11, 0x12
+RETRY_S = 0.020
+# REG_CONFIG: config 0, features FP_FEATURE_REPEAT | FP_FEATURE_PAGES, no
+# click window, batch 1
+CONFIG = bytes([0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01])
+STATES = {0: 'released', 1: 'pressed', 2: 'repeat', 3: 'click'}
+BAUDS = {115200: termios.B115200, 230400: termios.B230400, 460800: termios.B460800,
+         921600: termios.B921600}
+
+
+def crc16(data):
+    """CRC-16/CCITT-FALSE, as fp_link_crc()"""
+    crc = 0xFFFF
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) & 0xFFFF if crc & 0x8000 else (crc << 1) & 0xFFFF
+    return crc
+
+
+def frame(ftype, seq, payload=b''):
+    body = bytes([ftype, seq, len(payload)]) + bytes(payload)
+    crc = crc16(body)
+    return bytes([SOF]) + body + bytes([crc & 0xFF, crc >> 8])
+
+
+class Link:
+    def __init__(self, path, baud):
+        self.fd = os.open(path, os.O_RDWR | os.O_NOCTTY)
+        if os.isatty(self.fd):
+            tty.setraw(self.fd)
+            attr = termios.tcgetattr(self.fd)
+            attr[4] = attr[5] = BAUDS.get(baud, termios.B921600)
+            termios.tcsetattr(self.fd, termios.TCSANOW, attr)
+        self.buf = bytearray()
+        self.seq = 0
+        self.last_rx = None
+        self.acked = None
+        self.bad = self.dups = 0
+        self.pending = []     # sequenced frames received while sending
+
+    def send(self, ftype, payload=b''):
+        """A sequenced frame, sent again every RETRY_S until acknowledged;
+        what the panel pushes meanwhile is handled as usual"""
+        self.seq = (self.seq + 1) & 0xFF
+        f = frame(ftype, self.seq, payload)
+        while self.acked != self.seq:
+            os.write(self.fd, f)
+            self.pending += self.receive(RETRY_S, until_ack=self.seq)
+
+    def receive(self, timeout, until_ack=None):
+        """Handles frames for `timeout` s (or until the ACK of `until_ack`),
+        returns the sequenced ones received"""
+        got, self.pending = self.pending, []
+        end = time.monotonic() + timeout
+        while True:
+            left = end - time.monotonic()
+            if left <= 0 or (until_ack is not None and self.acked == until_ack) or \
+                    (got and until_ack is None):
+                return got
+            if not select.select([self.fd], [], [], left)[0]:
+                continue
+            data = os.read(self.fd, 4096)
+            if not data:
+                raise EOFError('line closed')
+            self.buf += data
+            got += self.parse()
+
+    def parse(self):
+        got = []
+        buf = self.buf
+        while True:
+            i = buf.find(SOF)
+            if i < 0:
+                buf.clear()
+                return got
+            del buf[:i]
+            if len(buf) < 4 or len(buf) < 6 + buf[3]:
+                return got
+            n = 6 + buf[3]
+            body = bytes(buf[1:n - 2])
+            if crc16(body) != buf[n - 2] | buf[n - 1] << 8:
+                # Not a frame (console text, a damaged frame): hunt on
+                self.bad += 1
+                del buf[:1]
+                continue
+            del buf[:n]
+            ftype, seq, payload = body[0], body[1], body[3:]
+            if ftype == ACK:
+                self.acked = seq
+                continue
+            os.write(self.fd, frame(ACK, seq))
+            if seq == self.last_rx:
+                self.dups += 1
+                continue
+            self.last_rx = seq
+            got.append((ftype, payload))
+
+    def read_register(self, reg):
+        self.send(READ, bytes([reg]))
+        while True:
+            for ftype, payload in self.receive(1.0):
+                if ftype == DATA and payload[0] == reg:
+                    return payload[1:]
+
+
+def events(payload):
+    for i in range(0, len(payload) - 3, 4):
+        yield payload[i], payload[i + 1], payload[i + 2] | payload[i + 3] << 8
+
+
+def show(ftype, payload):
+    if ftype == EVENTS:
+        for b, st, count in events(payload):
+            extra = f' x{count}' if st == 2 else f' {count} ms' if st == 3 else ''
+            print(f'button {b} {STATES.get(st, st)}{extra}')
+    elif ftype == STATE:
+        mask = payload[0] | payload[1] << 8
+        enc = payload[3] - 256 if payload[3] > 127 else payload[3]
+        print(f'state: INT 0x{mask:04x}, encoder {enc:+d}, page {payload[4]} of {payload[5]}')
+
+
+def bench(link, count):
+    n = lost = out_of_order = 0
+    first = None
+    while n < count:
+        got = link.receive(2.0)
+        if not got:
+            print(f'stalled after {n} events')
+            break
+        for ftype, payload in got:
+            if ftype != EVENTS:
+                continue
+            if first is None:
+                first = time.monotonic()
+            for b, st, _ in events(payload):
+                if (b, st) != (n % 54, (n // 54) & 1):
+                    # Where the stream went on from: lost events or disorder
+                    k = n
+                    while k < count and (b, st) != (k % 54, (k // 54) & 1):
+                        k += 1
+                    if k < count:
+                        lost += k - n
+                        n = k
+                    else:
+                        out_of_order += 1
+                n += 1
+    secs = time.monotonic() - first if first else 0
+    print(f'{n} events in {secs:.3f} s: {n / secs if secs else 0:.0f} events/s; '
+          f'lost {lost}, out of order {out_of_order}, '
+          f'duplicate frames {link.dups}, bad frames {link.bad}')
+    return lost == 0 and out_of_order == 0 and n == count
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    ap.add_argument('port', help='serial device or pty link')
+    ap.add_argument('--baud', type=int, default=921600)
+    ap.add_argument('--read', metavar='REG', type=lambda s: int(s, 0))
+    ap.add_argument('--write', metavar='REG', type=lambda s: int(s, 0), nargs='+')
+    ap.add_argument('--bench', metavar='N', type=int)
+    args = ap.parse_args()
+
+    link = Link(args.port, args.baud)
+    link.send(HELLO)
+    link.send(WRITE, CONFIG)
+    if args.write:
+        link.send(WRITE, bytes(args.write))
+    if args.read is not None:
+        print(' '.join(f'{b:02x}' for b in link.read_register(args.read)))
+        return 0
+    if args.bench:
+        return 0 if bench(link, args.bench) else 1
+    if args.write:
+        return 0
+    while True:
+        for ftype, payload in link.receive(1.0):
+            show(ftype, payload)
+
+
+if __name__ == '__main__':
+    try:
+        sys.exit(main())
+    except KeyboardInterrupt:
+        pass
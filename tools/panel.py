@@ -0,0 +1,22 @@
+"""Panel facts the simulators share, read from the firmware sources so they
+cannot go stale: which buttons are toggles (is_toggle[] in src/main.cpp).
+"""
+import os
+import re
+
+TOOLS_DIR = os.path.dirname(os.path.abspath(__file__))
+REPO_DIR = os.path.dirname(TOOLS_DIR)
+MAIN_CPP = os.path.join(REPO_DIR, 'src', 'main.cpp')
+
+
+def read_toggles(path=MAIN_CPP):
+    """Indices of the toggle buttons, all pages: the true entries of
+    is_toggle[]"""
+    with open(path, 'r') as f:
+        text = f.read()
+    m = re.search(r'is_toggle\[\w*\]\s*=\s*\{(.*?)\};', text, re.S)
+    if not m:
+        raise SystemExit(f'{path}: no is_toggle[] table')
+    body = re.sub(r'//.*|/\*.*?\*/', '', m.group(1), flags=re.S)
+    flags = [v.strip() for v in body.split(',') if v.strip()]
+    return [i for i, v in enumerate(flags) if v == 'true']
@@ -0,0 +1,151 @@
+"""Flash writes per hour of the toggle persistence policy (src/persist.cpp).
+
+Replays a toggle trace through the same rules as the firmware, with the
+constants read from src/persist.h: the pending bitmap is written by a timer
+every PERSIST_POLL_MS once there were no changes for PERSIST_DELAY_MS, at
+most once per PERSIST_MIN_INTERVAL_MS, and not at all when it equals the
+stored bitmap. The trace is either a CSV of `t_ms,button` toggles or a
+seeded heavy-use session: bursts of taps every few seconds, double taps that
+undo themselves, and the odd pause.
+
+Reported per policy (one write per toggle, delay only, delay + rate cap):
+writes per hour, the longest time a change stayed unsaved (lost on a power
+cut), and the NVS wear that follows. Every write appends one 32-byte entry,
+a 4 KB page holds 126, and the "nvs" partition of partitions.csv rotates
+through all its pages, so each page is erased once per pages * 126 writes.
+"""
+import argparse
+import csv
+import os
+import random
+import re
+
+from panel import read_toggles
+
+TOOLS_DIR = os.path.dirname(os.path.abspath(__file__))
+REPO_DIR = os.path.dirname(TOOLS_DIR)
+
+NVS_PAGE = 4096
+NVS_ENTRIES_PER_PAGE = 126
+ERASE_CYCLES = 100_000
+
+
+def read_policy(path=os.path.join(REPO_DIR, 'src', 'persist.h')):
+    with open(path, 'r') as f:
+        text = f.read()
+    return {name: int(re.search(rf'#define {name} (\d+)', text).group(1))
+            for name in ('PERSIST_DELAY_MS', 'PERSIST_MIN_INTERVAL_MS', 'PERSIST_POLL_MS')}
+
+
+def nvs_pages(csv_path=os.path.join(REPO_DIR, 'partitions.csv')):
+    with open(csv_path, 'r') as f:
+        for line in f:
+            cols = [c.strip() for c in line.split('#')[0].split(',')]
+            if len(cols) >= 5 and cols[0] == 'nvs':
+                return int(cols[4], 0) // NVS_PAGE
+    return 3
+
+
+def heavy_trace(hours, seed, toggles):
+    """[(t_ms, button)]: a burst every 2-20 s, 1-5 taps 150-700 ms apart on
+    `toggles`, a quarter of the taps followed by an undo, a 1-5 min pause
+    every ~6 min."""
+    rng = random.Random(seed)
+    end = int(hours * 3600_000)
+    t = 0
+    trace = []
+    while True:
+        t += rng.randint(2_000, 20_000)
+        if rng.random() < 0.03:
+            t += rng.randint(60_000, 300_000)
+        if t >= end:
+            return trace
+        for _ in range(rng.randint(1, 5)):
+            b = rng.choice(toggles)
+            trace.append((t, b))
+            if rng.random() < 0.25:
+                t += rng.randint(300, 1500)
+                trace.append((t, b))
+            t += rng.randint(150, 700)
+
+
+def read_trace(path):
+    with open(path, newline='') as f:
+        rows = [r for r in csv.reader(f) if r and not r[0].startswith('#')]
+    if rows and not rows[0][0].strip().isdigit():
+        rows = rows[1:]
+    return sorted((int(r[0]), int(r[1])) for r in rows)
+
+
+def simulate(trace, delay, interval, poll):
+    """(writes, reverted, max unsaved ms) for one policy; delay None writes
+    on every toggle."""
+    if delay is None:
+        return len(trace), 0, 0
+    stored = pending = 0
+    dirty = written = False
+    last_change = last_write = 0
+    dirty_since = 0
+    writes = reverted = max_unsaved = 0
+
+    def tick(now):
+        nonlocal stored, dirty, written, last_write, writes, max_unsaved
+        if not dirty or now - last_change < delay:
+            return
+        if written and now - last_write < interval:
+            return
+        max_unsaved = max(max_unsaved, now - dirty_since)
+        stored, dirty, written, last_write = pending, False, True, now
+        writes += 1
+
+    end = trace[-1][0] + delay + interval + poll if trace else 0
+    i = 0
+    for now in range(0, end + poll, poll):
+        # Events before this timer tick, as LVGL runs them between ticks
+        while i < len(trace) and trace[i][0] < now:
+            t, b = trace[i]
+            i += 1
+            bits = pending ^ (1 << b)
+            if dirty and bits == stored:
+                reverted += 1
+            if not dirty and bits != stored:
+                dirty_since = t
+            pending, last_change = bits, t
+            dirty = pending != stored
+        tick(now)
+    return writes, reverted, max_unsaved
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--trace', help='CSV of t_ms,button toggles instead of the generated one')
+    parser.add_argument('--hours', type=float, default=8, help='length of the generated trace')
+    parser.add_argument('--seed', type=int, default=1)
+    args = parser.parse_args()
+
+    policy = read_policy()
+    delay, interval, poll = (policy['PERSIST_DELAY_MS'], policy['PERSIST_MIN_INTERVAL_MS'],
+                             policy['PERSIST_POLL_MS'])
+    trace = read_trace(args.trace) if args.trace else heavy_trace(args.hours, args.seed, read_toggles())
+    if not trace:
+        raise SystemExit('empty trace')
+    hours = max(trace[-1][0] / 3600_000, 1 / 60)
+    pages = nvs_pages()
+    print(f'trace: {len(trace)} toggles over {hours:.2f} h, {len(trace) / hours:.0f} toggles/h')
+    print(f'nvs: {pages} pages of {NVS_ENTRIES_PER_PAGE} entries, {ERASE_CYCLES} erase cycles each\n')
+
+    rows = [('every toggle', None, 0), (f'{delay} ms quiet', delay, 0),
+            (f'{delay} ms quiet, {interval} ms apart', delay, interval)]
+    print(f'{"policy":<30} {"writes/h":>9} {"reverted":>9} {"max unsaved s":>14} '
+          f'{"erases/page/h":>14} {"flash life y":>13}')
+    for name, d, iv in rows:
+        writes, reverted, max_unsaved = simulate(trace, d, iv, poll)
+        per_h = writes / hours
+        erases = per_h / (pages * NVS_ENTRIES_PER_PAGE)
+        life_y = ERASE_CYCLES / erases / 8766 if erases else float('inf')
+        print(f'{name:<30} {per_h:>9.0f} {reverted:>9} {max_unsaved / 1000:>14.1f} '
+              f'{erases:>14.3f} {life_y:>13.1f}')
+
+
+if __name__ == '__main__':
+    main()
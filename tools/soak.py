@@ -0,0 +1,203 @@
+"""Soak test: thousands of taps injected through the panel's console, none lost.
+
+Drives the console's scripted input (src/script.h) on the panel's serial
+port: taps the buttons of the page on screen in a seeded random order, with
+random press times and gaps, and checks that every tap reached the master:
+
+- always, from the panel's own counters (`state` before and after): each tap
+  pushed its events into the queue (two for a momentary button, one for a
+  toggle), the master took all of them, none was dropped;
+- with --master PORT, the serial log of the test master
+  (test/front_panel_i2c): the events it printed, in order, are exactly the
+  taps (PRESS then REL, or one CLICK, for a momentary tap; PRESS or REL for a
+  toggle checked or unchecked).
+
+Every --ping-every taps, `ping` times a tap from the command to the master's
+read. A master (or the serial link) must be polling the panel throughout.
+
+  python3 tools/soak.py /dev/ttyUSB0 --taps 5000 --master /dev/ttyUSB1
+
+Linux only (termios).
+"""
+import argparse
+import os
+import random
+import re
+import select
+import sys
+import termios
+import threading
+import time
+import tty
+
+BAUDS = {115200: termios.B115200, 230400: termios.B230400, 460800: termios.B460800,
+         921600: termios.B921600}
+STATE_LINE = re.compile(r'ok queue: pushed (\d+) taken (\d+) waiting (\d+)/\d+ events \d+ dropped (\d+)')
+PANEL_LINE = re.compile(r'panel: page (\d+)')
+BUTTON_LINE = re.compile(r'ok button (\d+) \((.*)\): (momentary|toggle checked|toggle unchecked)')
+PING_LINE = re.compile(r'ping \d+: .*taken (\d+) us')
+MASTER_LINE = re.compile(r'Button (\d+) \(.*?\): (PRESS|REL|CLICK|REPEAT)')
+
+
+class Port:
+    """Line-based serial port"""
+    def __init__(self, path, baud):
+        self.fd = os.open(path, os.O_RDWR | os.O_NOCTTY)
+        if os.isatty(self.fd):
+            tty.setraw(self.fd)
+            attr = termios.tcgetattr(self.fd)
+            attr[4] = attr[5] = BAUDS.get(baud, termios.B115200)
+            termios.tcsetattr(self.fd, termios.TCSANOW, attr)
+            termios.tcflush(self.fd, termios.TCIFLUSH)
+        self.buf = b''
+
+    def readline(self, timeout):
+        end = time.monotonic() + timeout
+        while b'\n' not in self.buf:
+            left = end - time.monotonic()
+            if left <= 0 or not select.select([self.fd], [], [], left)[0]:
+                return None
+            self.buf += os.read(self.fd, 4096)
+        line, self.buf = self.buf.split(b'\n', 1)
+        return line.decode(errors='replace').strip('\r')
+
+    def command(self, text, timeout=10.0):
+        """Lines up to the one starting with "ok" or "error" (the log of the
+        panel goes by on the same port)"""
+        os.write(self.fd, text.encode() + b'\n')
+        lines = []
+        while True:
+            line = self.readline(timeout)
+            if line is None:
+                raise TimeoutError(f'no answer to "{text}"')
+            lines.append(line)
+            if line.startswith('ok') or line.startswith('error'):
+                return lines
+
+
+def queue_state(panel):
+    lines = panel.command('state')
+    page = next(int(m.group(1)) for m in map(PANEL_LINE.search, lines) if m)
+    m = STATE_LINE.search(lines[-1])
+    if not m:
+        raise RuntimeError(f'state: {lines[-1]}')
+    pushed, taken, waiting, dropped = map(int, m.groups())
+    return page, pushed, taken, waiting, dropped
+
+
+class MasterLog(threading.Thread):
+    """Events printed by the test master, as (button, 1 press / 0 release)"""
+    def __init__(self, path, baud):
+        super().__init__(daemon=True)
+        self.port = Port(path, baud)
+        self.events = []
+        self.repeats = 0
+
+    def run(self):
+        while True:
+            line = self.port.readline(1.0)
+            m = line and MASTER_LINE.search(line)
+            if not m:
+                continue
+            b, what = int(m.group(1)), m.group(2)
+            if what == 'CLICK':
+                self.events += [(b, 1), (b, 0)]
+            elif what == 'REPEAT':
+                self.repeats += 1
+            else:
+                self.events.append((b, 1 if what == 'PRESS' else 0))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    ap.add_argument('port', help="the panel's console (USB serial)")
+    ap.add_argument('--baud', type=int, default=115200)
+    ap.add_argument('--taps', type=int, default=1000)
+    ap.add_argument('--seed', type=int, default=1)
+    ap.add_argument('--press', type=int, nargs=2, default=[40, 200], metavar=('MIN', 'MAX'),
+                    help='press time range, ms (under the repeat delay)')
+    ap.add_argument('--gap', type=int, nargs=2, default=[0, 100], metavar=('MIN', 'MAX'),
+                    help='pause between taps, ms')
+    ap.add_argument('--ping-every', type=int, default=100)
+    ap.add_argument('--master', help="the test master's serial port, to check its events")
+    args = ap.parse_args()
+
+    rng = random.Random(args.seed)
+    panel = Port(args.port, args.baud)
+    page, pushed0, taken0, _, dropped0 = queue_state(panel)
+    buttons = {}
+    for b in range(page * 18, page * 18 + 18):
+        m = BUTTON_LINE.search(panel.command(f'state {b}')[-1])
+        buttons[b] = m.group(3)
+    momentary = [b for b, kind in buttons.items() if kind == 'momentary']
+    checked = {b: kind == 'toggle checked' for b, kind in buttons.items()}
+    ping_button = momentary[0]
+
+    master = None
+    if args.master:
+        master = MasterLog(args.master, args.baud)
+        master.start()
+        time.sleep(0.5)
+        del master.events[:]
+
+    expected = []
+    pings = []
+    errors = 0
+    t0 = time.monotonic()
+    for i in range(args.taps):
+        b = rng.choice(list(buttons))
+        answer = panel.command(f'tap {b} {rng.randint(*args.press)}')[-1]
+        if not answer.startswith('ok'):
+            print(f'tap {i}: {answer}')
+            errors += 1
+            continue
+        if b in momentary:
+            expected += [(b, 1), (b, 0)]
+        else:
+            checked[b] = not checked[b]
+            expected.append((b, 1 if checked[b] else 0))
+        if args.ping_every and (i + 1) % args.ping_every == 0:
+            lines = panel.command(f'ping {ping_button}')
+            pings += [int(m.group(1)) for m in map(PING_LINE.search, lines) if m]
+            if lines[-1].startswith('ok'):
+                expected += [(ping_button, 1), (ping_button, 0)]
+            else:
+                print(f'ping after tap {i + 1}: {lines[-1]}')
+                errors += 1
+        if (i + 1) % 500 == 0:
+            print(f'{i + 1} taps, {time.monotonic() - t0:.0f} s')
+        time.sleep(rng.randint(*args.gap) / 1000)
+
+    # The master has read everything once nothing waits in the queue
+    for _ in range(50):
+        page, pushed, taken, waiting, dropped = queue_state(panel)
+        if waiting == 0:
+            break
+        time.sleep(0.1)
+    time.sleep(0.5)
+    secs = time.monotonic() - t0
+    ok = errors == 0
+    print(f'{args.taps} taps in {secs:.0f} s, {len(expected)} events expected')
+    print(f'panel queue: pushed {pushed - pushed0}, taken {taken - taken0}, waiting {waiting}, '
+          f'dropped {dropped - dropped0}')
+    ok &= pushed - pushed0 == len(expected) and taken - taken0 == len(expected)
+    ok &= dropped == dropped0 and waiting == 0
+    if master:
+        got = master.events
+        same = next((k for k, (e, g) in enumerate(zip(expected, got)) if e != g),
+                    min(len(expected), len(got)))
+        print(f'master: {len(got)} events, {same} in order' +
+              (f'; first difference at {same}: expected {expected[same:same + 2]}, '
+               f'got {got[same:same + 2]}' if same < max(len(expected), len(got)) else '') +
+              (f', {master.repeats} unexpected repeats' if master.repeats else ''))
+        ok &= got == expected and master.repeats == 0
+    if pings:
+        pings.sort()
+        print(f'ping, command -> master read: median {pings[len(pings) // 2] / 1000:.1f} ms, '
+              f'max {pings[-1] / 1000:.1f} ms ({len(pings)} pings)')
+    print('PASS' if ok else 'FAIL')
+    return 0 if ok else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())